@@ -0,0 +1,25 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+
+// Best of repeats runs of iterations calls, in milliseconds per call.
+inline double MeasureMs(const std::function<void()>& func, int iterations = 20, int repeats = 5)
+{
+	func();
+
+	double best_ms = 0.0;
+	for (int repeat = 0; repeat < repeats; repeat++) {
+		auto start_time = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; i++) {
+			func();
+		}
+		auto end_time = std::chrono::steady_clock::now();
+
+		double elapsed_ms = std::chrono::duration<double, std::milli>(end_time - start_time).count() / iterations;
+		if (repeat == 0 || elapsed_ms < best_ms) {
+			best_ms = elapsed_ms;
+		}
+	}
+	return best_ms;
+}
@@ -0,0 +1,52 @@
+#include "concurrent_encoder.h"
+#include "mock_video_encoder.h"
+#include "renderer.h"
+#include "bench.h"
+
+#include <cstdio>
+
+using namespace DX;
+
+// Encode time per frame of two mock streams, back to back and with ConcurrentEncoder.
+static void Run(int yuv420_latency_us, int chroma420_latency_us)
+{
+	MockVideoEncoder encoders[2] = { MockVideoEncoder(yuv420_latency_us), MockVideoEncoder(chroma420_latency_us) };
+	encoders[0].Init();
+	encoders[1].Init();
+
+	PixelFramePool pool;
+	PixelFrame frame;
+	pool.Alloc(1920, 1080, PIXEL_FORMAT_NV12, &frame);
+
+	std::vector<uint8_t> out_frames[2];
+	EncodeTask tasks[2];
+	for (int i = 0; i < 2; i++) {
+		tasks[i].encoder = &encoders[i];
+		tasks[i].input.frame = &frame;
+		tasks[i].out_frame = &out_frames[i];
+	}
+
+	double serial_ms = MeasureMs([&] {
+		for (int i = 0; i < 2; i++) {
+			tasks[i].encoder->Encode(tasks[i].input, *tasks[i].out_frame);
+		}
+	});
+
+	ConcurrentEncoder encoder;
+	double concurrent_ms = MeasureMs([&] {
+		encoder.Run(tasks, 2);
+	});
+
+	printf("YUV420 %5.1f ms  Chroma420 %5.1f ms  back to back %6.2f ms  concurrent %6.2f ms  %5.2fx\n",
+		yuv420_latency_us / 1000.0, chroma420_latency_us / 1000.0,
+		serial_ms, concurrent_ms, serial_ms / concurrent_ms);
+}
+
+int main()
+{
+	Run(2000, 2000);
+	Run(8000, 6000);
+	Run(16000, 4000);
+	Run(8000, 0);
+	return 0;
+}
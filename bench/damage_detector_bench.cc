@@ -0,0 +1,105 @@
+#include "damage_detector.h"
+#include "renderer.h"
+#include "bench.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+using namespace DX;
+
+// Smooth gradients with a few hard edges, roughly like desktop content.
+static void FillPattern(PixelFrame* frame)
+{
+	for (int y = 0; y < frame->height; y++) {
+		uint8_t* row = frame->plane[0] + y * frame->pitch[0];
+		for (int x = 0; x < frame->width; x++) {
+			bool edge = ((x / 97) + (y / 61)) % 5 == 0;
+			row[x * 4 + 0] = static_cast<uint8_t>(edge ? 255 : x * 255 / frame->width);
+			row[x * 4 + 1] = static_cast<uint8_t>(edge ? 0 : y * 255 / frame->height);
+			row[x * 4 + 2] = static_cast<uint8_t>(128 + 100 * std::sin(x * 0.01) * std::cos(y * 0.013));
+			row[x * 4 + 3] = 255;
+		}
+	}
+}
+
+static void CopyFrame(const PixelFrame& src, PixelFrame* dst)
+{
+	for (int y = 0; y < src.height; y++) {
+		memcpy(dst->plane[0] + y * dst->pitch[0], src.plane[0] + y * src.pitch[0], src.width * 4);
+	}
+}
+
+// Inverts the blue channel of a rect, so every pixel in it differs.
+static void Damage(PixelFrame* frame, int left, int top, int right, int bottom)
+{
+	for (int y = top; y < bottom; y++) {
+		uint8_t* row = frame->plane[0] + y * frame->pitch[0];
+		for (int x = left; x < right; x++) {
+			row[x * 4] ^= 0xff;
+		}
+	}
+}
+
+static void Run(const char* name, const PixelFrame& last_frame, const PixelFrame& frame)
+{
+	DamageDetector detector;
+	int changed = detector.Detect(&last_frame, &frame);
+	size_t rects = detector.GetDamageRects().size();
+
+	double elapsed_ms = MeasureMs([&] { detector.Detect(&last_frame, &frame); }, 20, 5);
+	printf("%-28s %6.2f %% tiles %5d rects %4zu %8.3f ms/frame\n", name,
+		100.0 * changed / detector.GetTileCount(), changed, rects, elapsed_ms);
+}
+
+int main()
+{
+	const int width = 3840;
+	const int height = 2160;
+
+	PixelFramePool pool;
+	PixelFrame last_frame, frame;
+	pool.Alloc(width, height, PIXEL_FORMAT_ARGB, &last_frame);
+	pool.Alloc(width, height, PIXEL_FORMAT_ARGB, &frame);
+	FillPattern(&last_frame);
+
+	// Every byte of both frames is read.
+	CopyFrame(last_frame, &frame);
+	Run("4K static", last_frame, frame);
+
+	// A blinking caret.
+	Damage(&frame, 1201, 640, 1203, 664);
+	Run("4K caret", last_frame, frame);
+
+	// A line of typed text.
+	CopyFrame(last_frame, &frame);
+	Damage(&frame, 200, 900, 1400, 924);
+	Run("4K typing", last_frame, frame);
+
+	// A 720p video playing in a window.
+	CopyFrame(last_frame, &frame);
+	Damage(&frame, 500, 300, 1780, 1020);
+	Run("4K 720p video window", last_frame, frame);
+
+	// A scrolling 1080p browser window.
+	CopyFrame(last_frame, &frame);
+	Damage(&frame, 960, 540, 2880, 1620);
+	Run("4K scrolling window", last_frame, frame);
+
+	// Fullscreen video, each tile differs in its first block.
+	CopyFrame(last_frame, &frame);
+	Damage(&frame, 0, 0, width, height);
+	Run("4K full change", last_frame, frame);
+
+	// Worst case, only the last pixel of each tile differs so every byte is read
+	// and every whole tile is reported.
+	CopyFrame(last_frame, &frame);
+	for (int y = 63; y < height; y += 64) {
+		for (int x = 63; x < width; x += 64) {
+			Damage(&frame, x, y, x + 1, y + 1);
+		}
+	}
+	Run("4K last pixel of each tile", last_frame, frame);
+
+	return 0;
+}
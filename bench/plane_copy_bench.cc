@@ -0,0 +1,51 @@
+#include "plane_copy.h"
+#include "renderer.h"
+#include "bench.h"
+
+#include <cstdio>
+#include <cstring>
+
+using namespace DX;
+
+// The per-row loop the upload paths used before CopyPlane.
+static void CopyRowsMemcpy(uint8_t* dst, int dst_pitch, const uint8_t* src, int src_pitch, int row_bytes, int height)
+{
+	for (int i = 0; i < height; i++) {
+		memcpy(dst + i * dst_pitch, src + i * src_pitch, row_bytes);
+	}
+}
+
+static void Run(const char* name, int row_bytes, int height, int pitch_padding)
+{
+	PixelFramePool pool;
+	PixelFrame src, dst;
+	pool.Alloc(row_bytes / 4, height, PIXEL_FORMAT_ARGB, &src);
+	pool.Alloc(row_bytes / 4 + pitch_padding / 4, height, PIXEL_FORMAT_ARGB, &dst);
+	memset(src.plane[0], 1, static_cast<size_t>(src.pitch[0]) * height);
+	memset(dst.plane[0], 0, static_cast<size_t>(dst.pitch[0]) * height);
+
+	double memcpy_ms = MeasureMs([&] {
+		CopyRowsMemcpy(dst.plane[0], dst.pitch[0], src.plane[0], src.pitch[0], row_bytes, height);
+	});
+	double copy_plane_ms = MeasureMs([&] {
+		CopyPlane(dst.plane[0], dst.pitch[0], src.plane[0], src.pitch[0], row_bytes, height);
+	});
+
+	double megabytes = static_cast<double>(row_bytes) * height / (1024.0 * 1024.0);
+	printf("%-22s %8.1f MB  memcpy rows %7.3f ms %7.1f GB/s  CopyPlane %7.3f ms %7.1f GB/s  %5.2fx\n",
+		name, megabytes,
+		memcpy_ms, megabytes / 1024.0 / (memcpy_ms / 1000.0),
+		copy_plane_ms, megabytes / 1024.0 / (copy_plane_ms / 1000.0),
+		memcpy_ms / copy_plane_ms);
+}
+
+int main()
+{
+	Run("1080p Y, same pitch", 1920, 1080, 0);
+	Run("1080p ARGB", 1920 * 4, 1080, 64);
+	Run("4K Y, same pitch", 3840, 2160, 0);
+	Run("4K ARGB", 3840 * 4, 2160, 64);
+	Run("8K Y", 7680, 4320, 64);
+	Run("8K ARGB", 7680 * 4, 4320, 64);
+	return 0;
+}
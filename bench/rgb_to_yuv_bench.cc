@@ -0,0 +1,59 @@
+#include "cpu_rgb_to_yuv_converter.h"
+#include "renderer.h"
+#include "bench.h"
+
+#include <cmath>
+#include <cstdio>
+
+using namespace DX;
+
+// Smooth gradients with a few hard edges, roughly like desktop content.
+static void FillPattern(PixelFrame* frame)
+{
+	for (int y = 0; y < frame->height; y++) {
+		uint8_t* row = frame->plane[0] + y * frame->pitch[0];
+		for (int x = 0; x < frame->width; x++) {
+			bool edge = ((x / 97) + (y / 61)) % 5 == 0;
+			row[x * 4 + 0] = static_cast<uint8_t>(edge ? 255 : x * 255 / frame->width);
+			row[x * 4 + 1] = static_cast<uint8_t>(edge ? 0 : y * 255 / frame->height);
+			row[x * 4 + 2] = static_cast<uint8_t>(128 + 100 * std::sin(x * 0.01) * std::cos(y * 0.013));
+			row[x * 4 + 3] = 255;
+		}
+	}
+}
+
+static void Run(const char* name, int width, int height)
+{
+	PixelFramePool pool;
+	PixelFrame src;
+	pool.Alloc(width, height, PIXEL_FORMAT_ARGB, &src);
+	FillPattern(&src);
+
+	CPURGBToYUVConverter converter;
+	if (!converter.Init(width, height)) {
+		printf("%-18s init failed\n", name);
+		return;
+	}
+
+	// Half of the tiles need 4:4:4, the rest are cleared to neutral.
+	ChromaTileMask mask;
+	mask.tiles_x = (width + mask.tile_size - 1) / mask.tile_size;
+	mask.tiles_y = (height + mask.tile_size - 1) / mask.tile_size;
+	mask.tiles.resize(mask.tiles_x * mask.tiles_y);
+	for (size_t i = 0; i < mask.tiles.size(); i++) {
+		mask.tiles[i] = static_cast<uint8_t>(i % 2);
+	}
+
+	double megapixels = static_cast<double>(width) * height / 1e6;
+	double full_ms = MeasureMs([&] { converter.Convert(&src); }, 10, 3);
+	double masked_ms = MeasureMs([&] { converter.Convert(&src, &mask); }, 10, 3);
+	printf("%-18s full %8.3f ms %8.1f Mpx/s   masked %8.3f ms\n", name, full_ms, megapixels / (full_ms / 1000.0), masked_ms);
+}
+
+int main()
+{
+	Run("1080p", 1920, 1080);
+	Run("1440p ultrawide", 3440, 1440);
+	Run("4K", 3840, 2160);
+	return 0;
+}
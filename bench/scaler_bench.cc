@@ -0,0 +1,90 @@
+#include "cpu_scaler.h"
+#include "renderer.h"
+#include "bench.h"
+
+#include <cmath>
+#include <cstdio>
+
+using namespace DX;
+
+static const char* kFilterNames[] = { "nearest", "bilinear", "bicubic", "lanczos3" };
+
+// Smooth gradients with a few hard edges, roughly like desktop content.
+static void FillPattern(PixelFrame* frame)
+{
+	for (int y = 0; y < frame->height; y++) {
+		uint8_t* row = frame->plane[0] + y * frame->pitch[0];
+		for (int x = 0; x < frame->width; x++) {
+			bool edge = ((x / 97) + (y / 61)) % 5 == 0;
+			row[x * 4 + 0] = static_cast<uint8_t>(edge ? 255 : x * 255 / frame->width);
+			row[x * 4 + 1] = static_cast<uint8_t>(edge ? 0 : y * 255 / frame->height);
+			row[x * 4 + 2] = static_cast<uint8_t>(128 + 100 * std::sin(x * 0.01) * std::cos(y * 0.013));
+			row[x * 4 + 3] = 255;
+		}
+	}
+}
+
+// PSNR of a down-scale followed by a bicubic up-scale back to the source size.
+static double GetRoundTripPsnr(const PixelFrame& src, const PixelFrame& scaled)
+{
+	PixelFramePool pool;
+	PixelFrame restored;
+	pool.Alloc(src.width, src.height, PIXEL_FORMAT_ARGB, &restored);
+
+	ARGBScaler scaler;
+	scaler.Init(scaled.width, scaled.height, src.width, src.height, SCALE_FILTER_BICUBIC);
+	scaler.Scale(scaled.plane[0], scaled.pitch[0], restored.plane[0], restored.pitch[0]);
+
+	double error = 0.0;
+	for (int y = 0; y < src.height; y++) {
+		const uint8_t* a = src.plane[0] + y * src.pitch[0];
+		const uint8_t* b = restored.plane[0] + y * restored.pitch[0];
+		for (int x = 0; x < src.width * 4; x++) {
+			if ((x & 3) != 3) {
+				double diff = static_cast<double>(a[x]) - b[x];
+				error += diff * diff;
+			}
+		}
+	}
+
+	double mse = error / (static_cast<double>(src.width) * src.height * 3);
+	return mse > 0.0 ? 10.0 * std::log10(255.0 * 255.0 / mse) : 99.0;
+}
+
+static void Run(const char* name, int src_width, int src_height, int dst_width, int dst_height)
+{
+	PixelFramePool pool;
+	PixelFrame src, dst;
+	pool.Alloc(src_width, src_height, PIXEL_FORMAT_ARGB, &src);
+	pool.Alloc(dst_width, dst_height, PIXEL_FORMAT_ARGB, &dst);
+	FillPattern(&src);
+
+	for (int filter = SCALE_FILTER_NEAREST; filter <= SCALE_FILTER_LANCZOS3; filter++) {
+		ARGBScaler scaler;
+		if (!scaler.Init(src_width, src_height, dst_width, dst_height, static_cast<ScaleFilter>(filter))) {
+			printf("%-18s %-9s init failed\n", name, kFilterNames[filter]);
+			continue;
+		}
+
+		double elapsed_ms = MeasureMs([&] {
+			scaler.Scale(src.plane[0], src.pitch[0], dst.plane[0], dst.pitch[0]);
+		}, 10, 3);
+
+		double megapixels = static_cast<double>(dst_width) * dst_height / 1e6;
+		printf("%-18s %-9s %8.3f ms %8.1f Mpx/s", name, kFilterNames[filter], elapsed_ms, megapixels / (elapsed_ms / 1000.0));
+		if (dst_width < src_width) {
+			printf("  round trip %5.1f dB", GetRoundTripPsnr(src, dst));
+		}
+		printf("\n");
+	}
+}
+
+int main()
+{
+	Run("8K -> 1080p", 7680, 4320, 1920, 1080);
+	Run("4K -> 1080p", 3840, 2160, 1920, 1080);
+	Run("1440p -> 1080p", 2560, 1440, 1920, 1080);
+	Run("720p -> 1080p", 1280, 720, 1920, 1080);
+	Run("1080p -> 4K", 1920, 1080, 3840, 2160);
+	return 0;
+}
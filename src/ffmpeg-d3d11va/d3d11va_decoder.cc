@@ -28,7 +28,7 @@ static enum AVPixelFormat get_d3d11va_hw_format(AVCodecContext* avctx, const enu
 			frames_ctx->sw_format = AV_PIX_FMT_NV12;
 			frames_ctx->width = FFALIGN(avctx->coded_width, 32);
 			frames_ctx->height = FFALIGN(avctx->coded_height, 32);
-			frames_ctx->initial_pool_size = 10;
+			frames_ctx->initial_pool_size = 14; // + frames queued by the presentation scheduler
 
 			frames_hwctx->BindFlags |= D3D11_BIND_DECODER;
 			frames_hwctx->MiscFlags |= D3D11_RESOURCE_MISC_SHARED;
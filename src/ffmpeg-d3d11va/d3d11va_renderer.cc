@@ -47,7 +47,8 @@ void D3D11VARenderer::RenderFrame(AVFrame* frame)
 		index,
 		NULL);
 
-	DX::D3D11RenderTexture* render_target = render_targets_[DX::PIXEL_SHADER_NV12_BT601].get();
+	DX::D3D11RenderTexture* render_target = GetYUVRenderTarget(true,
+		DX::GetColorMatrix(frame->colorspace), DX::GetColorRange(frame->color_range));
 	if (render_target) {
 		render_target->Begin();
 		render_target->PSSetTexture(0, nv12_texture_y_srv);
@@ -2,6 +2,8 @@
 #include "av_demuxer.h"
 #include "d3d11va_decoder.h"
 #include "d3d11va_renderer.h"
+#include "presentation_scheduler.h"
+#include <memory>
 #include <thread>
 
 #pragma comment(lib, "avformat.lib")
@@ -39,7 +41,12 @@ int main(int argc, char** argv)
 	bool abort_request = false;
 	std::string pathname = "piper.h264";
 
-	std::thread decode_thread([&abort_request, &renderer, pathname] {
+	// Decoded frames are presented by pts on the window thread, the decoder
+	// waits while the scheduler queue is full.
+	DX::SteadyClock clock;
+	DX::PresentationScheduler<std::shared_ptr<AVFrame>> scheduler(&clock);
+
+	std::thread decode_thread([&abort_request, &renderer, &scheduler, pathname] {
 		AVDemuxer demuxer;
 		AVDecoder decoder;
 		AVStream* video_stream = nullptr;
@@ -49,6 +56,10 @@ int main(int argc, char** argv)
 		}
 
 		video_stream = demuxer.GetVideoStream();
+		AVRational time_base = video_stream->time_base;
+		if (video_stream->avg_frame_rate.num > 0 && video_stream->avg_frame_rate.den > 0) {
+			scheduler.SetFrameDuration(av_rescale_q(1, av_inv_q(video_stream->avg_frame_rate), AVRational{ 1, 1000000 }));
+		}
 
 		if (!decoder.Init(video_stream, renderer.GetD3D11Device())) {
 			abort_request = true;
@@ -66,10 +77,22 @@ int main(int argc, char** argv)
 					while (ret >= 0) {
 						ret = decoder.Recv(av_frame);
 						if (ret >= 0) {
-							renderer.RenderFrame(av_frame);
-						}					
+							int64_t pts = DX::kNoPts;
+							if (av_frame->pts != AV_NOPTS_VALUE) {
+								pts = av_rescale_q(av_frame->pts, time_base, AVRational{ 1, 1000000 });
+							}
+
+							std::shared_ptr<AVFrame> frame(av_frame_clone(av_frame), [](AVFrame* frame) {
+								av_frame_free(&frame);
+							});
+							av_frame_unref(av_frame);
+
+							while (!abort_request && !scheduler.WaitForSpace(10)) {}
+							if (frame) {
+								scheduler.Push(frame, pts);
+							}
+						}
 					}
-					Sleep(33);
 				}
 				av_packet_unref(av_packet);		
 
@@ -93,6 +116,12 @@ int main(int argc, char** argv)
 			continue;
 		}
 		else {
+			std::shared_ptr<AVFrame> frame;
+			if (scheduler.Poll(frame)) {
+				renderer.RenderFrame(frame.get());
+				scheduler.Presented();
+			}
+
 			int current_width = 0, current_height = 0;
 			GetWindowSize(window.GetHandle(), current_width, current_height);
 			if (current_width != original_width || current_height != original_height) {
@@ -100,12 +129,21 @@ int main(int argc, char** argv)
 				original_height = current_height;
 				renderer.Resize();
 			}
-			Sleep(1);
+
+			// Wake up for the next frame or a window message, whichever comes first.
+			int64_t wait_time = scheduler.GetWaitTime();
+			DWORD timeout = wait_time < 0 ? 1 : static_cast<DWORD>(wait_time / 1000);
+			::MsgWaitForMultipleObjects(0, NULL, FALSE, timeout, QS_ALLINPUT);
 		}		
 	}
 
 	abort_request = true;
 	decode_thread.join();
 
+	DX::PresentationStats stats = scheduler.GetStats();
+	printf("presented: %llu, dropped: %llu, repeated: %llu, jitter p50/p95/p99: %.3f/%.3f/%.3f ms \n",
+		stats.presented_frames, stats.dropped_frames, stats.repeated_frames,
+		stats.jitter.GetPercentile(50), stats.jitter.GetPercentile(95), stats.jitter.GetPercentile(99));
+
 	return 0;
 }
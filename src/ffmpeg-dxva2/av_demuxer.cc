@@ -168,15 +168,7 @@ int AVDemuxer::Read(AVPacket* pkt)
 		eof_ = 0;
 	}
 
-	if (pkt->pts != AV_NOPTS_VALUE) {
-		pkt->pts = (int64_t)(pkt->pts * (1000 * (av_q2d(format_context_->streams[pkt->stream_index]->time_base))));
-		pkt->dts = (int64_t)(pkt->dts * (1000 * (av_q2d(format_context_->streams[pkt->stream_index]->time_base))));
-	}
-	else {
-		pkt->pts = (int64_t)NAN;
-		pkt->dts = (int64_t)NAN;
-	}
-
+	// pts and dts stay in the stream time base, the decoder's pkt_timebase.
 	return 0;
 }
 
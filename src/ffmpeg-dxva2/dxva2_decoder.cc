@@ -25,7 +25,7 @@ static AVPixelFormat get_dxva2_hw_format(AVCodecContext* avctx, const enum AVPix
 			frames_ctx->sw_format = AV_PIX_FMT_NV12;
 			frames_ctx->width = FFALIGN(avctx->coded_width, 32);
 			frames_ctx->height = FFALIGN(avctx->coded_height, 32);
-			frames_ctx->initial_pool_size = 10;
+			frames_ctx->initial_pool_size = 14; // + frames queued by the presentation scheduler
 
 			int ret = av_hwframe_ctx_init(avctx->hw_frames_ctx);
 			if (ret < 0) {
@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 extern "C" {
 #include "libavformat/avformat.h"
@@ -30,6 +31,13 @@ public:
 	AVDecoder& operator=(const AVDecoder&) = delete;
 	AVDecoder(const AVDecoder&) = delete;
 
+	virtual bool Init() = 0;
+	virtual void Destroy() = 0;
+
+	// avcodec_send_packet() and avcodec_receive_frame() results.
+	virtual int  Send(std::vector<uint8_t>& frame) = 0;
+	virtual int  Recv(std::shared_ptr<AVFrame>& frame) = 0;
+
 	void SetOption(AVDecoderOption optopn, int value)
 	{
 		switch (optopn)
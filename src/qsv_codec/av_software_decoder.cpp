@@ -0,0 +1,88 @@
+#include "av_software_decoder.h"
+
+AVSoftwareDecoder::AVSoftwareDecoder()
+{
+	av_packet_ = av_packet_alloc();
+}
+
+AVSoftwareDecoder::~AVSoftwareDecoder()
+{
+	Destroy();
+	av_packet_free(&av_packet_);
+}
+
+bool AVSoftwareDecoder::Init()
+{
+	if (codec_context_ != nullptr) {
+		printf("[AVSoftwareDecoder] codec was opened. \n");
+		return false;
+	}
+
+	const AVCodec* codec = avcodec_find_decoder((AVCodecID)dec_type_);
+	if (!codec) {
+		printf("[AVSoftwareDecoder] Decoder(%s) not found. \n", avcodec_get_name((AVCodecID)dec_type_));
+		return false;
+	}
+
+	codec_context_ = avcodec_alloc_context3(codec);
+	codec_context_->flags |= AV_CODEC_FLAG_LOW_DELAY;
+	codec_context_->flags |= AV_CODEC_FLAG_OUTPUT_CORRUPT;
+	codec_context_->flags2 |= AV_CODEC_FLAG2_SHOW_ALL;
+	codec_context_->width = dec_width_;
+	codec_context_->height = dec_height_;
+
+	// Frame threads would add a frame of delay, slices do not.
+	codec_context_->thread_count = 0;
+	codec_context_->thread_type = FF_THREAD_SLICE;
+
+	if (avcodec_open2(codec_context_, codec, NULL) != 0) {
+		printf("[AVSoftwareDecoder] Open decoder failed. \n");
+		avcodec_free_context(&codec_context_);
+		codec_context_ = nullptr;
+		return false;
+	}
+
+	return true;
+}
+
+void AVSoftwareDecoder::Destroy()
+{
+	if (codec_context_ != nullptr) {
+		avcodec_free_context(&codec_context_);
+		codec_context_ = nullptr;
+	}
+}
+
+int AVSoftwareDecoder::Send(std::vector<uint8_t>& frame)
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+
+	if (codec_context_ == nullptr) {
+		return -1;
+	}
+
+	av_packet_->data = frame.data();
+	av_packet_->size = static_cast<int>(frame.size());
+	return avcodec_send_packet(codec_context_, av_packet_);
+}
+
+int AVSoftwareDecoder::Recv(std::shared_ptr<AVFrame>& frame)
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+
+	if (codec_context_ == nullptr) {
+		return -1;
+	}
+
+	frame.reset(av_frame_alloc(), [](AVFrame* frame) { av_frame_free(&frame); });
+
+	int ret = avcodec_receive_frame(codec_context_, frame.get());
+	if (ret >= 0) {
+		frame->pts = frame->best_effort_timestamp;
+	}
+	else if (ret == AVERROR_EOF) {
+		avcodec_flush_buffers(codec_context_);
+	}
+
+	return ret;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <vector>
+#include <mutex>
+#include <memory>
+#include "av_decoder.h"
+
+// libavcodec decoder without hardware acceleration, frames are in system
+// memory (usually AV_PIX_FMT_YUV420P). Runs headless, e.g. to measure
+// ConcurrentDecoder without a GPU.
+class AVSoftwareDecoder : public AVDecoder
+{
+public:
+	AVSoftwareDecoder();
+	virtual ~AVSoftwareDecoder();
+
+	virtual bool Init();
+	virtual void Destroy();
+
+	virtual int  Send(std::vector<uint8_t>& frame);
+	virtual int  Recv(std::shared_ptr<AVFrame>& frame);
+
+private:
+	std::mutex mutex_;
+
+	AVPacket* av_packet_ = nullptr;
+	AVCodecContext* codec_context_ = nullptr;
+};
@@ -0,0 +1,43 @@
+#include "concurrent_decoder.h"
+
+#include <chrono>
+
+ConcurrentDecoder::ConcurrentDecoder()
+{
+
+}
+
+ConcurrentDecoder::~ConcurrentDecoder()
+{
+	Destroy();
+}
+
+void ConcurrentDecoder::Destroy()
+{
+	workers_.Destroy();
+}
+
+void ConcurrentDecoder::Run(DecodeTask* tasks, int count)
+{
+	workers_.Run(count, [tasks](int index) {
+		RunTask(tasks[index]);
+	});
+}
+
+void ConcurrentDecoder::RunTask(DecodeTask& task)
+{
+	auto start_time = std::chrono::steady_clock::now();
+
+	task.frame.reset();
+	task.result = task.decoder->Send(*task.packet);
+	if (task.result >= 0) {
+		task.result = task.decoder->Recv(task.frame);
+	}
+
+	if (task.result < 0) {
+		task.frame.reset();
+	}
+
+	auto end_time = std::chrono::steady_clock::now();
+	task.decode_ms = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+}
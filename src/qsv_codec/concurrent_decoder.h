@@ -0,0 +1,35 @@
+#pragma once
+
+#include "av_decoder.h"
+#include "stream_workers.h"
+
+struct DecodeTask
+{
+	AVDecoder*            decoder = NULL;
+	std::vector<uint8_t>* packet  = NULL;
+
+	// Send() or Recv() result, frame is set when it is >= 0.
+	int    result    = 0;
+	double decode_ms = 0.0;
+	std::shared_ptr<AVFrame> frame;
+};
+
+// Decodes several streams at the same time, e.g. YUV420 and Chroma420, so the
+// combine can start once the slowest decode is done instead of after both.
+// Decoders sharing a D3D11 device need it multithread protected.
+class ConcurrentDecoder
+{
+public:
+	ConcurrentDecoder();
+	virtual ~ConcurrentDecoder();
+
+	void Destroy();
+
+	// Returns when all count tasks are done.
+	void Run(DecodeTask* tasks, int count);
+
+private:
+	static void RunTask(DecodeTask& task);
+
+	StreamWorkers workers_;
+};
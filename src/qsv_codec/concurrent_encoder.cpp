@@ -0,0 +1,33 @@
+#include "concurrent_encoder.h"
+
+#include <chrono>
+
+ConcurrentEncoder::ConcurrentEncoder()
+{
+
+}
+
+ConcurrentEncoder::~ConcurrentEncoder()
+{
+	Destroy();
+}
+
+void ConcurrentEncoder::Destroy()
+{
+	workers_.Destroy();
+}
+
+void ConcurrentEncoder::Run(EncodeTask* tasks, int count)
+{
+	workers_.Run(count, [tasks](int index) {
+		RunTask(tasks[index]);
+	});
+}
+
+void ConcurrentEncoder::RunTask(EncodeTask& task)
+{
+	auto start_time = std::chrono::steady_clock::now();
+	task.frame_size = task.encoder->Encode(task.input, *task.out_frame);
+	auto end_time = std::chrono::steady_clock::now();
+	task.encode_ms = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "video_encoder.h"
+#include "stream_workers.h"
+
+struct EncodeTask
+{
+	VideoEncoder*         encoder   = NULL;
+	VideoEncoderInput     input;
+	std::vector<uint8_t>* out_frame = NULL;
+
+	// Encode() result and time spent in it.
+	int    frame_size = 0;
+	double encode_ms  = 0.0;
+};
+
+// Encodes several streams at the same time, e.g. YUV420 and Chroma420, so a
+// frame costs the slowest encode instead of the sum. Each encoder must have
+// its own session; a shared D3D11 device must be multithread protected.
+class ConcurrentEncoder
+{
+public:
+	ConcurrentEncoder();
+	virtual ~ConcurrentEncoder();
+
+	void Destroy();
+
+	// Returns when all count tasks are done.
+	void Run(EncodeTask* tasks, int count);
+
+private:
+	static void RunTask(EncodeTask& task);
+
+	StreamWorkers workers_;
+};
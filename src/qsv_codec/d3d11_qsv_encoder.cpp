@@ -294,6 +294,15 @@ int D3D11QSVEncoder::Encode(ID3D11Texture2D* input_texture, std::vector<uint8_t>
 	return ret;
 }
 
+int D3D11QSVEncoder::Encode(const VideoEncoderInput& input, std::vector<uint8_t>& out_frame)
+{
+	if (!input.texture) {
+		return MFX_ERR_NULL_PTR;
+	}
+
+	return Encode(input.texture, out_frame);
+}
+
 int D3D11QSVEncoder::EncodeFrame(int index, std::vector<uint8_t>& out_frame)
 {
 	mfxSyncPoint syncp;
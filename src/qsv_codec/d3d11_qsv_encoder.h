@@ -1,13 +1,14 @@
 #pragma once
 
 #include "qsv_encoder.h"
+#include "video_encoder.h"
 #include "common_directx11.h"
 #include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
 
-class D3D11QSVEncoder : public QSVEncoder
+class D3D11QSVEncoder : public QSVEncoder, public VideoEncoder
 {
 public:
 	D3D11QSVEncoder(ID3D11Device* d3d11_device);
@@ -18,6 +19,8 @@ public:
 	
 	virtual int  Encode(HANDLE handle, std::vector<uint8_t>& out_frame);
 	virtual int  Encode(ID3D11Texture2D* input_texture, std::vector<uint8_t>& out_frame);
+	// Texture input only.
+	virtual int  Encode(const VideoEncoderInput& input, std::vector<uint8_t>& out_frame);
 
 private:
 	bool InitEncoder();
@@ -3,12 +3,35 @@
 #endif
 
 #include "d3d11_screen_capture.h"
+#include "tile_hasher.h"
 #include <fstream> 
+#include <chrono>
 
 #define MSDK_ALIGN16(value) (((value + 15) >> 4) << 4)
 
 using namespace DX;
 
+// Bounds how long Destroy() waits for the capture thread.
+static const int kAcquireTimeoutMs = 100;
+
+// A pending fingerprint is read back this soon when no new frame comes first.
+static const int kFingerprintDelayMs = 2;
+
+// LastPresentTime is a QueryPerformanceCounter value, the clock behind
+// std::chrono::steady_clock, 0 when only the cursor changed.
+static int64_t GetPresentTimeUs(const LARGE_INTEGER& present_time)
+{
+	if (present_time.QuadPart == 0) {
+		return std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	return present_time.QuadPart / frequency.QuadPart * 1000000
+		+ present_time.QuadPart % frequency.QuadPart * 1000000 / frequency.QuadPart;
+}
+
 D3D11ScreenCapture::D3D11ScreenCapture()
 {
 	memset(&monitor_, 0, sizeof(DX::Monitor));
@@ -27,17 +50,20 @@ bool D3D11ScreenCapture::Init(int display_index)
 	}
 
 	display_index_ = display_index;
+	frame_signal_.Reset();
 
 	if (!InitD3D11()) {
 		goto failed;
 	}
 
 	is_started_ = true;
-	AcquireFrame();
+	AcquireFrame(0);
 	capture_thread_.reset(new std::thread([this] {
+		// Blocks in AcquireNextFrame() until the desktop changes.
 		while (is_started_) {
-			std::this_thread::sleep_for(std::chrono::milliseconds(15));
-			AcquireFrame();
+			if (AcquireFrame(kAcquireTimeoutMs) < -1) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(15));
+			}
 		}
 		}));
 
@@ -127,7 +153,9 @@ bool D3D11ScreenCapture::InitD3D11()
 void D3D11ScreenCapture::CleanupD3D11()
 {
 	rgba_texture_.Reset();
-	gdi_texture_.Reset();
+	sampled_tiles_.clear();
+	sampled_step_ = 0;
+	is_fingerprint_pending_ = false;
 	shared_texture_.Reset();
 	dxgi_output_duplication_.Reset();
 	d3d11_device_.Reset();
@@ -156,32 +184,6 @@ bool D3D11ScreenCapture::CreateTexture()
 		return false;
 	}
 
-	desc.Width = dxgi_desc_.ModeDesc.Width;
-	desc.Height = dxgi_desc_.ModeDesc.Height;
-	desc.BindFlags = 0;
-	desc.Usage = D3D11_USAGE_STAGING;
-	desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
-	desc.MiscFlags = 0;
-
-	hr = d3d11_device_->CreateTexture2D(&desc, nullptr, rgba_texture_.GetAddressOf());
-	if (FAILED(hr)) {
-		printf("[D3D11ScreenCapture] Failed to create texture.\n");
-		return false;
-	}
-
-	desc.Width = dxgi_desc_.ModeDesc.Width;
-	desc.Height = dxgi_desc_.ModeDesc.Height;
-	desc.Usage = D3D11_USAGE_DEFAULT;
-	desc.CPUAccessFlags = 0;
-	desc.BindFlags = D3D11_BIND_RENDER_TARGET;
-	desc.MiscFlags = D3D11_RESOURCE_MISC_GDI_COMPATIBLE;
-
-	hr = d3d11_device_->CreateTexture2D(&desc, nullptr, gdi_texture_.GetAddressOf());
-	if (FAILED(hr)) {
-		printf("[D3D11ScreenCapture] Failed to create texture.\n");
-		return false;
-	}
-
 	Microsoft::WRL::ComPtr<IDXGIResource> dxgi_resource;
 	hr = shared_texture_->QueryInterface(__uuidof(IDXGIResource), reinterpret_cast<void**>(dxgi_resource.GetAddressOf()));
 	if (FAILED(hr)) {
@@ -201,6 +203,7 @@ bool D3D11ScreenCapture::CreateTexture()
 void D3D11ScreenCapture::Destroy()
 {
 	is_started_ = false;
+	frame_signal_.Cancel();
 	if (capture_thread_) {
 		capture_thread_->join();
 		capture_thread_.reset();
@@ -209,14 +212,27 @@ void D3D11ScreenCapture::Destroy()
 	CleanupD3D11();
 }
 
-int D3D11ScreenCapture::AcquireFrame()
+int D3D11ScreenCapture::AcquireFrame(int timeout_ms)
 {
 	Microsoft::WRL::ComPtr<IDXGIResource> dxgi_resource;
 	DXGI_OUTDUPL_FRAME_INFO frame_info;
 	memset(&frame_info, 0, sizeof(DXGI_OUTDUPL_FRAME_INFO));
 
+	if (is_fingerprint_pending_ && timeout_ms > kFingerprintDelayMs) {
+		timeout_ms = kFingerprintDelayMs;
+	}
+
 	dxgi_output_duplication_->ReleaseFrame();
-	HRESULT hr = dxgi_output_duplication_->AcquireNextFrame(0, &frame_info, dxgi_resource.GetAddressOf());
+	HRESULT hr = dxgi_output_duplication_->AcquireNextFrame(timeout_ms, &frame_info, dxgi_resource.GetAddressOf());
+
+	// The tiles copied by the last call have had the wait above to finish, and
+	// shared_texture_ still holds the frame they came from.
+	if (is_fingerprint_pending_) {
+		is_fingerprint_pending_ = false;
+		uint64_t fingerprint = HashFrame();
+		std::lock_guard<std::mutex> locker(mutex_);
+		fingerprint_ = fingerprint;
+	}
 
 	if (FAILED(hr)) {
 		if (hr == DXGI_ERROR_WAIT_TIMEOUT) {
@@ -231,9 +247,26 @@ int D3D11ScreenCapture::AcquireFrame()
 		return -3;
 	}
 
+	// The cursor is not drawn into the frame, the sink gets its shape and
+	// position and puts it on top itself.
+	bool is_cursor_updated = UpdateCursor(frame_info);
+
 	if (frame_info.AccumulatedFrames == 0 ||
 		frame_info.LastPresentTime.QuadPart == 0) {
-		// No image update, only cursor moved.
+		// No image update, only cursor moved. The textures and the fingerprint
+		// stay as they are.
+		if (is_cursor_updated) {
+			{
+				std::lock_guard<std::mutex> locker(mutex_);
+				frame_signal_.Notify(GetPresentTimeUs(frame_info.LastMouseUpdateTime));
+			}
+
+			Image image;
+			if (Capture(image)) {
+				RunFrameCallback(image);
+			}
+		}
+		return 0;
 	}
 
 	if (!dxgi_resource.Get()) {
@@ -246,45 +279,66 @@ int D3D11ScreenCapture::AcquireFrame()
 		return -1;
 	}
 
-	d3d11_context_->CopySubresourceRegion(
-		gdi_texture_.Get(),
-		0,
-		0,
-		0,
-		0, 
-		output_texture.Get(),
-		0,
-		NULL);
+	CaptureFrame(output_texture.Get(), GetPresentTimeUs(frame_info.LastPresentTime));
 
-	Microsoft::WRL::ComPtr<IDXGISurface1> surface1;
-	hr = gdi_texture_->QueryInterface(__uuidof(IDXGISurface1), reinterpret_cast<void**>(surface1.GetAddressOf()));
-	if (FAILED(hr)) {
-		return -1;
+	Image image;
+	if (Capture(image)) {
+		RunFrameCallback(image);
 	}
+	return 0;
+}
 
-	CURSORINFO cursor_info = { 0 };
-	cursor_info.cbSize = sizeof(CURSORINFO);
-	if (GetCursorInfo(&cursor_info) == TRUE) {
-		if (cursor_info.flags == CURSOR_SHOWING) {
-			auto cursor_position = cursor_info.ptScreenPos;
-			auto cursor_size = cursor_info.cbSize;
-			HDC  hdc;
-			surface1->GetDC(FALSE, &hdc);
-			DrawIconEx(hdc, cursor_position.x - monitor_.left, cursor_position.y - monitor_.top,
-				cursor_info.hCursor, 0, 0, 0, 0, DI_NORMAL | DI_DEFAULTSIZE);
-			surface1->ReleaseDC(nullptr);
-		}
+bool D3D11ScreenCapture::UpdateCursor(const DXGI_OUTDUPL_FRAME_INFO& frame_info)
+{
+	// Position and visibility are only valid with a mouse update.
+	if (frame_info.LastMouseUpdateTime.QuadPart == 0) {
+		return false;
 	}
 
-	d3d11_context_->CopyResource(rgba_texture_.Get(), gdi_texture_.Get());
+	std::shared_ptr<CursorShape> shape;
+	if (frame_info.PointerShapeBufferSize > 0) {
+		shape.reset(new CursorShape);
+		shape->data.resize(frame_info.PointerShapeBufferSize);
+
+		UINT size = 0;
+		DXGI_OUTDUPL_POINTER_SHAPE_INFO shape_info;
+		memset(&shape_info, 0, sizeof(shape_info));
+		HRESULT hr = dxgi_output_duplication_->GetFramePointerShape(frame_info.PointerShapeBufferSize,
+			shape->data.data(), &size, &shape_info);
+		if (SUCCEEDED(hr)) {
+			shape->type = static_cast<CursorShapeType>(shape_info.Type);
+			shape->width = static_cast<int>(shape_info.Width);
+			shape->height = static_cast<int>(shape_info.Type == DXGI_OUTDUPL_POINTER_SHAPE_TYPE_MONOCHROME ?
+				shape_info.Height / 2 : shape_info.Height);
+			shape->pitch = static_cast<int>(shape_info.Pitch);
+			shape->hot_x = shape_info.HotSpot.x;
+			shape->hot_y = shape_info.HotSpot.y;
+		}
+		else {
+			shape.reset();
+		}
+	}
 
-	CaptureFrame();
-	return 0;
+	std::lock_guard<std::mutex> locker(mutex_);
+	cursor_.is_visible = frame_info.PointerPosition.Visible != FALSE;
+	cursor_.x = frame_info.PointerPosition.Position.x;
+	cursor_.y = frame_info.PointerPosition.Position.y;
+	if (shape) {
+		cursor_.shape = shape;
+	}
+	return true;
 }
 
-void D3D11ScreenCapture::CaptureFrame()
+void D3D11ScreenCapture::CaptureFrame(ID3D11Texture2D* output_texture, int64_t timestamp_us)
 {
+	// Only the sampled tiles are copied, and mapped by the next AcquireFrame()
+	// so the copy is not waited for. Until then the frame has no fingerprint
+	// and is never taken as unchanged.
+	int sample_step = fingerprint_sample_step_;
+	is_fingerprint_pending_ = sample_step > 0 && CopySampledTiles(output_texture, sample_step);
+
 	std::lock_guard<std::mutex> locker(mutex_);
+	fingerprint_ = 0;
 
 	D3D11_MAPPED_SUBRESOURCE dsec = { 0 };
 	int image_width = (int)dxgi_desc_.ModeDesc.Width;
@@ -306,17 +360,8 @@ void D3D11ScreenCapture::CaptureFrame()
 		d3d11_context_->Unmap(rgba_texture_.Get(), 0);
 	}
 #endif
-	d3d11_context_->CopyResource(shared_texture_.Get(), gdi_texture_.Get());
-	//D3D11_BOX src_box = { 0, 0, 0, 1920, 1080, 1 };
-	//d3d11_context_->CopySubresourceRegion(
-	//	shared_texture_.Get(),
-	//	0,
-	//	0,
-	//	0,
-	//	0,
-	//	gdi_texture_.Get(),
-	//	0,
-	//	&src_box);
+	d3d11_context_->CopyResource(shared_texture_.Get(), output_texture);
+	frame_signal_.Notify(timestamp_us);
 }
 
 bool D3D11ScreenCapture::Capture(Image& image)
@@ -338,6 +383,9 @@ bool D3D11ScreenCapture::Capture(Image& image)
 	//image.bgra.assign(image_.get(), image_.get() + image_size_);
 	image.width = dxgi_desc_.ModeDesc.Width;// 1920;
 	image.height = dxgi_desc_.ModeDesc.Height;// 1080;
+	image.sequence = frame_signal_.GetSequence(&image.timestamp);
+	image.fingerprint = fingerprint_;
+	image.cursor = cursor_;
 
 	if (shared_handle_) {
 		image.shared_handle = shared_handle_;
@@ -345,3 +393,100 @@ bool D3D11ScreenCapture::Capture(Image& image)
 
 	return true;
 }
+
+void D3D11ScreenCapture::SetFingerprint(int sample_step)
+{
+	fingerprint_sample_step_ = sample_step > 0 ? sample_step : 0;
+}
+
+bool D3D11ScreenCapture::CopySampledTiles(ID3D11Texture2D* output_texture, int sample_step)
+{
+	int width = (int)dxgi_desc_.ModeDesc.Width;
+	int height = (int)dxgi_desc_.ModeDesc.Height;
+
+	if (!rgba_texture_ || sample_step != sampled_step_) {
+		rgba_texture_.Reset();
+		GetSampledTiles(width, height, sample_step, sampled_tiles_);
+		sampled_step_ = sample_step;
+
+		// Each tile row keeps its row, its tiles move to the left.
+		int packed_width = 0;
+		int row_width = 0;
+		int row_top = -1;
+		for (auto& tile : sampled_tiles_) {
+			if (tile.top != row_top) {
+				row_top = tile.top;
+				row_width = 0;
+			}
+			row_width += tile.right - tile.left;
+			packed_width = row_width > packed_width ? row_width : packed_width;
+		}
+
+		if (packed_width == 0) {
+			return false;
+		}
+
+		D3D11_TEXTURE2D_DESC desc = { 0 };
+		desc.Width = packed_width;
+		desc.Height = height;
+		desc.MipLevels = 1;
+		desc.ArraySize = 1;
+		desc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+		desc.SampleDesc.Count = 1;
+		desc.Usage = D3D11_USAGE_STAGING;
+		desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+
+		// Rows with fewer tiles leave the rest of the texture as it is, it is
+		// hashed too and must not differ from frame to frame.
+		std::vector<uint8_t> zero(static_cast<size_t>(packed_width) * height * 4);
+		D3D11_SUBRESOURCE_DATA init_data = { 0 };
+		init_data.pSysMem = zero.data();
+		init_data.SysMemPitch = packed_width * 4;
+
+		HRESULT hr = d3d11_device_->CreateTexture2D(&desc, &init_data, rgba_texture_.GetAddressOf());
+		if (FAILED(hr)) {
+			printf("[D3D11ScreenCapture] Failed to create texture.\n");
+			return false;
+		}
+	}
+
+	int x = 0;
+	int row_top = -1;
+	for (auto& tile : sampled_tiles_) {
+		if (tile.top != row_top) {
+			row_top = tile.top;
+			x = 0;
+		}
+		D3D11_BOX box = { (UINT)tile.left, (UINT)tile.top, 0, (UINT)tile.right, (UINT)tile.bottom, 1 };
+		d3d11_context_->CopySubresourceRegion(rgba_texture_.Get(), 0, x, tile.top, 0, output_texture, 0, &box);
+		x += tile.right - tile.left;
+	}
+
+	return true;
+}
+
+uint64_t D3D11ScreenCapture::HashFrame()
+{
+	D3D11_TEXTURE2D_DESC desc;
+	rgba_texture_->GetDesc(&desc);
+
+	D3D11_MAPPED_SUBRESOURCE mapped_resource = { 0 };
+	HRESULT hr = d3d11_context_->Map(rgba_texture_.Get(), 0, D3D11_MAP_READ, 0, &mapped_resource);
+	if (FAILED(hr)) {
+		return 0;
+	}
+
+	// The packed tiles as a whole, the packing follows the frame size and
+	// sample_step so equal frames give equal fingerprints.
+	PixelFrame frame;
+	frame.width = (int)desc.Width;
+	frame.height = (int)desc.Height;
+	frame.format = PIXEL_FORMAT_ARGB;
+	frame.plane[0] = static_cast<uint8_t*>(mapped_resource.pData);
+	frame.pitch[0] = mapped_resource.RowPitch;
+
+	uint64_t fingerprint = DX::HashFrame(&frame);
+
+	d3d11_context_->Unmap(rgba_texture_.Get(), 0);
+	return fingerprint;
+}
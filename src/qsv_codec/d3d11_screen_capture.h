@@ -10,6 +10,7 @@
 #include <mutex>
 #include <thread>
 #include <memory>
+#include <atomic>
 #include <wrl.h>
 #include <dxgi.h>
 #include <d3d11_1.h>
@@ -27,12 +28,17 @@ public:
 
 	virtual bool Capture(Image& image);
 
+	virtual void SetFingerprint(int sample_step);
+
 private:
 	bool InitD3D11();
 	void CleanupD3D11();
 	bool CreateTexture();
-	int  AcquireFrame();
-	void CaptureFrame();
+	int  AcquireFrame(int timeout_ms);
+	bool UpdateCursor(const DXGI_OUTDUPL_FRAME_INFO& frame_info);
+	void CaptureFrame(ID3D11Texture2D* output_texture, int64_t timestamp_us);
+	bool CopySampledTiles(ID3D11Texture2D* output_texture, int sample_step);
+	uint64_t HashFrame();
 
 	DX::Monitor monitor_;
 
@@ -43,6 +49,14 @@ private:
 	std::mutex mutex_;
 	//std::shared_ptr<uint8_t> image_;
 	uint32_t image_size_;
+	uint64_t fingerprint_ = 0;
+	std::atomic<int> fingerprint_sample_step_{ 0 };
+	// The tiles DX::HashFrame() samples, packed side by side in rgba_texture_.
+	std::vector<PixelRect> sampled_tiles_;
+	int  sampled_step_ = 0;
+	bool is_fingerprint_pending_ = false;
+	// Written by the capture thread under mutex_.
+	CursorState cursor_;
 
 	// d3d resource
 	DXGI_OUTDUPL_DESC dxgi_desc_;
@@ -52,7 +66,6 @@ private:
 	Microsoft::WRL::ComPtr<IDXGIOutputDuplication> dxgi_output_duplication_;
 	Microsoft::WRL::ComPtr<ID3D11Texture2D>        shared_texture_;
 	Microsoft::WRL::ComPtr<ID3D11Texture2D>        rgba_texture_;
-	Microsoft::WRL::ComPtr<ID3D11Texture2D>        gdi_texture_;
 };
 
 }
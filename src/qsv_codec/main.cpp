@@ -1,7 +1,7 @@
 #include "main_window.h"
 #include "video_source.h"
 #include "video_sink.h"
-#include <chrono>
+#include "presentation_scheduler.h"
 
 int main(int argc, char** argv)
 {
@@ -24,6 +24,9 @@ int main(int argc, char** argv)
 	if (!video_source.Init()) {
 		return -2;
 	}
+	video_source.SetSkipUnchangedFrames(true, 1000, 4);
+	video_source.SetSkipUnchangedChroma(true);
+	video_source.SetRegionAdaptiveChroma(true);
 
 	VideoSink video_sink;
 	if (!video_sink.Init(window.GetHandle(), video_source.GetWidth(), video_source.GetHeight())) {
@@ -36,7 +39,11 @@ int main(int argc, char** argv)
 	RECT rect;
 	GetWindowRect(window.GetHandle(), &rect);
 
-	auto start_time = std::chrono::high_resolution_clock::now();
+	// Capture on a fixed 30 fps cadence, a late slot is skipped instead of
+	// being made up with a burst of captures.
+	DX::SteadyClock clock;
+	const int64_t frame_interval = 33333;
+	int64_t next_capture_time = clock.GetTimeUs();
 
 	while (msg.message != WM_QUIT) {
 		if (::PeekMessage(&msg, NULL, 0U, 0U, PM_REMOVE)) {
@@ -53,10 +60,12 @@ int main(int argc, char** argv)
 				video_sink.Resize();
 			}
 
-			auto cur_time = std::chrono::high_resolution_clock::now();
-			auto elapsed_time = std::chrono::duration_cast<std::chrono::milliseconds>(cur_time - start_time).count();
-			if (elapsed_time >= 33) {
-				start_time = cur_time;
+			int64_t cur_time = clock.GetTimeUs();
+			if (cur_time >= next_capture_time) {
+				next_capture_time += frame_interval;
+				if (next_capture_time <= cur_time) {
+					next_capture_time = cur_time + frame_interval;
+				}
 				if (display_mode == 0) {
 					DX::Image image;
 					if (video_source.Capture(image)) {
@@ -75,9 +84,14 @@ int main(int argc, char** argv)
 					}
 				}
 			}
+
+			int64_t wait_time = next_capture_time - clock.GetTimeUs();
+			DWORD timeout = wait_time > 0 ? static_cast<DWORD>(wait_time / 1000) : 0;
+			::MsgWaitForMultipleObjects(0, NULL, FALSE, timeout, QS_ALLINPUT);
 		}
-		Sleep(1);
 	}
 
+	printf("unchanged frames skipped: %llu \n", static_cast<unsigned long long>(video_source.GetSkippedFrames()));
+	printf("chroma420 frames skipped: %llu \n", static_cast<unsigned long long>(video_source.GetSkippedChromaFrames()));
 	return 0;
 }
@@ -0,0 +1,61 @@
+#include "mock_video_encoder.h"
+#include "renderer.h"
+
+#include <chrono>
+#include <thread>
+
+MockVideoEncoder::MockVideoEncoder(int latency_us)
+	: latency_us_(latency_us)
+{
+
+}
+
+MockVideoEncoder::~MockVideoEncoder()
+{
+	Destroy();
+}
+
+bool MockVideoEncoder::Init()
+{
+	is_initialized_ = true;
+	encoded_frames_ = 0;
+	return true;
+}
+
+void MockVideoEncoder::Destroy()
+{
+	is_initialized_ = false;
+}
+
+int MockVideoEncoder::Encode(const VideoEncoderInput& input, std::vector<uint8_t>& out_frame)
+{
+	if (!is_initialized_ || (!input.texture && !input.frame)) {
+		return -1;
+	}
+
+	if (latency_us_ > 0) {
+		std::this_thread::sleep_for(std::chrono::microseconds(latency_us_));
+	}
+
+	// frame index, width and height as little endian uint32
+	uint32_t fields[3] = { static_cast<uint32_t>(encoded_frames_), 0, 0 };
+	if (input.frame) {
+		fields[1] = static_cast<uint32_t>(input.frame->width);
+		fields[2] = static_cast<uint32_t>(input.frame->height);
+	}
+
+	out_frame.clear();
+	for (uint32_t field : fields) {
+		for (int i = 0; i < 4; i++) {
+			out_frame.push_back(static_cast<uint8_t>(field >> (i * 8)));
+		}
+	}
+
+	encoded_frames_ += 1;
+	return static_cast<int>(out_frame.size());
+}
+
+uint64_t MockVideoEncoder::GetEncodedFrames()
+{
+	return encoded_frames_;
+}
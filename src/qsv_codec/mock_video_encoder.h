@@ -0,0 +1,25 @@
+#pragma once
+
+#include "video_encoder.h"
+
+// Software stand-in for a hardware encoder, it blocks for a fixed latency like
+// SyncOperation() and emits a small payload describing the input. Runs without
+// a GPU, so the overlap of ConcurrentEncoder can be measured anywhere.
+class MockVideoEncoder : public VideoEncoder
+{
+public:
+	MockVideoEncoder(int latency_us = 5000);
+	virtual ~MockVideoEncoder();
+
+	virtual bool Init();
+	virtual void Destroy();
+
+	virtual int  Encode(const VideoEncoderInput& input, std::vector<uint8_t>& out_frame);
+
+	uint64_t GetEncodedFrames();
+
+private:
+	int latency_us_ = 0;
+	bool is_initialized_ = false;
+	uint64_t encoded_frames_ = 0;
+};
@@ -1,6 +1,10 @@
 #pragma once
 
+#include "frame_signal.h"
+#include "cursor_overlay.h"
 #include <cstdint>
+#include <functional>
+#include <mutex>
 #include <vector>
 #include <Windows.h>
 
@@ -12,12 +16,27 @@ struct Image
 	int width;
 	int height;
 
+	// Frame number from 1, and capture time in steady clock microseconds.
+	uint64_t sequence = 0;
+	int64_t  timestamp = 0;
+
+	// Content hash of the frame, equal hashes mean an unchanged frame.
+	// 0 when the capturer does not compute one, or has not read it back yet,
+	// it can be filled in later for the same sequence.
+	uint64_t fingerprint = 0;
+
+	// Cursor on top of the frame, it is not drawn into shared_handle and does
+	// not take part in fingerprint.
+	CursorState cursor;
+
 	HANDLE shared_handle;
 };
 
 class ScreenCapture
 {
 public:
+	typedef std::function<void(const Image& image)> FrameCallback;
+
 	ScreenCapture& operator=(const ScreenCapture&) = delete;
 	ScreenCapture(const ScreenCapture&) = delete;
 	ScreenCapture() {}
@@ -28,8 +47,48 @@ public:
 
 	virtual bool Capture(Image& image) = 0;
 
+	// Fills Image::fingerprint from now on, sample_step as in DX::HashFrame().
+	// sample_step <= 0 turns it off.
+	virtual void SetFingerprint(int sample_step) {}
+
+	// Blocks until a frame newer than image.sequence was captured, then fills
+	// image like Capture(). Fails on timeout and after Destroy().
+	virtual bool WaitForFrame(Image& image, int timeout_ms)
+	{
+		if (!frame_signal_.Wait(image.sequence, timeout_ms)) {
+			return false;
+		}
+		return Capture(image);
+	}
+
+	// Runs on the capture thread for every new frame, keep it short.
+	void SetFrameCallback(const FrameCallback& callback)
+	{
+		std::lock_guard<std::mutex> locker(callback_mutex_);
+		frame_callback_ = callback;
+	}
+
 protected:
+	// Hands a new frame to the frame callback, call it without holding locks
+	// that Capture() takes.
+	void RunFrameCallback(const Image& image)
+	{
+		FrameCallback callback;
+		{
+			std::lock_guard<std::mutex> locker(callback_mutex_);
+			callback = frame_callback_;
+		}
+
+		if (callback) {
+			callback(image);
+		}
+	}
+
+	FrameSignal frame_signal_;
 
+private:
+	std::mutex callback_mutex_;
+	FrameCallback frame_callback_;
 };
 
 }
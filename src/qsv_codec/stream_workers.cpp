@@ -0,0 +1,88 @@
+#include "stream_workers.h"
+
+StreamWorkers::StreamWorkers()
+{
+
+}
+
+StreamWorkers::~StreamWorkers()
+{
+	Destroy();
+}
+
+void StreamWorkers::Destroy()
+{
+	std::lock_guard<std::mutex> run_locker(run_mutex_);
+
+	{
+		std::lock_guard<std::mutex> locker(mutex_);
+		is_quit_ = true;
+	}
+	start_cond_.notify_all();
+
+	for (auto& thread : threads_) {
+		thread.join();
+	}
+
+	threads_.clear();
+	is_quit_ = false;
+}
+
+void StreamWorkers::Run(int count, const std::function<void(int)>& task)
+{
+	if (count <= 0) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> run_locker(run_mutex_);
+
+	if (count > 1) {
+		std::lock_guard<std::mutex> locker(mutex_);
+		while (static_cast<int>(threads_.size()) < count - 1) {
+			int index = static_cast<int>(threads_.size()) + 1;
+			threads_.emplace_back(&StreamWorkers::WorkerThread, this, index, generation_);
+		}
+
+		task_ = &task;
+		task_count_ = count;
+		pending_tasks_ = count - 1;
+		generation_ += 1;
+		start_cond_.notify_all();
+	}
+
+	task(0);
+
+	if (count > 1) {
+		std::unique_lock<std::mutex> locker(mutex_);
+		done_cond_.wait(locker, [this] { return pending_tasks_ == 0; });
+		task_ = NULL;
+		task_count_ = 0;
+	}
+}
+
+void StreamWorkers::WorkerThread(int index, uint64_t generation)
+{
+	std::unique_lock<std::mutex> locker(mutex_);
+
+	while (true) {
+		start_cond_.wait(locker, [&] { return is_quit_ || generation_ != generation; });
+		if (is_quit_) {
+			break;
+		}
+
+		generation = generation_;
+		if (index >= task_count_) {
+			continue;
+		}
+
+		const std::function<void(int)>* task = task_;
+		locker.unlock();
+		(*task)(index);
+		locker.lock();
+
+		pending_tasks_ -= 1;
+		if (pending_tasks_ == 0) {
+			done_cond_.notify_one();
+		}
+	}
+}
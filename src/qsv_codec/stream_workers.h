@@ -0,0 +1,40 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Runs one blocking job per stream at the same time, e.g. the YUV420 and
+// Chroma420 encodes or decodes of a frame. Unlike DX::WorkerPool the thread
+// count is not tied to the CPU count, the jobs mostly wait on hardware. The
+// calling thread runs task(0) and each further index has its own thread.
+class StreamWorkers
+{
+public:
+	StreamWorkers();
+	virtual ~StreamWorkers();
+
+	void Destroy();
+
+	// Runs task(0) ... task(count - 1) and returns when all of them are done.
+	void Run(int count, const std::function<void(int)>& task);
+
+private:
+	void WorkerThread(int index, uint64_t generation);
+
+	std::mutex run_mutex_;
+
+	std::mutex mutex_;
+	std::condition_variable start_cond_;
+	std::condition_variable done_cond_;
+	std::vector<std::thread> threads_;
+	bool is_quit_ = false;
+
+	const std::function<void(int)>* task_ = NULL;
+	uint64_t generation_ = 0;
+	int task_count_ = 0;
+	int pending_tasks_ = 0;
+};
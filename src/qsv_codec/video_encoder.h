@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct ID3D11Texture2D;
+
+namespace DX {
+struct PixelFrame;
+}
+
+// GPU encoders take the texture, CPU ones the frame.
+struct VideoEncoderInput
+{
+	ID3D11Texture2D*      texture = NULL;
+	const DX::PixelFrame* frame   = NULL;
+};
+
+// Backend independent encoder, see D3D11QSVEncoder and MockVideoEncoder.
+class VideoEncoder
+{
+public:
+	virtual ~VideoEncoder() {}
+
+	virtual bool Init() = 0;
+	virtual void Destroy() = 0;
+
+	// Returns the frame size, 0 when the frame was held back and < 0 on error.
+	virtual int  Encode(const VideoEncoderInput& input, std::vector<uint8_t>& out_frame) = 0;
+};
@@ -1,4 +1,5 @@
 #include "video_sink.h"
+#include "shader/d3d11/shader_d3d11_pixel.h"
 
 #include "imgui.h"
 #include "imgui_impl_win32.h"
@@ -6,6 +7,8 @@
 
 #define ENABLE_IMGUI 0
 
+#define DX_SAFE_RELEASE(p) { if(p) { (p)->Release(); (p) = NULL; } } 
+
 VideoSink::VideoSink()
 {
 
@@ -70,6 +73,13 @@ void VideoSink::Destroy()
 	ImGui::DestroyContext();
 #endif
 
+	concurrent_decoder_.Destroy();
+	chroma420_frame_.reset();
+	has_chroma420_mask_ = false;
+
+	cursor_ = DX::CursorState();
+	ReleaseCursor();
+
 	if (yuv420_decoder_) {
 		yuv420_decoder_->Destroy();
 	}
@@ -81,6 +91,29 @@ void VideoSink::Destroy()
 	DX::D3D11Renderer::Destroy();
 }
 
+bool VideoSink::Resize()
+{
+	// The render targets lose their textures, and the back buffer must not be
+	// held while the swap chain resizes.
+	last_output_texture_ = NULL;
+	if (cursor_target_) {
+		cursor_target_->ReleaseTexture();
+	}
+	return DX::D3D11Renderer::Resize();
+}
+
+void VideoSink::ReleaseCursor()
+{
+	cursor_compositor_.Reset();
+	DX_SAFE_RELEASE(cursor_texture_);
+	cursor_shape_.reset();
+	DX_SAFE_RELEASE(cursor_shape_srv_);
+	DX_SAFE_RELEASE(cursor_shape_texture_);
+	DX_SAFE_RELEASE(cursor_blend_state_);
+	cursor_target_.reset();
+	last_output_texture_ = NULL;
+}
+
 void VideoSink::End()
 {
 	if (output_texture_) {
@@ -89,8 +122,10 @@ void VideoSink::End()
 		HRESULT hr = dxgi_swap_chain_->GetBuffer(0, __uuidof(ID3D11Texture2D), reinterpret_cast<void**>(&back_buffer));
 		if (SUCCEEDED(hr)) {
 			d3d11_context_->CopyResource(back_buffer, texture);
+			DrawCursor(back_buffer);
 			back_buffer->Release();
 		}
+		last_output_texture_ = output_texture_;
 		output_texture_ = NULL;
 	}
 
@@ -140,6 +175,7 @@ void VideoSink::End()
 	HRESULT hr = dxgi_swap_chain_->Present(0, 0);
 	if (FAILED(hr) && hr != DXGI_ERROR_WAS_STILL_DRAWING) {
 		if (hr == DXGI_ERROR_DEVICE_REMOVED) {
+			ReleaseCursor();
 			DX::D3D11Renderer::Destroy();
 			DX::D3D11Renderer::Init(wnd_);
 		}
@@ -159,6 +195,8 @@ void VideoSink::RenderFrame(DX::Image& image)
 		return;
 	}
 
+	cursor_ = image.cursor;
+
 	D3D11_TEXTURE2D_DESC desc;
 	texture->GetDesc(&desc);
 
@@ -184,7 +222,7 @@ void VideoSink::RenderFrame(DX::Image& image)
 		0,
 		NULL);
 
-	DX::D3D11RenderTexture* render_target = render_targets_[DX::PIXEL_SHADER_ARGB].get();
+	DX::D3D11RenderTexture* render_target = GetRenderTarget(DX::PIXEL_SHADER_ARGB);
 	if (render_target) {
 		render_target->Begin();
 		render_target->PSSetTexture(0, argb_texture_svr);
@@ -201,38 +239,12 @@ void VideoSink::RenderFrame(DX::Image& image)
 
 void VideoSink::RenderNV12(std::vector<std::vector<uint8_t>>& compressed_frame)
 {
-	if (compressed_frame.size() != 2) {
-		return;
-	}
-
-	if (compressed_frame[0].empty() ||
-		compressed_frame[1].empty()) {
-		return;
-	}
-
-	std::shared_ptr<AVFrame> yuv420_frame, chroma420_frame;
-
-	int ret = yuv420_decoder_->Send(compressed_frame[0]);
-	if (ret < 0) {
-		printf("[VideoSink] Send yuv420 frame failed. \n");
-		return;
-	}
-
-	ret = yuv420_decoder_->Recv(yuv420_frame);
-	if (ret < 0) {
-		printf("[VideoSink] Recv yuv420 frame failed. \n");
+	if (!UpdateCursor(compressed_frame)) {
 		return;
 	}
 
-	ret = chroma420_decoder_->Send(compressed_frame[1]);
-	if (ret < 0) {
-		printf("[VideoSink] Send chroma420 frame failed. \n");
-		return;
-	}
-
-	ret = chroma420_decoder_->Recv(chroma420_frame);
-	if (ret < 0) {
-		printf("[VideoSink] Recv chroma420 frame failed. \n");
+	std::shared_ptr<AVFrame> yuv420_frame;
+	if (!Decode(compressed_frame, yuv420_frame)) {
 		return;
 	}
 
@@ -266,7 +278,8 @@ void VideoSink::RenderNV12(std::vector<std::vector<uint8_t>>& compressed_frame)
 		yuv420_index,
 		NULL);
 
-	auto render_target = render_targets_[DX::PIXEL_SHADER_NV12_BT601];
+	DX::D3D11RenderTexture* render_target = GetYUVRenderTarget(true,
+		DX::GetColorMatrix(yuv420_frame->colorspace), DX::GetColorRange(yuv420_frame->color_range));
 	if (render_target) {
 		render_target->Begin();
 		render_target->PSSetTexture(0, nv12_texture_y_srv);
@@ -277,7 +290,7 @@ void VideoSink::RenderNV12(std::vector<std::vector<uint8_t>>& compressed_frame)
 		render_target->End();
 		render_target->PSSetTexture(0, NULL);
 		render_target->PSSetTexture(1, NULL);
-		output_texture_ = render_target.get();
+		output_texture_ = render_target;
 	}
 
 	Process();
@@ -287,49 +300,23 @@ void VideoSink::RenderNV12(std::vector<std::vector<uint8_t>>& compressed_frame)
 
 void VideoSink::RenderARGB(std::vector<std::vector<uint8_t>>& compressed_frame)
 {
-	if (compressed_frame.size() != 2) {
-		return;
-	}
-
-	if (compressed_frame[0].empty() || 
-		compressed_frame[1].empty()) {
-		return;
-	}
-
-	std::shared_ptr<AVFrame> yuv420_frame, chroma420_frame;
-
-	int ret = yuv420_decoder_->Send(compressed_frame[0]);
-	if (ret < 0) {
-		printf("[VideoSink] Send yuv420 frame failed. \n");
-		return;
-	}
-
-	ret = yuv420_decoder_->Recv(yuv420_frame);
-	if (ret < 0) {
-		printf("[VideoSink] Recv yuv420 frame failed. \n");
-		return;
-	}
-
-	ret = chroma420_decoder_->Send(compressed_frame[1]);
-	if (ret < 0) {
-		printf("[VideoSink] Send chroma420 frame failed. \n");
+	if (!UpdateCursor(compressed_frame)) {
 		return;
 	}
 
-	ret = chroma420_decoder_->Recv(chroma420_frame);
-	if (ret < 0) {
-		printf("[VideoSink] Recv chroma420 frame failed. \n");
+	std::shared_ptr<AVFrame> yuv420_frame;
+	if (!Decode(compressed_frame, yuv420_frame)) {
 		return;
 	}
 
 	ID3D11Texture2D* yuv420_texture = (ID3D11Texture2D*)yuv420_frame->data[0];
 	int yuv420_index = (int)yuv420_frame->data[1];
 
-	ID3D11Texture2D* chroma420_texture = (ID3D11Texture2D*)chroma420_frame->data[0];
-	int chroma420_index = (int)chroma420_frame->data[1];
+	ID3D11Texture2D* chroma420_texture = (ID3D11Texture2D*)chroma420_frame_->data[0];
+	int chroma420_index = (int)chroma420_frame_->data[1];
 
 	if (!color_converter_->Combine(yuv420_texture, yuv420_index, 
-		chroma420_texture, chroma420_index)) {
+		chroma420_texture, chroma420_index, has_chroma420_mask_ ? &chroma420_mask_ : NULL)) {
 		printf("[VideoSink] Combine frame failed. \n");
 		return;
 	}
@@ -361,7 +348,7 @@ void VideoSink::RenderARGB(std::vector<std::vector<uint8_t>>& compressed_frame)
 		0,
 		NULL);
 
-	auto render_target = render_targets_[DX::PIXEL_SHADER_ARGB];
+	DX::D3D11RenderTexture* render_target = GetRenderTarget(DX::PIXEL_SHADER_ARGB);
 	if (render_target) {
 		render_target->Begin();
 		render_target->PSSetTexture(0, argb_texture_svr);
@@ -370,8 +357,256 @@ void VideoSink::RenderARGB(std::vector<std::vector<uint8_t>>& compressed_frame)
 		render_target->Draw();
 		render_target->End();
 		render_target->PSSetTexture(0, NULL);
-		output_texture_ = render_target.get();
+		output_texture_ = render_target;
 	}
 
 	End();
 }
+
+bool VideoSink::Decode(std::vector<std::vector<uint8_t>>& compressed_frame, std::shared_ptr<AVFrame>& yuv420_frame)
+{
+	// Both streams are decoded at the same time, an empty Chroma420 payload
+	// means the chroma did not change and keeps the last frame.
+	DecodeTask tasks[2];
+	tasks[0].decoder = yuv420_decoder_.get();
+	tasks[0].packet = &compressed_frame[0];
+	tasks[1].decoder = chroma420_decoder_.get();
+	tasks[1].packet = &compressed_frame[1];
+
+	bool is_chroma_changed = !compressed_frame[1].empty();
+	concurrent_decoder_.Run(tasks, is_chroma_changed ? 2 : 1);
+
+	if (tasks[0].result < 0) {
+		printf("[VideoSink] Decode yuv420 frame failed. \n");
+		return false;
+	}
+
+	if (is_chroma_changed) {
+		if (tasks[1].result < 0) {
+			printf("[VideoSink] Decode chroma420 frame failed. \n");
+			return false;
+		}
+
+		chroma420_frame_ = tasks[1].frame;
+		has_chroma420_mask_ = compressed_frame.size() > 3 &&
+			DX::ParseChromaTileMask(compressed_frame[3].data(), compressed_frame[3].size(), &chroma420_mask_);
+	}
+
+	if (!chroma420_frame_) {
+		return false;
+	}
+
+	yuv420_frame = tasks[0].frame;
+	return true;
+}
+
+bool VideoSink::UpdateCursor(std::vector<std::vector<uint8_t>>& compressed_frame)
+{
+	if (compressed_frame.size() != 3 && compressed_frame.size() != 4) {
+		return false;
+	}
+
+	// An empty payload keeps the last cursor.
+	if (!compressed_frame[2].empty() &&
+		!DX::ParseCursorState(compressed_frame[2].data(), compressed_frame[2].size(), &cursor_)) {
+		printf("[VideoSink] Parse cursor failed. \n");
+	}
+
+	if (compressed_frame[0].empty()) {
+		if (last_output_texture_ && last_output_texture_->GetTexture()) {
+			output_texture_ = last_output_texture_;
+			End();
+		}
+		return false;
+	}
+
+	return true;
+}
+
+void VideoSink::DrawCursor(ID3D11Texture2D* back_buffer)
+{
+	if (!cursor_.is_visible || !cursor_.shape || width_ <= 0 || height_ <= 0) {
+		return;
+	}
+
+	DX::PixelFormat format = DX::PIXEL_FORMAT_UNKNOW;
+	if (output_format_ == DXGI_FORMAT_R8G8B8A8_UNORM) {
+		format = DX::PIXEL_FORMAT_RGBA;
+	}
+	else if (output_format_ == DXGI_FORMAT_B8G8R8A8_UNORM) {
+		format = DX::PIXEL_FORMAT_ARGB;
+	}
+	else {
+		return;
+	}
+
+	// The frame is scaled to the window, the shape keeps its size and its hot
+	// spot follows the scaled frame.
+	const DX::CursorShape& shape = *cursor_.shape;
+	DX::CursorState cursor = cursor_;
+	cursor.x = static_cast<int>(static_cast<int64_t>(cursor_.x + shape.hot_x) * output_width_ / width_) - shape.hot_x;
+	cursor.y = static_cast<int>(static_cast<int64_t>(cursor_.y + shape.hot_y) * output_height_ / height_) - shape.hot_y;
+
+	DX::PixelRect rect;
+	if (!DX::GetCursorRect(cursor, output_width_, output_height_, &rect)) {
+		return;
+	}
+
+	if (shape.type == DX::CURSOR_SHAPE_COLOR && DrawColorCursor(back_buffer, cursor, rect)) {
+		return;
+	}
+
+	UINT width = static_cast<UINT>(rect.right - rect.left);
+	UINT height = static_cast<UINT>(rect.bottom - rect.top);
+
+	if (cursor_texture_) {
+		D3D11_TEXTURE2D_DESC desc;
+		cursor_texture_->GetDesc(&desc);
+		if (desc.Width < width || desc.Height < height || desc.Format != output_format_) {
+			DX_SAFE_RELEASE(cursor_texture_);
+		}
+	}
+
+	if (!cursor_texture_) {
+		D3D11_TEXTURE2D_DESC desc;
+		memset(&desc, 0, sizeof(D3D11_TEXTURE2D_DESC));
+		desc.Width = width;
+		desc.Height = height;
+		desc.MipLevels = 1;
+		desc.ArraySize = 1;
+		desc.Format = output_format_;
+		desc.SampleDesc.Count = 1;
+		desc.Usage = D3D11_USAGE_STAGING;
+		desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+		HRESULT hr = d3d11_device_->CreateTexture2D(&desc, NULL, &cursor_texture_);
+		if (FAILED(hr)) {
+			printf("[VideoSink] Create cursor texture failed. \n");
+			return;
+		}
+	}
+
+	D3D11_BOX box = { static_cast<UINT>(rect.left), static_cast<UINT>(rect.top), 0,
+		static_cast<UINT>(rect.right), static_cast<UINT>(rect.bottom), 1 };
+	d3d11_context_->CopySubresourceRegion(cursor_texture_, 0, 0, 0, 0, back_buffer, 0, &box);
+
+	D3D11_MAPPED_SUBRESOURCE mapped_resource = { 0 };
+	HRESULT hr = d3d11_context_->Map(cursor_texture_, 0, D3D11_MAP_READ, 0, &mapped_resource);
+	if (FAILED(hr)) {
+		return;
+	}
+
+	// The area under the cursor as a frame of its own.
+	DX::PixelFrame patch;
+	patch.width = static_cast<int>(width);
+	patch.height = static_cast<int>(height);
+	patch.format = format;
+	patch.plane[0] = static_cast<uint8_t*>(mapped_resource.pData);
+	patch.pitch[0] = static_cast<int>(mapped_resource.RowPitch);
+
+	cursor.x -= rect.left;
+	cursor.y -= rect.top;
+	const DX::PixelFrame* output = cursor_compositor_.Compose(&patch, std::vector<DX::PixelRect>(), false, cursor);
+	d3d11_context_->Unmap(cursor_texture_, 0);
+
+	if (output) {
+		d3d11_context_->UpdateSubresource(back_buffer, 0, &box, output->plane[0], output->pitch[0], 0);
+	}
+}
+
+bool VideoSink::DrawColorCursor(ID3D11Texture2D* back_buffer, const DX::CursorState& cursor, const DX::PixelRect& rect)
+{
+	const DX::CursorShape& shape = *cursor.shape;
+
+	if (cursor_shape_ != cursor.shape) {
+		cursor_shape_.reset();
+		DX_SAFE_RELEASE(cursor_shape_srv_);
+		DX_SAFE_RELEASE(cursor_shape_texture_);
+
+		if (shape.pitch < shape.width * 4 || shape.data.size() < static_cast<size_t>(shape.pitch) * shape.height) {
+			return false;
+		}
+
+		D3D11_TEXTURE2D_DESC desc;
+		memset(&desc, 0, sizeof(D3D11_TEXTURE2D_DESC));
+		desc.Width = shape.width;
+		desc.Height = shape.height;
+		desc.MipLevels = 1;
+		desc.ArraySize = 1;
+		desc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+		desc.SampleDesc.Count = 1;
+		desc.Usage = D3D11_USAGE_IMMUTABLE;
+		desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+		D3D11_SUBRESOURCE_DATA init_data = { 0 };
+		init_data.pSysMem = shape.data.data();
+		init_data.SysMemPitch = shape.pitch;
+
+		HRESULT hr = d3d11_device_->CreateTexture2D(&desc, &init_data, &cursor_shape_texture_);
+		if (FAILED(hr)) {
+			printf("[VideoSink] Create cursor shape texture failed. \n");
+			return false;
+		}
+
+		hr = d3d11_device_->CreateShaderResourceView(cursor_shape_texture_, NULL, &cursor_shape_srv_);
+		if (FAILED(hr)) {
+			printf("[VideoSink] Create cursor shape view failed. \n");
+			DX_SAFE_RELEASE(cursor_shape_texture_);
+			return false;
+		}
+		cursor_shape_ = cursor.shape;
+	}
+
+	if (!cursor_blend_state_) {
+		// Straight alpha over the frame, the back buffer alpha is kept.
+		D3D11_BLEND_DESC blend_desc;
+		memset(&blend_desc, 0, sizeof(D3D11_BLEND_DESC));
+		blend_desc.RenderTarget[0].BlendEnable = TRUE;
+		blend_desc.RenderTarget[0].SrcBlend = D3D11_BLEND_SRC_ALPHA;
+		blend_desc.RenderTarget[0].DestBlend = D3D11_BLEND_INV_SRC_ALPHA;
+		blend_desc.RenderTarget[0].BlendOp = D3D11_BLEND_OP_ADD;
+		blend_desc.RenderTarget[0].SrcBlendAlpha = D3D11_BLEND_ZERO;
+		blend_desc.RenderTarget[0].DestBlendAlpha = D3D11_BLEND_ONE;
+		blend_desc.RenderTarget[0].BlendOpAlpha = D3D11_BLEND_OP_ADD;
+		blend_desc.RenderTarget[0].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
+
+		HRESULT hr = d3d11_device_->CreateBlendState(&blend_desc, &cursor_blend_state_);
+		if (FAILED(hr)) {
+			printf("[VideoSink] Create cursor blend state failed. \n");
+			return false;
+		}
+	}
+
+	if (!cursor_target_) {
+		cursor_target_.reset(new DX::D3D11RenderTexture(d3d11_device_));
+		if (!cursor_target_->InitVertexShader() || !cursor_target_->InitRasterizerState() ||
+			!cursor_target_->InitPixelShader(NULL, shader_d3d11_pixel, sizeof(shader_d3d11_pixel))) {
+			cursor_target_.reset();
+			return false;
+		}
+	}
+
+	if (!cursor_target_->InitTexture(back_buffer)) {
+		return false;
+	}
+
+	// The quad covers the shape at its own size, the scissor clips it to the
+	// back buffer.
+	D3D11_VIEWPORT viewport;
+	viewport.TopLeftX = static_cast<FLOAT>(cursor.x);
+	viewport.TopLeftY = static_cast<FLOAT>(cursor.y);
+	viewport.Width = static_cast<FLOAT>(shape.width);
+	viewport.Height = static_cast<FLOAT>(shape.height);
+	viewport.MinDepth = 0.0f;
+	viewport.MaxDepth = 1.0f;
+	D3D11_RECT scissor_rect = { rect.left, rect.top, rect.right, rect.bottom };
+
+	d3d11_context_->OMSetBlendState(cursor_blend_state_, NULL, 0xffffffff);
+	cursor_target_->Begin(&scissor_rect, &viewport);
+	cursor_target_->PSSetTexture(0, cursor_shape_srv_);
+	cursor_target_->PSSetSamplers(0, point_sampler_);
+	cursor_target_->Draw();
+	cursor_target_->End();
+	cursor_target_->PSSetTexture(0, NULL);
+	d3d11_context_->OMSetBlendState(NULL, NULL, 0xffffffff);
+	return true;
+}
@@ -3,6 +3,7 @@
 #include "d3d11_renderer.h"
 #include "screen_capture.h"
 #include "d3d11va_decoder.h"
+#include "concurrent_decoder.h"
 #include "d3d11_yuv_to_rgb_converter.h"
 extern "C" {
 #include "libavformat/avformat.h"
@@ -16,6 +17,7 @@ public:
 
 	virtual bool Init(HWND hwnd, int width, int height);
 	virtual void Destroy();
+	virtual bool Resize();
 
 	virtual void RenderFrame(DX::Image& image);
 	virtual void RenderNV12(std::vector<std::vector<uint8_t>>& compressed_frame);
@@ -24,7 +26,40 @@ public:
 private:
 	virtual void End();
 
+	// Decodes compressed_frame[0] into yuv420_frame and, in parallel,
+	// compressed_frame[1] into chroma420_frame_ with its tile mask from
+	// compressed_frame[3]. An empty Chroma420 payload keeps the last frame and mask.
+	bool Decode(std::vector<std::vector<uint8_t>>& compressed_frame, std::shared_ptr<AVFrame>& yuv420_frame);
+
+	// Takes the cursor from compressed_frame[2]. A frame without a YUV420
+	// payload only moved the cursor, the last output is presented again.
+	bool UpdateCursor(std::vector<std::vector<uint8_t>>& compressed_frame);
+
+	// Puts cursor_ on the back buffer. Colour shapes are alpha blended on the
+	// GPU. Monochrome and masked colour shapes depend on the pixels under them,
+	// that area is read back, drawn by CursorCompositor and written again,
+	// which waits for the GPU to finish the frame.
+	void DrawCursor(ID3D11Texture2D* back_buffer);
+	bool DrawColorCursor(ID3D11Texture2D* back_buffer, const DX::CursorState& cursor, const DX::PixelRect& rect);
+	void ReleaseCursor();
+
 	std::shared_ptr<D3D11VADecoder> yuv420_decoder_;
 	std::shared_ptr<D3D11VADecoder> chroma420_decoder_;
+	ConcurrentDecoder concurrent_decoder_;
+	std::shared_ptr<AVFrame> chroma420_frame_;
+	DX::ChromaTileMask chroma420_mask_;
+	bool has_chroma420_mask_ = false;
 	std::shared_ptr<DX::D3D11YUVToRGBConverter> color_converter_;
+
+	DX::CursorState cursor_;
+	DX::CursorCompositor cursor_compositor_;
+	ID3D11Texture2D* cursor_texture_ = NULL;
+
+	// The colour shape in cursor_shape_texture_, uploaded once per shape.
+	std::shared_ptr<const DX::CursorShape> cursor_shape_;
+	ID3D11Texture2D* cursor_shape_texture_ = NULL;
+	ID3D11ShaderResourceView* cursor_shape_srv_ = NULL;
+	ID3D11BlendState* cursor_blend_state_ = NULL;
+	std::unique_ptr<DX::D3D11RenderTexture> cursor_target_;
+	DX::D3D11RenderTexture* last_output_texture_ = NULL;
 };
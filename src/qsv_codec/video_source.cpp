@@ -1,4 +1,11 @@
 #include "video_source.h"
+#include <chrono>
+
+static int64_t GetTimeUs()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
 
 VideoSource::VideoSource()
 {
@@ -56,6 +63,12 @@ bool VideoSource::Init()
 		return false;
 	}
 
+	tile_reducer_ = std::make_shared<DX::D3D11TileReducer>(d3d11_device);
+	if (!tile_reducer_->Init(video_width_, video_height_)) {
+		printf("init tile reducer failed. \n");
+		return false;
+	}
+
 	return true;
 }
 
@@ -65,6 +78,12 @@ void VideoSource::Destroy()
 		screen_capture_->Destroy();
 	}
 
+	concurrent_encoder_.Destroy();
+
+	if (tile_reducer_) {
+		tile_reducer_->Destroy();
+	}
+
 	if (color_converter_) {
 		color_converter_->Destroy();
 	}
@@ -99,7 +118,29 @@ bool VideoSource::Capture(std::vector<std::vector<uint8_t>>& compressed_frame)
 		printf("[VideoSource] Capture image failed. \n");
 		return false;
 	}
-	
+
+	// The sink keeps showing the last frame, nothing to convert or encode. A
+	// moved cursor is sent on its own and drawn on top by the sink.
+	int64_t now = GetTimeUs();
+	if (image.sequence == last_sequence_ && last_fingerprint_ == 0) {
+		// The fingerprint is read back after the frame, the encoded frame has it now.
+		last_fingerprint_ = image.fingerprint;
+	}
+
+	if (skip_unchanged_frames_ && image.fingerprint != 0 && image.fingerprint == last_fingerprint_) {
+		if (keep_alive_us_ <= 0 || now - last_encode_time_ < keep_alive_us_) {
+			skipped_frames_ += 1;
+			if (!IsCursorChanged(image.cursor)) {
+				return false;
+			}
+
+			compressed_frame.clear();
+			compressed_frame.resize(3);
+			SerializeCursor(image.cursor, compressed_frame[2]);
+			return true;
+		}
+	}
+
 	ID3D11Device* d3d11_device = qsv_device_->GetD3D11Device();
 	ID3D11Texture2D* argb_texture = NULL;
 
@@ -109,36 +150,155 @@ bool VideoSource::Capture(std::vector<std::vector<uint8_t>>& compressed_frame)
 		return false;
 	}
 
-	if (!color_converter_->Convert(argb_texture)) {
+	std::vector<uint8_t> chroma_mask_data;
+	const DX::ChromaTileMask* chroma_mask = NULL;
+	if (region_adaptive_chroma_ && ClassifyChroma(argb_texture)) {
+		chroma_mask = &chroma_mask_;
+		DX::SerializeChromaTileMask(chroma_mask_, chroma_mask_data);
+	}
+
+	if (!color_converter_->Convert(argb_texture, chroma_mask)) {
 		printf("[VideoSource] Convert image failed. \n");
 		argb_texture->Release();
 		return false;
 	}
 	argb_texture->Release();
 
+	// The sink rebuilds masked out tiles differently, so a new mask needs a new
+	// Chroma420 frame even when the samples are the same.
+	bool is_chroma_changed = true;
+	if (skip_unchanged_chroma_) {
+		is_chroma_changed = IsChroma420Changed() || chroma_mask_data != last_chroma_mask_data_;
+	}
+
 	std::vector<uint8_t> yuv420_frame;
 	std::vector<uint8_t> chroma420_frame;
-	int frame_size = 0;
 
-	frame_size = yuv420_encoder_->Encode(color_converter_->GetYUV420Texture(), yuv420_frame);
-	if (frame_size < 0) {
-		printf("[VideoSource] YUV420 Encoder encode failed. \n");
+	// Both streams are encoded at the same time, each on its own session.
+	EncodeTask tasks[2];
+	tasks[0].encoder = yuv420_encoder_.get();
+	tasks[0].input.texture = color_converter_->GetYUV420Texture();
+	tasks[0].out_frame = &yuv420_frame;
+	tasks[1].encoder = chroma420_encoder_.get();
+	tasks[1].input.texture = color_converter_->GetChroma420Texture();
+	tasks[1].out_frame = &chroma420_frame;
+	concurrent_encoder_.Run(tasks, is_chroma_changed ? 2 : 1);
+
+	// An empty Chroma420 payload is the unchanged marker, frames an encoder
+	// held back are not sent at all.
+	if (tasks[0].frame_size <= 0) {
+		if (tasks[0].frame_size < 0) {
+			printf("[VideoSource] YUV420 Encoder encode failed. \n");
+		}
+
+		if (is_chroma_changed && tasks[1].frame_size > 0) {
+			// The Chroma420 frame is dropped too, restart its stream on a key frame.
+			chroma420_encoder_->SetOption(QSV_ENCODER_OPTION_FORCE_IDR, 1);
+			ResetChroma420Tiles();
+		}
 		return false;
 	}
 
-	frame_size = chroma420_encoder_->Encode(color_converter_->GetChroma420Texture(), chroma420_frame);
-	if (frame_size < 0) {
-		printf("[VideoSource] Chroma420 Encoder encode failed. \n");
-		return false;
+	if (!is_chroma_changed) {
+		skipped_chroma_frames_ += 1;
+	}
+	else {
+		if (tasks[1].frame_size <= 0) {
+			// The compared texture already moved on, so the next frame is encoded regardless.
+			ResetChroma420Tiles();
+			if (tasks[1].frame_size < 0) {
+				printf("[VideoSource] Chroma420 Encoder encode failed. \n");
+			}
+			return false;
+		}
+		last_chroma_mask_data_ = chroma_mask_data;
 	}
 
+	last_fingerprint_ = image.fingerprint;
+	last_sequence_ = image.sequence;
+	last_encode_time_ = now;
+
+	std::vector<uint8_t> cursor_data;
+	SerializeCursor(image.cursor, cursor_data);
+
 	compressed_frame.clear();
 	compressed_frame.push_back(yuv420_frame);
 	compressed_frame.push_back(chroma420_frame);
+	compressed_frame.push_back(cursor_data);
+	if (region_adaptive_chroma_) {
+		compressed_frame.push_back(chroma_mask_data);
+	}
 
 	return true;
 }
 
+void VideoSource::SetSkipUnchangedFrames(bool enable, int keep_alive_ms, int sample_step)
+{
+	skip_unchanged_frames_ = enable;
+	keep_alive_us_ = static_cast<int64_t>(keep_alive_ms) * 1000;
+	last_fingerprint_ = 0;
+	if (screen_capture_) {
+		screen_capture_->SetFingerprint(enable ? sample_step : 0);
+	}
+}
+
+uint64_t VideoSource::GetSkippedFrames()
+{
+	return skipped_frames_;
+}
+
+void VideoSource::SetSkipUnchangedChroma(bool enable)
+{
+	skip_unchanged_chroma_ = enable;
+	ResetChroma420Tiles();
+}
+
+uint64_t VideoSource::GetSkippedChromaFrames()
+{
+	return skipped_chroma_frames_;
+}
+
+void VideoSource::SetRegionAdaptiveChroma(bool enable)
+{
+	region_adaptive_chroma_ = enable;
+	last_chroma_mask_data_.clear();
+	ResetChroma420Tiles();
+}
+
+bool VideoSource::ClassifyChroma(ID3D11Texture2D* argb_texture)
+{
+	// Classified on the GPU, only the per-tile results are read back.
+	return tile_reducer_->ClassifyChromaDetail(argb_texture, &chroma_mask_);
+}
+
+bool VideoSource::IsCursorChanged(const DX::CursorState& cursor)
+{
+	return cursor.is_visible != last_cursor_.is_visible || cursor.shape != last_cursor_.shape ||
+		(cursor.is_visible && (cursor.x != last_cursor_.x || cursor.y != last_cursor_.y));
+}
+
+void VideoSource::SerializeCursor(const DX::CursorState& cursor, std::vector<uint8_t>& data)
+{
+	// Only called for frames that are sent, the sink keeps the last shape.
+	DX::SerializeCursorState(cursor, cursor.shape && cursor.shape != last_cursor_.shape, data);
+	last_cursor_ = cursor;
+}
+
+bool VideoSource::IsChroma420Changed()
+{
+	// Compared with the last encoded Chroma420 texture on the GPU, only the
+	// per-tile results are read back.
+	int changed_tiles = tile_reducer_->UpdateNV12(color_converter_->GetChroma420Texture());
+	return changed_tiles != 0;
+}
+
+void VideoSource::ResetChroma420Tiles()
+{
+	if (tile_reducer_) {
+		tile_reducer_->Reset();
+	}
+}
+
 int VideoSource::GetWidth()
 {
 	return video_width_;
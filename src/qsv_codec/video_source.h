@@ -3,7 +3,10 @@
 #include "d3d11_screen_capture.h"
 #include "d3d11_qsv_device.h"
 #include "d3d11_qsv_encoder.h"
+#include "concurrent_encoder.h"
 #include "d3d11_rgb_to_yuv_converter.h"
+#include "d3d11_tile_reducer.h"
+#include "chroma_tile_mask.h"
 #include <memory>
 #include <vector>
 
@@ -17,12 +20,45 @@ public:
 	void Destroy();
 
 	bool Capture(DX::Image& image);
+
+	// compressed_frame[0] is the YUV420 frame and compressed_frame[1] the Chroma420
+	// frame. An empty compressed_frame[1] means the auxiliary chroma did not change
+	// and was not encoded, the previous Chroma420 frame still applies.
+	// compressed_frame[2] is the serialized DX::CursorState, with the shape only
+	// when it changed since the last sent one.
+	// With region adaptive chroma compressed_frame[3] is the serialized
+	// DX::ChromaTileMask of the Chroma420 frame, empty for the whole frame.
 	bool Capture(std::vector<std::vector<uint8_t>>& compressed_frame);
 
+	// Returns false without converting or encoding while the captured frame has
+	// the fingerprint of the last encoded one. If only the cursor changed the
+	// frame is still skipped and just compressed_frame[2] is sent, with empty
+	// YUV420 and Chroma420 payloads. An unchanged frame is still sent
+	// every keep_alive_ms, 0 never sends one. sample_step as in DX::HashFrame().
+	// The sampled tiles of every captured frame are read back to the CPU, with
+	// sample_step 1 that is the whole frame, about 20 MB per frame at 3440x1440
+	// even when it turns out unchanged. Use 4 or more for a live capture.
+	void SetSkipUnchangedFrames(bool enable, int keep_alive_ms = 1000, int sample_step = 1);
+	uint64_t GetSkippedFrames();
+
+	// Skip the Chroma420 encode when its tile hashes match the last encoded frame.
+	void SetSkipUnchangedChroma(bool enable);
+	uint64_t GetSkippedChromaFrames();
+
+	// Keep the Chroma420 samples only for tiles with colour detail, the rest
+	// is left neutral and rebuilt from upsampled 4:2:0 chroma by the sink.
+	void SetRegionAdaptiveChroma(bool enable);
+
 	int GetWidth();
 	int GetHeight();
 
 private:
+	bool IsChroma420Changed();
+	void ResetChroma420Tiles();
+	bool ClassifyChroma(ID3D11Texture2D* argb_texture);
+	bool IsCursorChanged(const DX::CursorState& cursor);
+	void SerializeCursor(const DX::CursorState& cursor, std::vector<uint8_t>& data);
+
 	std::shared_ptr<DX::ScreenCapture> screen_capture_;
 
 	std::shared_ptr<DX::D3D11RGBToYUVConverter> color_converter_;
@@ -30,6 +66,27 @@ private:
 	std::shared_ptr<D3D11QSVDevice>  qsv_device_;
 	std::shared_ptr<D3D11QSVEncoder> yuv420_encoder_;
 	std::shared_ptr<D3D11QSVEncoder> chroma420_encoder_;
+	ConcurrentEncoder concurrent_encoder_;
+
+	bool skip_unchanged_frames_ = false;
+	int64_t keep_alive_us_ = 0;
+	uint64_t last_fingerprint_ = 0;
+	uint64_t last_sequence_ = 0;
+	int64_t last_encode_time_ = 0;
+	uint64_t skipped_frames_ = 0;
+
+	// Cursor of the last sent frame, its shape is only sent again on a change.
+	DX::CursorState last_cursor_;
+
+	// Chroma420 tiles changed since the last encoded frame and colour detail
+	// tiles of the captured frame, both found on the GPU.
+	std::shared_ptr<DX::D3D11TileReducer> tile_reducer_;
+	bool skip_unchanged_chroma_ = false;
+	uint64_t skipped_chroma_frames_ = 0;
+
+	DX::ChromaTileMask chroma_mask_;
+	std::vector<uint8_t> last_chroma_mask_data_;
+	bool region_adaptive_chroma_ = false;
 
 	int video_width_ = 0;
 	int video_height_ = 0;
@@ -4,9 +4,28 @@
 
 #include "d3d11_screen_capture.h"
 #include <fstream> 
+#include <chrono>
 
 using namespace DX;
 
+// Bounds how long Destroy() waits for the capture thread.
+static const int kAcquireTimeoutMs = 100;
+
+// LastPresentTime is a QueryPerformanceCounter value, the clock behind
+// std::chrono::steady_clock, 0 when only the cursor changed.
+static int64_t GetPresentTimeUs(const LARGE_INTEGER& present_time)
+{
+	if (present_time.QuadPart == 0) {
+		return std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	return present_time.QuadPart / frequency.QuadPart * 1000000
+		+ present_time.QuadPart % frequency.QuadPart * 1000000 / frequency.QuadPart;
+}
+
 D3D11ScreenCapture::D3D11ScreenCapture()
 {
 	memset(&monitor_, 0, sizeof(DX::Monitor));
@@ -25,17 +44,20 @@ bool D3D11ScreenCapture::Init(int display_index)
 	}
 
 	display_index_ = display_index;
+	frame_signal_.Reset();
 
 	if (!InitD3D11()) {
 		goto failed;
 	}
 
 	is_started_ = true;
-	AcquireFrame();
+	AcquireFrame(0);
 	capture_thread_.reset(new std::thread([this] {
+		// Blocks in AcquireNextFrame() until the desktop changes.
 		while (is_started_) {
-			std::this_thread::sleep_for(std::chrono::milliseconds(10));
-			AcquireFrame();
+			if (AcquireFrame(kAcquireTimeoutMs) < -1) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
 		}
 	}));
 
@@ -123,7 +145,6 @@ bool D3D11ScreenCapture::InitD3D11()
 void D3D11ScreenCapture::CleanupD3D11()
 {
 	rgba_texture_.Reset();
-	gdi_texture_.Reset();
 	shared_texture_.Reset();
 	dxgi_output_duplication_.Reset();
 	d3d11_device_.Reset();
@@ -163,17 +184,6 @@ bool D3D11ScreenCapture::CreateTexture()
 		return false;
 	}
 
-	desc.Usage = D3D11_USAGE_DEFAULT;
-	desc.CPUAccessFlags = 0;
-	desc.BindFlags = D3D11_BIND_RENDER_TARGET;
-	desc.MiscFlags = D3D11_RESOURCE_MISC_GDI_COMPATIBLE;
-
-	hr = d3d11_device_->CreateTexture2D(&desc, nullptr, gdi_texture_.GetAddressOf());
-	if (FAILED(hr)) {
-		printf("[D3D11ScreenCapture] Failed to create texture.\n");
-		return false;
-	}
-
 	Microsoft::WRL::ComPtr<IDXGIResource> dxgi_resource;
 	hr = shared_texture_->QueryInterface(__uuidof(IDXGIResource), reinterpret_cast<void**>(dxgi_resource.GetAddressOf()));
 	if (FAILED(hr)) {
@@ -193,22 +203,24 @@ bool D3D11ScreenCapture::CreateTexture()
 void D3D11ScreenCapture::Destroy()
 {
 	is_started_ = false;
+	frame_signal_.Cancel();
 	if (capture_thread_) {
 		capture_thread_->join();
 		capture_thread_.reset();
 	}
 
 	CleanupD3D11();
+	frame_ring_.Clear();
 }
 
-int D3D11ScreenCapture::AcquireFrame()
+int D3D11ScreenCapture::AcquireFrame(int timeout_ms)
 {
 	Microsoft::WRL::ComPtr<IDXGIResource> dxgi_resource;
 	DXGI_OUTDUPL_FRAME_INFO frame_info;
 	memset(&frame_info, 0, sizeof(DXGI_OUTDUPL_FRAME_INFO));
 
 	dxgi_output_duplication_->ReleaseFrame();
-	HRESULT hr = dxgi_output_duplication_->AcquireNextFrame(0, &frame_info, dxgi_resource.GetAddressOf());
+	HRESULT hr = dxgi_output_duplication_->AcquireNextFrame(timeout_ms, &frame_info, dxgi_resource.GetAddressOf());
 
 	if (FAILED(hr)) {
 		if (hr == DXGI_ERROR_WAIT_TIMEOUT) {
@@ -223,9 +235,20 @@ int D3D11ScreenCapture::AcquireFrame()
 		return -3;
 	}
 
+	// The cursor is not drawn into the frame, consumers get its shape and
+	// position and put it on top themselves.
+	bool is_cursor_updated = UpdateCursor(frame_info);
+
 	if (frame_info.AccumulatedFrames == 0 ||
 		frame_info.LastPresentTime.QuadPart == 0) {
 		// No image update, only cursor moved.
+		if (is_cursor_updated && PublishCursor(GetPresentTimeUs(frame_info.LastMouseUpdateTime))) {
+			Image image;
+			if (Capture(image)) {
+				RunFrameCallback(image);
+			}
+		}
+		return 0;
 	}
 
 	if (!dxgi_resource.Get()) {
@@ -238,56 +261,83 @@ int D3D11ScreenCapture::AcquireFrame()
 		return -1;
 	}
 
-	d3d11_context_->CopyResource(gdi_texture_.Get(), output_texture.Get());
+	d3d11_context_->CopyResource(rgba_texture_.Get(), output_texture.Get());
 
-	Microsoft::WRL::ComPtr<IDXGISurface1> surface1;
-	hr = gdi_texture_->QueryInterface(__uuidof(IDXGISurface1), reinterpret_cast<void**>(surface1.GetAddressOf()));
-	if (FAILED(hr)) {
-		return -1;
-	}
+	DX::PixelFrame* frame = CaptureFrame(output_texture.Get());
+	if (frame) {
+		PublishFrame(frame, GetPresentTimeUs(frame_info.LastPresentTime));
 
-	CURSORINFO cursor_info = { 0 };
-	cursor_info.cbSize = sizeof(CURSORINFO);
-	if (GetCursorInfo(&cursor_info) == TRUE) {
-		if (cursor_info.flags == CURSOR_SHOWING) {
-			auto cursor_position = cursor_info.ptScreenPos;
-			auto cursor_size = cursor_info.cbSize;
-			HDC  hdc;
-			surface1->GetDC(FALSE, &hdc);
-			DrawIconEx(hdc, cursor_position.x - monitor_.left, cursor_position.y - monitor_.top,
-				cursor_info.hCursor, 0, 0, 0, 0, DI_NORMAL | DI_DEFAULTSIZE);
-			surface1->ReleaseDC(nullptr);
+		Image image;
+		if (Capture(image)) {
+			RunFrameCallback(image);
 		}
 	}
+	return 0;
+}
 
-	d3d11_context_->CopyResource(rgba_texture_.Get(), gdi_texture_.Get());
+bool D3D11ScreenCapture::UpdateCursor(const DXGI_OUTDUPL_FRAME_INFO& frame_info)
+{
+	// Position and visibility are only valid with a mouse update.
+	if (frame_info.LastMouseUpdateTime.QuadPart == 0) {
+		return false;
+	}
 
-	CaptureFrame();
-	return 0;
+	cursor_.is_visible = frame_info.PointerPosition.Visible != FALSE;
+	cursor_.x = frame_info.PointerPosition.Position.x;
+	cursor_.y = frame_info.PointerPosition.Position.y;
+
+	if (frame_info.PointerShapeBufferSize > 0) {
+		std::shared_ptr<DX::CursorShape> shape(new DX::CursorShape);
+		shape->data.resize(frame_info.PointerShapeBufferSize);
+
+		UINT size = 0;
+		DXGI_OUTDUPL_POINTER_SHAPE_INFO shape_info;
+		memset(&shape_info, 0, sizeof(shape_info));
+		HRESULT hr = dxgi_output_duplication_->GetFramePointerShape(frame_info.PointerShapeBufferSize,
+			shape->data.data(), &size, &shape_info);
+		if (SUCCEEDED(hr)) {
+			shape->type = static_cast<DX::CursorShapeType>(shape_info.Type);
+			shape->width = static_cast<int>(shape_info.Width);
+			shape->height = static_cast<int>(shape_info.Type == DXGI_OUTDUPL_POINTER_SHAPE_TYPE_MONOCHROME ?
+				shape_info.Height / 2 : shape_info.Height);
+			shape->pitch = static_cast<int>(shape_info.Pitch);
+			shape->hot_x = shape_info.HotSpot.x;
+			shape->hot_y = shape_info.HotSpot.y;
+			cursor_.shape = shape;
+		}
+	}
+
+	SetCursor(cursor_);
+	return true;
 }
 
-void D3D11ScreenCapture::CaptureFrame()
+PixelFrame* D3D11ScreenCapture::CaptureFrame(ID3D11Texture2D* output_texture)
 {
 	std::lock_guard<std::mutex> locker(mutex_);
 
+	DX::PixelFrame* frame = NULL;
 	D3D11_MAPPED_SUBRESOURCE dsec = { 0 };
 
 	HRESULT hr = d3d11_context_->Map(rgba_texture_.Get(), 0, D3D11_MAP_READ, 0, &dsec);
 	if (!FAILED(hr)) {
+		int image_width = (int)dxgi_desc_.ModeDesc.Width;
+		int image_height = (int)dxgi_desc_.ModeDesc.Height;
+
+		// Copied once, straight into a buffer the consumers get a view of.
 		if (dsec.pData != NULL) {
-			int image_width = (int)dxgi_desc_.ModeDesc.Width;
-			int image_height = (int)dxgi_desc_.ModeDesc.Height;
-			image_size_ = image_width * image_height * 4;
-			image_.reset(new uint8_t[image_size_], std::default_delete<uint8_t[]>());
+			frame = frame_ring_.BeginWrite(image_width, image_height, DX::PIXEL_FORMAT_ARGB);
+		}
 
+		if (frame) {
 			for (int y = 0; y < image_height; y++) {
-				memcpy(image_.get() + y * image_width * 4, (uint8_t*)dsec.pData + y * dsec.RowPitch, image_width * 4);
+				memcpy(frame->plane[0] + y * frame->pitch[0], (uint8_t*)dsec.pData + y * dsec.RowPitch, image_width * 4);
 			}
 		}
 		d3d11_context_->Unmap(rgba_texture_.Get(), 0);
 	}
 
-	d3d11_context_->CopyResource(shared_texture_.Get(), gdi_texture_.Get());
+	d3d11_context_->CopyResource(shared_texture_.Get(), output_texture);
+	return frame;
 }
 
 bool D3D11ScreenCapture::Capture(Image& image)
@@ -298,18 +348,10 @@ bool D3D11ScreenCapture::Capture(Image& image)
 		return false;
 	}
 
-	if (image_size_ == 0) {
+	if (!GetLatestFrame(image)) {
 		return false;
 	}
 
-	if (image.bgra.size() != image_size_) {
-		image.bgra.resize(image_size_);
-	}
-
-	image.bgra.assign(image_.get(), image_.get() + image_size_);
-	image.width = dxgi_desc_.ModeDesc.Width;
-	image.height = dxgi_desc_.ModeDesc.Height;
-
 	if (shared_handle_) {
 		image.shared_handle = shared_handle_;
 	}
@@ -358,9 +400,9 @@ bool D3D11ScreenCapture::SaveToFile(std::string pathname)
 
 	fp_out.write((char*)file_header, 54);
 
-	char* image_data = (char*)(&image.bgra[0]);
+	char* image_data = (char*)image.frame->plane[0];
 	for (int h = image_height - 1; h >= 0; h--) {
-		fp_out.write(image_data + h * image_width * 4, image_width * 4);
+		fp_out.write(image_data + h * image.frame->pitch[0], image_width * 4);
 	}
 
 	fp_out.close();
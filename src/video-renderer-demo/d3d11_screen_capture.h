@@ -34,8 +34,9 @@ private:
 	bool InitD3D11();
 	void CleanupD3D11();
 	bool CreateTexture();
-	int  AcquireFrame();
-	void CaptureFrame();
+	int  AcquireFrame(int timeout_ms);
+	bool UpdateCursor(const DXGI_OUTDUPL_FRAME_INFO& frame_info);
+	PixelFrame* CaptureFrame(ID3D11Texture2D* output_texture);
 
 	DX::Monitor monitor_;
 
@@ -44,8 +45,8 @@ private:
 	std::unique_ptr<std::thread> capture_thread_;
 
 	std::mutex mutex_;
-	std::shared_ptr<uint8_t> image_;
-	uint32_t image_size_;
+	// Capture thread only, shared with consumers through SetCursor().
+	CursorState cursor_;
 
 	// d3d resource
 	DXGI_OUTDUPL_DESC dxgi_desc_;
@@ -55,7 +56,6 @@ private:
 	Microsoft::WRL::ComPtr<IDXGIOutputDuplication> dxgi_output_duplication_;
 	Microsoft::WRL::ComPtr<ID3D11Texture2D>        shared_texture_;
 	Microsoft::WRL::ComPtr<ID3D11Texture2D>        rgba_texture_;
-	Microsoft::WRL::ComPtr<ID3D11Texture2D>        gdi_texture_;
 };
 
 }
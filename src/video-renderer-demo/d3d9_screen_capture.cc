@@ -1,4 +1,5 @@
 #include "d3d9_screen_capture.h"
+#include <chrono>
 
 using namespace DX;
 
@@ -81,6 +82,7 @@ void D3D9ScreenCapture::Destroy()
 	DX_SAFE_RELEASE(surface_);
 	DX_SAFE_RELEASE(d3d9_device_);
 	DX_SAFE_RELEASE(d3d9_);
+	frame_ring_.Clear();
 }
 
 bool D3D9ScreenCapture::Capture(Image& image)
@@ -92,11 +94,6 @@ bool D3D9ScreenCapture::Capture(Image& image)
 	int width  = monitor_.right - monitor_.left;
 	int height = monitor_.bottom - monitor_.top;
 
-	int image_size = width * height * 4;
-	if (image.bgra.size() != image_size) {
-		image.bgra.resize(image_size);
-	}
-
 	HRESULT hr = d3d9_device_->GetFrontBufferData(0, surface_);
 	if (FAILED(hr)) {
 		return false;
@@ -104,15 +101,29 @@ bool D3D9ScreenCapture::Capture(Image& image)
 
 	D3DLOCKED_RECT rect;
 	ZeroMemory(&rect, sizeof(rect));
-	if (surface_->LockRect(&rect, 0, 0) != S_OK) {
-		return true;
+	if (surface_->LockRect(&rect, 0, 0) == S_OK) {
+		DX::PixelFrame* frame = frame_ring_.BeginWrite(width, height, DX::PIXEL_FORMAT_ARGB);
+		if (frame) {
+			for (int y = 0; y < height; y++) {
+				memcpy(frame->plane[0] + y * frame->pitch[0], (uint8_t*)rect.pBits + y * rect.Pitch, width * 4);
+			}
+			PublishFrame(frame, std::chrono::duration_cast<std::chrono::microseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count());
+		}
+		surface_->UnlockRect();
 	}
 
-	image.width = width;
-	image.height = height;
-	image.bgra.assign((uint8_t*)rect.pBits, (uint8_t*)rect.pBits + image_size);
-
-	surface_->UnlockRect();
+	// Lock failed or all buffers still held by consumers: previous frame again.
+	if (!GetLatestFrame(image)) {
+		return false;
+	}
 
+	RunFrameCallback(image);
 	return true;
 }
+
+bool D3D9ScreenCapture::WaitForFrame(Image& image, int timeout_ms)
+{
+	// No capture thread, GetFrontBufferData() reads the current frame.
+	return Capture(image);
+}
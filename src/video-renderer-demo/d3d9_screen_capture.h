@@ -19,6 +19,7 @@ public:
 	virtual void Destroy();
 
 	virtual bool Capture(Image& image);
+	virtual bool WaitForFrame(Image& image, int timeout_ms);
 
 private:
 	DX::Monitor monitor_;
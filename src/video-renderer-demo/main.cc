@@ -19,122 +19,82 @@ static void GetWindowSize(HWND hwnd, int& width, int& height)
 	height = static_cast<int>(rect.bottom - rect.top);
 }
 
-static void RenderARGB(DX::Renderer* renderer, DX::Image argb_image)
+static void RenderARGB(DX::Renderer* renderer, const DX::PixelFrame* argb_frame)
 {
-	DX::PixelFrame pixel_frame;
-
-	pixel_frame.width = argb_image.width;
-	pixel_frame.height = argb_image.height;
-	pixel_frame.format = DX::PIXEL_FORMAT_ARGB;
-	pixel_frame.pitch[0] = argb_image.width * 4;
-	pixel_frame.plane[0] = &argb_image.bgra[0];
-
+	DX::PixelFrame pixel_frame = *argb_frame;
 	renderer->Render(&pixel_frame);
 }
 
-static void RenderI444(DX::Renderer* renderer, DX::Image argb_image)
+static void RenderI444(DX::Renderer* renderer, DX::PixelFramePool* pool, const DX::PixelFrame* argb_frame)
 {
 	DX::PixelFrame pixel_frame;
-
-	int dst_stride_y = argb_image.width;
-	int dst_stride_u = argb_image.width;
-	int dst_stride_v = argb_image.width;
-	std::unique_ptr<uint8_t> dst_y(new uint8_t[dst_stride_y * argb_image.height]);
-	std::unique_ptr<uint8_t> dst_u(new uint8_t[dst_stride_u * argb_image.height]);
-	std::unique_ptr<uint8_t> dst_v(new uint8_t[dst_stride_v * argb_image.height]);
+	if (!pool->Alloc(argb_frame->width, argb_frame->height, DX::PIXEL_FORMAT_I444, &pixel_frame)) {
+		return;
+	}
 
 	libyuv::ARGBToI444(
-		&argb_image.bgra[0], 
-		argb_image.width * 4,
-		dst_y.get(), 
-		dst_stride_y, 
-		dst_u.get(),
-		dst_stride_u,
-		dst_v.get(), 
-		dst_stride_v, 
-		argb_image.width, 
-		argb_image.height
+		argb_frame->plane[0],
+		argb_frame->pitch[0],
+		pixel_frame.plane[0], 
+		pixel_frame.pitch[0], 
+		pixel_frame.plane[1],
+		pixel_frame.pitch[1],
+		pixel_frame.plane[2], 
+		pixel_frame.pitch[2], 
+		argb_frame->width, 
+		argb_frame->height
 	);
 
-	pixel_frame.width = argb_image.width;
-	pixel_frame.height = argb_image.height;
-	pixel_frame.format = DX::PIXEL_FORMAT_I444;
-	pixel_frame.pitch[0] = dst_stride_y;
-	pixel_frame.pitch[1] = dst_stride_u;
-	pixel_frame.pitch[2] = dst_stride_v;
-	pixel_frame.plane[0] = dst_y.get();
-	pixel_frame.plane[1] = dst_u.get();
-	pixel_frame.plane[2] = dst_v.get();
-
+	pixel_frame.dirty_rects = argb_frame->dirty_rects;
+	pixel_frame.is_unchanged = argb_frame->is_unchanged;
 	renderer->Render(&pixel_frame);
 }
 
-static void RenderI420(DX::Renderer* renderer, DX::Image argb_image)
+static void RenderI420(DX::Renderer* renderer, DX::PixelFramePool* pool, const DX::PixelFrame* argb_frame)
 {
 	DX::PixelFrame pixel_frame;
-
-	int dst_stride_y = argb_image.width;
-	int dst_stride_u = (argb_image.width + 1) / 2;
-	int dst_stride_v = (argb_image.width + 1) / 2;
-	std::unique_ptr<uint8_t> dst_y(new uint8_t[dst_stride_y * argb_image.height]);
-	std::unique_ptr<uint8_t> dst_u(new uint8_t[dst_stride_u * argb_image.height / 2]);
-	std::unique_ptr<uint8_t> dst_v(new uint8_t[dst_stride_v * argb_image.height / 2]);
+	if (!pool->Alloc(argb_frame->width, argb_frame->height, DX::PIXEL_FORMAT_I420, &pixel_frame)) {
+		return;
+	}
 
 	libyuv::ARGBToI420(
-		&argb_image.bgra[0],
-		argb_image.width * 4,
-		dst_y.get(),
-		dst_stride_y,
-		dst_u.get(),
-		dst_stride_u,
-		dst_v.get(),
-		dst_stride_v,
-		argb_image.width,
-		argb_image.height
+		argb_frame->plane[0],
+		argb_frame->pitch[0],
+		pixel_frame.plane[0],
+		pixel_frame.pitch[0],
+		pixel_frame.plane[1],
+		pixel_frame.pitch[1],
+		pixel_frame.plane[2],
+		pixel_frame.pitch[2],
+		argb_frame->width,
+		argb_frame->height
 	);
 
-	pixel_frame.width = argb_image.width;
-	pixel_frame.height = argb_image.height;
-	pixel_frame.format = DX::PIXEL_FORMAT_I420;
-	pixel_frame.pitch[0] = dst_stride_y;
-	pixel_frame.pitch[1] = dst_stride_u;
-	pixel_frame.pitch[2] = dst_stride_v;
-	pixel_frame.plane[0] = dst_y.get();
-	pixel_frame.plane[1] = dst_u.get();
-	pixel_frame.plane[2] = dst_v.get();
-
+	pixel_frame.dirty_rects = argb_frame->dirty_rects;
+	pixel_frame.is_unchanged = argb_frame->is_unchanged;
 	renderer->Render(&pixel_frame);
 }
 
-static void RenderNV12(DX::Renderer* renderer, DX::Image argb_image)
+static void RenderNV12(DX::Renderer* renderer, DX::PixelFramePool* pool, const DX::PixelFrame* argb_frame)
 {
 	DX::PixelFrame pixel_frame;
-
-	int dst_stride_y  = argb_image.width;
-	int dst_stride_uv = argb_image.width;
-
-	std::unique_ptr<uint8_t> dst_y(new uint8_t[dst_stride_y * argb_image.height]);
-	std::unique_ptr<uint8_t> dst_uv(new uint8_t[dst_stride_uv * argb_image.height / 2]);
+	if (!pool->Alloc(argb_frame->width, argb_frame->height, DX::PIXEL_FORMAT_NV12, &pixel_frame)) {
+		return;
+	}
 
 	libyuv::ARGBToNV12(
-		&argb_image.bgra[0],
-		argb_image.width * 4,
-		dst_y.get(),
-		dst_stride_y,
-		dst_uv.get(),
-		dst_stride_uv,
-		argb_image.width,
-		argb_image.height
+		argb_frame->plane[0],
+		argb_frame->pitch[0],
+		pixel_frame.plane[0],
+		pixel_frame.pitch[0],
+		pixel_frame.plane[1],
+		pixel_frame.pitch[1],
+		argb_frame->width,
+		argb_frame->height
 	);
-	
-	pixel_frame.width    = argb_image.width;
-	pixel_frame.height   = argb_image.height;
-	pixel_frame.format   = DX::PIXEL_FORMAT_NV12;
-	pixel_frame.pitch[0] = dst_stride_y;
-	pixel_frame.pitch[1] = dst_stride_uv;
-	pixel_frame.plane[0] = dst_y.get();
-	pixel_frame.plane[1] = dst_uv.get();
 
+	pixel_frame.dirty_rects = argb_frame->dirty_rects;
+	pixel_frame.is_unchanged = argb_frame->is_unchanged;
 	renderer->Render(&pixel_frame);
 }
 
@@ -164,6 +124,9 @@ int main(int argc, char** argv)
 	ZeroMemory(&msg, sizeof(msg));
 
 	DX::PixelFormat render_format = DX::PIXEL_FORMAT_I420;
+	DX::PixelFramePool frame_pool;
+	DX::Image argb_image;
+	DX::CursorCompositor cursor_compositor;
 
 	while (msg.message != WM_QUIT) {
 		if (::PeekMessage(&msg, NULL, 0U, 0U, PM_REMOVE)) {
@@ -180,20 +143,42 @@ int main(int argc, char** argv)
 				renderer.Resize();
 			}
 
-			DX::Image argb_image;
-			if (screen_capture.Capture(argb_image)) {
-				if (render_format == DX::PIXEL_FORMAT_ARGB) {
-					RenderARGB(&renderer, argb_image);
+			// Keeps the window responsive while the desktop is idle.
+			uint64_t last_sequence = argb_image.sequence;
+			if (screen_capture.WaitForFrame(argb_image, 16)) {
+				// Damage is relative to the previous frame, redraw everything after a skipped one.
+				std::vector<DX::PixelRect> dirty_rects;
+				bool is_unchanged = false;
+				if (argb_image.sequence == last_sequence + 1) {
+					if (argb_image.is_cursor_only) {
+						is_unchanged = true;
+					}
+					else {
+						dirty_rects = argb_image.frame->dirty_rects;
+						is_unchanged = argb_image.frame->is_unchanged;
+					}
 				}
-				else if (render_format == DX::PIXEL_FORMAT_I444) {
-					RenderI444(&renderer, argb_image);
-				}
-				else if (render_format == DX::PIXEL_FORMAT_I420) {
-					RenderI420(&renderer, argb_image);
-				}
-				else if (render_format == DX::PIXEL_FORMAT_NV12) {
-					RenderNV12(&renderer, argb_image);
+
+				// The cursor comes as metadata, a cursor move only redraws its old and new area.
+				const DX::PixelFrame* argb_frame = cursor_compositor.Compose(argb_image.frame.get(),
+					dirty_rects, is_unchanged, argb_image.cursor);
+				if (argb_frame) {
+					if (render_format == DX::PIXEL_FORMAT_ARGB) {
+						RenderARGB(&renderer, argb_frame);
+					}
+					else if (render_format == DX::PIXEL_FORMAT_I444) {
+						RenderI444(&renderer, &frame_pool, argb_frame);
+					}
+					else if (render_format == DX::PIXEL_FORMAT_I420) {
+						RenderI420(&renderer, &frame_pool, argb_frame);
+					}
+					else if (render_format == DX::PIXEL_FORMAT_NV12) {
+						RenderNV12(&renderer, &frame_pool, argb_frame);
+					}
 				}
+
+				// Give the buffer back, only the sequence number is needed.
+				argb_image.frame.reset();
 			}
 		}
 	}
@@ -1,23 +1,51 @@
 #pragma once
 
+#include "renderer.h"
+#include "frame_ring.h"
+#include "frame_signal.h"
+#include "damage_detector.h"
+#include "cursor_overlay.h"
 #include <cstdint>
-#include <vector>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#ifdef _WIN32
 #include <Windows.h>
+#else
+typedef void* HANDLE;
+#endif
 
 namespace DX {
 
 struct Image
 {
-	std::vector<uint8_t> bgra;
+	// Read-only view of a ring buffer, PIXEL_FORMAT_ARGB (BGRA byte order).
+	// Hold it only as long as needed, the capturer reuses the buffer afterwards.
+	// frame->dirty_rects and frame->is_unchanged hold the damage since frame
+	// sequence - 1.
+	std::shared_ptr<const PixelFrame> frame;
 	int width;
 	int height;
 
+	// Frame number from 1, and capture time in steady clock microseconds.
+	uint64_t sequence = 0;
+	int64_t  timestamp = 0;
+
+	// Cursor on top of the frame, it is not drawn into frame or shared_handle.
+	// is_cursor_only: only the cursor changed since sequence - 1, frame is the
+	// same as before.
+	CursorState cursor;
+	bool is_cursor_only = false;
+
 	HANDLE shared_handle;
 };
 
 class ScreenCapture
 {
 public:
+	typedef std::function<void(const Image& image)> FrameCallback;
+
 	ScreenCapture& operator=(const ScreenCapture&) = delete;
 	ScreenCapture(const ScreenCapture&) = delete;
 	ScreenCapture() {}
@@ -28,8 +56,112 @@ public:
 
 	virtual bool Capture(Image& image) = 0;
 
+	// Blocks until a frame newer than image.sequence was captured, then fills
+	// image like Capture(). Fails on timeout and after Destroy().
+	virtual bool WaitForFrame(Image& image, int timeout_ms)
+	{
+		if (!frame_signal_.Wait(image.sequence, timeout_ms)) {
+			return false;
+		}
+		return Capture(image);
+	}
+
+	// Runs on the capture thread for every new frame, keep it short.
+	void SetFrameCallback(const FrameCallback& callback)
+	{
+		std::lock_guard<std::mutex> locker(callback_mutex_);
+		frame_callback_ = callback;
+	}
+
 protected:
+	// Capture thread: publishes the frame from frame_ring_.BeginWrite() and
+	// wakes WaitForFrame(). Without dirty rects from the source, they are
+	// found by comparing with the previous frame.
+	void PublishFrame(PixelFrame* frame, int64_t timestamp_us)
+	{
+		// Only the capture thread publishes, the latest frame stays put meanwhile.
+		if (frame->dirty_rects.empty() && !frame->is_unchanged) {
+			std::shared_ptr<const PixelFrame> last_frame = frame_ring_.GetLatest();
+			int changed_tiles = damage_detector_.Detect(last_frame.get(), frame);
+			if (changed_tiles > 0) {
+				frame->dirty_rects = damage_detector_.GetDamageRects();
+			}
+			else if (changed_tiles == 0) {
+				frame->is_unchanged = true;
+			}
+		}
+
+		std::lock_guard<std::mutex> locker(frame_mutex_);
+		frame_ring_.EndWrite();
+		is_cursor_only_ = false;
+		frame_signal_.Notify(timestamp_us);
+	}
+
+	// Capture thread: cursor for the next published frame or cursor update.
+	void SetCursor(const CursorState& cursor)
+	{
+		std::lock_guard<std::mutex> locker(frame_mutex_);
+		cursor_ = cursor;
+	}
+
+	// Capture thread: wakes WaitForFrame() for a cursor update, the frame stays
+	// the same. False before the first frame.
+	bool PublishCursor(int64_t timestamp_us)
+	{
+		std::lock_guard<std::mutex> locker(frame_mutex_);
+		if (!frame_ring_.GetLatest()) {
+			return false;
+		}
+
+		is_cursor_only_ = true;
+		frame_signal_.Notify(timestamp_us);
+		return true;
+	}
+
+	// Hands a new frame to the frame callback, call it without holding locks
+	// that Capture() takes.
+	void RunFrameCallback(const Image& image)
+	{
+		FrameCallback callback;
+		{
+			std::lock_guard<std::mutex> locker(callback_mutex_);
+			callback = frame_callback_;
+		}
+
+		if (callback) {
+			callback(image);
+		}
+	}
+
+	// Latest published frame with its sequence number and timestamp.
+	bool GetLatestFrame(Image& image)
+	{
+		std::lock_guard<std::mutex> locker(frame_mutex_);
+
+		std::shared_ptr<const PixelFrame> frame = frame_ring_.GetLatest();
+		if (!frame) {
+			return false;
+		}
+
+		image.frame = frame;
+		image.width = frame->width;
+		image.height = frame->height;
+		image.sequence = frame_signal_.GetSequence(&image.timestamp);
+		image.cursor = cursor_;
+		image.is_cursor_only = is_cursor_only_;
+		return true;
+	}
+
+	FrameRing frame_ring_;
+	FrameSignal frame_signal_;
 
+private:
+	std::mutex frame_mutex_;
+	CursorState cursor_;
+	bool is_cursor_only_ = false;
+	DamageDetector damage_detector_;
+	std::mutex callback_mutex_;
+	FrameCallback frame_callback_;
 };
 
 }
@@ -0,0 +1,160 @@
+#include "synthetic_screen_capture.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+using namespace DX;
+
+static int64_t GetTimeUs()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+SyntheticScreenCapture::SyntheticScreenCapture(int width, int height, int fps, std::string pathname)
+	: width_(width)
+	, height_(height)
+	, fps_(fps > 0 ? fps : 60)
+	, pathname_(pathname)
+{
+
+}
+
+SyntheticScreenCapture::~SyntheticScreenCapture()
+{
+	Destroy();
+}
+
+bool SyntheticScreenCapture::Init(int /*display_index*/)
+{
+	if (is_started_) {
+		return true;
+	}
+
+	if (width_ <= 0 || height_ <= 0) {
+		return false;
+	}
+
+	if (!pathname_.empty()) {
+		file_.open(pathname_.c_str(), std::ios::in | std::ios::binary);
+		if (!file_) {
+			printf("[SyntheticScreenCapture] open %s failed.\n", pathname_.c_str());
+			return false;
+		}
+	}
+
+	frame_signal_.Reset();
+	is_started_ = true;
+	capture_thread_.reset(new std::thread(&SyntheticScreenCapture::CaptureThread, this));
+	return true;
+}
+
+void SyntheticScreenCapture::Destroy()
+{
+	is_started_ = false;
+	frame_signal_.Cancel();
+	if (capture_thread_) {
+		capture_thread_->join();
+		capture_thread_.reset();
+	}
+
+	if (file_.is_open()) {
+		file_.close();
+	}
+	frame_ring_.Clear();
+}
+
+bool SyntheticScreenCapture::Capture(Image& image)
+{
+	if (!is_started_) {
+		return false;
+	}
+
+	if (!GetLatestFrame(image)) {
+		return false;
+	}
+
+	image.shared_handle = NULL;
+	return true;
+}
+
+void SyntheticScreenCapture::CaptureThread()
+{
+	const int64_t interval_us = 1000000 / fps_;
+	int64_t next_time_us = GetTimeUs();
+
+	while (is_started_) {
+		PixelFrame* frame = frame_ring_.BeginWrite(width_, height_, PIXEL_FORMAT_ARGB);
+		if (frame) {
+			if (file_.is_open()) {
+				if (!ReadFrame(frame)) {
+					frame_ring_.EndWrite(false);
+					break;
+				}
+			}
+			else {
+				DrawFrame(frame, frame_signal_.GetSequence() + 1);
+			}
+
+			PublishFrame(frame, GetTimeUs());
+
+			Image image;
+			if (Capture(image)) {
+				RunFrameCallback(image);
+			}
+		}
+
+		// Fixed rate, a late frame does not shift the ones after it.
+		next_time_us += interval_us;
+		int64_t wait_us = next_time_us - GetTimeUs();
+		if (wait_us > 0) {
+			std::this_thread::sleep_for(std::chrono::microseconds(wait_us));
+		}
+		else {
+			next_time_us = GetTimeUs();
+		}
+	}
+}
+
+bool SyntheticScreenCapture::ReadFrame(PixelFrame* frame)
+{
+	for (int pass = 0; pass < 2; pass++) {
+		int y = 0;
+		for (; y < height_; y++) {
+			if (!file_.read(reinterpret_cast<char*>(frame->plane[0] + y * frame->pitch[0]), width_ * 4)) {
+				break;
+			}
+		}
+
+		if (y == height_) {
+			return true;
+		}
+
+		// End of file, start over.
+		file_.clear();
+		file_.seekg(0, std::ios::beg);
+	}
+
+	printf("[SyntheticScreenCapture] %s holds no complete %dx%d frame.\n", pathname_.c_str(), width_, height_);
+	return false;
+}
+
+void SyntheticScreenCapture::DrawFrame(PixelFrame* frame, uint64_t sequence)
+{
+	// Vertical bar moving one column per frame over a horizontal gradient.
+	int bar_x = static_cast<int>(sequence % width_);
+
+	for (int y = 0; y < height_; y++) {
+		uint8_t* row = frame->plane[0] + y * frame->pitch[0];
+		for (int x = 0; x < width_; x++) {
+			uint8_t value = static_cast<uint8_t>(x * 255 / width_);
+			row[x * 4 + 0] = value;
+			row[x * 4 + 1] = static_cast<uint8_t>(y * 255 / height_);
+			row[x * 4 + 2] = x == bar_x ? 255 : value;
+			row[x * 4 + 3] = 255;
+		}
+	}
+
+	uint32_t tag = static_cast<uint32_t>(sequence);
+	memcpy(frame->plane[0], &tag, sizeof(tag));
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "screen_capture.h"
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace DX {
+
+// Produces frames on its own thread at a fixed rate, without a display.
+// Frames are read from a file of raw BGRA frames (width * height * 4 bytes
+// each, looped) or, without a file, drawn as a moving test pattern whose
+// first pixel holds the low 32 bits of the sequence number.
+class SyntheticScreenCapture : public ScreenCapture
+{
+public:
+	SyntheticScreenCapture(int width = 1920, int height = 1080, int fps = 60, std::string pathname = "");
+	virtual ~SyntheticScreenCapture();
+
+	virtual bool Init(int display_index = 0);
+	virtual void Destroy();
+
+	virtual bool Capture(Image& image);
+
+private:
+	void CaptureThread();
+	bool ReadFrame(PixelFrame* frame);
+	void DrawFrame(PixelFrame* frame, uint64_t sequence);
+
+	int width_ = 0;
+	int height_ = 0;
+	int fps_ = 0;
+	std::string pathname_;
+	std::ifstream file_;
+
+	std::atomic<bool> is_started_{ false };
+	std::unique_ptr<std::thread> capture_thread_;
+};
+
+}
@@ -0,0 +1,120 @@
+#include "async_renderer.h"
+#include "log.h"
+
+#include <chrono>
+
+using namespace DX;
+
+static int64_t GetTimeUs()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+AsyncRenderer::AsyncRenderer()
+{
+
+}
+
+AsyncRenderer::~AsyncRenderer()
+{
+	Destroy();
+}
+
+bool AsyncRenderer::Init(Renderer* renderer)
+{
+	if (is_running_ || !renderer) {
+		return false;
+	}
+
+	renderer_ = renderer;
+	is_running_ = true;
+	render_thread_ = std::thread(&AsyncRenderer::RenderThread, this);
+	return true;
+}
+
+void AsyncRenderer::Destroy()
+{
+	if (!is_running_) {
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> locker(wait_mutex_);
+		is_running_ = false;
+	}
+	wait_cond_.notify_one();
+
+	if (render_thread_.joinable()) {
+		render_thread_.join();
+	}
+
+	QueuedFrame queued_frame;
+	mailbox_.Fetch(queued_frame);
+	renderer_ = NULL;
+}
+
+void AsyncRenderer::RenderAsync(const PixelFrame& frame)
+{
+	if (!is_running_) {
+		return;
+	}
+
+	QueuedFrame queued_frame;
+	if (frame.storage) {
+		queued_frame.frame = frame;
+	}
+	else if (!frame_pool_.Clone(&frame, &queued_frame.frame)) {
+		return;
+	}
+
+	queued_frame.submit_time = GetTimeUs();
+	queued_frame.sequence = ++sequence_;
+	mailbox_.Post(std::move(queued_frame));
+
+	// Not taking wait_mutex_ keeps the producer from blocking, a missed
+	// wakeup costs at most one wait timeout.
+	wait_cond_.notify_one();
+}
+
+RenderQueueStats AsyncRenderer::GetStats()
+{
+	std::lock_guard<std::mutex> locker(stats_mutex_);
+
+	RenderQueueStats stats = stats_;
+	stats.submitted_frames = mailbox_.GetPostedCount();
+	stats.dropped_frames = mailbox_.GetDroppedCount();
+	return stats;
+}
+
+void AsyncRenderer::RenderThread()
+{
+	uint64_t last_sequence = 0;
+
+	while (is_running_) {
+		QueuedFrame queued_frame;
+		if (!mailbox_.Fetch(queued_frame)) {
+			std::unique_lock<std::mutex> locker(wait_mutex_);
+			wait_cond_.wait_for(locker, std::chrono::milliseconds(2), [this] {
+				return !is_running_ || mailbox_.HasItem();
+			});
+			continue;
+		}
+
+		// Damage of dropped frames is unknown here, redraw everything.
+		if (queued_frame.sequence != last_sequence + 1) {
+			queued_frame.frame.dirty_rects.clear();
+			queued_frame.frame.is_unchanged = false;
+		}
+		last_sequence = queued_frame.sequence;
+
+		int64_t start_time = GetTimeUs();
+		renderer_->Render(&queued_frame.frame);
+		int64_t end_time = GetTimeUs();
+
+		std::lock_guard<std::mutex> locker(stats_mutex_);
+		stats_.rendered_frames += 1;
+		stats_.queue_latency.Add(start_time - queued_frame.submit_time);
+		stats_.render_latency.Add(end_time - queued_frame.submit_time);
+	}
+}
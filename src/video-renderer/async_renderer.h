@@ -0,0 +1,69 @@
+#pragma once
+
+#include "renderer.h"
+#include "frame_mailbox.h"
+#include "latency_histogram.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace DX {
+
+struct RenderQueueStats
+{
+	uint64_t submitted_frames = 0;
+	uint64_t rendered_frames  = 0;
+	uint64_t dropped_frames   = 0;
+
+	// RenderAsync() to the start of Render().
+	LatencyHistogram queue_latency;
+	// RenderAsync() to the end of Render().
+	LatencyHistogram render_latency;
+};
+
+// Runs Renderer::Render() on its own thread. Only the latest frame is kept,
+// frames replaced before they were rendered are dropped.
+class AsyncRenderer
+{
+public:
+	AsyncRenderer();
+	virtual ~AsyncRenderer();
+
+	// renderer must be initialized and outlive this object.
+	bool Init(Renderer* renderer);
+	void Destroy();
+
+	// Never waits for the renderer. A frame without storage is copied into
+	// a pooled buffer first, so the caller may reuse its planes on return.
+	void RenderAsync(const PixelFrame& frame);
+
+	RenderQueueStats GetStats();
+
+private:
+	struct QueuedFrame
+	{
+		PixelFrame frame;
+		int64_t    submit_time = 0;
+		uint64_t   sequence = 0;
+	};
+
+	void RenderThread();
+
+	Renderer* renderer_ = NULL;
+
+	std::atomic<bool> is_running_{ false };
+	std::thread render_thread_;
+	std::mutex wait_mutex_;
+	std::condition_variable wait_cond_;
+
+	FrameMailbox<QueuedFrame> mailbox_;
+	PixelFramePool frame_pool_;
+	uint64_t sequence_ = 0;
+
+	std::mutex stats_mutex_;
+	RenderQueueStats stats_;
+};
+
+}
@@ -0,0 +1,241 @@
+#include "chroma_tile_mask.h"
+#include "worker_pool.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define CHROMA_TILE_MASK_SSE2 1
+#include <emmintrin.h>
+#endif
+
+using namespace DX;
+
+// Frames smaller than this are classified on the calling thread.
+static const int64_t kMinParallelPixels = 512 * 512;
+
+static inline int Spread(int a, int b, int c, int d)
+{
+	int max_value = a > b ? a : b;
+	max_value = max_value > c ? max_value : c;
+	max_value = max_value > d ? max_value : d;
+	int min_value = a < b ? a : b;
+	min_value = min_value < c ? min_value : c;
+	min_value = min_value < d ? min_value : d;
+	return max_value - min_value;
+}
+
+// p0, p1 of row 0 and p2, p3 of row 1.
+static inline bool IsDetailBlock(const uint8_t* p0, const uint8_t* p1, const uint8_t* p2, const uint8_t* p3, int threshold)
+{
+	int b = Spread(p0[0] - p0[1], p1[0] - p1[1], p2[0] - p2[1], p3[0] - p3[1]);
+	int r = Spread(p0[2] - p0[1], p1[2] - p1[1], p2[2] - p2[1], p3[2] - p3[1]);
+	return b > threshold || r > threshold;
+}
+
+#ifdef CHROMA_TILE_MASK_SSE2
+// B-G, 0, R-G, A-G of two pixels as int16.
+static inline __m128i ChromaDiff(__m128i pixels)
+{
+	__m128i g = _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels, _MM_SHUFFLE(1, 1, 1, 1)), _MM_SHUFFLE(1, 1, 1, 1));
+	return _mm_sub_epi16(pixels, g);
+}
+
+// Spread over the 2x2 block, repeated in both halves.
+static inline __m128i BlockSpread(__m128i row0, __m128i row1)
+{
+	__m128i d0 = ChromaDiff(row0);
+	__m128i d1 = ChromaDiff(row1);
+	__m128i max_value = _mm_max_epi16(d0, d1);
+	__m128i min_value = _mm_min_epi16(d0, d1);
+	max_value = _mm_max_epi16(max_value, _mm_shuffle_epi32(max_value, _MM_SHUFFLE(1, 0, 3, 2)));
+	min_value = _mm_min_epi16(min_value, _mm_shuffle_epi32(min_value, _MM_SHUFFLE(1, 0, 3, 2)));
+	return _mm_sub_epi16(max_value, min_value);
+}
+#endif
+
+// Number of detail blocks in pixels [0, width) of a row pair.
+static int CountDetailBlocks(const uint8_t* row0, const uint8_t* row1, int width, int threshold)
+{
+	int count = 0;
+	int x = 0;
+
+#ifdef CHROMA_TILE_MASK_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i limit = _mm_set1_epi16(static_cast<short>(threshold));
+	for (; x + 4 <= width; x += 4) {
+		__m128i a = _mm_loadu_si128((const __m128i*)(row0 + x * 4));
+		__m128i b = _mm_loadu_si128((const __m128i*)(row1 + x * 4));
+		__m128i spread0 = BlockSpread(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+		__m128i spread1 = BlockSpread(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+
+		// Lanes 0 and 2 are B-G and R-G of each block, alpha is ignored.
+		int bits = _mm_movemask_epi8(_mm_cmpgt_epi16(_mm_unpacklo_epi64(spread0, spread1), limit));
+		count += ((bits & 0x0033) != 0) + ((bits & 0x3300) != 0);
+	}
+#endif
+
+	for (; x < width; x += 2) {
+		int x1 = x + 1 < width ? x + 1 : x;
+		count += IsDetailBlock(row0 + x * 4, row0 + x1 * 4, row1 + x * 4, row1 + x1 * 4, threshold);
+	}
+
+	return count;
+}
+
+static void ClassifyTileRow(const PixelFrame* frame, ChromaTileMask* mask, int ty, int threshold, int min_blocks)
+{
+	int tile_size = mask->tile_size;
+	int top = ty * tile_size;
+	int bottom = top + tile_size < frame->height ? top + tile_size : frame->height;
+
+	for (int tx = 0; tx < mask->tiles_x; tx++) {
+		int left = tx * tile_size;
+		int right = left + tile_size < frame->width ? left + tile_size : frame->width;
+
+		int count = 0;
+		for (int y = top; y < bottom && count < min_blocks; y += 2) {
+			const uint8_t* row0 = frame->plane[0] + y * frame->pitch[0] + left * 4;
+			const uint8_t* row1 = y + 1 < bottom ? row0 + frame->pitch[0] : row0;
+			count += CountDetailBlocks(row0, row1, right - left, threshold);
+		}
+
+		mask->tiles[ty * mask->tiles_x + tx] = count >= min_blocks ? 1 : 0;
+	}
+}
+
+int ChromaTileMask::GetCount() const
+{
+	int count = 0;
+	for (uint8_t tile : tiles) {
+		count += tile ? 1 : 0;
+	}
+	return count;
+}
+
+bool ChromaTileMask::Matches(int width, int height) const
+{
+	return tile_size >= 4 && tile_size % 4 == 0 &&
+		tiles_x == (width + tile_size - 1) / tile_size &&
+		tiles_y == (height + tile_size - 1) / tile_size &&
+		tiles.size() == static_cast<size_t>(tiles_x) * tiles_y;
+}
+
+void DX::ClassifyChromaDetail(const PixelFrame* frame, ChromaTileMask* mask, int threshold, int min_blocks)
+{
+	if (mask->tile_size < 4 || mask->tile_size % 4 != 0) {
+		mask->tile_size = 64;
+	}
+
+	mask->tiles_x = (frame->width + mask->tile_size - 1) / mask->tile_size;
+	mask->tiles_y = (frame->height + mask->tile_size - 1) / mask->tile_size;
+	mask->tiles.assign(static_cast<size_t>(mask->tiles_x) * mask->tiles_y, 1);
+
+	if (frame->format != PIXEL_FORMAT_ARGB || min_blocks <= 0) {
+		return;
+	}
+
+	int num_tasks = 1;
+	if (static_cast<int64_t>(frame->width) * frame->height >= kMinParallelPixels) {
+		num_tasks = mask->tiles_y;
+	}
+
+	if (num_tasks <= 1) {
+		for (int ty = 0; ty < mask->tiles_y; ty++) {
+			ClassifyTileRow(frame, mask, ty, threshold, min_blocks);
+		}
+		return;
+	}
+
+	WorkerPool::Instance().Run(num_tasks, [=](int ty) {
+		ClassifyTileRow(frame, mask, ty, threshold, min_blocks);
+	});
+}
+
+void DX::GetChromaTileRuns(const ChromaTileMask& mask, int width, int height, bool is_set, std::vector<PixelRect>& rects)
+{
+	rects.clear();
+
+	for (int ty = 0; ty < mask.tiles_y; ty++) {
+		int tx = 0;
+		while (tx < mask.tiles_x) {
+			if (mask.IsSet(tx, ty) != is_set) {
+				tx++;
+				continue;
+			}
+
+			int first = tx;
+			while (tx < mask.tiles_x && mask.IsSet(tx, ty) == is_set) {
+				tx++;
+			}
+
+			PixelRect rect;
+			rect.left = first * mask.tile_size;
+			rect.top = ty * mask.tile_size;
+			rect.right = tx * mask.tile_size < width ? tx * mask.tile_size : width;
+			rect.bottom = rect.top + mask.tile_size < height ? rect.top + mask.tile_size : height;
+			if (rect.left < rect.right && rect.top < rect.bottom) {
+				rects.push_back(rect);
+			}
+		}
+	}
+}
+
+void DX::GetChroma420Rects(int width, const PixelRect& rect, PixelRect y_rects[2], PixelRect uv_rects[2])
+{
+	// B4 B5: odd columns, U in the left half of the Y plane and V in the right half.
+	// B6-B9: even columns of odd rows, two per UV pair, U then V halves.
+	for (int i = 0; i < 2; i++) {
+		y_rects[i].left = i * width / 2 + rect.left / 2;
+		y_rects[i].right = i * width / 2 + rect.right / 2;
+		y_rects[i].top = rect.top;
+		y_rects[i].bottom = rect.bottom;
+
+		uv_rects[i].left = i * width / 4 + rect.left / 4;
+		uv_rects[i].right = i * width / 4 + rect.right / 4;
+		uv_rects[i].top = rect.top / 2;
+		uv_rects[i].bottom = rect.bottom / 2;
+	}
+}
+
+void DX::SerializeChromaTileMask(const ChromaTileMask& mask, std::vector<uint8_t>& data)
+{
+	size_t count = mask.tiles.size();
+	data.assign(6 + (count + 7) / 8, 0);
+
+	int header[3] = { mask.tile_size, mask.tiles_x, mask.tiles_y };
+	for (int i = 0; i < 3; i++) {
+		data[i * 2] = static_cast<uint8_t>(header[i] & 0xff);
+		data[i * 2 + 1] = static_cast<uint8_t>((header[i] >> 8) & 0xff);
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (mask.tiles[i]) {
+			data[6 + i / 8] |= static_cast<uint8_t>(1 << (i % 8));
+		}
+	}
+}
+
+bool DX::ParseChromaTileMask(const uint8_t* data, size_t size, ChromaTileMask* mask)
+{
+	if (size < 6) {
+		return false;
+	}
+
+	int header[3];
+	for (int i = 0; i < 3; i++) {
+		header[i] = data[i * 2] | (data[i * 2 + 1] << 8);
+	}
+
+	size_t count = static_cast<size_t>(header[1]) * header[2];
+	if (header[0] < 4 || header[0] % 4 != 0 || size != 6 + (count + 7) / 8) {
+		return false;
+	}
+
+	mask->tile_size = header[0];
+	mask->tiles_x = header[1];
+	mask->tiles_y = header[2];
+	mask->tiles.resize(count);
+	for (size_t i = 0; i < count; i++) {
+		mask->tiles[i] = (data[6 + i / 8] >> (i % 8)) & 1;
+	}
+
+	return true;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "renderer.h"
+#include <cstdint>
+#include <vector>
+
+namespace DX {
+
+// Tiles of a frame that need full 4:4:4 chroma. Outside the mask the Chroma420
+// samples are left neutral (cheap to encode) and combiners fall back to
+// upsampled 4:2:0 chroma.
+struct ChromaTileMask
+{
+	int tile_size = 64;  // luma pixels, multiple of 4
+	int tiles_x = 0;
+	int tiles_y = 0;
+	std::vector<uint8_t> tiles;  // tiles_x * tiles_y, 1 for 4:4:4
+
+	bool IsSet(int tx, int ty) const { return tiles[ty * tiles_x + tx] != 0; }
+	int GetCount() const;
+
+	// True when the tile grid covers a width x height frame.
+	bool Matches(int width, int height) const;
+};
+
+// Marks tiles of an ARGB frame where at least min_blocks 2x2 blocks have a
+// B-G or R-G spread above threshold, i.e. where 4:2:0 would smear colour.
+// Other formats mark every tile.
+void ClassifyChromaDetail(const PixelFrame* frame, ChromaTileMask* mask, int threshold = 16, int min_blocks = 4);
+
+// Horizontal runs of tiles that are set (or not set), clipped to width x height.
+void GetChromaTileRuns(const ChromaTileMask& mask, int width, int height, bool is_set, std::vector<PixelRect>& rects);
+
+// Where the samples of rect (luma pixels, edges on multiples of 4) sit in a
+// Chroma420 frame of the given width: y_rects in Y plane bytes, uv_rects in
+// UV plane pairs. Index 0 holds U, index 1 holds V.
+void GetChroma420Rects(int width, const PixelRect& rect, PixelRect y_rects[2], PixelRect uv_rects[2]);
+
+// Transport form: tile_size, tiles_x and tiles_y as little endian uint16,
+// followed by one bit per tile.
+void SerializeChromaTileMask(const ChromaTileMask& mask, std::vector<uint8_t>& data);
+bool ParseChromaTileMask(const uint8_t* data, size_t size, ChromaTileMask* mask);
+
+}
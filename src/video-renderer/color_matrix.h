@@ -0,0 +1,123 @@
+#pragma once
+
+namespace DX {
+
+enum ColorMatrix
+{
+	COLOR_MATRIX_BT601 = 0,
+	COLOR_MATRIX_BT709,
+	COLOR_MATRIX_BT2020,  // non-constant luminance
+	COLOR_MATRIX_MAX,
+};
+
+enum ColorRange
+{
+	COLOR_RANGE_LIMITED = 0,  // Y 16-235, UV 16-240
+	COLOR_RANGE_FULL,         // 0-255
+	COLOR_RANGE_MAX,
+};
+
+// Matrix from the ISO/IEC 23091-2 matrix_coefficients code, the value of
+// AVFrame::colorspace. Unspecified and unknown codes keep BT.601.
+inline ColorMatrix GetColorMatrix(int matrix_coefficients)
+{
+	if (matrix_coefficients == 1) {
+		return COLOR_MATRIX_BT709;
+	}
+	if (matrix_coefficients == 9 || matrix_coefficients == 10) {
+		return COLOR_MATRIX_BT2020;
+	}
+	return COLOR_MATRIX_BT601;
+}
+
+// Range from AVFrame::color_range, only AVCOL_RANGE_JPEG (2) is full range.
+inline ColorRange GetColorRange(int av_color_range)
+{
+	return av_color_range == 2 ? COLOR_RANGE_FULL : COLOR_RANGE_LIMITED;
+}
+
+// Luma weights, kg = 1 - kr - kb.
+struct ColorPrimaryWeights
+{
+	double kr;
+	double kb;
+};
+
+constexpr ColorPrimaryWeights kColorPrimaryWeights[COLOR_MATRIX_MAX] = {
+	{ 0.299,  0.114  },  // BT.601
+	{ 0.2126, 0.0722 },  // BT.709
+	{ 0.2627, 0.0593 },  // BT.2020
+};
+
+// R = y_scale * (Y - y_offset)                  + rv * (V - 128)
+// G = y_scale * (Y - y_offset) + gu * (U - 128) + gv * (V - 128)
+// B = y_scale * (Y - y_offset) + bu * (U - 128)
+// on 8-bit samples. The CPU fixed point kernels and the shader constants both
+// come from here, so the software and GPU paths produce the same colors.
+struct YUVToRGBCoefficients
+{
+	double y_scale;
+	double y_offset;
+	double rv;
+	double gu;
+	double gv;
+	double bu;
+};
+
+constexpr YUVToRGBCoefficients GetYUVToRGBCoefficients(ColorMatrix matrix, ColorRange range)
+{
+	return {
+		range == COLOR_RANGE_FULL ? 1.0 : 255.0 / 219.0,
+		range == COLOR_RANGE_FULL ? 0.0 : 16.0,
+		2.0 * (1.0 - kColorPrimaryWeights[matrix].kr) * (range == COLOR_RANGE_FULL ? 1.0 : 255.0 / 224.0),
+		-2.0 * (1.0 - kColorPrimaryWeights[matrix].kb) * kColorPrimaryWeights[matrix].kb
+			/ (1.0 - kColorPrimaryWeights[matrix].kr - kColorPrimaryWeights[matrix].kb)
+			* (range == COLOR_RANGE_FULL ? 1.0 : 255.0 / 224.0),
+		-2.0 * (1.0 - kColorPrimaryWeights[matrix].kr) * kColorPrimaryWeights[matrix].kr
+			/ (1.0 - kColorPrimaryWeights[matrix].kr - kColorPrimaryWeights[matrix].kb)
+			* (range == COLOR_RANGE_FULL ? 1.0 : 255.0 / 224.0),
+		2.0 * (1.0 - kColorPrimaryWeights[matrix].kb) * (range == COLOR_RANGE_FULL ? 1.0 : 255.0 / 224.0),
+	};
+}
+
+// Pixel shader constants for normalized samples:
+// rgb = float3(dot(yuv + offset, r), dot(yuv + offset, g), dot(yuv + offset, b))
+struct YUVShaderConstants
+{
+	float offset[4];
+	float r[4];
+	float g[4];
+	float b[4];
+};
+
+constexpr YUVShaderConstants GetYUVShaderConstants(ColorMatrix matrix, ColorRange range)
+{
+	return {
+		{
+			static_cast<float>(-GetYUVToRGBCoefficients(matrix, range).y_offset / 255.0),
+			static_cast<float>(-128.0 / 255.0),
+			static_cast<float>(-128.0 / 255.0),
+			0.0f,
+		},
+		{
+			static_cast<float>(GetYUVToRGBCoefficients(matrix, range).y_scale),
+			0.0f,
+			static_cast<float>(GetYUVToRGBCoefficients(matrix, range).rv),
+			0.0f,
+		},
+		{
+			static_cast<float>(GetYUVToRGBCoefficients(matrix, range).y_scale),
+			static_cast<float>(GetYUVToRGBCoefficients(matrix, range).gu),
+			static_cast<float>(GetYUVToRGBCoefficients(matrix, range).gv),
+			0.0f,
+		},
+		{
+			static_cast<float>(GetYUVToRGBCoefficients(matrix, range).y_scale),
+			static_cast<float>(GetYUVToRGBCoefficients(matrix, range).bu),
+			0.0f,
+			0.0f,
+		},
+	};
+}
+
+}
@@ -0,0 +1,450 @@
+#include "compositor.h"
+#include "cpu_color_converter.h"
+#include "worker_pool.h"
+#include "log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+using namespace DX;
+
+// More damaged rects than this are merged into their bounding box.
+static const size_t kMaxDamageRects = 16;
+
+// Smaller damage is drawn on the calling thread.
+static const uint64_t kMinParallelPixels = 256 * 256;
+static const int kMinStripeRows = 16;
+
+// Radius of the widest scale filter, Lanczos-3.
+static const int kFilterMargin = 3;
+
+static bool IntersectRect(const PixelRect& a, const PixelRect& b, PixelRect* rect)
+{
+	rect->left = a.left > b.left ? a.left : b.left;
+	rect->top = a.top > b.top ? a.top : b.top;
+	rect->right = a.right < b.right ? a.right : b.right;
+	rect->bottom = a.bottom < b.bottom ? a.bottom : b.bottom;
+	return rect->left < rect->right && rect->top < rect->bottom;
+}
+
+static bool IsScaled(const CompositeLayer* layer)
+{
+	return layer->dst_rect.right - layer->dst_rect.left != layer->frame->width ||
+		layer->dst_rect.bottom - layer->dst_rect.top != layer->frame->height;
+}
+
+static bool IsSupported(const PixelFrame* frame)
+{
+	if (!frame || frame->width <= 0 || frame->height <= 0) {
+		return false;
+	}
+
+	return frame->format > PIXEL_FORMAT_UNKNOW && frame->format < PIXEL_FORMAT_MAX;
+}
+
+Compositor::Compositor()
+{
+
+}
+
+Compositor::~Compositor()
+{
+	Destroy();
+}
+
+bool Compositor::Init(int width, int height, Renderer* renderer)
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+
+	renderer_ = renderer;
+	return CreateOutput(width, height);
+}
+
+void Compositor::Destroy()
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+
+	renderer_ = NULL;
+	output_ = PixelFrame();
+	has_output_ = false;
+	last_layers_.clear();
+	damage_.clear();
+	frame_pool_.Clear();
+}
+
+bool Compositor::Resize(int width, int height)
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+
+	if (width == output_.width && height == output_.height) {
+		return true;
+	}
+	return CreateOutput(width, height);
+}
+
+void Compositor::SetScaleFilter(ScaleFilter filter)
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+
+	if (scale_filter_ != filter) {
+		scale_filter_ = filter;
+		has_output_ = false;
+	}
+}
+
+const PixelFrame* Compositor::GetOutput()
+{
+	return has_output_ ? &output_ : NULL;
+}
+
+CompositorStats Compositor::GetStats()
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+	return stats_;
+}
+
+bool Compositor::CreateOutput(int width, int height)
+{
+	output_ = PixelFrame();
+	has_output_ = false;
+
+	if (!frame_pool_.Alloc(width, height, PIXEL_FORMAT_ARGB, &output_)) {
+		LOG("Create compositor output failed, %dx%d", width, height);
+		return false;
+	}
+	return true;
+}
+
+void Compositor::Compose(const std::vector<CompositeLayer>& layers)
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+
+	if (!output_.plane[0]) {
+		return;
+	}
+
+	auto start_time = std::chrono::steady_clock::now();
+
+	std::vector<const CompositeLayer*> sorted_layers;
+	for (auto& layer : layers) {
+		if (IsSupported(layer.frame)) {
+			sorted_layers.push_back(&layer);
+		}
+	}
+	std::stable_sort(sorted_layers.begin(), sorted_layers.end(), [](const CompositeLayer* a, const CompositeLayer* b) {
+		return a->z_order < b->z_order;
+	});
+
+	GetDamage(sorted_layers);
+	uint64_t converted_pixels = ConvertLayers(sorted_layers);
+
+	uint64_t pixels = 0;
+	int top = output_.height;
+	int bottom = 0;
+	for (auto& rect : damage_) {
+		pixels += static_cast<uint64_t>(rect.right - rect.left) * (rect.bottom - rect.top);
+		top = rect.top < top ? rect.top : top;
+		bottom = rect.bottom > bottom ? rect.bottom : bottom;
+	}
+
+	if (!damage_.empty()) {
+		WorkerPool& worker_pool = WorkerPool::Instance();
+		int num_stripes = 1;
+		if (pixels >= kMinParallelPixels) {
+			num_stripes = worker_pool.GetConcurrency();
+			if (num_stripes > (bottom - top) / kMinStripeRows) {
+				num_stripes = (bottom - top) / kMinStripeRows;
+			}
+			num_stripes = num_stripes < 1 ? 1 : num_stripes;
+		}
+
+		int stripe_rows = (bottom - top + num_stripes - 1) / num_stripes;
+		auto draw_stripe = [&](int index) {
+			PixelRect stripe;
+			stripe.left = 0;
+			stripe.right = output_.width;
+			stripe.top = top + index * stripe_rows;
+			stripe.bottom = stripe.top + stripe_rows < bottom ? stripe.top + stripe_rows : bottom;
+
+			std::vector<uint8_t> line;
+			for (auto& rect : damage_) {
+				PixelRect part;
+				if (IntersectRect(rect, stripe, &part)) {
+					DrawRows(sorted_layers, part, line);
+				}
+			}
+		};
+
+		if (num_stripes > 1) {
+			worker_pool.Run(num_stripes, draw_stripe);
+		}
+		else {
+			draw_stripe(0);
+		}
+
+		has_output_ = true;
+		if (renderer_) {
+			output_.dirty_rects = damage_;
+			renderer_->Render(&output_);
+		}
+	}
+
+	auto end_time = std::chrono::steady_clock::now();
+	double elapsed_ms = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+
+	stats_.last_pixels = pixels;
+	stats_.last_converted_pixels = converted_pixels;
+	stats_.total_pixels += pixels;
+	stats_.frame_count += 1;
+	stats_.last_ms = elapsed_ms;
+	stats_.average_ms += (elapsed_ms - stats_.average_ms) / static_cast<double>(stats_.frame_count);
+	if (elapsed_ms > stats_.max_ms) {
+		stats_.max_ms = elapsed_ms;
+	}
+}
+
+void Compositor::GetDamage(const std::vector<const CompositeLayer*>& layers)
+{
+	PixelRect output_rect;
+	output_rect.right = output_.width;
+	output_rect.bottom = output_.height;
+
+	damage_.clear();
+
+	bool is_same_layout = has_output_ && last_layers_.size() == layers.size();
+	for (size_t i = 0; is_same_layout && i < layers.size(); i++) {
+		const CompositeLayer* layer = layers[i];
+		const LayerState& state = last_layers_[i];
+		is_same_layout = state.dst_rect.left == layer->dst_rect.left && state.dst_rect.top == layer->dst_rect.top &&
+			state.dst_rect.right == layer->dst_rect.right && state.dst_rect.bottom == layer->dst_rect.bottom &&
+			state.z_order == layer->z_order && state.width == layer->frame->width &&
+			state.height == layer->frame->height && state.format == layer->frame->format &&
+			state.color_matrix == layer->frame->color_matrix && state.color_range == layer->frame->color_range;
+	}
+
+	last_layers_.resize(layers.size());
+	for (size_t i = 0; i < layers.size(); i++) {
+		if (!is_same_layout) {
+			last_layers_[i].is_converted = false;
+		}
+		last_layers_[i].dst_rect = layers[i]->dst_rect;
+		last_layers_[i].z_order = layers[i]->z_order;
+		last_layers_[i].width = layers[i]->frame->width;
+		last_layers_[i].height = layers[i]->frame->height;
+		last_layers_[i].format = layers[i]->frame->format;
+		last_layers_[i].color_matrix = layers[i]->frame->color_matrix;
+		last_layers_[i].color_range = layers[i]->frame->color_range;
+	}
+
+	// Layers moved, appeared or went away, uncovered background must be cleared.
+	if (!is_same_layout) {
+		damage_.push_back(output_rect);
+		return;
+	}
+
+	std::vector<PixelRect> dirty_rects;
+	for (auto layer : layers) {
+		if (!layer->is_updated) {
+			continue;
+		}
+
+		const PixelFrame* frame = layer->frame;
+		const PixelRect& dst_rect = layer->dst_rect;
+		int64_t dst_width = dst_rect.right - dst_rect.left;
+		int64_t dst_height = dst_rect.bottom - dst_rect.top;
+
+		// Filter taps reach past the dirty pixels, in source pixels when
+		// up-scaling and in output pixels when down-scaling.
+		int margin = (scale_filter_ != SCALE_FILTER_NEAREST && IsScaled(layer)) ? kFilterMargin : 0;
+
+		GetDirtyRects(frame, false, dirty_rects);
+		for (auto& dirty_rect : dirty_rects) {
+			int64_t left = dirty_rect.left - margin;
+			int64_t top = dirty_rect.top - margin;
+			int64_t right = dirty_rect.right + margin;
+			int64_t bottom = dirty_rect.bottom + margin;
+
+			PixelRect rect;
+			rect.left = dst_rect.left + static_cast<int>(left * dst_width / frame->width) - margin;
+			rect.top = dst_rect.top + static_cast<int>(top * dst_height / frame->height) - margin;
+			rect.right = dst_rect.left + static_cast<int>((right * dst_width + frame->width - 1) / frame->width) + margin;
+			rect.bottom = dst_rect.top + static_cast<int>((bottom * dst_height + frame->height - 1) / frame->height) + margin;
+
+			PixelRect clipped;
+			if (IntersectRect(rect, dst_rect, &clipped) && IntersectRect(clipped, output_rect, &clipped)) {
+				damage_.push_back(clipped);
+			}
+		}
+	}
+
+	if (damage_.size() > kMaxDamageRects) {
+		PixelRect bound = damage_[0];
+		for (auto& rect : damage_) {
+			bound.left = rect.left < bound.left ? rect.left : bound.left;
+			bound.top = rect.top < bound.top ? rect.top : bound.top;
+			bound.right = rect.right > bound.right ? rect.right : bound.right;
+			bound.bottom = rect.bottom > bound.bottom ? rect.bottom : bound.bottom;
+		}
+		damage_.assign(1, bound);
+	}
+}
+
+uint64_t Compositor::ConvertLayers(const std::vector<const CompositeLayer*>& layers)
+{
+	if (scale_filter_ == SCALE_FILTER_NEAREST) {
+		return 0;
+	}
+
+	std::vector<size_t> indexes;
+	for (size_t i = 0; i < layers.size(); i++) {
+		LayerState& state = last_layers_[i];
+		if (IsScaled(layers[i]) && (layers[i]->is_updated || !state.is_converted)) {
+			indexes.push_back(i);
+		}
+	}
+
+	if (indexes.empty()) {
+		return 0;
+	}
+
+	PixelRect output_rect;
+	output_rect.right = output_.width;
+	output_rect.bottom = output_.height;
+
+	// One layer per task, tiles convert in parallel.
+	std::vector<uint64_t> converted_pixels(indexes.size(), 0);
+	auto convert_layer = [&](int index) {
+		const CompositeLayer* layer = layers[indexes[index]];
+		LayerState& state = last_layers_[indexes[index]];
+		const PixelFrame* frame = layer->frame;
+		const PixelRect& dst_rect = layer->dst_rect;
+
+		// A new layout converts everything visible, later updates only
+		// their dirty rects.
+		bool is_full = !state.is_converted;
+		if (is_full) {
+			int dst_width = dst_rect.right - dst_rect.left;
+			int dst_height = dst_rect.bottom - dst_rect.top;
+			if (!state.scaler.Init(frame->width, frame->height, dst_width, dst_height, scale_filter_)) {
+				return;
+			}
+			state.argb.resize(static_cast<size_t>(frame->width) * frame->height * 4);
+		}
+
+		// Source pixels read for the part of the layer inside the output.
+		PixelRect visible, src_visible;
+		if (!IntersectRect(dst_rect, output_rect, &visible)) {
+			state.is_converted = true;
+			return;
+		}
+		visible.left -= dst_rect.left;
+		visible.top -= dst_rect.top;
+		visible.right -= dst_rect.left;
+		visible.bottom -= dst_rect.top;
+		if (!state.scaler.GetSrcRect(visible, &src_visible)) {
+			return;
+		}
+
+		std::vector<PixelRect> rects;
+		if (is_full) {
+			rects.push_back(src_visible);
+		}
+		else {
+			GetDirtyRects(frame, false, rects);
+		}
+
+		for (auto& rect : rects) {
+			PixelRect area;
+			if (!IntersectRect(rect, src_visible, &area)) {
+				continue;
+			}
+
+			// Chroma pairs start on even columns.
+			area.left &= ~1;
+			for (int y = area.top; y < area.bottom; y++) {
+				uint8_t* dst = state.argb.data() + (static_cast<size_t>(y) * frame->width + area.left) * 4;
+				FrameRowToBGRA(frame, y, area.left, area.right, dst);
+			}
+			converted_pixels[index] += static_cast<uint64_t>(area.right - area.left) * (area.bottom - area.top);
+		}
+		state.is_converted = true;
+	};
+
+	if (indexes.size() > 1) {
+		WorkerPool::Instance().Run(static_cast<int>(indexes.size()), convert_layer);
+	}
+	else {
+		convert_layer(0);
+	}
+
+	uint64_t total = 0;
+	for (uint64_t pixels : converted_pixels) {
+		total += pixels;
+	}
+	return total;
+}
+
+void Compositor::DrawRows(const std::vector<const CompositeLayer*>& layers, const PixelRect& rect, std::vector<uint8_t>& line)
+{
+	for (int y = rect.top; y < rect.bottom; y++) {
+		uint32_t* dst = reinterpret_cast<uint32_t*>(output_.plane[0] + y * output_.pitch[0]);
+		std::fill(dst + rect.left, dst + rect.right, 0xff000000);
+	}
+
+	for (size_t i = 0; i < layers.size(); i++) {
+		const CompositeLayer* layer = layers[i];
+		PixelRect area;
+		if (!IntersectRect(layer->dst_rect, rect, &area)) {
+			continue;
+		}
+
+		const PixelFrame* frame = layer->frame;
+		const PixelRect& dst_rect = layer->dst_rect;
+		int64_t dst_width = dst_rect.right - dst_rect.left;
+		int64_t dst_height = dst_rect.bottom - dst_rect.top;
+		bool is_scaled = IsScaled(layer);
+
+		LayerState& state = last_layers_[i];
+		if (is_scaled && state.is_converted) {
+			PixelRect clip;
+			clip.left = area.left - dst_rect.left;
+			clip.top = area.top - dst_rect.top;
+			clip.right = area.right - dst_rect.left;
+			clip.bottom = area.bottom - dst_rect.top;
+
+			uint8_t* dst = output_.plane[0] + dst_rect.top * output_.pitch[0] + dst_rect.left * 4;
+			state.scaler.Scale(state.argb.data(), frame->width * 4, dst, output_.pitch[0], &clip);
+			continue;
+		}
+
+		// Source columns covering the area, nearest sampling when scaled.
+		int src_left = static_cast<int>((area.left - dst_rect.left) * frame->width / dst_width);
+		int src_right = static_cast<int>((area.right - 1 - dst_rect.left) * frame->width / dst_width) + 1;
+		int src_aligned = src_left & ~1;
+
+		size_t line_size = static_cast<size_t>(src_right - src_aligned) * 4;
+		if (line.size() < line_size) {
+			line.resize(line_size);
+		}
+
+		for (int y = area.top; y < area.bottom; y++) {
+			int src_y = static_cast<int>((y - dst_rect.top) * frame->height / dst_height);
+			uint8_t* dst = output_.plane[0] + y * output_.pitch[0] + area.left * 4;
+
+			FrameRowToBGRA(frame, src_y, src_aligned, src_right, line.data());
+
+			if (!is_scaled) {
+				memcpy(dst, line.data() + (src_left - src_aligned) * 4, (area.right - area.left) * 4);
+				continue;
+			}
+
+			const uint32_t* src = reinterpret_cast<const uint32_t*>(line.data());
+			uint32_t* dst_pixels = reinterpret_cast<uint32_t*>(dst);
+			for (int x = area.left; x < area.right; x++) {
+				int src_x = static_cast<int>((x - dst_rect.left) * frame->width / dst_width);
+				dst_pixels[x - area.left] = src[src_x - src_aligned];
+			}
+		}
+	}
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "renderer.h"
+#include "cpu_scaler.h"
+#include <mutex>
+#include <vector>
+
+namespace DX {
+
+struct CompositeLayer
+{
+	PixelFrame* frame = NULL;
+
+	// Destination in output pixels, right and bottom exclusive. The frame
+	// is scaled to fill it, see Compositor::SetScaleFilter().
+	PixelRect dst_rect;
+
+	// Layers with a higher z_order are drawn on top.
+	int z_order = 0;
+
+	// false if the frame did not change since the last Compose(), it must
+	// still hold the same content as it may be redrawn under other layers.
+	bool is_updated = true;
+};
+
+struct CompositorStats
+{
+	uint64_t frame_count = 0;
+	double   last_ms     = 0.0;
+	double   average_ms  = 0.0;
+	double   max_ms      = 0.0;
+
+	// Output pixels redrawn by the last Compose() and in total.
+	uint64_t last_pixels  = 0;
+	uint64_t total_pixels = 0;
+
+	// Source pixels converted to BGRA for filtered scaling by the last Compose().
+	uint64_t last_converted_pixels = 0;
+};
+
+// Converts and places many frames into one ARGB output in a single pass, so
+// a video wall needs one Renderer and swap chain instead of one per tile.
+// Only damaged areas are redrawn, split into row stripes on the WorkerPool,
+// and passed on to the renderer as dirty rects.
+class Compositor
+{
+public:
+	Compositor();
+	virtual ~Compositor();
+
+	// renderer may be NULL, the output is then only kept in memory.
+	bool Init(int width, int height, Renderer* renderer);
+	void Destroy();
+
+	bool Resize(int width, int height);
+
+	// Filter for layers whose size differs from their destination, the
+	// default is SCALE_FILTER_NEAREST.
+	void SetScaleFilter(ScaleFilter filter);
+
+	void Compose(const std::vector<CompositeLayer>& layers);
+
+	// Valid until the next Compose(), Resize() or Destroy().
+	const PixelFrame* GetOutput();
+
+	CompositorStats GetStats();
+
+private:
+	struct LayerState
+	{
+		PixelRect   dst_rect;
+		int         z_order = 0;
+		int         width   = 0;
+		int         height  = 0;
+		PixelFormat format  = PIXEL_FORMAT_UNKNOW;
+		ColorMatrix color_matrix = COLOR_MATRIX_BT601;
+		ColorRange  color_range  = COLOR_RANGE_LIMITED;
+
+		// BGRA copy of the frame for filtered scaling, only the source
+		// pixels that reach the output are converted.
+		std::vector<uint8_t> argb;
+		bool is_converted = false;
+		ARGBScaler scaler;
+	};
+
+	bool CreateOutput(int width, int height);
+	void GetDamage(const std::vector<const CompositeLayer*>& layers);
+	// Returns the number of source pixels converted.
+	uint64_t ConvertLayers(const std::vector<const CompositeLayer*>& layers);
+	void DrawRows(const std::vector<const CompositeLayer*>& layers, const PixelRect& rect, std::vector<uint8_t>& line);
+
+	std::mutex mutex_;
+
+	Renderer* renderer_ = NULL;
+	ScaleFilter scale_filter_ = SCALE_FILTER_NEAREST;
+
+	PixelFramePool frame_pool_;
+	PixelFrame output_;
+	bool has_output_ = false;
+
+	std::vector<LayerState> last_layers_;
+	std::vector<PixelRect> damage_;
+
+	CompositorStats stats_;
+};
+
+}
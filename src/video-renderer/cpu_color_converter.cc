@@ -0,0 +1,613 @@
+#include "cpu_color_converter.h"
+#include "renderer.h"
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define CPU_COLOR_CONVERTER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+using namespace DX;
+
+static constexpr int RoundToInt(double value)
+{
+	return value < 0 ? -static_cast<int>(-value + 0.5) : static_cast<int>(value + 0.5);
+}
+
+// 6-bit fixed point coefficients of one matrix and range, evaluated at compile
+// time from the color_matrix.h table. Y is scaled with mulhi on Y * 257.
+template <ColorMatrix M, ColorRange R>
+struct YUVFixedPoint
+{
+	enum : int {
+		kYG  = RoundToInt(GetYUVToRGBCoefficients(M, R).y_scale * 64 * 65536 / 257),
+		kYGB = RoundToInt(-GetYUVToRGBCoefficients(M, R).y_scale * GetYUVToRGBCoefficients(M, R).y_offset * 64) + 32,
+		kUB  = RoundToInt(GetYUVToRGBCoefficients(M, R).bu * 64),
+		kUG  = RoundToInt(-GetYUVToRGBCoefficients(M, R).gu * 64),
+		kVG  = RoundToInt(-GetYUVToRGBCoefficients(M, R).gv * 64),
+		kVR  = RoundToInt(GetYUVToRGBCoefficients(M, R).rv * 64),
+	};
+
+	// mulhi_epu16 takes kYG unsigned, the chroma products stay within int16.
+	static_assert(kYG > 0 && kYG < 65536, "Y gain out of range");
+	static_assert(kUB * 128 < 32768 && kVR * 128 < 32768 && (kUG + kVG) * 128 < 32768, "UV gain out of range");
+};
+
+typedef YUVFixedPoint<COLOR_MATRIX_BT601, COLOR_RANGE_LIMITED> BT601Limited;
+static_assert(BT601Limited::kYGB == -1160 && BT601Limited::kUB == 129 && BT601Limited::kUG == 25 &&
+	BT601Limited::kVG == 52 && BT601Limited::kVR == 102, "BT.601 limited range coefficients changed");
+
+// Instantiates a row kernel for every matrix and range, indexed [matrix][range].
+#define YUV_ROW_KERNELS(Row) { \
+	{ Row<YUVFixedPoint<COLOR_MATRIX_BT601, COLOR_RANGE_LIMITED>>, Row<YUVFixedPoint<COLOR_MATRIX_BT601, COLOR_RANGE_FULL>> }, \
+	{ Row<YUVFixedPoint<COLOR_MATRIX_BT709, COLOR_RANGE_LIMITED>>, Row<YUVFixedPoint<COLOR_MATRIX_BT709, COLOR_RANGE_FULL>> }, \
+	{ Row<YUVFixedPoint<COLOR_MATRIX_BT2020, COLOR_RANGE_LIMITED>>, Row<YUVFixedPoint<COLOR_MATRIX_BT2020, COLOR_RANGE_FULL>> } }
+
+typedef void (*PlanarRowFunc)(const uint8_t*, const uint8_t*, const uint8_t*, uint8_t*, int);
+typedef void (*SemiPlanarRowFunc)(const uint8_t*, const uint8_t*, uint8_t*, int);
+typedef void (*PackedRowFunc)(const uint8_t*, uint8_t*, int);
+typedef void (*Planar16RowFunc)(const uint16_t*, const uint16_t*, const uint16_t*, uint8_t*, int);
+typedef void (*SemiPlanar16RowFunc)(const uint16_t*, const uint16_t*, uint8_t*, int);
+
+// Picks the instantiation once per call, the row loops never branch on the matrix.
+template <typename Func>
+static Func SelectRowKernel(Func const (&kernels)[COLOR_MATRIX_MAX][COLOR_RANGE_MAX], ColorMatrix matrix, ColorRange range)
+{
+	if (matrix < 0 || matrix >= COLOR_MATRIX_MAX) {
+		matrix = COLOR_MATRIX_BT601;
+	}
+	if (range < 0 || range >= COLOR_RANGE_MAX) {
+		range = COLOR_RANGE_LIMITED;
+	}
+	return kernels[matrix][range];
+}
+
+static inline uint8_t Clamp255(int value)
+{
+	return static_cast<uint8_t>(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+// y16: Y scaled to [0, 65535], 8-bit Y is y * 257 and 10-bit Y keeps its extra bits.
+template <class K>
+static inline void YUV16ToBGRAPixel(int y16, int u, int v, uint8_t* dst)
+{
+	int yy = ((y16 * K::kYG) >> 16) + K::kYGB;
+	u -= 128;
+	v -= 128;
+	dst[0] = Clamp255((yy + K::kUB * u) >> 6);
+	dst[1] = Clamp255((yy - K::kUG * u - K::kVG * v) >> 6);
+	dst[2] = Clamp255((yy + K::kVR * v) >> 6);
+	dst[3] = 0xff;
+}
+
+template <class K>
+static inline void YUVToBGRAPixel(int y, int u, int v, uint8_t* dst)
+{
+	YUV16ToBGRAPixel<K>(y * 257, u, v, dst);
+}
+
+// 10-bit samples in the low bits (I010), the bits above are ignored. A 10-bit
+// code is 4x the 8-bit one, so y16 is y * 257 / 4, saturated above code 1020.
+static inline int Y10To16(int y)
+{
+	y &= 0x3ff;
+	y = (y << 6) + (y >> 2);
+	return y > 65535 ? 65535 : y;
+}
+
+static inline int UV10To8(int uv)
+{
+	uv = ((uv & 0x3ff) + 2) >> 2;
+	return uv > 255 ? 255 : uv;
+}
+
+#ifdef CPU_COLOR_CONVERTER_SSE2
+// y16: 8 x uint16 Y scaled to [0, 65535], u, v: 8 x uint16 in [0, 255],
+// writes 8 BGRA pixels.
+template <class K>
+static inline void YUV16ToBGRA8(__m128i y16, __m128i u, __m128i v, uint8_t* dst)
+{
+	const __m128i yg  = _mm_set1_epi16(static_cast<short>(K::kYG));
+	const __m128i ygb = _mm_set1_epi16(static_cast<short>(K::kYGB));
+	const __m128i bias = _mm_set1_epi16(128);
+	const __m128i alpha = _mm_set1_epi8(static_cast<char>(0xff));
+
+	__m128i yy = _mm_mulhi_epu16(y16, yg);
+	yy = _mm_add_epi16(yy, ygb);
+	u = _mm_sub_epi16(u, bias);
+	v = _mm_sub_epi16(v, bias);
+
+	__m128i b = _mm_adds_epi16(yy, _mm_mullo_epi16(u, _mm_set1_epi16(K::kUB)));
+	__m128i g = _mm_subs_epi16(yy, _mm_adds_epi16(_mm_mullo_epi16(u, _mm_set1_epi16(K::kUG)),
+		_mm_mullo_epi16(v, _mm_set1_epi16(K::kVG))));
+	__m128i r = _mm_adds_epi16(yy, _mm_mullo_epi16(v, _mm_set1_epi16(K::kVR)));
+
+	b = _mm_packus_epi16(_mm_srai_epi16(b, 6), _mm_srai_epi16(b, 6));
+	g = _mm_packus_epi16(_mm_srai_epi16(g, 6), _mm_srai_epi16(g, 6));
+	r = _mm_packus_epi16(_mm_srai_epi16(r, 6), _mm_srai_epi16(r, 6));
+
+	__m128i bg = _mm_unpacklo_epi8(b, g);
+	__m128i ra = _mm_unpacklo_epi8(r, alpha);
+	_mm_storeu_si128((__m128i*)(dst), _mm_unpacklo_epi16(bg, ra));
+	_mm_storeu_si128((__m128i*)(dst + 16), _mm_unpackhi_epi16(bg, ra));
+}
+
+// 8 x uint8 Y in the low half of y8, y * 257 is the byte repeated.
+template <class K>
+static inline void YUVToBGRA8(__m128i y8, __m128i u, __m128i v, uint8_t* dst)
+{
+	YUV16ToBGRA8<K>(_mm_unpacklo_epi8(y8, y8), u, v, dst);
+}
+
+static inline __m128i Y10To16x8(__m128i y)
+{
+	y = _mm_and_si128(y, _mm_set1_epi16(0x3ff));
+	return _mm_adds_epu16(_mm_slli_epi16(y, 6), _mm_srli_epi16(y, 2));
+}
+
+static inline __m128i UV10To8x8(__m128i uv)
+{
+	// (uv + 2) >> 2 without overflowing 16 bits, 1023 rounds up to 256.
+	uv = _mm_and_si128(uv, _mm_set1_epi16(0x3ff));
+	uv = _mm_avg_epu16(_mm_srli_epi16(uv, 1), _mm_setzero_si128());
+	return _mm_min_epi16(uv, _mm_set1_epi16(255));
+}
+#endif
+
+template <class K>
+static void I420ToBGRARow(const uint8_t* src_y, const uint8_t* src_u, const uint8_t* src_v, uint8_t* dst, int width)
+{
+	int x = 0;
+
+#ifdef CPU_COLOR_CONVERTER_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	for (; x + 8 <= width; x += 8) {
+		__m128i y = _mm_loadl_epi64((const __m128i*)(src_y + x));
+		int u4 = 0, v4 = 0;
+		memcpy(&u4, src_u + x / 2, 4);
+		memcpy(&v4, src_v + x / 2, 4);
+		__m128i u = _mm_cvtsi32_si128(u4);
+		__m128i v = _mm_cvtsi32_si128(v4);
+		u = _mm_unpacklo_epi8(_mm_unpacklo_epi8(u, u), zero);
+		v = _mm_unpacklo_epi8(_mm_unpacklo_epi8(v, v), zero);
+		YUVToBGRA8<K>(y, u, v, dst + x * 4);
+	}
+#endif
+
+	for (; x < width; x++) {
+		YUVToBGRAPixel<K>(src_y[x], src_u[x / 2], src_v[x / 2], dst + x * 4);
+	}
+}
+
+template <class K>
+static void I444ToBGRARow(const uint8_t* src_y, const uint8_t* src_u, const uint8_t* src_v, uint8_t* dst, int width)
+{
+	int x = 0;
+
+#ifdef CPU_COLOR_CONVERTER_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	for (; x + 8 <= width; x += 8) {
+		__m128i y = _mm_loadl_epi64((const __m128i*)(src_y + x));
+		__m128i u = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(src_u + x)), zero);
+		__m128i v = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(src_v + x)), zero);
+		YUVToBGRA8<K>(y, u, v, dst + x * 4);
+	}
+#endif
+
+	for (; x < width; x++) {
+		YUVToBGRAPixel<K>(src_y[x], src_u[x], src_v[x], dst + x * 4);
+	}
+}
+
+template <class K>
+static void NV12ToBGRARow(const uint8_t* src_y, const uint8_t* src_uv, uint8_t* dst, int width)
+{
+	int x = 0;
+
+#ifdef CPU_COLOR_CONVERTER_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i mask = _mm_set1_epi32(0x0000ffff);
+	for (; x + 8 <= width; x += 8) {
+		__m128i y = _mm_loadl_epi64((const __m128i*)(src_y + x));
+		__m128i uv = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(src_uv + x)), zero);
+		__m128i u = _mm_and_si128(uv, mask);
+		__m128i v = _mm_srli_epi32(uv, 16);
+		u = _mm_or_si128(u, _mm_slli_epi32(u, 16));
+		v = _mm_or_si128(v, _mm_slli_epi32(v, 16));
+		YUVToBGRA8<K>(y, u, v, dst + x * 4);
+	}
+#endif
+
+	for (; x < width; x++) {
+		YUVToBGRAPixel<K>(src_y[x], src_uv[(x / 2) * 2], src_uv[(x / 2) * 2 + 1], dst + x * 4);
+	}
+}
+
+template <class K>
+static void I010ToBGRARow(const uint16_t* src_y, const uint16_t* src_u, const uint16_t* src_v, uint8_t* dst, int width)
+{
+	int x = 0;
+
+#ifdef CPU_COLOR_CONVERTER_SSE2
+	for (; x + 8 <= width; x += 8) {
+		__m128i y = Y10To16x8(_mm_loadu_si128((const __m128i*)(src_y + x)));
+		__m128i u = UV10To8x8(_mm_loadl_epi64((const __m128i*)(src_u + x / 2)));
+		__m128i v = UV10To8x8(_mm_loadl_epi64((const __m128i*)(src_v + x / 2)));
+		u = _mm_unpacklo_epi16(u, u);
+		v = _mm_unpacklo_epi16(v, v);
+		YUV16ToBGRA8<K>(y, u, v, dst + x * 4);
+	}
+#endif
+
+	for (; x < width; x++) {
+		YUV16ToBGRAPixel<K>(Y10To16(src_y[x]), UV10To8(src_u[x / 2]), UV10To8(src_v[x / 2]), dst + x * 4);
+	}
+}
+
+template <class K>
+static void P010ToBGRARow(const uint16_t* src_y, const uint16_t* src_uv, uint8_t* dst, int width)
+{
+	int x = 0;
+
+#ifdef CPU_COLOR_CONVERTER_SSE2
+	const __m128i mask = _mm_set1_epi32(0x0000ffff);
+	for (; x + 8 <= width; x += 8) {
+		// 10 bits in the MSBs, the low 6 bits are dropped as in the scalar tail.
+		__m128i y = Y10To16x8(_mm_srli_epi16(_mm_loadu_si128((const __m128i*)(src_y + x)), 6));
+		__m128i uv = _mm_srli_epi16(_mm_loadu_si128((const __m128i*)(src_uv + x)), 6);
+		uv = UV10To8x8(uv);
+		__m128i u = _mm_and_si128(uv, mask);
+		__m128i v = _mm_srli_epi32(uv, 16);
+		u = _mm_or_si128(u, _mm_slli_epi32(u, 16));
+		v = _mm_or_si128(v, _mm_slli_epi32(v, 16));
+		YUV16ToBGRA8<K>(y, u, v, dst + x * 4);
+	}
+#endif
+
+	for (; x < width; x++) {
+		YUV16ToBGRAPixel<K>(Y10To16(src_y[x] >> 6), UV10To8(src_uv[(x / 2) * 2] >> 6),
+			UV10To8(src_uv[(x / 2) * 2 + 1] >> 6), dst + x * 4);
+	}
+}
+
+// UVOffset: 1 for YUY2 (Y0 U Y1 V), 0 for UYVY (U Y0 V Y1).
+template <class K, int UVOffset>
+static void Packed422ToBGRARow(const uint8_t* src, uint8_t* dst, int width)
+{
+	const int uv_offset = UVOffset;
+	const int y_offset = 1 - UVOffset;
+	int x = 0;
+
+#ifdef CPU_COLOR_CONVERTER_SSE2
+	const __m128i low = _mm_set1_epi16(0x00ff);
+	const __m128i mask = _mm_set1_epi32(0x0000ffff);
+	for (; x + 8 <= width; x += 8) {
+		__m128i pixels = _mm_loadu_si128((const __m128i*)(src + x * 2));
+		__m128i y = uv_offset ? _mm_and_si128(pixels, low) : _mm_srli_epi16(pixels, 8);
+		__m128i uv = uv_offset ? _mm_srli_epi16(pixels, 8) : _mm_and_si128(pixels, low);
+		__m128i u = _mm_and_si128(uv, mask);
+		__m128i v = _mm_srli_epi32(uv, 16);
+		u = _mm_or_si128(u, _mm_slli_epi32(u, 16));
+		v = _mm_or_si128(v, _mm_slli_epi32(v, 16));
+		YUV16ToBGRA8<K>(_mm_or_si128(y, _mm_slli_epi16(y, 8)), u, v, dst + x * 4);
+	}
+#endif
+
+	for (; x < width; x++) {
+		const uint8_t* pair = src + (x / 2) * 4;
+		YUVToBGRAPixel<K>(src[x * 2 + y_offset], pair[uv_offset], pair[uv_offset + 2], dst + x * 4);
+	}
+}
+
+template <class K>
+static void YUY2ToBGRARow(const uint8_t* src, uint8_t* dst, int width)
+{
+	Packed422ToBGRARow<K, 1>(src, dst, width);
+}
+
+template <class K>
+static void UYVYToBGRARow(const uint8_t* src, uint8_t* dst, int width)
+{
+	Packed422ToBGRARow<K, 0>(src, dst, width);
+}
+
+static void RGB24ToBGRARow(const uint8_t* src, uint8_t* dst, int width)
+{
+	int x = 0;
+
+	// 4 pixels from 3 little-endian words.
+	for (; x + 4 <= width; x += 4) {
+		uint32_t s0, s1, s2;
+		memcpy(&s0, src + x * 3, 4);
+		memcpy(&s1, src + x * 3 + 4, 4);
+		memcpy(&s2, src + x * 3 + 8, 4);
+		uint32_t d[4];
+		d[0] = s0 | 0xff000000;
+		d[1] = (s0 >> 24) | (s1 << 8) | 0xff000000;
+		d[2] = (s1 >> 16) | (s2 << 16) | 0xff000000;
+		d[3] = (s2 >> 8) | 0xff000000;
+		memcpy(dst + x * 4, d, 16);
+	}
+
+	for (; x < width; x++) {
+		dst[x * 4 + 0] = src[x * 3 + 0];
+		dst[x * 4 + 1] = src[x * 3 + 1];
+		dst[x * 4 + 2] = src[x * 3 + 2];
+		dst[x * 4 + 3] = 0xff;
+	}
+}
+
+static void RGBAToBGRARow(const uint8_t* src, uint8_t* dst, int width)
+{
+	int x = 0;
+
+#ifdef CPU_COLOR_CONVERTER_SSE2
+	const __m128i ga = _mm_set1_epi32(static_cast<int>(0xff00ff00));
+	const __m128i rb = _mm_set1_epi32(0x00ff00ff);
+	for (; x + 4 <= width; x += 4) {
+		__m128i pixels = _mm_loadu_si128((const __m128i*)(src + x * 4));
+		__m128i swapped = _mm_and_si128(pixels, rb);
+		swapped = _mm_or_si128(_mm_slli_epi32(swapped, 16), _mm_srli_epi32(swapped, 16));
+		_mm_storeu_si128((__m128i*)(dst + x * 4), _mm_or_si128(_mm_and_si128(pixels, ga), swapped));
+	}
+#endif
+
+	for (; x < width; x++) {
+		dst[x * 4 + 0] = src[x * 4 + 2];
+		dst[x * 4 + 1] = src[x * 4 + 1];
+		dst[x * 4 + 2] = src[x * 4 + 0];
+		dst[x * 4 + 3] = src[x * 4 + 3];
+	}
+}
+
+template <int UVOffset>
+static void Packed422ToI422Row(const uint8_t* src, uint8_t* dst_y, uint8_t* dst_u, uint8_t* dst_v, int width)
+{
+	const int uv_offset = UVOffset;
+	const int y_offset = 1 - UVOffset;
+	int x = 0;
+
+#ifdef CPU_COLOR_CONVERTER_SSE2
+	const __m128i low = _mm_set1_epi16(0x00ff);
+	const __m128i zero = _mm_setzero_si128();
+	for (; x + 16 <= width; x += 16) {
+		__m128i p0 = _mm_loadu_si128((const __m128i*)(src + x * 2));
+		__m128i p1 = _mm_loadu_si128((const __m128i*)(src + x * 2 + 16));
+		__m128i y0 = uv_offset ? _mm_and_si128(p0, low) : _mm_srli_epi16(p0, 8);
+		__m128i y1 = uv_offset ? _mm_and_si128(p1, low) : _mm_srli_epi16(p1, 8);
+		__m128i uv0 = uv_offset ? _mm_srli_epi16(p0, 8) : _mm_and_si128(p0, low);
+		__m128i uv1 = uv_offset ? _mm_srli_epi16(p1, 8) : _mm_and_si128(p1, low);
+		__m128i uv = _mm_packus_epi16(uv0, uv1);
+		_mm_storeu_si128((__m128i*)(dst_y + x), _mm_packus_epi16(y0, y1));
+		_mm_storel_epi64((__m128i*)(dst_u + x / 2), _mm_packus_epi16(_mm_and_si128(uv, low), zero));
+		_mm_storel_epi64((__m128i*)(dst_v + x / 2), _mm_packus_epi16(_mm_srli_epi16(uv, 8), zero));
+	}
+#endif
+
+	for (; x < width; x++) {
+		dst_y[x] = src[x * 2 + y_offset];
+		if ((x & 1) == 0) {
+			dst_u[x / 2] = src[x * 2 + uv_offset];
+			dst_v[x / 2] = src[x * 2 + uv_offset + 2];
+		}
+	}
+}
+
+void DX::I420ToBGRA(const uint8_t* src_y, int src_pitch_y,
+	const uint8_t* src_u, int src_pitch_u,
+	const uint8_t* src_v, int src_pitch_v,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height, ColorMatrix matrix, ColorRange range)
+{
+	static const PlanarRowFunc kernels[COLOR_MATRIX_MAX][COLOR_RANGE_MAX] = YUV_ROW_KERNELS(I420ToBGRARow);
+	PlanarRowFunc row = SelectRowKernel(kernels, matrix, range);
+
+	for (int i = 0; i < height; i++) {
+		row(src_y + i * src_pitch_y,
+			src_u + (i / 2) * src_pitch_u,
+			src_v + (i / 2) * src_pitch_v,
+			dst_bgra + i * dst_pitch, width);
+	}
+}
+
+void DX::I444ToBGRA(const uint8_t* src_y, int src_pitch_y,
+	const uint8_t* src_u, int src_pitch_u,
+	const uint8_t* src_v, int src_pitch_v,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height, ColorMatrix matrix, ColorRange range)
+{
+	static const PlanarRowFunc kernels[COLOR_MATRIX_MAX][COLOR_RANGE_MAX] = YUV_ROW_KERNELS(I444ToBGRARow);
+	PlanarRowFunc row = SelectRowKernel(kernels, matrix, range);
+
+	for (int i = 0; i < height; i++) {
+		row(src_y + i * src_pitch_y,
+			src_u + i * src_pitch_u,
+			src_v + i * src_pitch_v,
+			dst_bgra + i * dst_pitch, width);
+	}
+}
+
+void DX::NV12ToBGRA(const uint8_t* src_y, int src_pitch_y,
+	const uint8_t* src_uv, int src_pitch_uv,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height, ColorMatrix matrix, ColorRange range)
+{
+	static const SemiPlanarRowFunc kernels[COLOR_MATRIX_MAX][COLOR_RANGE_MAX] = YUV_ROW_KERNELS(NV12ToBGRARow);
+	SemiPlanarRowFunc row = SelectRowKernel(kernels, matrix, range);
+
+	for (int i = 0; i < height; i++) {
+		row(src_y + i * src_pitch_y,
+			src_uv + (i / 2) * src_pitch_uv,
+			dst_bgra + i * dst_pitch, width);
+	}
+}
+
+void DX::I422ToBGRA(const uint8_t* src_y, int src_pitch_y,
+	const uint8_t* src_u, int src_pitch_u,
+	const uint8_t* src_v, int src_pitch_v,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height, ColorMatrix matrix, ColorRange range)
+{
+	static const PlanarRowFunc kernels[COLOR_MATRIX_MAX][COLOR_RANGE_MAX] = YUV_ROW_KERNELS(I420ToBGRARow);
+	PlanarRowFunc row = SelectRowKernel(kernels, matrix, range);
+
+	for (int i = 0; i < height; i++) {
+		row(src_y + i * src_pitch_y,
+			src_u + i * src_pitch_u,
+			src_v + i * src_pitch_v,
+			dst_bgra + i * dst_pitch, width);
+	}
+}
+
+void DX::YUY2ToBGRA(const uint8_t* src_yuy2, int src_pitch,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height, ColorMatrix matrix, ColorRange range)
+{
+	static const PackedRowFunc kernels[COLOR_MATRIX_MAX][COLOR_RANGE_MAX] = YUV_ROW_KERNELS(YUY2ToBGRARow);
+	PackedRowFunc row = SelectRowKernel(kernels, matrix, range);
+
+	for (int i = 0; i < height; i++) {
+		row(src_yuy2 + i * src_pitch, dst_bgra + i * dst_pitch, width);
+	}
+}
+
+void DX::UYVYToBGRA(const uint8_t* src_uyvy, int src_pitch,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height, ColorMatrix matrix, ColorRange range)
+{
+	static const PackedRowFunc kernels[COLOR_MATRIX_MAX][COLOR_RANGE_MAX] = YUV_ROW_KERNELS(UYVYToBGRARow);
+	PackedRowFunc row = SelectRowKernel(kernels, matrix, range);
+
+	for (int i = 0; i < height; i++) {
+		row(src_uyvy + i * src_pitch, dst_bgra + i * dst_pitch, width);
+	}
+}
+
+void DX::RGB24ToBGRA(const uint8_t* src_rgb24, int src_pitch,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height)
+{
+	for (int i = 0; i < height; i++) {
+		RGB24ToBGRARow(src_rgb24 + i * src_pitch, dst_bgra + i * dst_pitch, width);
+	}
+}
+
+void DX::RGBAToBGRA(const uint8_t* src_rgba, int src_pitch,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height)
+{
+	for (int i = 0; i < height; i++) {
+		RGBAToBGRARow(src_rgba + i * src_pitch, dst_bgra + i * dst_pitch, width);
+	}
+}
+
+void DX::YUY2ToI422(const uint8_t* src_yuy2, int src_pitch,
+	uint8_t* dst_y, int dst_pitch_y,
+	uint8_t* dst_u, int dst_pitch_u,
+	uint8_t* dst_v, int dst_pitch_v,
+	int width, int height)
+{
+	for (int i = 0; i < height; i++) {
+		Packed422ToI422Row<1>(src_yuy2 + i * src_pitch,
+			dst_y + i * dst_pitch_y, dst_u + i * dst_pitch_u, dst_v + i * dst_pitch_v, width);
+	}
+}
+
+void DX::UYVYToI422(const uint8_t* src_uyvy, int src_pitch,
+	uint8_t* dst_y, int dst_pitch_y,
+	uint8_t* dst_u, int dst_pitch_u,
+	uint8_t* dst_v, int dst_pitch_v,
+	int width, int height)
+{
+	for (int i = 0; i < height; i++) {
+		Packed422ToI422Row<0>(src_uyvy + i * src_pitch,
+			dst_y + i * dst_pitch_y, dst_u + i * dst_pitch_u, dst_v + i * dst_pitch_v, width);
+	}
+}
+
+void DX::I010ToBGRA(const uint8_t* src_y, int src_pitch_y,
+	const uint8_t* src_u, int src_pitch_u,
+	const uint8_t* src_v, int src_pitch_v,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height, ColorMatrix matrix, ColorRange range)
+{
+	static const Planar16RowFunc kernels[COLOR_MATRIX_MAX][COLOR_RANGE_MAX] = YUV_ROW_KERNELS(I010ToBGRARow);
+	Planar16RowFunc row = SelectRowKernel(kernels, matrix, range);
+
+	for (int i = 0; i < height; i++) {
+		row(reinterpret_cast<const uint16_t*>(src_y + i * src_pitch_y),
+			reinterpret_cast<const uint16_t*>(src_u + (i / 2) * src_pitch_u),
+			reinterpret_cast<const uint16_t*>(src_v + (i / 2) * src_pitch_v),
+			dst_bgra + i * dst_pitch, width);
+	}
+}
+
+void DX::P010ToBGRA(const uint8_t* src_y, int src_pitch_y,
+	const uint8_t* src_uv, int src_pitch_uv,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height, ColorMatrix matrix, ColorRange range)
+{
+	static const SemiPlanar16RowFunc kernels[COLOR_MATRIX_MAX][COLOR_RANGE_MAX] = YUV_ROW_KERNELS(P010ToBGRARow);
+	SemiPlanar16RowFunc row = SelectRowKernel(kernels, matrix, range);
+
+	for (int i = 0; i < height; i++) {
+		row(reinterpret_cast<const uint16_t*>(src_y + i * src_pitch_y),
+			reinterpret_cast<const uint16_t*>(src_uv + (i / 2) * src_pitch_uv),
+			dst_bgra + i * dst_pitch, width);
+	}
+}
+
+void DX::FrameRowToBGRA(const PixelFrame* frame, int y, int x0, int x1, uint8_t* dst)
+{
+	int width = x1 - x0;
+
+	if (frame->format == PIXEL_FORMAT_ARGB) {
+		memcpy(dst, frame->plane[0] + y * frame->pitch[0] + x0 * 4, width * 4);
+	}
+	else if (frame->format == PIXEL_FORMAT_I420) {
+		I420ToBGRA(frame->plane[0] + y * frame->pitch[0] + x0, frame->pitch[0],
+			frame->plane[1] + (y / 2) * frame->pitch[1] + x0 / 2, frame->pitch[1],
+			frame->plane[2] + (y / 2) * frame->pitch[2] + x0 / 2, frame->pitch[2],
+			dst, width * 4, width, 1, frame->color_matrix, frame->color_range);
+	}
+	else if (frame->format == PIXEL_FORMAT_I444) {
+		I444ToBGRA(frame->plane[0] + y * frame->pitch[0] + x0, frame->pitch[0],
+			frame->plane[1] + y * frame->pitch[1] + x0, frame->pitch[1],
+			frame->plane[2] + y * frame->pitch[2] + x0, frame->pitch[2],
+			dst, width * 4, width, 1, frame->color_matrix, frame->color_range);
+	}
+	else if (frame->format == PIXEL_FORMAT_NV12) {
+		NV12ToBGRA(frame->plane[0] + y * frame->pitch[0] + x0, frame->pitch[0],
+			frame->plane[1] + (y / 2) * frame->pitch[1] + x0, frame->pitch[1],
+			dst, width * 4, width, 1, frame->color_matrix, frame->color_range);
+	}
+	else if (frame->format == PIXEL_FORMAT_P010) {
+		P010ToBGRA(frame->plane[0] + y * frame->pitch[0] + x0 * 2, frame->pitch[0],
+			frame->plane[1] + (y / 2) * frame->pitch[1] + x0 * 2, frame->pitch[1],
+			dst, width * 4, width, 1, frame->color_matrix, frame->color_range);
+	}
+	else if (frame->format == PIXEL_FORMAT_I010) {
+		I010ToBGRA(frame->plane[0] + y * frame->pitch[0] + x0 * 2, frame->pitch[0],
+			frame->plane[1] + (y / 2) * frame->pitch[1] + x0, frame->pitch[1],
+			frame->plane[2] + (y / 2) * frame->pitch[2] + x0, frame->pitch[2],
+			dst, width * 4, width, 1, frame->color_matrix, frame->color_range);
+	}
+	else if (frame->format == PIXEL_FORMAT_YUY2) {
+		YUY2ToBGRA(frame->plane[0] + y * frame->pitch[0] + x0 * 2, frame->pitch[0], dst, width * 4, width, 1, frame->color_matrix, frame->color_range);
+	}
+	else if (frame->format == PIXEL_FORMAT_UYVY) {
+		UYVYToBGRA(frame->plane[0] + y * frame->pitch[0] + x0 * 2, frame->pitch[0], dst, width * 4, width, 1, frame->color_matrix, frame->color_range);
+	}
+	else if (frame->format == PIXEL_FORMAT_I422) {
+		I422ToBGRA(frame->plane[0] + y * frame->pitch[0] + x0, frame->pitch[0],
+			frame->plane[1] + y * frame->pitch[1] + x0 / 2, frame->pitch[1],
+			frame->plane[2] + y * frame->pitch[2] + x0 / 2, frame->pitch[2],
+			dst, width * 4, width, 1, frame->color_matrix, frame->color_range);
+	}
+	else if (frame->format == PIXEL_FORMAT_RGB24) {
+		RGB24ToBGRA(frame->plane[0] + y * frame->pitch[0] + x0 * 3, frame->pitch[0], dst, width * 4, width, 1);
+	}
+	else if (frame->format == PIXEL_FORMAT_RGBA) {
+		RGBAToBGRA(frame->plane[0] + y * frame->pitch[0] + x0 * 4, frame->pitch[0], dst, width * 4, width, 1);
+	}
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "color_matrix.h"
+#include <cstdint>
+
+namespace DX {
+
+struct PixelFrame;
+
+// CPU YUV to BGRA conversion, BT.601 limited range by default (same default as the YUV and NV12 shaders).
+// The fixed point kernels are built from the color_matrix.h table for every
+// matrix and range. SSE2 is used on x86/x64, other targets fall back to the scalar path.
+
+void I420ToBGRA(const uint8_t* src_y, int src_pitch_y,
+	const uint8_t* src_u, int src_pitch_u,
+	const uint8_t* src_v, int src_pitch_v,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height,
+	ColorMatrix matrix = COLOR_MATRIX_BT601, ColorRange range = COLOR_RANGE_LIMITED);
+
+void I444ToBGRA(const uint8_t* src_y, int src_pitch_y,
+	const uint8_t* src_u, int src_pitch_u,
+	const uint8_t* src_v, int src_pitch_v,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height,
+	ColorMatrix matrix = COLOR_MATRIX_BT601, ColorRange range = COLOR_RANGE_LIMITED);
+
+void NV12ToBGRA(const uint8_t* src_y, int src_pitch_y,
+	const uint8_t* src_uv, int src_pitch_uv,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height,
+	ColorMatrix matrix = COLOR_MATRIX_BT601, ColorRange range = COLOR_RANGE_LIMITED);
+
+void I422ToBGRA(const uint8_t* src_y, int src_pitch_y,
+	const uint8_t* src_u, int src_pitch_u,
+	const uint8_t* src_v, int src_pitch_v,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height,
+	ColorMatrix matrix = COLOR_MATRIX_BT601, ColorRange range = COLOR_RANGE_LIMITED);
+
+// Packed 4:2:2, a pixel pair shares one U and V.
+void YUY2ToBGRA(const uint8_t* src_yuy2, int src_pitch,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height,
+	ColorMatrix matrix = COLOR_MATRIX_BT601, ColorRange range = COLOR_RANGE_LIMITED);
+
+void UYVYToBGRA(const uint8_t* src_uyvy, int src_pitch,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height,
+	ColorMatrix matrix = COLOR_MATRIX_BT601, ColorRange range = COLOR_RANGE_LIMITED);
+
+// Splits packed 4:2:2 into I422 planes, used to upload into the planar YUV shaders.
+void YUY2ToI422(const uint8_t* src_yuy2, int src_pitch,
+	uint8_t* dst_y, int dst_pitch_y,
+	uint8_t* dst_u, int dst_pitch_u,
+	uint8_t* dst_v, int dst_pitch_v,
+	int width, int height);
+
+void UYVYToI422(const uint8_t* src_uyvy, int src_pitch,
+	uint8_t* dst_y, int dst_pitch_y,
+	uint8_t* dst_u, int dst_pitch_u,
+	uint8_t* dst_v, int dst_pitch_v,
+	int width, int height);
+
+// RGB24 is B G R in memory and gets an opaque alpha, RGBA is R G B A.
+void RGB24ToBGRA(const uint8_t* src_rgb24, int src_pitch,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height);
+
+void RGBAToBGRA(const uint8_t* src_rgba, int src_pitch,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height);
+
+// 10-bit formats, 16-bit little-endian samples and pitches in bytes.
+// I010 holds the value in the low 10 bits, P010 in the high 10 bits.
+// Y keeps its 10-bit precision, U and V are rounded to 8 bits.
+
+void I010ToBGRA(const uint8_t* src_y, int src_pitch_y,
+	const uint8_t* src_u, int src_pitch_u,
+	const uint8_t* src_v, int src_pitch_v,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height,
+	ColorMatrix matrix = COLOR_MATRIX_BT601, ColorRange range = COLOR_RANGE_LIMITED);
+
+void P010ToBGRA(const uint8_t* src_y, int src_pitch_y,
+	const uint8_t* src_uv, int src_pitch_uv,
+	uint8_t* dst_bgra, int dst_pitch,
+	int width, int height,
+	ColorMatrix matrix = COLOR_MATRIX_BT601, ColorRange range = COLOR_RANGE_LIMITED);
+
+// Converts pixels [x0, x1) of row y of a frame in any PixelFormat with the
+// frame's color matrix and range, x0 must be even.
+void FrameRowToBGRA(const PixelFrame* frame, int y, int x0, int x1, uint8_t* dst);
+
+}
@@ -0,0 +1,39 @@
+#include "cpu_features.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+using namespace DX;
+
+static bool DetectAVX2()
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	int info[4] = { 0 };
+	__cpuid(info, 0);
+	if (info[0] < 7) {
+		return false;
+	}
+
+	// AVX and OSXSAVE, and the OS saves the YMM registers.
+	__cpuid(info, 1);
+	if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 ||
+		(_xgetbv(0) & 6) != 6) {
+		return false;
+	}
+
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	return __builtin_cpu_supports("avx2") != 0;
+#else
+	return false;
+#endif
+}
+
+bool DX::CPUHasAVX2()
+{
+	static const bool has_avx2 = DetectAVX2();
+	return has_avx2;
+}
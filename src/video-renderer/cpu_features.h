@@ -0,0 +1,17 @@
+#pragma once
+
+// AVX2 kernels are built without /arch:AVX2 and picked at runtime with CPUHasAVX2().
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define CPU_FEATURES_AVX2 1
+#define CPU_AVX2_TARGET
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CPU_FEATURES_AVX2 1
+#define CPU_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+namespace DX {
+
+// True if both the CPU and the OS support AVX2, checked once.
+bool CPUHasAVX2();
+
+}
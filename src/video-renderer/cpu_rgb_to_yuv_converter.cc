@@ -0,0 +1,352 @@
+#include "cpu_rgb_to_yuv_converter.h"
+#include "cpu_features.h"
+#include "worker_pool.h"
+#include "log.h"
+
+#include <cstring>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define CPU_RGB_TO_YUV_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#ifdef CPU_FEATURES_AVX2
+#include <immintrin.h>
+#endif
+
+using namespace DX;
+
+// Shader coefficients times 1000 for B, G, R and the offset (times 255), so
+// value * 255 = (B * b + G * g + R * r + 255 * offset) / 1000 exactly.
+static const int16_t kYCoeffs[4] = {  98,  504,  257,  62 };
+static const int16_t kUCoeffs[4] = { 439, -291, -148, 501 };
+static const int16_t kVCoeffs[4] = { -71, -368,  439, 501 };
+
+// Frames smaller than this are converted on the calling thread.
+static const int64_t kMinParallelPixels = 512 * 512;
+static const int kMinStripeRows = 16;
+
+static inline uint8_t RGBToValue(const uint8_t* bgra, const int16_t coeffs[4])
+{
+	int sum = bgra[0] * coeffs[0] + bgra[1] * coeffs[1] + bgra[2] * coeffs[2] + 255 * coeffs[3];
+	return static_cast<uint8_t>((sum + 500) / 1000);
+}
+
+static void RGBToYUVRowC(const uint8_t* src, uint8_t* dst_y, uint8_t* dst_u, uint8_t* dst_v, int x, int width)
+{
+	for (; x < width; x++) {
+		dst_y[x] = RGBToValue(src + x * 4, kYCoeffs);
+		dst_u[x] = RGBToValue(src + x * 4, kUCoeffs);
+		dst_v[x] = RGBToValue(src + x * 4, kVCoeffs);
+	}
+}
+
+static inline uint32_t PackCoeffs(int16_t c0, int16_t c1)
+{
+	return static_cast<uint16_t>(c0) | (static_cast<uint32_t>(static_cast<uint16_t>(c1)) << 16);
+}
+
+#ifdef CPU_RGB_TO_YUV_SSE2
+// Sums are below 2^18, so float keeps them exact and the 0.0005 margin makes
+// the truncation land on the same side as the integer (sum + 500) / 1000.
+static inline __m128i DivideRound1000(__m128i sum)
+{
+	__m128 value = _mm_mul_ps(_mm_cvtepi32_ps(sum), _mm_set1_ps(0.001f));
+	return _mm_cvttps_epi32(_mm_add_ps(value, _mm_set1_ps(0.5005f)));
+}
+
+// p01, p23: B G R 255 of 4 pixels as int16, returns 4 values as int32.
+static inline __m128i DotSSE2(__m128i p01, __m128i p23, __m128i coeffs)
+{
+	__m128 m01 = _mm_castsi128_ps(_mm_madd_epi16(p01, coeffs));
+	__m128 m23 = _mm_castsi128_ps(_mm_madd_epi16(p23, coeffs));
+	__m128i bg = _mm_castps_si128(_mm_shuffle_ps(m01, m23, _MM_SHUFFLE(2, 0, 2, 0)));
+	__m128i ra = _mm_castps_si128(_mm_shuffle_ps(m01, m23, _MM_SHUFFLE(3, 1, 3, 1)));
+	return DivideRound1000(_mm_add_epi32(bg, ra));
+}
+
+static int RGBToYUVRowSSE2(const uint8_t* src, uint8_t* dst_y, uint8_t* dst_u, uint8_t* dst_v, int width)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xff000000));
+	const __m128i y_coeffs = _mm_set_epi32(static_cast<int>(PackCoeffs(kYCoeffs[2], kYCoeffs[3])), static_cast<int>(PackCoeffs(kYCoeffs[0], kYCoeffs[1])),
+		static_cast<int>(PackCoeffs(kYCoeffs[2], kYCoeffs[3])), static_cast<int>(PackCoeffs(kYCoeffs[0], kYCoeffs[1])));
+	const __m128i u_coeffs = _mm_set_epi32(static_cast<int>(PackCoeffs(kUCoeffs[2], kUCoeffs[3])), static_cast<int>(PackCoeffs(kUCoeffs[0], kUCoeffs[1])),
+		static_cast<int>(PackCoeffs(kUCoeffs[2], kUCoeffs[3])), static_cast<int>(PackCoeffs(kUCoeffs[0], kUCoeffs[1])));
+	const __m128i v_coeffs = _mm_set_epi32(static_cast<int>(PackCoeffs(kVCoeffs[2], kVCoeffs[3])), static_cast<int>(PackCoeffs(kVCoeffs[0], kVCoeffs[1])),
+		static_cast<int>(PackCoeffs(kVCoeffs[2], kVCoeffs[3])), static_cast<int>(PackCoeffs(kVCoeffs[0], kVCoeffs[1])));
+
+	int x = 0;
+	for (; x + 8 <= width; x += 8) {
+		// The offset is multiplied by the alpha byte, forced to 255.
+		__m128i a = _mm_or_si128(_mm_loadu_si128((const __m128i*)(src + x * 4)), alpha);
+		__m128i b = _mm_or_si128(_mm_loadu_si128((const __m128i*)(src + x * 4 + 16)), alpha);
+		__m128i p01 = _mm_unpacklo_epi8(a, zero);
+		__m128i p23 = _mm_unpackhi_epi8(a, zero);
+		__m128i p45 = _mm_unpacklo_epi8(b, zero);
+		__m128i p67 = _mm_unpackhi_epi8(b, zero);
+
+		__m128i y = _mm_packs_epi32(DotSSE2(p01, p23, y_coeffs), DotSSE2(p45, p67, y_coeffs));
+		__m128i u = _mm_packs_epi32(DotSSE2(p01, p23, u_coeffs), DotSSE2(p45, p67, u_coeffs));
+		__m128i v = _mm_packs_epi32(DotSSE2(p01, p23, v_coeffs), DotSSE2(p45, p67, v_coeffs));
+		_mm_storel_epi64((__m128i*)(dst_y + x), _mm_packus_epi16(y, y));
+		_mm_storel_epi64((__m128i*)(dst_u + x), _mm_packus_epi16(u, u));
+		_mm_storel_epi64((__m128i*)(dst_v + x), _mm_packus_epi16(v, v));
+	}
+
+	return x;
+}
+#endif
+
+#ifdef CPU_FEATURES_AVX2
+// Same as DotSSE2 for 8 pixels, p0123 and p4567 hold 4 pixels each.
+CPU_AVX2_TARGET
+static inline __m128i DotAVX2(__m256i p0123, __m256i p4567, __m256i coeffs)
+{
+	__m256i sum = _mm256_hadd_epi32(_mm256_madd_epi16(p0123, coeffs), _mm256_madd_epi16(p4567, coeffs));
+	sum = _mm256_permute4x64_epi64(sum, _MM_SHUFFLE(3, 1, 2, 0));
+
+	__m256 value = _mm256_mul_ps(_mm256_cvtepi32_ps(sum), _mm256_set1_ps(0.001f));
+	__m256i result = _mm256_cvttps_epi32(_mm256_add_ps(value, _mm256_set1_ps(0.5005f)));
+	__m128i packed = _mm_packs_epi32(_mm256_castsi256_si128(result), _mm256_extracti128_si256(result, 1));
+	return _mm_packus_epi16(packed, packed);
+}
+
+CPU_AVX2_TARGET
+static int RGBToYUVRowAVX2(const uint8_t* src, uint8_t* dst_y, uint8_t* dst_u, uint8_t* dst_v, int width)
+{
+	const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xff000000));
+	const __m256i y_coeffs = _mm256_set_epi16(kYCoeffs[3], kYCoeffs[2], kYCoeffs[1], kYCoeffs[0], kYCoeffs[3], kYCoeffs[2], kYCoeffs[1], kYCoeffs[0],
+		kYCoeffs[3], kYCoeffs[2], kYCoeffs[1], kYCoeffs[0], kYCoeffs[3], kYCoeffs[2], kYCoeffs[1], kYCoeffs[0]);
+	const __m256i u_coeffs = _mm256_set_epi16(kUCoeffs[3], kUCoeffs[2], kUCoeffs[1], kUCoeffs[0], kUCoeffs[3], kUCoeffs[2], kUCoeffs[1], kUCoeffs[0],
+		kUCoeffs[3], kUCoeffs[2], kUCoeffs[1], kUCoeffs[0], kUCoeffs[3], kUCoeffs[2], kUCoeffs[1], kUCoeffs[0]);
+	const __m256i v_coeffs = _mm256_set_epi16(kVCoeffs[3], kVCoeffs[2], kVCoeffs[1], kVCoeffs[0], kVCoeffs[3], kVCoeffs[2], kVCoeffs[1], kVCoeffs[0],
+		kVCoeffs[3], kVCoeffs[2], kVCoeffs[1], kVCoeffs[0], kVCoeffs[3], kVCoeffs[2], kVCoeffs[1], kVCoeffs[0]);
+
+	int x = 0;
+	for (; x + 8 <= width; x += 8) {
+		__m256i p0123 = _mm256_cvtepu8_epi16(_mm_or_si128(_mm_loadu_si128((const __m128i*)(src + x * 4)), alpha));
+		__m256i p4567 = _mm256_cvtepu8_epi16(_mm_or_si128(_mm_loadu_si128((const __m128i*)(src + x * 4 + 16)), alpha));
+		_mm_storel_epi64((__m128i*)(dst_y + x), DotAVX2(p0123, p4567, y_coeffs));
+		_mm_storel_epi64((__m128i*)(dst_u + x), DotAVX2(p0123, p4567, u_coeffs));
+		_mm_storel_epi64((__m128i*)(dst_v + x), DotAVX2(p0123, p4567, v_coeffs));
+	}
+
+	return x;
+}
+#endif
+
+static void RGBToYUVRow(const uint8_t* src, uint8_t* dst_y, uint8_t* dst_u, uint8_t* dst_v, int width)
+{
+	int x = 0;
+
+#if defined(CPU_FEATURES_AVX2)
+	if (CPUHasAVX2()) {
+		x = RGBToYUVRowAVX2(src, dst_y, dst_u, dst_v, width);
+	}
+	else
+#endif
+	{
+#if defined(CPU_RGB_TO_YUV_SSE2)
+		x = RGBToYUVRowSSE2(src, dst_y, dst_u, dst_v, width);
+#endif
+	}
+
+	RGBToYUVRowC(src, dst_y, dst_u, dst_v, x, width);
+}
+
+// dst[i] = src[2 * i + phase]
+static void PickBytes(const uint8_t* src, uint8_t* dst, int count, int phase)
+{
+	int i = 0;
+
+#ifdef CPU_RGB_TO_YUV_SSE2
+	const __m128i mask = _mm_set1_epi16(0x00ff);
+	for (; i + 16 <= count; i += 16) {
+		__m128i a = _mm_loadu_si128((const __m128i*)(src + i * 2));
+		__m128i b = _mm_loadu_si128((const __m128i*)(src + i * 2 + 16));
+		if (phase) {
+			a = _mm_srli_epi16(a, 8);
+			b = _mm_srli_epi16(b, 8);
+		}
+		else {
+			a = _mm_and_si128(a, mask);
+			b = _mm_and_si128(b, mask);
+		}
+		_mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(a, b));
+	}
+#endif
+
+	for (; i < count; i++) {
+		dst[i] = src[2 * i + phase];
+	}
+}
+
+// dst = u[0] v[0] u[2] v[2] ..., count pairs.
+static void InterleaveEven(const uint8_t* src_u, const uint8_t* src_v, uint8_t* dst, int count)
+{
+	int i = 0;
+
+#ifdef CPU_RGB_TO_YUV_SSE2
+	const __m128i mask = _mm_set1_epi16(0x00ff);
+	for (; i + 8 <= count; i += 8) {
+		__m128i u = _mm_and_si128(_mm_loadu_si128((const __m128i*)(src_u + i * 2)), mask);
+		__m128i v = _mm_slli_epi16(_mm_loadu_si128((const __m128i*)(src_v + i * 2)), 8);
+		_mm_storeu_si128((__m128i*)(dst + i * 2), _mm_or_si128(u, v));
+	}
+#endif
+
+	for (; i < count; i++) {
+		dst[i * 2] = src_u[i * 2];
+		dst[i * 2 + 1] = src_v[i * 2];
+	}
+}
+
+CPURGBToYUVConverter::CPURGBToYUVConverter()
+{
+
+}
+
+CPURGBToYUVConverter::~CPURGBToYUVConverter()
+{
+	Destroy();
+}
+
+bool CPURGBToYUVConverter::Init(int width, int height)
+{
+	if (width <= 0 || height <= 0 || width % 4 != 0 || height % 2 != 0) {
+		LOG("Unsupported frame size, %dx%d", width, height);
+		return false;
+	}
+
+	if (!frame_pool_.Alloc(width, height, PIXEL_FORMAT_NV12, &yuv420_frame_) ||
+		!frame_pool_.Alloc(width, height, PIXEL_FORMAT_NV12, &chroma420_frame_)) {
+		Destroy();
+		return false;
+	}
+
+	width_ = width;
+	height_ = height;
+	return true;
+}
+
+void CPURGBToYUVConverter::Destroy()
+{
+	yuv420_frame_ = PixelFrame();
+	chroma420_frame_ = PixelFrame();
+	frame_pool_.Clear();
+	width_ = 0;
+	height_ = 0;
+}
+
+bool CPURGBToYUVConverter::Convert(const PixelFrame* argb_frame, const ChromaTileMask* mask)
+{
+	if (!yuv420_frame_.storage) {
+		return false;
+	}
+
+	if (argb_frame->format != PIXEL_FORMAT_ARGB || argb_frame->width != width_ || argb_frame->height != height_) {
+		LOG("Unexpected frame, format:%d size:%dx%d", argb_frame->format, argb_frame->width, argb_frame->height);
+		return false;
+	}
+
+	int num_stripes = 1;
+	WorkerPool& worker_pool = WorkerPool::Instance();
+	if (static_cast<int64_t>(width_) * height_ >= kMinParallelPixels) {
+		num_stripes = worker_pool.GetConcurrency();
+		if (num_stripes > height_ / kMinStripeRows) {
+			num_stripes = height_ / kMinStripeRows;
+		}
+	}
+
+	if (mask && !mask->Matches(width_, height_)) {
+		LOG("Chroma tile mask does not match %dx%d", width_, height_);
+		mask = NULL;
+	}
+
+	if (num_stripes <= 1) {
+		ConvertRows(argb_frame, 0, height_);
+		if (mask) {
+			ClearChroma420Tiles(*mask);
+		}
+		return true;
+	}
+
+	// Stripes start on even rows, each pair fills one row of both UV planes.
+	int stripe_rows = ((height_ + num_stripes - 1) / num_stripes + 1) & ~1;
+	worker_pool.Run(num_stripes, [=](int index) {
+		int top = index * stripe_rows;
+		int bottom = top + stripe_rows < height_ ? top + stripe_rows : height_;
+		if (top < bottom) {
+			ConvertRows(argb_frame, top, bottom);
+		}
+	});
+
+	if (mask) {
+		ClearChroma420Tiles(*mask);
+	}
+	return true;
+}
+
+void CPURGBToYUVConverter::ConvertRows(const PixelFrame* argb_frame, int top, int bottom)
+{
+	int half_width = width_ / 2;
+	std::vector<uint8_t> line(static_cast<size_t>(width_) * 2);
+	uint8_t* line_u = line.data();
+	uint8_t* line_v = line.data() + width_;
+
+	for (int y = top; y < bottom; y++) {
+		RGBToYUVRow(argb_frame->plane[0] + y * argb_frame->pitch[0],
+			yuv420_frame_.plane[0] + y * yuv420_frame_.pitch[0], line_u, line_v, width_);
+
+		// B4 B5
+		uint8_t* chroma_y = chroma420_frame_.plane[0] + y * chroma420_frame_.pitch[0];
+		PickBytes(line_u, chroma_y, half_width, 1);
+		PickBytes(line_v, chroma_y + half_width, half_width, 1);
+
+		if (y % 2 == 0) {
+			// B2 B3
+			InterleaveEven(line_u, line_v, yuv420_frame_.plane[1] + (y / 2) * yuv420_frame_.pitch[1], half_width);
+		}
+		else {
+			// B6 B8 | B7 B9
+			uint8_t* chroma_uv = chroma420_frame_.plane[1] + (y / 2) * chroma420_frame_.pitch[1];
+			PickBytes(line_u, chroma_uv, half_width, 0);
+			PickBytes(line_v, chroma_uv + half_width, half_width, 0);
+		}
+	}
+}
+
+void CPURGBToYUVConverter::ClearChroma420Tiles(const ChromaTileMask& mask)
+{
+	std::vector<PixelRect> rects;
+	GetChromaTileRuns(mask, width_, height_, false, rects);
+
+	for (auto& rect : rects) {
+		PixelRect y_rects[2], uv_rects[2];
+		GetChroma420Rects(width_, rect, y_rects, uv_rects);
+
+		for (int i = 0; i < 2; i++) {
+			for (int y = y_rects[i].top; y < y_rects[i].bottom; y++) {
+				memset(chroma420_frame_.plane[0] + y * chroma420_frame_.pitch[0] + y_rects[i].left,
+					128, y_rects[i].right - y_rects[i].left);
+			}
+
+			for (int y = uv_rects[i].top; y < uv_rects[i].bottom; y++) {
+				memset(chroma420_frame_.plane[1] + y * chroma420_frame_.pitch[1] + uv_rects[i].left * 2,
+					128, (uv_rects[i].right - uv_rects[i].left) * 2);
+			}
+		}
+	}
+}
+
+PixelFrame* CPURGBToYUVConverter::GetYUV420Frame()
+{
+	return yuv420_frame_.storage ? &yuv420_frame_ : NULL;
+}
+
+PixelFrame* CPURGBToYUVConverter::GetChroma420Frame()
+{
+	return chroma420_frame_.storage ? &chroma420_frame_ : NULL;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "renderer.h"
+#include "chroma_tile_mask.h"
+#include <cstdint>
+
+namespace DX {
+
+// CPU counterpart of D3D11RGBToYUVConverter, for hosts without a GPU.
+// Splits a BGRA frame into the same two NV12 frames as d3d11_rgb_to_yuv420.hlsl
+// and d3d11_rgb_to_chroma420.hlsl:
+//   YUV420    Y: Y444(x, y)   UV: U444(2x, 2y) V444(2x, 2y)                        (B1-B3)
+//   Chroma420 Y: U444(2x + 1, y) | V444(2x + 1, y)                                 (B4, B5)
+//             UV: U444(4x, 2y + 1) U444(4x + 2, 2y + 1) | V444(...)                (B6-B9)
+// Values are the shader formulas rounded half up, computed exactly in integers.
+// Rows run on the WorkerPool, AVX2 is picked at runtime and SSE2 otherwise.
+class CPURGBToYUVConverter
+{
+public:
+	CPURGBToYUVConverter();
+	virtual ~CPURGBToYUVConverter();
+
+	// width must be a multiple of 4 and height even.
+	bool Init(int width, int height);
+	void Destroy();
+
+	// argb_frame is PIXEL_FORMAT_ARGB of the size given to Init(). Chroma420
+	// samples of tiles outside mask are set to 128.
+	bool Convert(const PixelFrame* argb_frame, const ChromaTileMask* mask = NULL);
+
+	// NV12 frames, valid until the next Init() or Destroy().
+	PixelFrame* GetYUV420Frame();
+	PixelFrame* GetChroma420Frame();
+
+private:
+	void ConvertRows(const PixelFrame* argb_frame, int top, int bottom);
+	void ClearChroma420Tiles(const ChromaTileMask& mask);
+
+	int width_  = 0;
+	int height_ = 0;
+
+	PixelFramePool frame_pool_;
+	PixelFrame yuv420_frame_;
+	PixelFrame chroma420_frame_;
+};
+
+}
@@ -0,0 +1,371 @@
+#include "cpu_scaler.h"
+#include "worker_pool.h"
+#include "log.h"
+
+#include <cmath>
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define CPU_SCALER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+using namespace DX;
+
+static const int kWeightBits = 14;
+// Horizontally filtered rows are kept as int16 with this many fraction bits.
+static const int kRowBits = 6;
+
+// Outputs smaller than this are scaled on the calling thread.
+static const int64_t kMinParallelPixels = 512 * 512;
+static const int kMinStripeRows = 16;
+
+static const double kPi = 3.14159265358979323846;
+
+static double Sinc(double x)
+{
+	if (x == 0.0) {
+		return 1.0;
+	}
+	x *= kPi;
+	return sin(x) / x;
+}
+
+static double GetFilterRadius(ScaleFilter filter)
+{
+	switch (filter)
+	{
+	case SCALE_FILTER_BILINEAR:
+		return 1.0;
+	case SCALE_FILTER_BICUBIC:
+		return 2.0;
+	case SCALE_FILTER_LANCZOS3:
+		return 3.0;
+	default:
+		return 0.5;
+	}
+}
+
+static double GetFilterWeight(ScaleFilter filter, double x)
+{
+	x = fabs(x);
+
+	switch (filter)
+	{
+	case SCALE_FILTER_BILINEAR:
+		return x < 1.0 ? 1.0 - x : 0.0;
+	case SCALE_FILTER_BICUBIC: {
+		const double a = -0.5;
+		if (x < 1.0) {
+			return ((a + 2.0) * x - (a + 3.0)) * x * x + 1.0;
+		}
+		if (x < 2.0) {
+			return ((a * x - 5.0 * a) * x + 8.0 * a) * x - 4.0 * a;
+		}
+		return 0.0;
+	}
+	case SCALE_FILTER_LANCZOS3:
+		return x < 3.0 ? Sinc(x) * Sinc(x / 3.0) : 0.0;
+	default:
+		return x < 0.5 ? 1.0 : 0.0;
+	}
+}
+
+static inline uint8_t Clamp255(int value)
+{
+	return static_cast<uint8_t>(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+// dst[x - x0] = sum of taps source pixels, kRowBits fraction bits.
+static void FilterRow(const uint8_t* src, int16_t* dst, const int* offsets, const int16_t* weights, int taps, int x0, int x1)
+{
+	for (int x = x0; x < x1; x++) {
+		const uint8_t* s = src + offsets[x] * 4;
+		const int16_t* w = weights + x * taps;
+		int16_t* d = dst + (x - x0) * 4;
+		int k = 0;
+
+#ifdef CPU_SCALER_SSE2
+		const __m128i zero = _mm_setzero_si128();
+		__m128i sum = _mm_setzero_si128();
+		for (; k + 2 <= taps; k += 2) {
+			int64_t pixels = 0;
+			memcpy(&pixels, s + k * 4, 8);
+			__m128i p = _mm_unpacklo_epi8(_mm_cvtsi64_si128(pixels), zero);
+			// b0 b1 g0 g1 r0 r1 a0 a1
+			p = _mm_unpacklo_epi16(p, _mm_unpackhi_epi64(p, p));
+			__m128i ww = _mm_set1_epi32(static_cast<int>((static_cast<uint32_t>(static_cast<uint16_t>(w[k + 1])) << 16) | static_cast<uint16_t>(w[k])));
+			sum = _mm_add_epi32(sum, _mm_madd_epi16(p, ww));
+		}
+		int32_t sums[4];
+		_mm_storeu_si128((__m128i*)sums, sum);
+#else
+		int32_t sums[4] = { 0, 0, 0, 0 };
+#endif
+
+		for (; k < taps; k++) {
+			for (int c = 0; c < 4; c++) {
+				sums[c] += s[k * 4 + c] * w[k];
+			}
+		}
+
+		const int shift = kWeightBits - kRowBits;
+		for (int c = 0; c < 4; c++) {
+			d[c] = static_cast<int16_t>((sums[c] + (1 << (shift - 1))) >> shift);
+		}
+	}
+}
+
+// dst[i] = sum of rows[k][i] * weights[k], for count int16 values.
+static void FilterColumn(const int16_t* const* rows, const int16_t* weights, int taps, uint8_t* dst, int count)
+{
+	const int shift = kWeightBits + kRowBits;
+	int i = 0;
+
+#ifdef CPU_SCALER_SSE2
+	const __m128i round = _mm_set1_epi32(1 << (shift - 1));
+	for (; i + 8 <= count; i += 8) {
+		__m128i sum_lo = round;
+		__m128i sum_hi = round;
+		for (int k = 0; k < taps; k += 2) {
+			__m128i a = _mm_loadu_si128((const __m128i*)(rows[k] + i));
+			__m128i b = _mm_setzero_si128();
+			uint16_t w1 = 0;
+			if (k + 1 < taps) {
+				b = _mm_loadu_si128((const __m128i*)(rows[k + 1] + i));
+				w1 = static_cast<uint16_t>(weights[k + 1]);
+			}
+			__m128i ww = _mm_set1_epi32(static_cast<int>((static_cast<uint32_t>(w1) << 16) | static_cast<uint16_t>(weights[k])));
+			sum_lo = _mm_add_epi32(sum_lo, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), ww));
+			sum_hi = _mm_add_epi32(sum_hi, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), ww));
+		}
+		sum_lo = _mm_srai_epi32(sum_lo, shift);
+		sum_hi = _mm_srai_epi32(sum_hi, shift);
+		__m128i value = _mm_packs_epi32(sum_lo, sum_hi);
+		_mm_storel_epi64((__m128i*)(dst + i), _mm_packus_epi16(value, value));
+	}
+#endif
+
+	for (; i < count; i++) {
+		int sum = 1 << (shift - 1);
+		for (int k = 0; k < taps; k++) {
+			sum += rows[k][i] * weights[k];
+		}
+		dst[i] = Clamp255(sum >> shift);
+	}
+}
+
+ARGBScaler::ARGBScaler()
+{
+
+}
+
+ARGBScaler::~ARGBScaler()
+{
+
+}
+
+bool ARGBScaler::Init(int src_width, int src_height, int dst_width, int dst_height, ScaleFilter filter)
+{
+	if (src_width <= 0 || src_height <= 0 || dst_width <= 0 || dst_height <= 0) {
+		LOG("Invalid scale size, %dx%d -> %dx%d", src_width, src_height, dst_width, dst_height);
+		return false;
+	}
+
+	if (src_width == src_width_ && src_height == src_height_ &&
+		dst_width == dst_width_ && dst_height == dst_height_ && filter == filter_) {
+		return true;
+	}
+
+	src_width_ = src_width;
+	src_height_ = src_height;
+	dst_width_ = dst_width;
+	dst_height_ = dst_height;
+	filter_ = filter;
+
+	BuildTable(src_width, dst_width, filter, &x_table_);
+	BuildTable(src_height, dst_height, filter, &y_table_);
+	return true;
+}
+
+void ARGBScaler::BuildTable(int src_size, int dst_size, ScaleFilter filter, FilterTable* table)
+{
+	double scale = static_cast<double>(src_size) / dst_size;
+	table->offsets.assign(dst_size, 0);
+
+	if (filter == SCALE_FILTER_NEAREST) {
+		table->taps = 1;
+		table->weights.assign(dst_size, 1 << kWeightBits);
+		for (int i = 0; i < dst_size; i++) {
+			int offset = static_cast<int>((i + 0.5) * scale);
+			table->offsets[i] = offset < src_size ? offset : src_size - 1;
+		}
+		return;
+	}
+
+	// Down-scales stretch the kernel over the source so it also low-passes.
+	double stretch = scale > 1.0 ? scale : 1.0;
+	double support = GetFilterRadius(filter) * stretch;
+
+	std::vector<int> first(dst_size);
+	std::vector<std::vector<double>> weights(dst_size);
+	int taps = 1;
+
+	for (int i = 0; i < dst_size; i++) {
+		double center = (i + 0.5) * scale - 0.5;
+		int lo = static_cast<int>(ceil(center - support));
+		int hi = static_cast<int>(floor(center + support));
+		int clamped_lo = lo < 0 ? 0 : (lo >= src_size ? src_size - 1 : lo);
+		int clamped_hi = hi < 0 ? 0 : (hi >= src_size ? src_size - 1 : hi);
+
+		// Taps outside the source fold onto the edge pixel.
+		std::vector<double>& w = weights[i];
+		w.assign(clamped_hi - clamped_lo + 1, 0.0);
+		for (int j = lo; j <= hi; j++) {
+			int index = j < 0 ? 0 : (j >= src_size ? src_size - 1 : j);
+			w[index - clamped_lo] += GetFilterWeight(filter, (j - center) / stretch);
+		}
+
+		first[i] = clamped_lo;
+		taps = static_cast<int>(w.size()) > taps ? static_cast<int>(w.size()) : taps;
+	}
+
+	// Even tap counts let the SIMD paths work on pairs.
+	taps = (taps + 1) & ~1;
+	taps = taps < src_size ? taps : src_size;
+
+	table->taps = taps;
+	table->weights.assign(static_cast<size_t>(dst_size) * taps, 0);
+
+	for (int i = 0; i < dst_size; i++) {
+		std::vector<double>& w = weights[i];
+		int offset = first[i] + taps <= src_size ? first[i] : src_size - taps;
+		table->offsets[i] = offset;
+
+		double sum = 0.0;
+		for (double value : w) {
+			sum += value;
+		}
+
+		int16_t* dst = &table->weights[static_cast<size_t>(i) * taps];
+		int total = 0;
+		int largest = 0;
+		for (size_t j = 0; j < w.size(); j++) {
+			int k = first[i] - offset + static_cast<int>(j);
+			int value = static_cast<int>(floor(w[j] / sum * (1 << kWeightBits) + 0.5));
+			dst[k] = static_cast<int16_t>(value);
+			total += value;
+			largest = dst[k] > dst[largest] ? k : largest;
+		}
+
+		// Rounding must not change the brightness of flat areas.
+		dst[largest] = static_cast<int16_t>(dst[largest] + (1 << kWeightBits) - total);
+	}
+}
+
+void ARGBScaler::Scale(const uint8_t* src, int src_pitch, uint8_t* dst, int dst_pitch, const PixelRect* clip)
+{
+	if (x_table_.taps == 0 || y_table_.taps == 0) {
+		return;
+	}
+
+	PixelRect rect;
+	rect.right = dst_width_;
+	rect.bottom = dst_height_;
+	if (clip) {
+		rect.left = clip->left > 0 ? clip->left : 0;
+		rect.top = clip->top > 0 ? clip->top : 0;
+		rect.right = clip->right < dst_width_ ? clip->right : dst_width_;
+		rect.bottom = clip->bottom < dst_height_ ? clip->bottom : dst_height_;
+	}
+
+	int width = rect.right - rect.left;
+	int height = rect.bottom - rect.top;
+	if (width <= 0 || height <= 0) {
+		return;
+	}
+
+	int num_stripes = 1;
+	WorkerPool& worker_pool = WorkerPool::Instance();
+	if (static_cast<int64_t>(width) * height >= kMinParallelPixels) {
+		num_stripes = worker_pool.GetConcurrency();
+		if (num_stripes > height / kMinStripeRows) {
+			num_stripes = height / kMinStripeRows;
+		}
+	}
+
+	if (num_stripes <= 1) {
+		ScaleRows(src, src_pitch, dst, dst_pitch, rect);
+		return;
+	}
+
+	int stripe_rows = (height + num_stripes - 1) / num_stripes;
+	worker_pool.Run(num_stripes, [=](int index) {
+		PixelRect stripe = rect;
+		stripe.top = rect.top + index * stripe_rows;
+		stripe.bottom = stripe.top + stripe_rows < rect.bottom ? stripe.top + stripe_rows : rect.bottom;
+		if (stripe.top < stripe.bottom) {
+			ScaleRows(src, src_pitch, dst, dst_pitch, stripe);
+		}
+	});
+}
+
+bool ARGBScaler::GetSrcRect(const PixelRect& rect, PixelRect* src_rect)
+{
+	int left = rect.left > 0 ? rect.left : 0;
+	int top = rect.top > 0 ? rect.top : 0;
+	int right = rect.right < dst_width_ ? rect.right : dst_width_;
+	int bottom = rect.bottom < dst_height_ ? rect.bottom : dst_height_;
+	if (x_table_.taps == 0 || y_table_.taps == 0 || left >= right || top >= bottom) {
+		return false;
+	}
+
+	// Offsets grow with the output position, the last one reads the furthest.
+	src_rect->left = x_table_.offsets[left];
+	src_rect->top = y_table_.offsets[top];
+	src_rect->right = x_table_.offsets[right - 1] + x_table_.taps;
+	src_rect->bottom = y_table_.offsets[bottom - 1] + y_table_.taps;
+	return true;
+}
+
+void ARGBScaler::ScaleRows(const uint8_t* src, int src_pitch, uint8_t* dst, int dst_pitch, const PixelRect& clip)
+{
+	int width = clip.right - clip.left;
+
+	if (filter_ == SCALE_FILTER_NEAREST) {
+		for (int y = clip.top; y < clip.bottom; y++) {
+			const uint32_t* src_row = reinterpret_cast<const uint32_t*>(src + y_table_.offsets[y] * src_pitch);
+			uint32_t* dst_row = reinterpret_cast<uint32_t*>(dst + y * dst_pitch);
+			for (int x = clip.left; x < clip.right; x++) {
+				dst_row[x] = src_row[x_table_.offsets[x]];
+			}
+		}
+		return;
+	}
+
+	// Filtered source rows, slot = row % taps. Consecutive output rows read
+	// overlapping windows, so each source row is filtered once per stripe.
+	int taps = y_table_.taps;
+	size_t row_size = static_cast<size_t>(width) * 4;
+	std::vector<int16_t> cache(row_size * taps);
+	std::vector<int> cache_rows(taps, -1);
+	std::vector<const int16_t*> rows(taps);
+
+	for (int y = clip.top; y < clip.bottom; y++) {
+		int offset = y_table_.offsets[y];
+		for (int k = 0; k < taps; k++) {
+			int src_y = offset + k;
+			int slot = src_y % taps;
+			int16_t* row = &cache[slot * row_size];
+			if (cache_rows[slot] != src_y) {
+				FilterRow(src + src_y * src_pitch, row, x_table_.offsets.data(), x_table_.weights.data(),
+					x_table_.taps, clip.left, clip.right);
+				cache_rows[slot] = src_y;
+			}
+			rows[k] = row;
+		}
+
+		FilterColumn(rows.data(), &y_table_.weights[static_cast<size_t>(y) * taps], taps,
+			dst + y * dst_pitch + clip.left * 4, static_cast<int>(row_size));
+	}
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "renderer.h"
+#include <cstdint>
+#include <vector>
+
+namespace DX {
+
+enum ScaleFilter
+{
+	SCALE_FILTER_NEAREST = 0,
+	SCALE_FILTER_BILINEAR,
+	SCALE_FILTER_BICUBIC,  // Catmull-Rom
+	SCALE_FILTER_LANCZOS3,
+};
+
+// Separable BGRA scaler. Coefficient tables are built once in Init() and
+// widened on down-scales so every source pixel contributes. Rows run on the
+// WorkerPool when the output is large, SSE2 is used on x86/x64.
+class ARGBScaler
+{
+public:
+	ARGBScaler();
+	virtual ~ARGBScaler();
+
+	bool Init(int src_width, int src_height, int dst_width, int dst_height, ScaleFilter filter);
+
+	// dst is the origin of the dst_width x dst_height image, clip limits the
+	// pixels written (NULL for all of them).
+	void Scale(const uint8_t* src, int src_pitch, uint8_t* dst, int dst_pitch, const PixelRect* clip = NULL);
+
+	// Source pixels read by Scale() for the dst pixels in rect, false when
+	// no pixel of rect is inside the dst image.
+	bool GetSrcRect(const PixelRect& rect, PixelRect* src_rect);
+
+	int GetSrcWidth()  { return src_width_; }
+	int GetSrcHeight() { return src_height_; }
+	int GetDstWidth()  { return dst_width_; }
+	int GetDstHeight() { return dst_height_; }
+	ScaleFilter GetFilter() { return filter_; }
+
+private:
+	struct FilterTable
+	{
+		int taps = 0;
+		std::vector<int> offsets;       // first source pixel of each output pixel
+		std::vector<int16_t> weights;   // taps per output pixel, sum is 1 << 14
+	};
+
+	static void BuildTable(int src_size, int dst_size, ScaleFilter filter, FilterTable* table);
+
+	void ScaleRows(const uint8_t* src, int src_pitch, uint8_t* dst, int dst_pitch, const PixelRect& clip);
+
+	int src_width_  = 0;
+	int src_height_ = 0;
+	int dst_width_  = 0;
+	int dst_height_ = 0;
+	ScaleFilter filter_ = SCALE_FILTER_NEAREST;
+
+	FilterTable x_table_;
+	FilterTable y_table_;
+};
+
+}
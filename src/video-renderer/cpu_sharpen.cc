@@ -0,0 +1,304 @@
+#include "cpu_sharpen.h"
+#include "cpu_color_converter.h"
+#include "cpu_features.h"
+#include "worker_pool.h"
+
+#include <cstring>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define CPU_SHARPEN_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#ifdef CPU_FEATURES_AVX2
+#include <immintrin.h>
+#endif
+
+using namespace DX;
+
+// 11 bits keeps the center weight in int16 up to unsharp 10.
+static const int kWeightBits = 11;
+static const int kRadius = 2;
+static const int kTaps = 2 * kRadius + 1;
+
+// Rects smaller than this are sharpened on the calling thread.
+static const int64_t kMinParallelPixels = 256 * 256;
+static const int kMinStripeRows = 32;
+
+struct SharpenKernel
+{
+	int16_t weights[kTaps][kTaps];
+};
+
+static float ClampUnsharp(float unsharp)
+{
+	return unsharp < 0.0f ? 0.0f : (unsharp > 10.0f ? 10.0f : unsharp);
+}
+
+static void BuildKernel(float unsharp, SharpenKernel* kernel)
+{
+	// Linear samples at 1.5 and 1.2 pixels, per axis and summed over both directions.
+	static const float kCross[kTaps] = { 0.5f, 0.5f, 0.0f, 0.5f, 0.5f };
+	static const float kDiagonal[kTaps] = { 0.2f, 0.8f, 0.0f, 0.8f, 0.2f };
+	static const float kCenter[kTaps] = { 0.0f, 0.0f, 1.0f, 0.0f, 0.0f };
+
+	unsharp = ClampUnsharp(unsharp);
+
+	int sum = 0;
+	for (int i = 0; i < kTaps; i++) {
+		for (int j = 0; j < kTaps; j++) {
+			float t = kCenter[i] * kCenter[j] * 0.859375f
+				- (kCross[i] * kCenter[j] + kCenter[i] * kCross[j]) * 0.1171875f
+				- kDiagonal[i] * kDiagonal[j] * 0.09765625f;
+			float weight = kCenter[i] * kCenter[j] + unsharp * t;
+			float scaled = weight * (1 << kWeightBits);
+			kernel->weights[i][j] = static_cast<int16_t>(scaled < 0.0f ? scaled - 0.5f : scaled + 0.5f);
+			sum += kernel->weights[i][j];
+		}
+	}
+
+	// The filter keeps flat areas unchanged, put the rounding error in the center.
+	kernel->weights[kRadius][kRadius] += static_cast<int16_t>((1 << kWeightBits) - sum);
+}
+
+static inline uint8_t Clamp255(int value)
+{
+	return static_cast<uint8_t>(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+// rows[i] points kRadius pixels left of the first output pixel of row y + i - kRadius.
+static void SharpenRowC(const uint8_t* const* rows, const SharpenKernel& kernel, uint8_t* dst, int x, int width)
+{
+	for (; x < width; x++) {
+		for (int c = 0; c < 4; c++) {
+			int sum = 1 << (kWeightBits - 1);
+			for (int i = 0; i < kTaps; i++) {
+				const uint8_t* src = rows[i] + x * 4 + c;
+				for (int j = 0; j < kTaps; j++) {
+					sum += kernel.weights[i][j] * src[j * 4];
+				}
+			}
+			dst[x * 4 + c] = Clamp255(sum >> kWeightBits);
+		}
+	}
+}
+
+static inline uint32_t PackWeights(int16_t w0, int16_t w1)
+{
+	return static_cast<uint16_t>(w0) | (static_cast<uint32_t>(static_cast<uint16_t>(w1)) << 16);
+}
+
+#ifdef CPU_SHARPEN_SSE2
+// Taps j and j + 1 of one row are interleaved and summed with pmaddwd.
+static int SharpenRowSSE2(const uint8_t* const* rows, const SharpenKernel& kernel, uint8_t* dst, int width)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i round = _mm_set1_epi32(1 << (kWeightBits - 1));
+
+	__m128i weights[kTaps][3];
+	for (int i = 0; i < kTaps; i++) {
+		weights[i][0] = _mm_set1_epi32(static_cast<int>(PackWeights(kernel.weights[i][0], kernel.weights[i][1])));
+		weights[i][1] = _mm_set1_epi32(static_cast<int>(PackWeights(kernel.weights[i][2], kernel.weights[i][3])));
+		weights[i][2] = _mm_set1_epi32(static_cast<int>(PackWeights(kernel.weights[i][4], 0)));
+	}
+
+	int x = 0;
+	for (; x + 4 <= width; x += 4) {
+		__m128i acc0 = round, acc1 = round, acc2 = round, acc3 = round;
+
+		for (int i = 0; i < kTaps; i++) {
+			const uint8_t* src = rows[i] + x * 4;
+			for (int j = 0; j < kTaps; j += 2) {
+				__m128i a = _mm_loadu_si128((const __m128i*)(src + j * 4));
+				__m128i b = j + 1 < kTaps ? _mm_loadu_si128((const __m128i*)(src + (j + 1) * 4)) : zero;
+				__m128i a01 = _mm_unpacklo_epi8(a, zero);
+				__m128i a23 = _mm_unpackhi_epi8(a, zero);
+				__m128i b01 = _mm_unpacklo_epi8(b, zero);
+				__m128i b23 = _mm_unpackhi_epi8(b, zero);
+				const __m128i& w = weights[i][j / 2];
+				acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(_mm_unpacklo_epi16(a01, b01), w));
+				acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(_mm_unpackhi_epi16(a01, b01), w));
+				acc2 = _mm_add_epi32(acc2, _mm_madd_epi16(_mm_unpacklo_epi16(a23, b23), w));
+				acc3 = _mm_add_epi32(acc3, _mm_madd_epi16(_mm_unpackhi_epi16(a23, b23), w));
+			}
+		}
+
+		__m128i p01 = _mm_packs_epi32(_mm_srai_epi32(acc0, kWeightBits), _mm_srai_epi32(acc1, kWeightBits));
+		__m128i p23 = _mm_packs_epi32(_mm_srai_epi32(acc2, kWeightBits), _mm_srai_epi32(acc3, kWeightBits));
+		_mm_storeu_si128((__m128i*)(dst + x * 4), _mm_packus_epi16(p01, p23));
+	}
+
+	return x;
+}
+#endif
+
+#ifdef CPU_FEATURES_AVX2
+// Same as SharpenRowSSE2, 4 pixels in one register.
+CPU_AVX2_TARGET
+static int SharpenRowAVX2(const uint8_t* const* rows, const SharpenKernel& kernel, uint8_t* dst, int width)
+{
+	const __m256i round = _mm256_set1_epi32(1 << (kWeightBits - 1));
+
+	__m256i weights[kTaps][3];
+	for (int i = 0; i < kTaps; i++) {
+		weights[i][0] = _mm256_set1_epi32(static_cast<int>(PackWeights(kernel.weights[i][0], kernel.weights[i][1])));
+		weights[i][1] = _mm256_set1_epi32(static_cast<int>(PackWeights(kernel.weights[i][2], kernel.weights[i][3])));
+		weights[i][2] = _mm256_set1_epi32(static_cast<int>(PackWeights(kernel.weights[i][4], 0)));
+	}
+
+	int x = 0;
+	for (; x + 4 <= width; x += 4) {
+		// Lane 0 holds pixels 0 and 2, lane 1 pixels 1 and 3.
+		__m256i acc02 = round, acc13 = round;
+
+		for (int i = 0; i < kTaps; i++) {
+			const uint8_t* src = rows[i] + x * 4;
+			for (int j = 0; j < kTaps; j += 2) {
+				__m256i a = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(src + j * 4)));
+				__m256i b = j + 1 < kTaps ? _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(src + (j + 1) * 4))) : _mm256_setzero_si256();
+				const __m256i& w = weights[i][j / 2];
+				acc02 = _mm256_add_epi32(acc02, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), w));
+				acc13 = _mm256_add_epi32(acc13, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), w));
+			}
+		}
+
+		__m256i p = _mm256_packs_epi32(_mm256_srai_epi32(acc02, kWeightBits), _mm256_srai_epi32(acc13, kWeightBits));
+		p = _mm256_packus_epi16(p, p);
+		p = _mm256_permute4x64_epi64(p, 0x08);
+		_mm_storeu_si128((__m128i*)(dst + x * 4), _mm256_castsi256_si128(p));
+	}
+
+	return x;
+}
+#endif
+
+static void SharpenRow(const uint8_t* const* rows, const SharpenKernel& kernel, uint8_t* dst, int width)
+{
+	int x = 0;
+
+#if defined(CPU_FEATURES_AVX2)
+	if (CPUHasAVX2()) {
+		x = SharpenRowAVX2(rows, kernel, dst, width);
+	}
+	else
+#endif
+	{
+#if defined(CPU_SHARPEN_SSE2)
+		x = SharpenRowSSE2(rows, kernel, dst, width);
+#endif
+	}
+
+	SharpenRowC(rows, kernel, dst, x, width);
+}
+
+// fill_row(y, x0, x1, line) writes BGRA pixels [x0, x1) of source row y, x0 is even.
+template<typename FillRow>
+static void SharpenRows(int width, int height, const PixelRect& rect, const SharpenKernel& kernel,
+	const FillRow& fill_row, uint8_t* dst, int dst_pitch)
+{
+	// Lines start on an even pixel so 4:2:0 chroma stays aligned.
+	int line_left = (rect.left - kRadius) & ~1;
+	int line_right = rect.right + kRadius;
+	int line_width = line_right - line_left;
+	int fill_left = line_left > 0 ? line_left : 0;
+	int fill_right = line_right < width ? line_right : width;
+	int offset = rect.left - kRadius - line_left;
+
+	std::vector<uint8_t> lines(static_cast<size_t>(kTaps) * line_width * 4);
+	int line_rows[kTaps];
+	for (int i = 0; i < kTaps; i++) {
+		line_rows[i] = -1;
+	}
+
+	for (int y = rect.top; y < rect.bottom; y++) {
+		const uint8_t* rows[kTaps];
+
+		for (int i = 0; i < kTaps; i++) {
+			int src_y = y + i - kRadius;
+			src_y = src_y < 0 ? 0 : (src_y >= height ? height - 1 : src_y);
+
+			// The rows of one window are consecutive, so they never share a slot.
+			int slot = src_y % kTaps;
+			uint8_t* line = lines.data() + static_cast<size_t>(slot) * line_width * 4;
+			if (line_rows[slot] != src_y) {
+				fill_row(src_y, fill_left, fill_right, line + (fill_left - line_left) * 4);
+				for (int x = line_left; x < fill_left; x++) {
+					memcpy(line + (x - line_left) * 4, line + (fill_left - line_left) * 4, 4);
+				}
+				for (int x = fill_right; x < line_right; x++) {
+					memcpy(line + (x - line_left) * 4, line + (fill_right - 1 - line_left) * 4, 4);
+				}
+				line_rows[slot] = src_y;
+			}
+			rows[i] = line + offset * 4;
+		}
+
+		SharpenRow(rows, kernel, dst + y * dst_pitch + rect.left * 4, rect.right - rect.left);
+	}
+}
+
+template<typename FillRow>
+static void SharpenRect(int width, int height, const PixelRect& rect, float unsharp,
+	const FillRow& fill_row, uint8_t* dst, int dst_pitch)
+{
+	PixelRect clip = rect;
+	clip.left = clip.left > 0 ? clip.left : 0;
+	clip.top = clip.top > 0 ? clip.top : 0;
+	clip.right = clip.right < width ? clip.right : width;
+	clip.bottom = clip.bottom < height ? clip.bottom : height;
+	if (clip.left >= clip.right || clip.top >= clip.bottom) {
+		return;
+	}
+
+	SharpenKernel kernel;
+	BuildKernel(unsharp, &kernel);
+
+	int clip_width = clip.right - clip.left;
+	int clip_height = clip.bottom - clip.top;
+
+	int num_stripes = 1;
+	WorkerPool& worker_pool = WorkerPool::Instance();
+	if (static_cast<int64_t>(clip_width) * clip_height >= kMinParallelPixels) {
+		num_stripes = worker_pool.GetConcurrency();
+		if (num_stripes > clip_height / kMinStripeRows) {
+			num_stripes = clip_height / kMinStripeRows;
+		}
+	}
+
+	if (num_stripes <= 1) {
+		SharpenRows(width, height, clip, kernel, fill_row, dst, dst_pitch);
+		return;
+	}
+
+	// Each stripe converts its own two rows of context above and below.
+	int stripe_rows = (clip_height + num_stripes - 1) / num_stripes;
+	worker_pool.Run(num_stripes, [&](int index) {
+		PixelRect stripe = clip;
+		stripe.top = clip.top + index * stripe_rows;
+		stripe.bottom = stripe.top + stripe_rows < clip.bottom ? stripe.top + stripe_rows : clip.bottom;
+		if (stripe.top < stripe.bottom) {
+			SharpenRows(width, height, stripe, kernel, fill_row, dst, dst_pitch);
+		}
+	});
+}
+
+void DX::SharpenBGRA(const uint8_t* src, int src_pitch, uint8_t* dst, int dst_pitch,
+	int width, int height, const PixelRect& rect, float unsharp)
+{
+	auto fill_row = [=](int y, int x0, int x1, uint8_t* line) {
+		memcpy(line, src + y * src_pitch + x0 * 4, (x1 - x0) * 4);
+	};
+
+	SharpenRect(width, height, rect, unsharp, fill_row, dst, dst_pitch);
+}
+
+void DX::ConvertAndSharpen(const PixelFrame* frame, const PixelRect& rect, float unsharp,
+	uint8_t* dst, int dst_pitch)
+{
+	auto fill_row = [=](int y, int x0, int x1, uint8_t* line) {
+		FrameRowToBGRA(frame, y, x0, x1, line);
+	};
+
+	SharpenRect(frame->width, frame->height, rect, unsharp, fill_row, dst, dst_pitch);
+}
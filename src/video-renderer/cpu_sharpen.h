@@ -0,0 +1,29 @@
+#pragma once
+
+#include "renderer.h"
+#include <cstdint>
+
+namespace DX {
+
+// CPU version of the sharpen pass (d3d11_sharpen.hlsl, mpv unsharp):
+//   out = p + unsharp * (p * 0.859375 - cross * 0.1171875 - diagonal * 0.09765625)
+// with the cross samples 1.5 and the diagonal samples 1.2 pixels away. The
+// shader interpolates them linearly and clamps them to the edge texels, which
+// folds into one 5x5 kernel with clamped edges.
+// AVX2 is picked at runtime on x86/x64 and SSE2 is the fallback, there is
+// no SSE4 path. Other targets use the scalar path.
+// unsharp: 0.0 to 10.0
+
+// Sharpens rect of a width x height BGRA image. src and dst are image origins
+// and must not overlap.
+void SharpenBGRA(const uint8_t* src, int src_pitch, uint8_t* dst, int dst_pitch,
+	int width, int height, const PixelRect& rect, float unsharp);
+
+// Converts rect of a frame in any PixelFormat to BGRA and sharpens it in
+// the same pass: source rows are converted into a five line ring and filtered
+// while still in cache, the unsharpened image is never written out.
+// dst is the origin of a frame sized BGRA image.
+void ConvertAndSharpen(const PixelFrame* frame, const PixelRect& rect, float unsharp,
+	uint8_t* dst, int dst_pitch);
+
+}
@@ -0,0 +1,355 @@
+#include "cpu_yuv_to_rgb_converter.h"
+#include "color_matrix.h"
+#include "cpu_features.h"
+#include "worker_pool.h"
+#include "log.h"
+
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define CPU_YUV_TO_RGB_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#ifdef CPU_FEATURES_AVX2
+#include <immintrin.h>
+#endif
+
+using namespace DX;
+
+// Same constants as d3d11_yuv_to_rgb.hlsl, the zero coefficients are left out.
+static constexpr YUVShaderConstants kConstants = GetYUVShaderConstants(COLOR_MATRIX_BT601, COLOR_RANGE_LIMITED);
+static const float kOffsetY = kConstants.offset[0];
+static const float kOffsetC = kConstants.offset[1];
+static const float kYR = kConstants.r[0], kVR = kConstants.r[2];
+static const float kYG = kConstants.g[0], kUG = kConstants.g[1], kVG = kConstants.g[2];
+static const float kYB = kConstants.b[0], kUB = kConstants.b[1];
+
+// Frames smaller than this are combined on the calling thread.
+static const int64_t kMinParallelPixels = 512 * 512;
+static const int kMinStripeRows = 16;
+
+// Float to UNORM8 as the output merger does it, saturate then round.
+static inline uint8_t ToUnorm8(float value)
+{
+	value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+	return static_cast<uint8_t>(static_cast<int>(value * 255.0f + 0.5f));
+}
+
+static void YUVToBGRARowC(const uint8_t* src_y, const uint8_t* src_u, const uint8_t* src_v, uint8_t* dst, int x, int width)
+{
+	for (; x < width; x++) {
+		float y = src_y[x] / 255.0f + kOffsetY;
+		float u = src_u[x] / 255.0f + kOffsetC;
+		float v = src_v[x] / 255.0f + kOffsetC;
+		dst[x * 4 + 0] = ToUnorm8(y * kYB + u * kUB);
+		dst[x * 4 + 1] = ToUnorm8(y * kYG + u * kUG + v * kVG);
+		dst[x * 4 + 2] = ToUnorm8(y * kYR + v * kVR);
+		dst[x * 4 + 3] = 0xff;
+	}
+}
+
+#ifdef CPU_YUV_TO_RGB_SSE2
+// Same operations in the same order as YUVToBGRARowC, so results are identical.
+static inline __m128i FloatToUnorm8(__m128 value)
+{
+	value = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+	return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(value, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+}
+
+static inline __m128 ByteToFloat(__m128i value, float offset)
+{
+	return _mm_add_ps(_mm_div_ps(_mm_cvtepi32_ps(value), _mm_set1_ps(255.0f)), _mm_set1_ps(offset));
+}
+
+// b, g, r: 8 x int16 in [0, 255], writes 8 BGRA pixels.
+static inline void StoreBGRA8(__m128i b, __m128i g, __m128i r, uint8_t* dst)
+{
+	const __m128i alpha = _mm_set1_epi8(static_cast<char>(0xff));
+
+	b = _mm_packus_epi16(b, b);
+	g = _mm_packus_epi16(g, g);
+	r = _mm_packus_epi16(r, r);
+
+	__m128i bg = _mm_unpacklo_epi8(b, g);
+	__m128i ra = _mm_unpacklo_epi8(r, alpha);
+	_mm_storeu_si128((__m128i*)(dst), _mm_unpacklo_epi16(bg, ra));
+	_mm_storeu_si128((__m128i*)(dst + 16), _mm_unpackhi_epi16(bg, ra));
+}
+
+static int YUVToBGRARowSSE2(const uint8_t* src_y, const uint8_t* src_u, const uint8_t* src_v, uint8_t* dst, int width)
+{
+	const __m128i zero = _mm_setzero_si128();
+
+	int x = 0;
+	for (; x + 8 <= width; x += 8) {
+		__m128i y16 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(src_y + x)), zero);
+		__m128i u16 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(src_u + x)), zero);
+		__m128i v16 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(src_v + x)), zero);
+
+		__m128i b[2], g[2], r[2];
+		for (int i = 0; i < 2; i++) {
+			__m128 y = ByteToFloat(i ? _mm_unpackhi_epi16(y16, zero) : _mm_unpacklo_epi16(y16, zero), kOffsetY);
+			__m128 u = ByteToFloat(i ? _mm_unpackhi_epi16(u16, zero) : _mm_unpacklo_epi16(u16, zero), kOffsetC);
+			__m128 v = ByteToFloat(i ? _mm_unpackhi_epi16(v16, zero) : _mm_unpacklo_epi16(v16, zero), kOffsetC);
+			b[i] = FloatToUnorm8(_mm_add_ps(_mm_mul_ps(y, _mm_set1_ps(kYB)), _mm_mul_ps(u, _mm_set1_ps(kUB))));
+			g[i] = FloatToUnorm8(_mm_add_ps(_mm_add_ps(_mm_mul_ps(y, _mm_set1_ps(kYG)), _mm_mul_ps(u, _mm_set1_ps(kUG))),
+				_mm_mul_ps(v, _mm_set1_ps(kVG))));
+			r[i] = FloatToUnorm8(_mm_add_ps(_mm_mul_ps(y, _mm_set1_ps(kYR)), _mm_mul_ps(v, _mm_set1_ps(kVR))));
+		}
+
+		StoreBGRA8(_mm_packs_epi32(b[0], b[1]), _mm_packs_epi32(g[0], g[1]), _mm_packs_epi32(r[0], r[1]), dst + x * 4);
+	}
+
+	return x;
+}
+#endif
+
+#ifdef CPU_FEATURES_AVX2
+CPU_AVX2_TARGET
+static inline __m128i FloatToUnorm8AVX2(__m256 value)
+{
+	value = _mm256_min_ps(_mm256_max_ps(value, _mm256_setzero_ps()), _mm256_set1_ps(1.0f));
+	__m256i result = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(value, _mm256_set1_ps(255.0f)), _mm256_set1_ps(0.5f)));
+	return _mm_packs_epi32(_mm256_castsi256_si128(result), _mm256_extracti128_si256(result, 1));
+}
+
+CPU_AVX2_TARGET
+static inline __m256 ByteToFloatAVX2(const uint8_t* src, float offset)
+{
+	__m256 value = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)src)));
+	return _mm256_add_ps(_mm256_div_ps(value, _mm256_set1_ps(255.0f)), _mm256_set1_ps(offset));
+}
+
+CPU_AVX2_TARGET
+static int YUVToBGRARowAVX2(const uint8_t* src_y, const uint8_t* src_u, const uint8_t* src_v, uint8_t* dst, int width)
+{
+	int x = 0;
+	for (; x + 8 <= width; x += 8) {
+		__m256 y = ByteToFloatAVX2(src_y + x, kOffsetY);
+		__m256 u = ByteToFloatAVX2(src_u + x, kOffsetC);
+		__m256 v = ByteToFloatAVX2(src_v + x, kOffsetC);
+
+		__m128i b = FloatToUnorm8AVX2(_mm256_add_ps(_mm256_mul_ps(y, _mm256_set1_ps(kYB)), _mm256_mul_ps(u, _mm256_set1_ps(kUB))));
+		__m128i g = FloatToUnorm8AVX2(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(y, _mm256_set1_ps(kYG)), _mm256_mul_ps(u, _mm256_set1_ps(kUG))),
+			_mm256_mul_ps(v, _mm256_set1_ps(kVG))));
+		__m128i r = FloatToUnorm8AVX2(_mm256_add_ps(_mm256_mul_ps(y, _mm256_set1_ps(kYR)), _mm256_mul_ps(v, _mm256_set1_ps(kVR))));
+
+		StoreBGRA8(b, g, r, dst + x * 4);
+	}
+
+	return x;
+}
+#endif
+
+static void YUVToBGRARow(const uint8_t* src_y, const uint8_t* src_u, const uint8_t* src_v, uint8_t* dst, int width)
+{
+	int x = 0;
+
+#if defined(CPU_FEATURES_AVX2)
+	if (CPUHasAVX2()) {
+		x = YUVToBGRARowAVX2(src_y, src_u, src_v, dst, width);
+	}
+	else
+#endif
+	{
+#if defined(CPU_YUV_TO_RGB_SSE2)
+		x = YUVToBGRARowSSE2(src_y, src_u, src_v, dst, width);
+#endif
+	}
+
+	YUVToBGRARowC(src_y, src_u, src_v, dst, x, width);
+}
+
+// Even rows, B2 B3 + B4 B5: dst_u = uv[0] odd_u[0] uv[2] odd_u[1] ..., same for v.
+static void InterleaveUVRow(const uint8_t* src_uv, const uint8_t* odd_u, const uint8_t* odd_v,
+	uint8_t* dst_u, uint8_t* dst_v, int pairs)
+{
+	int i = 0;
+
+#ifdef CPU_YUV_TO_RGB_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i mask = _mm_set1_epi16(0x00ff);
+	for (; i + 8 <= pairs; i += 8) {
+		__m128i uv = _mm_loadu_si128((const __m128i*)(src_uv + i * 2));
+		__m128i u = _mm_unpacklo_epi8(zero, _mm_loadl_epi64((const __m128i*)(odd_u + i)));
+		__m128i v = _mm_unpacklo_epi8(zero, _mm_loadl_epi64((const __m128i*)(odd_v + i)));
+		_mm_storeu_si128((__m128i*)(dst_u + i * 2), _mm_or_si128(_mm_and_si128(uv, mask), u));
+		_mm_storeu_si128((__m128i*)(dst_v + i * 2), _mm_or_si128(_mm_srli_epi16(uv, 8), v));
+	}
+#endif
+
+	for (; i < pairs; i++) {
+		dst_u[i * 2] = src_uv[i * 2];
+		dst_u[i * 2 + 1] = odd_u[i];
+		dst_v[i * 2] = src_uv[i * 2 + 1];
+		dst_v[i * 2 + 1] = odd_v[i];
+	}
+}
+
+// Odd rows, B6 B8 + B4 and B7 B9 + B5: dst = even[0] odd[0] even[1] odd[1] ...
+static void InterleaveRow(const uint8_t* even, const uint8_t* odd, uint8_t* dst, int pairs)
+{
+	int i = 0;
+
+#ifdef CPU_YUV_TO_RGB_SSE2
+	for (; i + 16 <= pairs; i += 16) {
+		__m128i a = _mm_loadu_si128((const __m128i*)(even + i));
+		__m128i b = _mm_loadu_si128((const __m128i*)(odd + i));
+		_mm_storeu_si128((__m128i*)(dst + i * 2), _mm_unpacklo_epi8(a, b));
+		_mm_storeu_si128((__m128i*)(dst + i * 2 + 16), _mm_unpackhi_epi8(a, b));
+	}
+#endif
+
+	for (; i < pairs; i++) {
+		dst[i * 2] = even[i];
+		dst[i * 2 + 1] = odd[i];
+	}
+}
+
+CPUYUVToRGBConverter::CPUYUVToRGBConverter()
+{
+
+}
+
+CPUYUVToRGBConverter::~CPUYUVToRGBConverter()
+{
+	Destroy();
+}
+
+// Bilinear 4:2:0 to 4:4:4 for columns [x0, x1) of row y. The YUV420 chroma
+// is co-sited with the top left pixel of each 2x2 block, so even pixels take
+// their sample as is and odd ones average it with the next, clamped at the edges.
+static void UpsampleUVRow(const uint8_t* src_uv, int src_pitch, int half_width, int half_height,
+	int y, int x0, int x1, uint8_t* dst_u, uint8_t* dst_v)
+{
+	int j0 = y / 2;
+	int j1 = y % 2 == 1 && j0 + 1 < half_height ? j0 + 1 : j0;
+	const uint8_t* row0 = src_uv + j0 * src_pitch;
+	const uint8_t* row1 = src_uv + j1 * src_pitch;
+
+	for (int x = x0; x < x1; x++) {
+		int i0 = (x / 2) * 2;
+		int i1 = x % 2 == 1 && x / 2 + 1 < half_width ? i0 + 2 : i0;
+
+		for (int c = 0; c < 2; c++) {
+			int value = row0[i0 + c] + row0[i1 + c] + row1[i0 + c] + row1[i1 + c];
+			(c == 0 ? dst_u : dst_v)[x] = static_cast<uint8_t>((value + 2) >> 2);
+		}
+	}
+}
+
+bool CPUYUVToRGBConverter::Init(int width, int height)
+{
+	if (width <= 0 || height <= 0 || width % 4 != 0 || height % 2 != 0) {
+		LOG("Unsupported frame size, %dx%d", width, height);
+		return false;
+	}
+
+	if (!frame_pool_.Alloc(width, height, PIXEL_FORMAT_ARGB, &rgba_frame_)) {
+		Destroy();
+		return false;
+	}
+
+	width_ = width;
+	height_ = height;
+	return true;
+}
+
+void CPUYUVToRGBConverter::Destroy()
+{
+	rgba_frame_ = PixelFrame();
+	frame_pool_.Clear();
+	width_ = 0;
+	height_ = 0;
+}
+
+bool CPUYUVToRGBConverter::Combine(const PixelFrame* yuv420_frame, const PixelFrame* chroma420_frame, const ChromaTileMask* mask)
+{
+	if (!rgba_frame_.storage) {
+		return false;
+	}
+
+	const PixelFrame* frames[2] = { yuv420_frame, chroma420_frame };
+	for (auto frame : frames) {
+		if (frame->format != PIXEL_FORMAT_NV12 || frame->width != width_ || frame->height != height_) {
+			LOG("Unexpected frame, format:%d size:%dx%d", frame->format, frame->width, frame->height);
+			return false;
+		}
+	}
+
+	if (mask && !mask->Matches(width_, height_)) {
+		LOG("Chroma tile mask does not match %dx%d", width_, height_);
+		mask = NULL;
+	}
+
+	int num_stripes = 1;
+	WorkerPool& worker_pool = WorkerPool::Instance();
+	if (static_cast<int64_t>(width_) * height_ >= kMinParallelPixels) {
+		num_stripes = worker_pool.GetConcurrency();
+		if (num_stripes > height_ / kMinStripeRows) {
+			num_stripes = height_ / kMinStripeRows;
+		}
+	}
+
+	if (num_stripes <= 1) {
+		CombineRows(yuv420_frame, chroma420_frame, mask, 0, height_);
+		return true;
+	}
+
+	int stripe_rows = (height_ + num_stripes - 1) / num_stripes;
+	worker_pool.Run(num_stripes, [=](int index) {
+		int top = index * stripe_rows;
+		int bottom = top + stripe_rows < height_ ? top + stripe_rows : height_;
+		if (top < bottom) {
+			CombineRows(yuv420_frame, chroma420_frame, mask, top, bottom);
+		}
+	});
+
+	return true;
+}
+
+void CPUYUVToRGBConverter::CombineRows(const PixelFrame* yuv420_frame, const PixelFrame* chroma420_frame,
+	const ChromaTileMask* mask, int top, int bottom)
+{
+	int half_width = width_ / 2;
+	std::vector<uint8_t> line(static_cast<size_t>(width_) * 2);
+	uint8_t* line_u = line.data();
+	uint8_t* line_v = line.data() + width_;
+
+	for (int y = top; y < bottom; y++) {
+		// B4 B5, odd columns of every row.
+		const uint8_t* odd_u = chroma420_frame->plane[0] + y * chroma420_frame->pitch[0];
+		const uint8_t* odd_v = odd_u + half_width;
+
+		if (y % 2 == 0) {
+			InterleaveUVRow(yuv420_frame->plane[1] + (y / 2) * yuv420_frame->pitch[1], odd_u, odd_v,
+				line_u, line_v, half_width);
+		}
+		else {
+			const uint8_t* even_u = chroma420_frame->plane[1] + (y / 2) * chroma420_frame->pitch[1];
+			InterleaveRow(even_u, odd_u, line_u, half_width);
+			InterleaveRow(even_u + half_width, odd_v, line_v, half_width);
+		}
+
+		if (mask) {
+			int ty = y / mask->tile_size;
+			for (int tx = 0; tx < mask->tiles_x; tx++) {
+				if (!mask->IsSet(tx, ty)) {
+					int x0 = tx * mask->tile_size;
+					int x1 = x0 + mask->tile_size < width_ ? x0 + mask->tile_size : width_;
+					UpsampleUVRow(yuv420_frame->plane[1], yuv420_frame->pitch[1], half_width, height_ / 2,
+						y, x0, x1, line_u, line_v);
+				}
+			}
+		}
+
+		YUVToBGRARow(yuv420_frame->plane[0] + y * yuv420_frame->pitch[0], line_u, line_v,
+			rgba_frame_.plane[0] + y * rgba_frame_.pitch[0], width_);
+	}
+}
+
+PixelFrame* CPUYUVToRGBConverter::GetRGBAFrame()
+{
+	return rgba_frame_.storage ? &rgba_frame_ : NULL;
+}
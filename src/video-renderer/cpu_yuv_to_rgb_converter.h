@@ -0,0 +1,44 @@
+#pragma once
+
+#include "renderer.h"
+#include "chroma_tile_mask.h"
+#include <cstdint>
+
+namespace DX {
+
+// CPU counterpart of D3D11YUVToRGBConverter::Combine(), rebuilds full chroma BGRA
+// from a decoded YUV420 frame and its Chroma420 companion (B1-B9 layout, see
+// CPURGBToYUVConverter). Instead of branching per pixel like d3d11_yuv_to_rgb.hlsl,
+// each row's U444 and V444 are de-interleaved from the two frames with shuffles
+// and then converted with the shader's float math, so the output matches a
+// scalar port of the shader exactly. Rows run on the WorkerPool, AVX2 is picked
+// at runtime and SSE2 otherwise.
+class CPUYUVToRGBConverter
+{
+public:
+	CPUYUVToRGBConverter();
+	virtual ~CPUYUVToRGBConverter();
+
+	// width must be a multiple of 4 and height even.
+	bool Init(int width, int height);
+	void Destroy();
+
+	// Both frames are NV12 of the size given to Init(). Tiles outside mask use
+	// the YUV420 chroma interpolated between its co-sited samples, as
+	// d3d11_yuv420_to_rgb.hlsl does.
+	bool Combine(const PixelFrame* yuv420_frame, const PixelFrame* chroma420_frame, const ChromaTileMask* mask = NULL);
+
+	// PIXEL_FORMAT_ARGB frame, valid until the next Init() or Destroy().
+	PixelFrame* GetRGBAFrame();
+
+private:
+	void CombineRows(const PixelFrame* yuv420_frame, const PixelFrame* chroma420_frame, const ChromaTileMask* mask, int top, int bottom);
+
+	int width_  = 0;
+	int height_ = 0;
+
+	PixelFramePool frame_pool_;
+	PixelFrame rgba_frame_;
+};
+
+}
@@ -0,0 +1,275 @@
+#include "cursor_overlay.h"
+#include "plane_copy.h"
+#include "log.h"
+
+using namespace DX;
+
+static bool IntersectRect(const PixelRect& a, const PixelRect& b, PixelRect* rect)
+{
+	rect->left = a.left > b.left ? a.left : b.left;
+	rect->top = a.top > b.top ? a.top : b.top;
+	rect->right = a.right < b.right ? a.right : b.right;
+	rect->bottom = a.bottom < b.bottom ? a.bottom : b.bottom;
+	return rect->left < rect->right && rect->top < rect->bottom;
+}
+
+static inline uint8_t Blend(uint8_t src, uint8_t dst, uint8_t alpha)
+{
+	return static_cast<uint8_t>((src * alpha + dst * (255 - alpha) + 127) / 255);
+}
+
+// Bytes of data DrawCursor() reads for a shape.
+static size_t GetShapeDataSize(const CursorShape& shape)
+{
+	int rows = shape.type == CURSOR_SHAPE_MONOCHROME ? shape.height * 2 : shape.height;
+	int row_bytes = shape.type == CURSOR_SHAPE_MONOCHROME ? (shape.width + 7) / 8 : shape.width * 4;
+	if (shape.width <= 0 || shape.height <= 0 || shape.pitch < row_bytes) {
+		return 0;
+	}
+	return static_cast<size_t>(shape.pitch) * (rows - 1) + row_bytes;
+}
+
+bool DX::GetCursorRect(const CursorState& cursor, int width, int height, PixelRect* rect)
+{
+	if (!cursor.is_visible || !cursor.shape || cursor.shape->width <= 0 || cursor.shape->height <= 0) {
+		return false;
+	}
+
+	PixelRect cursor_rect;
+	cursor_rect.left = cursor.x;
+	cursor_rect.top = cursor.y;
+	cursor_rect.right = cursor.x + cursor.shape->width;
+	cursor_rect.bottom = cursor.y + cursor.shape->height;
+
+	PixelRect frame_rect;
+	frame_rect.right = width;
+	frame_rect.bottom = height;
+	return IntersectRect(cursor_rect, frame_rect, rect);
+}
+
+void DX::DrawCursor(PixelFrame* frame, const CursorState& cursor, const PixelRect& clip)
+{
+	if (frame->format != PIXEL_FORMAT_ARGB && frame->format != PIXEL_FORMAT_RGBA) {
+		return;
+	}
+
+	PixelRect cursor_rect, rect;
+	if (!GetCursorRect(cursor, frame->width, frame->height, &cursor_rect) || !IntersectRect(cursor_rect, clip, &rect)) {
+		return;
+	}
+
+	const CursorShape& shape = *cursor.shape;
+	size_t shape_size = GetShapeDataSize(shape);
+	if (shape_size == 0 || shape.data.size() < shape_size) {
+		LOG("Cursor shape data too small, %dx%d pitch %d", shape.width, shape.height, shape.pitch);
+		return;
+	}
+
+	// Shapes are BGRA, RGBA frames swap red and blue.
+	int r = frame->format == PIXEL_FORMAT_RGBA ? 0 : 2;
+	int b = 2 - r;
+
+	for (int y = rect.top; y < rect.bottom; y++) {
+		uint8_t* dst = frame->plane[0] + y * frame->pitch[0];
+		int shape_y = y - cursor.y;
+
+		for (int x = rect.left; x < rect.right; x++) {
+			uint8_t* pixel = dst + x * 4;
+			int shape_x = x - cursor.x;
+
+			if (shape.type == CURSOR_SHAPE_MONOCHROME) {
+				int bit = 0x80 >> (shape_x & 7);
+				uint8_t and_mask = (shape.data[shape_y * shape.pitch + shape_x / 8] & bit) ? 0xff : 0x00;
+				uint8_t xor_mask = (shape.data[(shape_y + shape.height) * shape.pitch + shape_x / 8] & bit) ? 0xff : 0x00;
+				pixel[0] = (pixel[0] & and_mask) ^ xor_mask;
+				pixel[1] = (pixel[1] & and_mask) ^ xor_mask;
+				pixel[2] = (pixel[2] & and_mask) ^ xor_mask;
+				continue;
+			}
+
+			const uint8_t* src = &shape.data[shape_y * shape.pitch + shape_x * 4];
+			if (shape.type == CURSOR_SHAPE_MASKED_COLOR) {
+				if (src[3] == 0xff) {
+					pixel[b] ^= src[0];
+					pixel[1] ^= src[1];
+					pixel[r] ^= src[2];
+				}
+				else {
+					pixel[b] = src[0];
+					pixel[1] = src[1];
+					pixel[r] = src[2];
+				}
+			}
+			else {
+				pixel[b] = Blend(src[0], pixel[b], src[3]);
+				pixel[1] = Blend(src[1], pixel[1], src[3]);
+				pixel[r] = Blend(src[2], pixel[r], src[3]);
+			}
+		}
+	}
+}
+
+static void WriteLE(std::vector<uint8_t>& data, uint32_t value, int bytes)
+{
+	for (int i = 0; i < bytes; i++) {
+		data.push_back(static_cast<uint8_t>((value >> (i * 8)) & 0xff));
+	}
+}
+
+static uint32_t ReadLE(const uint8_t* data, int bytes)
+{
+	uint32_t value = 0;
+	for (int i = 0; i < bytes; i++) {
+		value |= static_cast<uint32_t>(data[i]) << (i * 8);
+	}
+	return value;
+}
+
+void DX::SerializeCursorState(const CursorState& cursor, bool include_shape, std::vector<uint8_t>& data)
+{
+	size_t shape_size = include_shape && cursor.shape ? GetShapeDataSize(*cursor.shape) : 0;
+	include_shape = shape_size > 0 && cursor.shape->data.size() >= shape_size;
+
+	data.clear();
+	data.push_back(static_cast<uint8_t>((cursor.is_visible ? 1 : 0) | (include_shape ? 2 : 0)));
+	WriteLE(data, static_cast<uint32_t>(cursor.x), 4);
+	WriteLE(data, static_cast<uint32_t>(cursor.y), 4);
+
+	if (include_shape) {
+		const CursorShape& shape = *cursor.shape;
+		int header[6] = { shape.type, shape.width, shape.height, shape.pitch, shape.hot_x, shape.hot_y };
+		for (int i = 0; i < 6; i++) {
+			WriteLE(data, static_cast<uint32_t>(header[i]), 2);
+		}
+		data.insert(data.end(), shape.data.begin(), shape.data.begin() + shape_size);
+	}
+}
+
+bool DX::ParseCursorState(const uint8_t* data, size_t size, CursorState* cursor)
+{
+	if (size < 9 || (data[0] & ~3) != 0) {
+		return false;
+	}
+
+	std::shared_ptr<CursorShape> shape;
+	if (data[0] & 2) {
+		if (size < 21) {
+			return false;
+		}
+
+		int header[6];
+		for (int i = 0; i < 6; i++) {
+			header[i] = static_cast<int>(ReadLE(data + 9 + i * 2, 2));
+		}
+		if (header[0] != CURSOR_SHAPE_MONOCHROME && header[0] != CURSOR_SHAPE_COLOR && header[0] != CURSOR_SHAPE_MASKED_COLOR) {
+			return false;
+		}
+
+		shape = std::make_shared<CursorShape>();
+		shape->type = static_cast<CursorShapeType>(header[0]);
+		shape->width = header[1];
+		shape->height = header[2];
+		shape->pitch = header[3];
+		shape->hot_x = header[4];
+		shape->hot_y = header[5];
+		size_t shape_size = GetShapeDataSize(*shape);
+		if (shape_size == 0 || size != 21 + shape_size) {
+			return false;
+		}
+		shape->data.assign(data + 21, data + size);
+	}
+	else if (size != 9) {
+		return false;
+	}
+
+	cursor->is_visible = (data[0] & 1) != 0;
+	cursor->x = static_cast<int32_t>(ReadLE(data + 1, 4));
+	cursor->y = static_cast<int32_t>(ReadLE(data + 5, 4));
+	if (shape) {
+		cursor->shape = shape;
+	}
+	return true;
+}
+
+CursorCompositor::CursorCompositor()
+	: frame_pool_(1)
+{
+
+}
+
+CursorCompositor::~CursorCompositor()
+{
+	Reset();
+}
+
+const PixelFrame* CursorCompositor::Compose(const PixelFrame* frame, const std::vector<PixelRect>& dirty_rects, bool is_unchanged,
+	const CursorState& cursor)
+{
+	if (!frame || (frame->format != PIXEL_FORMAT_ARGB && frame->format != PIXEL_FORMAT_RGBA)) {
+		return NULL;
+	}
+
+	bool whole_frame = !has_output_ || output_.width != frame->width || output_.height != frame->height ||
+		output_.format != frame->format;
+
+	if (whole_frame) {
+		output_ = PixelFrame();
+		if (!frame_pool_.Alloc(frame->width, frame->height, frame->format, &output_)) {
+			has_output_ = false;
+			return NULL;
+		}
+		has_output_ = true;
+		has_cursor_rect_ = false;
+	}
+
+	// Damage of the frame, then the old cursor area is restored from it.
+	PixelFrame damage;
+	damage.width = frame->width;
+	damage.height = frame->height;
+	damage.format = frame->format;
+	damage.dirty_rects = dirty_rects;
+	damage.is_unchanged = is_unchanged;
+	GetDirtyRects(&damage, whole_frame, rects_);
+
+	if (has_cursor_rect_) {
+		rects_.push_back(cursor_rect_);
+	}
+
+	for (auto& rect : rects_) {
+		CopyRect(frame, rect);
+	}
+
+	has_cursor_rect_ = GetCursorRect(cursor, frame->width, frame->height, &cursor_rect_);
+	if (has_cursor_rect_) {
+		DrawCursor(&output_, cursor, cursor_rect_);
+		rects_.push_back(cursor_rect_);
+	}
+
+	output_.color_matrix = frame->color_matrix;
+	output_.color_range = frame->color_range;
+	if (whole_frame) {
+		output_.dirty_rects.clear();
+	}
+	else {
+		output_.dirty_rects = rects_;
+	}
+	output_.is_unchanged = !whole_frame && rects_.empty();
+
+	return &output_;
+}
+
+void CursorCompositor::Reset()
+{
+	output_ = PixelFrame();
+	has_output_ = false;
+	has_cursor_rect_ = false;
+	rects_.clear();
+	frame_pool_.Clear();
+}
+
+void CursorCompositor::CopyRect(const PixelFrame* frame, const PixelRect& rect)
+{
+	CopyPlane(output_.plane[0] + rect.top * output_.pitch[0] + rect.left * 4, output_.pitch[0],
+		frame->plane[0] + rect.top * frame->pitch[0] + rect.left * 4, frame->pitch[0],
+		(rect.right - rect.left) * 4, rect.bottom - rect.top);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "renderer.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace DX {
+
+// Same meaning as DXGI_OUTDUPL_POINTER_SHAPE_TYPE.
+enum CursorShapeType
+{
+	CURSOR_SHAPE_MONOCHROME = 1,   // 1 bpp AND mask rows followed by XOR mask rows
+	CURSOR_SHAPE_COLOR = 2,        // BGRA, straight alpha
+	CURSOR_SHAPE_MASKED_COLOR = 4, // BGRA, alpha 0xFF XORs the screen, 0 replaces it
+};
+
+struct CursorShape
+{
+	CursorShapeType type = CURSOR_SHAPE_COLOR;
+	int width  = 0;
+	int height = 0;  // visible rows, monochrome data holds twice as many
+	int pitch  = 0;
+	int hot_x  = 0;
+	int hot_y  = 0;
+	std::vector<uint8_t> data;
+};
+
+struct CursorState
+{
+	// Shapes are shared between states until the cursor changes its look.
+	std::shared_ptr<const CursorShape> shape;
+	// Top left corner of the shape in frame pixels.
+	int  x = 0;
+	int  y = 0;
+	bool is_visible = false;
+};
+
+// Frame pixels covered by the cursor in a width x height frame, false if none.
+bool GetCursorRect(const CursorState& cursor, int width, int height, PixelRect* rect);
+
+// Draws the cursor into an ARGB or RGBA frame, touching only pixels inside clip.
+void DrawCursor(PixelFrame* frame, const CursorState& cursor, const PixelRect& clip);
+
+// Transport form: a flags byte (bit 0 visible, bit 1 shape follows), x and y as
+// little endian int32, then with include_shape the shape type, width, height,
+// pitch, hot_x and hot_y as little endian uint16 followed by the shape data.
+// Send the shape only when it changed, ParseCursorState() keeps the last one.
+void SerializeCursorState(const CursorState& cursor, bool include_shape, std::vector<uint8_t>& data);
+bool ParseCursorState(const uint8_t* data, size_t size, CursorState* cursor);
+
+// Puts the cursor on top of captured frames at render time, on the CPU. The
+// output keeps the last frame, so a cursor move only restores the old cursor
+// area and draws the new one. Supports ARGB and RGBA.
+class CursorCompositor
+{
+public:
+	CursorCompositor();
+	virtual ~CursorCompositor();
+
+	// dirty_rects and is_unchanged follow PixelFrame and are relative to the
+	// frame of the previous Compose(). The output lists the pixels it changed in
+	// its dirty_rects and stays valid until the next Compose() or Reset().
+	const PixelFrame* Compose(const PixelFrame* frame, const std::vector<PixelRect>& dirty_rects, bool is_unchanged,
+		const CursorState& cursor);
+
+	void Reset();
+
+private:
+	void CopyRect(const PixelFrame* frame, const PixelRect& rect);
+
+	PixelFramePool frame_pool_;
+	PixelFrame output_;
+	bool has_output_ = false;
+
+	bool has_cursor_rect_ = false;
+	PixelRect cursor_rect_;
+	std::vector<PixelRect> rects_;
+};
+
+}
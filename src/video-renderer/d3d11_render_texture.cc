@@ -73,13 +73,7 @@ bool D3D11RenderTexture::InitTexture(UINT width, UINT height, DXGI_FORMAT format
 		return false;
 	}
 
-	DX_SAFE_RELEASE(texture_);
-	DX_SAFE_RELEASE(texture_rtv_);
-	DX_SAFE_RELEASE(texture_srv_);
-	DX_SAFE_RELEASE(nv12_y_rtv_);
-	DX_SAFE_RELEASE(nv12_uv_rtv_);
-	DX_SAFE_RELEASE(nv12_y_srv_);
-	DX_SAFE_RELEASE(nv12_uv_srv_);
+	ReleaseTexture();
 
 	HRESULT hr = S_OK;
 
@@ -103,14 +97,48 @@ bool D3D11RenderTexture::InitTexture(UINT width, UINT height, DXGI_FORMAT format
 		return false;
 	}
 
+	return CreateViews();
+}
+
+bool D3D11RenderTexture::InitTexture(ID3D11Texture2D* texture)
+{
+	if (!d3d11_device_ || !texture) {
+		return false;
+	}
+
+	if (texture == texture_) {
+		return true;
+	}
+
+	ReleaseTexture();
+
+	texture_ = texture;
+	texture_->AddRef();
+	return CreateViews();
+}
+
+bool D3D11RenderTexture::CreateViews()
+{
+	HRESULT hr = S_OK;
+
+	D3D11_TEXTURE2D_DESC texture_desc;
+	texture_->GetDesc(&texture_desc);
+
+	DXGI_FORMAT format = texture_desc.Format;
+	UINT bind_flags = texture_desc.BindFlags;
+
 	D3D11_RENDER_TARGET_VIEW_DESC rtv_desc;
 	D3D11_SHADER_RESOURCE_VIEW_DESC rsv_desc;
 	memset(&rtv_desc, 0, sizeof(D3D11_RENDER_TARGET_VIEW_DESC));
 	memset(&rsv_desc, 0, sizeof(D3D11_SHADER_RESOURCE_VIEW_DESC));
 
-	if (format == DXGI_FORMAT_NV12) {
+	if (format == DXGI_FORMAT_NV12 || format == DXGI_FORMAT_P010) {
+		// P010 planes are viewed as R16 and R16G16.
+		DXGI_FORMAT y_format = (format == DXGI_FORMAT_P010) ? DXGI_FORMAT_R16_UNORM : DXGI_FORMAT_R8_UNORM;
+		DXGI_FORMAT uv_format = (format == DXGI_FORMAT_P010) ? DXGI_FORMAT_R16G16_UNORM : DXGI_FORMAT_R8G8_UNORM;
+
 		if (bind_flags & D3D11_BIND_RENDER_TARGET) {
-			rtv_desc.Format = DXGI_FORMAT_R8_UNORM;
+			rtv_desc.Format = y_format;
 			rtv_desc.ViewDimension = D3D11_RTV_DIMENSION_TEXTURE2D;
 			rtv_desc.Texture2D.MipSlice = 0;
 
@@ -120,7 +148,7 @@ bool D3D11RenderTexture::InitTexture(UINT width, UINT height, DXGI_FORMAT format
 				goto failed;
 			}
 
-			rtv_desc.Format = DXGI_FORMAT_R8G8_UNORM;
+			rtv_desc.Format = uv_format;
 			hr = d3d11_device_->CreateRenderTargetView(texture_, &rtv_desc, &nv12_uv_rtv_);
 			if (FAILED(hr)) {
 				LOG("ID3D11Device::CreateRenderTargetView(R8G8) failed, %x \n", hr);
@@ -128,23 +156,25 @@ bool D3D11RenderTexture::InitTexture(UINT width, UINT height, DXGI_FORMAT format
 			}
 		}
 
-		memset(&rsv_desc, 0, sizeof(D3D11_SHADER_RESOURCE_VIEW_DESC));
-		rsv_desc.Format = DXGI_FORMAT_R8_UNORM;
-		rsv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
-		rsv_desc.Texture2D.MostDetailedMip = 0;
-		rsv_desc.Texture2D.MipLevels = 1;
+		if (bind_flags & D3D11_BIND_SHADER_RESOURCE) {
+			memset(&rsv_desc, 0, sizeof(D3D11_SHADER_RESOURCE_VIEW_DESC));
+			rsv_desc.Format = y_format;
+			rsv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+			rsv_desc.Texture2D.MostDetailedMip = 0;
+			rsv_desc.Texture2D.MipLevels = 1;
 
-		hr = d3d11_device_->CreateShaderResourceView(texture_, &rsv_desc, &nv12_y_srv_);
-		if (FAILED(hr)) {
-			LOG("ID3D11Device::CreateShaderResourceView(R8) failed, %x \n", hr);
-			goto failed;
-		}
+			hr = d3d11_device_->CreateShaderResourceView(texture_, &rsv_desc, &nv12_y_srv_);
+			if (FAILED(hr)) {
+				LOG("ID3D11Device::CreateShaderResourceView(R8) failed, %x \n", hr);
+				goto failed;
+			}
 
-		rsv_desc.Format = DXGI_FORMAT_R8G8_UNORM;
-		hr = d3d11_device_->CreateShaderResourceView(texture_, &rsv_desc, &nv12_uv_srv_);
-		if (FAILED(hr)) {
-			LOG("ID3D11Device::CreateShaderResourceView(R8G8) failed, %x \n", hr);
-			goto failed;
+			rsv_desc.Format = uv_format;
+			hr = d3d11_device_->CreateShaderResourceView(texture_, &rsv_desc, &nv12_uv_srv_);
+			if (FAILED(hr)) {
+				LOG("ID3D11Device::CreateShaderResourceView(R8G8) failed, %x \n", hr);
+				goto failed;
+			}
 		}
 	}
 	else {
@@ -160,29 +190,25 @@ bool D3D11RenderTexture::InitTexture(UINT width, UINT height, DXGI_FORMAT format
 			}
 		}
 
-		memset(&rsv_desc, 0, sizeof(D3D11_SHADER_RESOURCE_VIEW_DESC));
-		rsv_desc.Format = format;
-		rsv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
-		rsv_desc.Texture2D.MostDetailedMip = 0;
-		rsv_desc.Texture2D.MipLevels = 1;
+		if (bind_flags & D3D11_BIND_SHADER_RESOURCE) {
+			memset(&rsv_desc, 0, sizeof(D3D11_SHADER_RESOURCE_VIEW_DESC));
+			rsv_desc.Format = format;
+			rsv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+			rsv_desc.Texture2D.MostDetailedMip = 0;
+			rsv_desc.Texture2D.MipLevels = 1;
 
-		hr = d3d11_device_->CreateShaderResourceView(texture_, &rsv_desc, &texture_srv_);
-		if (FAILED(hr)) {
-			LOG("ID3D11Device::CreateShaderResourceView() failed, %x \n", hr);
-			goto failed;
+			hr = d3d11_device_->CreateShaderResourceView(texture_, &rsv_desc, &texture_srv_);
+			if (FAILED(hr)) {
+				LOG("ID3D11Device::CreateShaderResourceView() failed, %x \n", hr);
+				goto failed;
+			}
 		}
 	}
 
 	return true;
 
 failed:
-	DX_SAFE_RELEASE(texture_);
-	DX_SAFE_RELEASE(texture_rtv_);
-	DX_SAFE_RELEASE(texture_srv_);
-	DX_SAFE_RELEASE(nv12_y_rtv_);
-	DX_SAFE_RELEASE(nv12_uv_rtv_);
-	DX_SAFE_RELEASE(nv12_y_srv_);
-	DX_SAFE_RELEASE(nv12_uv_srv_);
+	ReleaseTexture();
 	return false;
 }
 
@@ -199,11 +225,15 @@ bool D3D11RenderTexture::InitVertexShader()
 
 	HRESULT hr = S_OK;
 
-	D3D11_TEXTURE2D_DESC desc;
-	texture_->GetDesc(&desc);
-
-	float width = static_cast<FLOAT>(desc.Width);
-	float height = static_cast<FLOAT>(desc.Height);
+	// Begin() updates the vertices to the texture size of each draw.
+	float width = 0.0f;
+	float height = 0.0f;
+	if (texture_) {
+		D3D11_TEXTURE2D_DESC desc;
+		texture_->GetDesc(&desc);
+		width = static_cast<FLOAT>(desc.Width);
+		height = static_cast<FLOAT>(desc.Height);
+	}
 
 	const D3D11_INPUT_ELEMENT_DESC layout[] =
 	{
@@ -354,7 +384,7 @@ bool D3D11RenderTexture::InitRasterizerState()
 	raster_desc.FillMode = D3D11_FILL_SOLID;
 	raster_desc.FrontCounterClockwise = FALSE;
 	raster_desc.MultisampleEnable = FALSE;
-	raster_desc.ScissorEnable = FALSE;
+	raster_desc.ScissorEnable = TRUE;
 	raster_desc.SlopeScaledDepthBias = 0.0f;
 
 	HRESULT hr = d3d11_device_->CreateRasterizerState(&raster_desc, &rasterizer_state_);
@@ -411,6 +441,14 @@ void D3D11RenderTexture::Cleanup()
 	DX_SAFE_RELEASE(vertex_buffer_);
 	DX_SAFE_RELEASE(pixel_shader_);
 
+	ReleaseTexture();
+
+	DX_SAFE_RELEASE(d3d11_device_);
+	DX_SAFE_RELEASE(d3d11_context_);
+}
+
+void D3D11RenderTexture::ReleaseTexture()
+{
 	DX_SAFE_RELEASE(texture_);
 	DX_SAFE_RELEASE(texture_srv_);
 	DX_SAFE_RELEASE(texture_rtv_);
@@ -419,12 +457,9 @@ void D3D11RenderTexture::Cleanup()
 	DX_SAFE_RELEASE(nv12_uv_rtv_);
 	DX_SAFE_RELEASE(nv12_y_srv_);
 	DX_SAFE_RELEASE(nv12_uv_srv_);
-
-	DX_SAFE_RELEASE(d3d11_device_);
-	DX_SAFE_RELEASE(d3d11_context_);
 }
 
-void D3D11RenderTexture::Begin()
+void D3D11RenderTexture::Begin(const D3D11_RECT* scissor_rect, const D3D11_VIEWPORT* viewport)
 {
 	if (!texture_) {
 		return;
@@ -436,14 +471,14 @@ void D3D11RenderTexture::Begin()
 	float width = static_cast<FLOAT>(texture_desc.Width);
 	float height = static_cast<FLOAT>(texture_desc.Height);
 
-	D3D11_VIEWPORT viewport;
-	viewport.Width = width;
-	viewport.Height = height;
-	viewport.MinDepth = 0.0f;
-	viewport.MaxDepth = 1.0f;
-	viewport.TopLeftX = 0;
-	viewport.TopLeftY = 0;
-	d3d11_context_->RSSetViewports(1, &viewport);
+	D3D11_VIEWPORT texture_viewport;
+	texture_viewport.Width = width;
+	texture_viewport.Height = height;
+	texture_viewport.MinDepth = 0.0f;
+	texture_viewport.MaxDepth = 1.0f;
+	texture_viewport.TopLeftX = 0;
+	texture_viewport.TopLeftY = 0;
+	d3d11_context_->RSSetViewports(1, viewport ? viewport : &texture_viewport);
 
 	D3D11_MAPPED_SUBRESOURCE mapped_resource;
 	HRESULT hr = d3d11_context_->Map(vertex_buffer_, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped_resource);
@@ -468,21 +503,31 @@ void D3D11RenderTexture::Begin()
 	d3d11_context_->OMGetRenderTargets(1, &cache_rtv_, &cache_dsv_);
 	d3d11_context_->OMSetRenderTargets(0, NULL, NULL);
 
-	if (texture_desc.Format == DXGI_FORMAT_NV12) {
+	if (texture_desc.Format == DXGI_FORMAT_NV12 || texture_desc.Format == DXGI_FORMAT_P010) {
 		ID3D11RenderTargetView* nv12_rtv[2] = { nv12_y_rtv_ , nv12_uv_rtv_ };
 		d3d11_context_->OMSetRenderTargets(2, nv12_rtv, NULL);
-		d3d11_context_->ClearRenderTargetView(nv12_rtv[0], Colors::Black);
-		d3d11_context_->ClearRenderTargetView(nv12_rtv[1], Colors::Black);
+		if (!scissor_rect) {
+			d3d11_context_->ClearRenderTargetView(nv12_rtv[0], Colors::Black);
+			d3d11_context_->ClearRenderTargetView(nv12_rtv[1], Colors::Black);
+		}
 	}
 	else {
 		d3d11_context_->OMSetRenderTargets(1, &texture_rtv_, NULL);
-		d3d11_context_->ClearRenderTargetView(texture_rtv_, Colors::Black);
+		if (!scissor_rect) {
+			d3d11_context_->ClearRenderTargetView(texture_rtv_, Colors::Black);
+		}
 	}
 
 	if (rasterizer_state_) {
 		d3d11_context_->RSSetState(rasterizer_state_);
 	}
 
+	D3D11_RECT rect = { 0, 0, static_cast<LONG>(texture_desc.Width), static_cast<LONG>(texture_desc.Height) };
+	if (scissor_rect) {
+		rect = *scissor_rect;
+	}
+	d3d11_context_->RSSetScissorRects(1, &rect);
+
 	if (vertex_layout_) {
 		d3d11_context_->IASetInputLayout(vertex_layout_);
 	}
@@ -16,13 +16,20 @@ public:
 	virtual ~D3D11RenderTexture();
 
 	bool InitTexture(UINT width, UINT height, DXGI_FORMAT format, D3D11_USAGE usage, UINT bind_flags, UINT cpu_flags, UINT misc_flags);
+	// Renders into a texture owned elsewhere, e.g. by D3D11TexturePool.
+	bool InitTexture(ID3D11Texture2D* texture);
 	bool InitVertexShader();
 	bool InitPixelShader(CONST WCHAR* pathname, const BYTE* pixel_shader = NULL, size_t pixel_shader_size = 0);
 	bool InitRasterizerState();
 
 	void Cleanup();
+	// Drops the texture and its views, shaders are kept for the next InitTexture().
+	void ReleaseTexture();
 
-	void Begin();
+	// scissor_rect limits drawing to a region and keeps the rest of the
+	// previous content, NULL draws and clears the whole texture. viewport
+	// places the quad, NULL stretches it over the whole texture.
+	void Begin(const D3D11_RECT* scissor_rect = NULL, const D3D11_VIEWPORT* viewport = NULL);
 	void PSSetTexture(UINT slot, ID3D11ShaderResourceView* shader_resource_view);
 	void PSSetConstant(UINT slot, ID3D11Buffer* buffer);
 	void PSSetSamplers(UINT slot, ID3D11SamplerState* sampler);
@@ -40,6 +47,8 @@ public:
 	ID3D11ShaderResourceView* GetNV12UVShaderResourceView();
 
 private:
+	bool CreateViews();
+
 	ID3D11Device*               d3d11_device_     = NULL;
 	ID3D11DeviceContext*        d3d11_context_    = NULL;
 
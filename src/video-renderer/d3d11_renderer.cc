@@ -1,11 +1,11 @@
 #include "d3d11_renderer.h"
 #include "log.h"
+#include "plane_copy.h"
+#include "cpu_color_converter.h"
 
 #include "shader/d3d11/shader_d3d11_pixel.h"
-#include "shader/d3d11/shader_d3d11_nv12_bt601.h"
-#include "shader/d3d11/shader_d3d11_nv12_bt709.h"
-#include "shader/d3d11/shader_d3d11_yuv_bt601.h"
-#include "shader/d3d11/shader_d3d11_yuv_bt709.h"
+#include "shader/d3d11/shader_d3d11_nv12.h"
+#include "shader/d3d11/shader_d3d11_yuv.h"
 #include "shader/d3d11/shader_d3d11_sharpen.h"
 
 #define DX_SAFE_RELEASE(p) { if(p) { (p)->Release(); (p) = NULL; } } 
@@ -20,6 +20,19 @@ struct SharpenShaderConstants
 	float align_;
 };
 
+// Dirty rect in texels of a plane subsampled by x_shift and y_shift.
+static D3D11_BOX GetPlaneBox(const PixelRect& rect, int x_shift, int y_shift)
+{
+	D3D11_BOX box;
+	box.left = rect.left >> x_shift;
+	box.top = rect.top >> y_shift;
+	box.front = 0;
+	box.right = (rect.right + (1 << x_shift) - 1) >> x_shift;
+	box.bottom = (rect.bottom + (1 << y_shift) - 1) >> y_shift;
+	box.back = 1;
+	return box;
+}
+
 D3D11Renderer::D3D11Renderer()
 {
 
@@ -56,17 +69,22 @@ void D3D11Renderer::Destroy()
 
 	for (int i = 0; i < PIXEL_PLANE_MAX; i++) {
 		input_textures_[i].reset();
+		for (int j = 0; j < kNumStagingTextures; j++) {
+			staging_textures_[j][i].reset();
+		}
 	}
 
 	for (int i = 0; i < PIXEL_SHADER_MAX; i++) {
 		render_targets_[i].reset();
 	}
+	texture_pool_.reset();
 
 	if (d3d11_context_) {
 		d3d11_context_->ClearState();
 	}
 
 	DX_SAFE_RELEASE(sharpen_constants_);
+	ReleaseColorConstants();
 	DX_SAFE_RELEASE(point_sampler_);
 	DX_SAFE_RELEASE(linear_sampler_);
 	DX_SAFE_RELEASE(main_render_target_view_);
@@ -76,6 +94,7 @@ void D3D11Renderer::Destroy()
 
 	output_texture_ = NULL;
 	pixel_format_ = PIXEL_FORMAT_UNKNOW;
+	has_last_frame_ = false;
 }
 
 bool D3D11Renderer::Resize()
@@ -101,6 +120,7 @@ bool D3D11Renderer::Resize()
 	d3d11_context_->OMSetRenderTargets(0, NULL, NULL);
 
 	DX_SAFE_RELEASE(sharpen_constants_);
+	ReleaseColorConstants();
 	DX_SAFE_RELEASE(main_render_target_view_);
 	DX_SAFE_RELEASE(point_sampler_);
 	DX_SAFE_RELEASE(linear_sampler_);
@@ -110,10 +130,19 @@ bool D3D11Renderer::Resize()
 
 	for (int i = 0; i < PIXEL_PLANE_MAX; i++) {
 		input_textures_[i].reset();
+		for (int j = 0; j < kNumStagingTextures; j++) {
+			staging_textures_[j][i].reset();
+		}
 	}
 
+	// Shaders of the render targets are kept, textures follow the new size.
 	for (int i = 0; i < PIXEL_SHADER_MAX; i++) {
-		render_targets_[i].reset();
+		if (render_targets_[i]) {
+			render_targets_[i]->ReleaseTexture();
+		}
+	}
+	if (texture_pool_) {
+		texture_pool_->Clear();
 	}
 
 	HRESULT hr = dxgi_swap_chain_->ResizeBuffers(
@@ -158,6 +187,9 @@ void D3D11Renderer::Render(PixelFrame* frame)
 	Copy(frame);
 	Process();
 	End();
+
+	has_last_frame_ = true;
+	last_unsharp_ = unsharp_;
 }
 
 IDXGISwapChain* D3D11Renderer::GetDXGISwapChain()
@@ -175,6 +207,12 @@ void D3D11Renderer::SetSharpen(float unsharp)
 	unsharp_ = unsharp;
 }
 
+uint64_t D3D11Renderer::GetPixelsTouched()
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+	return pixels_touched_;
+}
+
 bool D3D11Renderer::InitDevice()
 {
 	RECT rect;
@@ -296,10 +334,12 @@ bool D3D11Renderer::CreateRenderer()
 		return false;
 	}
 
-	for (int i = 0; i < PIXEL_SHADER_MAX; i++) {
-		render_targets_[i].reset(new D3D11RenderTexture(d3d11_device_));
+	if (!texture_pool_) {
+		texture_pool_.reset(new D3D11TexturePool(d3d11_device_));
 	}
 
+	has_last_frame_ = false;
+
 	ID3D11Texture2D* back_buffer = NULL;
 	HRESULT hr = dxgi_swap_chain_->GetBuffer(0, __uuidof(ID3D11Texture2D), reinterpret_cast<void**>(&back_buffer));
 	if (FAILED(hr)) {
@@ -317,47 +357,28 @@ bool D3D11Renderer::CreateRenderer()
 		return false;
 	}
 
-	UINT bind_flags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
-	UINT cpu_flags = 0;
-	UINT misc_flags = 0;
-	D3D11_USAGE usage = D3D11_USAGE_DEFAULT;
-
-	for (int i = 0; i < PIXEL_SHADER_MAX; i++) {
-		auto render_target = render_targets_[i].get();
-		render_target->InitTexture(desc.Width, desc.Height, desc.Format, usage, bind_flags, cpu_flags, misc_flags);
-		render_target->InitVertexShader();
-		render_target->InitRasterizerState();
-		if (i == PIXEL_SHADER_ARGB) {
-			render_target->InitPixelShader(NULL, shader_d3d11_pixel, sizeof(shader_d3d11_pixel));
-		}
-		else if (i == PIXEL_SHADER_YUV_BT601) {
-			render_target->InitPixelShader(NULL, shader_d3d11_yuv_bt601, sizeof(shader_d3d11_yuv_bt601));
-		}
-		else if (i == PIXEL_SHADER_YUV_BT709) {
-			render_target->InitPixelShader(NULL, shader_d3d11_yuv_bt709, sizeof(shader_d3d11_yuv_bt709));
-		}
-		else if (i == PIXEL_SHADER_NV12_BT601) {
-			render_target->InitPixelShader(NULL, shader_d3d11_nv12_bt601, sizeof(shader_d3d11_nv12_bt601));
-		}
-		else if (i == PIXEL_SHADER_NV12_BT709) {
-			render_target->InitPixelShader(NULL, shader_d3d11_nv12_bt709, sizeof(shader_d3d11_nv12_bt709));
-		}
-		else if (i == PIXEL_SHADER_SHARPEN) {
-			render_target->InitPixelShader(NULL, shader_d3d11_sharpen, sizeof(shader_d3d11_sharpen));
-			D3D11_BUFFER_DESC buffer_desc;
-			memset(&buffer_desc, 0, sizeof(D3D11_BUFFER_DESC));
-			buffer_desc.Usage = D3D11_USAGE_DEFAULT;
-			buffer_desc.ByteWidth = sizeof(SharpenShaderConstants);
-			buffer_desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-			buffer_desc.CPUAccessFlags = 0;
-			hr = d3d11_device_->CreateBuffer(&buffer_desc, NULL, &sharpen_constants_);
-			if (FAILED(hr)) {
-				fprintf(stderr, "[D3D11Renderer] CreateBuffer(CONSTANT_BUFFER) failed, %x \n", hr);
-				return false;
-			}
+	output_width_ = desc.Width;
+	output_height_ = desc.Height;
+	output_format_ = desc.Format;
+
+	if (!sharpen_constants_) {
+		D3D11_BUFFER_DESC buffer_desc;
+		memset(&buffer_desc, 0, sizeof(D3D11_BUFFER_DESC));
+		buffer_desc.Usage = D3D11_USAGE_DEFAULT;
+		buffer_desc.ByteWidth = sizeof(SharpenShaderConstants);
+		buffer_desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+		buffer_desc.CPUAccessFlags = 0;
+		hr = d3d11_device_->CreateBuffer(&buffer_desc, NULL, &sharpen_constants_);
+		if (FAILED(hr)) {
+			fprintf(stderr, "[D3D11Renderer] CreateBuffer(CONSTANT_BUFFER) failed, %x \n", hr);
+			return false;
 		}
 	}
 
+	if (!CreateColorConstants()) {
+		return false;
+	}
+
 	D3D11_SAMPLER_DESC sampler_desc;
 	memset(&sampler_desc, 0, sizeof(D3D11_SAMPLER_DESC));
 	sampler_desc.Filter = D3D11_FILTER_MIN_MAG_MIP_POINT;
@@ -396,9 +417,13 @@ bool D3D11Renderer::CreateTexture(int width, int height, PixelFormat format)
 		input_textures_[i].reset(new D3D11RenderTexture(d3d11_device_));
 	}
 
-	D3D11_USAGE usage = D3D11_USAGE_DYNAMIC;
+	// The CPU writes to staging textures and only dirty rects are copied
+	// to the inputs, a dynamic texture would lose the last frame on Map().
+	// The staging textures rotate per frame, so Map() does not wait for
+	// the copies of the previous frames to finish.
+	D3D11_USAGE usage = D3D11_USAGE_DEFAULT;
 	UINT bind_flags   = D3D11_BIND_SHADER_RESOURCE;
-	UINT cpu_flags    = D3D11_CPU_ACCESS_WRITE;
+	UINT cpu_flags    = 0;
 	UINT half_width   = (width + 1) / 2;
 	UINT half_height  = (height + 1) / 2;
 
@@ -414,22 +439,198 @@ bool D3D11Renderer::CreateTexture(int width, int height, PixelFormat format)
 		input_textures_[PIXEL_PLANE_U]->InitTexture(width, height, dxgi_format, usage, bind_flags, cpu_flags, 0);
 		input_textures_[PIXEL_PLANE_V]->InitTexture(width, height, dxgi_format, usage, bind_flags, cpu_flags, 0);
 	}
-	else if (format == PIXEL_FORMAT_ARGB) {
+	else if (format == PIXEL_FORMAT_I422 || format == PIXEL_FORMAT_YUY2 || format == PIXEL_FORMAT_UYVY) {
+		DXGI_FORMAT dxgi_format = DXGI_FORMAT_R8_UNORM;
+		input_textures_[PIXEL_PLANE_Y]->InitTexture(width, height, dxgi_format, usage, bind_flags, cpu_flags, 0);
+		input_textures_[PIXEL_PLANE_U]->InitTexture(half_width, height, dxgi_format, usage, bind_flags, cpu_flags, 0);
+		input_textures_[PIXEL_PLANE_V]->InitTexture(half_width, height, dxgi_format, usage, bind_flags, cpu_flags, 0);
+	}
+	else if (format == PIXEL_FORMAT_ARGB || format == PIXEL_FORMAT_RGB24) {
 		DXGI_FORMAT dxgi_format = DXGI_FORMAT_B8G8R8A8_UNORM;
 		input_textures_[PIXEL_PLANE_ARGB]->InitTexture(width, height, dxgi_format, usage, bind_flags, cpu_flags, 0);
 	}
+	else if (format == PIXEL_FORMAT_RGBA) {
+		DXGI_FORMAT dxgi_format = DXGI_FORMAT_R8G8B8A8_UNORM;
+		input_textures_[PIXEL_PLANE_ARGB]->InitTexture(width, height, dxgi_format, usage, bind_flags, cpu_flags, 0);
+	}
 	else if (format == PIXEL_FORMAT_NV12) {
 		DXGI_FORMAT dxgi_format = DXGI_FORMAT_NV12;
 		input_textures_[PIXEL_PLANE_NV12]->InitTexture(width, height, dxgi_format, usage, bind_flags, cpu_flags, 0);
 	}
+	else if (format == PIXEL_FORMAT_P010) {
+		DXGI_FORMAT dxgi_format = DXGI_FORMAT_P010;
+		input_textures_[PIXEL_PLANE_NV12]->InitTexture(width, height, dxgi_format, usage, bind_flags, cpu_flags, 0);
+	}
+	else if (format == PIXEL_FORMAT_I010) {
+		DXGI_FORMAT dxgi_format = DXGI_FORMAT_R16_UNORM;
+		input_textures_[PIXEL_PLANE_Y]->InitTexture(width, height, dxgi_format, usage, bind_flags, cpu_flags, 0);
+		input_textures_[PIXEL_PLANE_U]->InitTexture(half_width, half_height, dxgi_format, usage, bind_flags, cpu_flags, 0);
+		input_textures_[PIXEL_PLANE_V]->InitTexture(half_width, half_height, dxgi_format, usage, bind_flags, cpu_flags, 0);
+	}
+
+	for (int i = 0; i < PIXEL_PLANE_MAX; i++) {
+		ID3D11Texture2D* texture = input_textures_[i]->GetTexture();
+		for (int j = 0; j < kNumStagingTextures; j++) {
+			staging_textures_[j][i].reset();
+			if (texture) {
+				D3D11_TEXTURE2D_DESC desc;
+				texture->GetDesc(&desc);
+				staging_textures_[j][i].reset(new D3D11RenderTexture(d3d11_device_));
+				staging_textures_[j][i]->InitTexture(desc.Width, desc.Height, desc.Format, D3D11_USAGE_STAGING, 0, D3D11_CPU_ACCESS_WRITE, 0);
+			}
+		}
+	}
+	staging_index_ = 0;
 
 	width_ = width;
 	height_ = height;
 	pixel_format_ = format;
+	has_last_frame_ = false;
+
+	return true;
+}
+
+D3D11RenderTexture* D3D11Renderer::GetRenderTarget(PixelShader shader)
+{
+	if (!d3d11_device_ || !texture_pool_ || shader <= PIXEL_SHADER_UNKNOW || shader >= PIXEL_SHADER_MAX) {
+		return NULL;
+	}
+
+	int index = (shader == PIXEL_SHADER_SHARPEN) ? 1 : 0;
+	ID3D11Texture2D* texture = texture_pool_->GetTexture(output_width_, output_height_, output_format_, index);
+	if (!texture) {
+		return NULL;
+	}
+
+	auto& render_target = render_targets_[shader];
+	if (render_target) {
+		if (render_target->GetTexture() != texture && !render_target->InitTexture(texture)) {
+			return NULL;
+		}
+		BindColorConstants(render_target.get(), shader);
+		return render_target.get();
+	}
+
+	render_target.reset(new D3D11RenderTexture(d3d11_device_));
+	render_target->InitTexture(texture);
+	render_target->InitVertexShader();
+	render_target->InitRasterizerState();
+
+	bool result = false;
+	if (shader == PIXEL_SHADER_ARGB) {
+		result = render_target->InitPixelShader(NULL, shader_d3d11_pixel, sizeof(shader_d3d11_pixel));
+	}
+	else if (shader == PIXEL_SHADER_YUV) {
+		result = render_target->InitPixelShader(NULL, shader_d3d11_yuv, sizeof(shader_d3d11_yuv));
+	}
+	else if (shader == PIXEL_SHADER_NV12) {
+		result = render_target->InitPixelShader(NULL, shader_d3d11_nv12, sizeof(shader_d3d11_nv12));
+	}
+	else if (shader == PIXEL_SHADER_SHARPEN) {
+		result = render_target->InitPixelShader(NULL, shader_d3d11_sharpen, sizeof(shader_d3d11_sharpen));
+	}
+
+	if (!result) {
+		render_target.reset();
+		return NULL;
+	}
+
+	BindColorConstants(render_target.get(), shader);
+	return render_target.get();
+}
+
+bool D3D11Renderer::CreateColorConstants()
+{
+	for (int matrix = 0; matrix < COLOR_MATRIX_MAX; matrix++) {
+		for (int range = 0; range < COLOR_RANGE_MAX; range++) {
+			if (color_constants_[matrix][range]) {
+				continue;
+			}
+
+			YUVShaderConstants constants = GetYUVShaderConstants(static_cast<ColorMatrix>(matrix), static_cast<ColorRange>(range));
+
+			D3D11_BUFFER_DESC buffer_desc;
+			memset(&buffer_desc, 0, sizeof(D3D11_BUFFER_DESC));
+			buffer_desc.Usage = D3D11_USAGE_IMMUTABLE;
+			buffer_desc.ByteWidth = sizeof(YUVShaderConstants);
+			buffer_desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+			buffer_desc.CPUAccessFlags = 0;
+
+			D3D11_SUBRESOURCE_DATA init_data;
+			memset(&init_data, 0, sizeof(D3D11_SUBRESOURCE_DATA));
+			init_data.pSysMem = &constants;
+
+			HRESULT hr = d3d11_device_->CreateBuffer(&buffer_desc, &init_data, &color_constants_[matrix][range]);
+			if (FAILED(hr)) {
+				LOG("ID3D11Device::CreateBuffer(CONSTANT_BUFFER) failed, %x ", hr);
+				return false;
+			}
+		}
+	}
 
 	return true;
 }
 
+void D3D11Renderer::ReleaseColorConstants()
+{
+	for (int matrix = 0; matrix < COLOR_MATRIX_MAX; matrix++) {
+		for (int range = 0; range < COLOR_RANGE_MAX; range++) {
+			DX_SAFE_RELEASE(color_constants_[matrix][range]);
+		}
+	}
+}
+
+void D3D11Renderer::BindColorConstants(D3D11RenderTexture* render_target, PixelShader shader)
+{
+	// Subclasses draw the YUV and NV12 targets themselves, so bind on every
+	// lookup. GetYUVRenderTarget() then replaces the BT.601 default.
+	if (shader == PIXEL_SHADER_YUV || shader == PIXEL_SHADER_NV12) {
+		BindColorConstants(render_target, COLOR_MATRIX_BT601, COLOR_RANGE_LIMITED);
+	}
+}
+
+void D3D11Renderer::BindColorConstants(D3D11RenderTexture* render_target, ColorMatrix matrix, ColorRange range)
+{
+	if (matrix < 0 || matrix >= COLOR_MATRIX_MAX) {
+		matrix = COLOR_MATRIX_BT601;
+	}
+	if (range < 0 || range >= COLOR_RANGE_MAX) {
+		range = COLOR_RANGE_LIMITED;
+	}
+	render_target->PSSetConstant(1, color_constants_[matrix][range]);
+}
+
+D3D11RenderTexture* D3D11Renderer::GetYUVRenderTarget(bool is_nv12, ColorMatrix matrix, ColorRange range)
+{
+	D3D11RenderTexture* render_target = GetRenderTarget(is_nv12 ? PIXEL_SHADER_NV12 : PIXEL_SHADER_YUV);
+	if (render_target) {
+		BindColorConstants(render_target, matrix, range);
+	}
+	return render_target;
+}
+
+uint64_t D3D11Renderer::GetBytesHeld()
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+
+	uint64_t bytes = 0;
+	for (int i = 0; i < PIXEL_PLANE_MAX; i++) {
+		if (input_textures_[i]) {
+			bytes += GetTextureBytes(input_textures_[i]->GetTexture());
+		}
+		for (int j = 0; j < kNumStagingTextures; j++) {
+			if (staging_textures_[j][i]) {
+				bytes += GetTextureBytes(staging_textures_[j][i]->GetTexture());
+			}
+		}
+	}
+
+	if (texture_pool_) {
+		bytes += texture_pool_->GetBytes();
+	}
+	return bytes;
+}
+
 void D3D11Renderer::D3D11Renderer::Begin()
 {
 	if (main_render_target_view_) {
@@ -444,7 +645,22 @@ void D3D11Renderer::Copy(PixelFrame* frame)
 		return;
 	}
 
-	if (frame->format == PIXEL_FORMAT_I420) {
+	bool is_color_changed = color_matrix_ != frame->color_matrix || color_range_ != frame->color_range;
+	color_matrix_ = frame->color_matrix;
+	color_range_ = frame->color_range;
+
+	GetDirtyRects(frame, !has_last_frame_ || last_unsharp_ != unsharp_ || is_color_changed, dirty_rects_);
+
+	// Every frame writes its dirty rects to the next set of staging textures.
+	staging_index_ = (staging_index_ + 1) % kNumStagingTextures;
+
+	pixels_touched_ = 0;
+	for (auto& rect : dirty_rects_) {
+		pixels_touched_ += static_cast<uint64_t>(rect.right - rect.left) * (rect.bottom - rect.top);
+	}
+
+	if (frame->format == PIXEL_FORMAT_I420 || frame->format == PIXEL_FORMAT_I010 ||
+		frame->format == PIXEL_FORMAT_I422) {
 		if (input_textures_[PIXEL_PLANE_Y] &&
 			input_textures_[PIXEL_PLANE_U] &&
 			input_textures_[PIXEL_PLANE_V]) {
@@ -458,12 +674,20 @@ void D3D11Renderer::Copy(PixelFrame* frame)
 			UpdateI444(frame);
 		}
 	}
-	else if (frame->format == PIXEL_FORMAT_ARGB) {
+	else if (frame->format == PIXEL_FORMAT_YUY2 || frame->format == PIXEL_FORMAT_UYVY) {
+		if (input_textures_[PIXEL_PLANE_Y] &&
+			input_textures_[PIXEL_PLANE_U] &&
+			input_textures_[PIXEL_PLANE_V]) {
+			UpdatePacked422(frame);
+		}
+	}
+	else if (frame->format == PIXEL_FORMAT_ARGB || frame->format == PIXEL_FORMAT_RGBA ||
+		frame->format == PIXEL_FORMAT_RGB24) {
 		if (input_textures_[PIXEL_PLANE_ARGB]) {
 			UpdateARGB(frame);
 		}
 	}
-	else if (frame->format == PIXEL_FORMAT_NV12) {
+	else if (frame->format == PIXEL_FORMAT_NV12 || frame->format == PIXEL_FORMAT_P010) {
 		if (input_textures_[PIXEL_PLANE_NV12]) {
 			UpdateNV12(frame);
 		}
@@ -479,7 +703,7 @@ void D3D11Renderer::Process()
 	if (unsharp_ > 0) {
 		float width = static_cast<float>(width_);
 		float height = static_cast<float>(height_);
-		D3D11RenderTexture* render_target = render_targets_[PIXEL_SHADER_SHARPEN].get();
+		D3D11RenderTexture* render_target = GetRenderTarget(PIXEL_SHADER_SHARPEN);
 
 		SharpenShaderConstants sharpen_shader_constants;
 		sharpen_shader_constants.width = static_cast<float>(width);
@@ -487,7 +711,10 @@ void D3D11Renderer::Process()
 		sharpen_shader_constants.unsharp = unsharp_;
 		d3d11_context_->UpdateSubresource((ID3D11Resource*)sharpen_constants_, 0, NULL, &sharpen_shader_constants, 0, 0);
 
-		render_target->Begin();
+		D3D11_RECT scissor_rect;
+		bool is_partial = GetScissorRect(render_target, 4, &scissor_rect);
+
+		render_target->Begin(is_partial ? &scissor_rect : NULL);
 		render_target->PSSetTexture(0, output_texture_->GetShaderResourceView());
 		render_target->PSSetConstant(0, sharpen_constants_);
 		render_target->PSSetSamplers(0, linear_sampler_);
@@ -531,39 +758,32 @@ void D3D11Renderer::End()
 
 void D3D11Renderer::UpdateARGB(PixelFrame* frame)
 {
-	HRESULT hr = S_OK;
-	D3D11_MAPPED_SUBRESOURCE map;
-
-	ID3D11Texture2D* texture = input_textures_[PIXEL_PLANE_ARGB]->GetTexture();
-	ID3D11ShaderResourceView*  shader_resource_view = input_textures_[PIXEL_PLANE_ARGB]->GetShaderResourceView();
-	UINT sub_resource = ::D3D11CalcSubresource(0, 0, 1);
-
-	if (texture) {
-		hr = d3d11_context_->Map(
-			(ID3D11Resource*)texture,
-			sub_resource,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&map
-		);
-
-		if (SUCCEEDED(hr)) {
-			int src_pitch = frame->pitch[0];
-			int dst_pitch = map.RowPitch;
-			int pitch = (src_pitch <= dst_pitch) ? src_pitch : dst_pitch;
-			uint8_t* src_data = frame->plane[0];
-			uint8_t* dst_data = (uint8_t*)map.pData;
-			for (int i = 0; i < frame->height; i++) {
-				memcpy(dst_data, src_data, pitch);
-				dst_data += dst_pitch;
-				src_data += src_pitch;
+	ID3D11ShaderResourceView* shader_resource_view = input_textures_[PIXEL_PLANE_ARGB]->GetShaderResourceView();
+
+	if (frame->format == PIXEL_FORMAT_RGB24) {
+		// There is no 24-bit texture format, the pixels are expanded while
+		// they are written to the staging texture.
+		D3D11_MAPPED_SUBRESOURCE map;
+		if (MapPlane(PIXEL_PLANE_ARGB, &map)) {
+			for (auto& rect : dirty_rects_) {
+				RGB24ToBGRA(frame->plane[0] + rect.top * frame->pitch[0] + rect.left * 3, frame->pitch[0],
+					(uint8_t*)map.pData + rect.top * map.RowPitch + rect.left * 4, map.RowPitch,
+					rect.right - rect.left, rect.bottom - rect.top);
 			}
+			UnmapPlane(PIXEL_PLANE_ARGB, 0, 0);
 		}
+	}
+	else {
+		// RGBA is held in an R8G8B8A8 texture, the shader samples it in channel order.
+		UpdatePlane(PIXEL_PLANE_ARGB, frame->plane[0], frame->pitch[0], 4, 0, 0);
+	}
 
-		d3d11_context_->Unmap((ID3D11Resource*)texture, sub_resource);
+	D3D11RenderTexture* render_target = GetRenderTarget(PIXEL_SHADER_ARGB);
+	if (render_target) {
+		D3D11_RECT scissor_rect;
+		bool is_partial = GetScissorRect(render_target, 2, &scissor_rect);
 
-		D3D11RenderTexture* render_target = render_targets_[PIXEL_SHADER_ARGB].get();
-		render_target->Begin();
+		render_target->Begin(is_partial ? &scissor_rect : NULL);
 		render_target->PSSetTexture(0, shader_resource_view);
 		render_target->PSSetSamplers(0, linear_sampler_);
 		render_target->PSSetSamplers(1, point_sampler_);
@@ -576,164 +796,84 @@ void D3D11Renderer::UpdateARGB(PixelFrame* frame)
 
 void D3D11Renderer::UpdateI444(PixelFrame* frame)
 {
-	ID3D11Texture2D* y_texture = input_textures_[PIXEL_PLANE_Y]->GetTexture();
-	ID3D11Texture2D* u_texture = input_textures_[PIXEL_PLANE_U]->GetTexture();
-	ID3D11Texture2D* v_texture = input_textures_[PIXEL_PLANE_V]->GetTexture();
-	ID3D11ShaderResourceView* y_texture_view = input_textures_[PIXEL_PLANE_Y]->GetShaderResourceView();
-	ID3D11ShaderResourceView* u_texture_view = input_textures_[PIXEL_PLANE_U]->GetShaderResourceView();
-	ID3D11ShaderResourceView* v_texture_view = input_textures_[PIXEL_PLANE_V]->GetShaderResourceView();
+	UpdatePlane(PIXEL_PLANE_Y, frame->plane[0], frame->pitch[0], 1, 0, 0);
+	UpdatePlane(PIXEL_PLANE_U, frame->plane[1], frame->pitch[1], 1, 0, 0);
+	UpdatePlane(PIXEL_PLANE_V, frame->plane[2], frame->pitch[2], 1, 0, 0);
 
-	D3D11_MAPPED_SUBRESOURCE map;
-	HRESULT hr = S_OK;
-	UINT sub_resource = ::D3D11CalcSubresource(0, 0, 1);
+	DrawYUV();
+}
 
-	if (y_texture) {
-		hr = d3d11_context_->Map(y_texture, sub_resource, D3D11_MAP_WRITE_DISCARD, 0, &map);
-		if (SUCCEEDED(hr)) {
-			int src_pitch = frame->pitch[0];
-			int dst_pitch = map.RowPitch;
-			int pitch = (src_pitch <= dst_pitch) ? src_pitch : dst_pitch;
-			uint8_t* src_data = frame->plane[0];
-			uint8_t* dst_data = (uint8_t*)map.pData;
-
-			for (int i = 0; i < frame->height; i++) {
-				memcpy(dst_data, src_data, pitch);
-				dst_data += dst_pitch;
-				src_data += src_pitch;
-			}
-		}
-		d3d11_context_->Unmap((ID3D11Resource*)y_texture, sub_resource);
+void D3D11Renderer::UpdateI420(PixelFrame* frame)
+{
+	// I010 goes through the same shader, the samples are widened to 16 bits on upload.
+	// I422 only differs by the full height chroma planes.
+	bool is_10bit = frame->format == PIXEL_FORMAT_I010;
+	int bytes_per_pixel = is_10bit ? 2 : 1;
+	int y_shift = frame->format == PIXEL_FORMAT_I422 ? 0 : 1;
+	UpdatePlane(PIXEL_PLANE_Y, frame->plane[0], frame->pitch[0], bytes_per_pixel, 0, 0, is_10bit);
+	UpdatePlane(PIXEL_PLANE_U, frame->plane[1], frame->pitch[1], bytes_per_pixel, 1, y_shift, is_10bit);
+	UpdatePlane(PIXEL_PLANE_V, frame->plane[2], frame->pitch[2], bytes_per_pixel, 1, y_shift, is_10bit);
+
+	DrawYUV();
+}
+
+void D3D11Renderer::UpdatePacked422(PixelFrame* frame)
+{
+	// YUY2 and UYVY are split into I422 planes while they are written to
+	// the staging textures, the planar shader does the rest.
+	PixelPlane planes[3] = { PIXEL_PLANE_Y, PIXEL_PLANE_U, PIXEL_PLANE_V };
+	D3D11_MAPPED_SUBRESOURCE maps[3];
+
+	int num_mapped = 0;
+	while (num_mapped < 3 && MapPlane(planes[num_mapped], &maps[num_mapped])) {
+		num_mapped++;
 	}
 
-	if (u_texture) {
-		hr = d3d11_context_->Map(u_texture, sub_resource, D3D11_MAP_WRITE_DISCARD, 0, &map);
-		if (SUCCEEDED(hr)) {
-			int src_pitch = frame->pitch[1];
-			int dst_pitch = map.RowPitch;
-			int pitch = (src_pitch <= dst_pitch) ? src_pitch : dst_pitch;
-			uint8_t* src_data = frame->plane[1];
-			uint8_t* dst_data = (uint8_t*)map.pData;
-
-			for (int i = 0; i < frame->height; i++) {
-				memcpy(dst_data, src_data, pitch);
-				dst_data += dst_pitch;
-				src_data += src_pitch;
-			}
+	if (num_mapped < 3) {
+		for (int i = 0; i < num_mapped; i++) {
+			d3d11_context_->Unmap(GetStagingTexture(planes[i]), 0);
 		}
-
-		d3d11_context_->Unmap((ID3D11Resource*)u_texture, sub_resource);
+		return;
 	}
 
-	if (v_texture) {
-		hr = d3d11_context_->Map(v_texture, sub_resource, D3D11_MAP_WRITE_DISCARD, 0, &map);
-		if (SUCCEEDED(hr)) {
-			int src_pitch = frame->pitch[2];
-			int dst_pitch = map.RowPitch;
-			int pitch = (src_pitch <= dst_pitch) ? src_pitch : dst_pitch;
-			uint8_t* src_data = frame->plane[2];
-			uint8_t* dst_data = (uint8_t*)map.pData;
-
-			for (int i = 0; i < frame->height; i++) {
-				memcpy(dst_data, src_data, pitch);
-				dst_data += dst_pitch;
-				src_data += src_pitch;
-			}
+	// Rects are aligned to even coordinates, see GetDirtyRects().
+	for (auto& rect : dirty_rects_) {
+		const uint8_t* src_data = frame->plane[0] + rect.top * frame->pitch[0] + rect.left * 2;
+		uint8_t* y_data = (uint8_t*)maps[0].pData + rect.top * maps[0].RowPitch + rect.left;
+		uint8_t* u_data = (uint8_t*)maps[1].pData + rect.top * maps[1].RowPitch + rect.left / 2;
+		uint8_t* v_data = (uint8_t*)maps[2].pData + rect.top * maps[2].RowPitch + rect.left / 2;
+		int width = rect.right - rect.left;
+		int height = rect.bottom - rect.top;
+
+		if (frame->format == PIXEL_FORMAT_YUY2) {
+			YUY2ToI422(src_data, frame->pitch[0], y_data, maps[0].RowPitch,
+				u_data, maps[1].RowPitch, v_data, maps[2].RowPitch, width, height);
+		}
+		else {
+			UYVYToI422(src_data, frame->pitch[0], y_data, maps[0].RowPitch,
+				u_data, maps[1].RowPitch, v_data, maps[2].RowPitch, width, height);
 		}
-
-		d3d11_context_->Unmap((ID3D11Resource*)v_texture, sub_resource);
 	}
 
-	D3D11RenderTexture* render_target = render_targets_[PIXEL_SHADER_YUV_BT601].get();
-	if (render_target) {
-		render_target->Begin();
-		render_target->PSSetTexture(0, y_texture_view);
-		render_target->PSSetTexture(1, u_texture_view);
-		render_target->PSSetTexture(2, v_texture_view);
-		render_target->PSSetSamplers(0, linear_sampler_);
-		render_target->PSSetSamplers(1, point_sampler_);
-		render_target->Draw();
-		render_target->End();
-		render_target->PSSetTexture(0, NULL);
-		render_target->PSSetTexture(1, NULL);
-		render_target->PSSetTexture(2, NULL);
-		output_texture_ = render_target;
-	}
+	UnmapPlane(PIXEL_PLANE_Y, 0, 0);
+	UnmapPlane(PIXEL_PLANE_U, 1, 0);
+	UnmapPlane(PIXEL_PLANE_V, 1, 0);
+
+	DrawYUV();
 }
 
-void D3D11Renderer::UpdateI420(PixelFrame* frame)
+void D3D11Renderer::DrawYUV()
 {
-	ID3D11Texture2D* y_texture = input_textures_[PIXEL_PLANE_Y]->GetTexture();
-	ID3D11Texture2D* u_texture = input_textures_[PIXEL_PLANE_U]->GetTexture();
-	ID3D11Texture2D* v_texture = input_textures_[PIXEL_PLANE_V]->GetTexture();
 	ID3D11ShaderResourceView* y_texture_view = input_textures_[PIXEL_PLANE_Y]->GetShaderResourceView();
 	ID3D11ShaderResourceView* u_texture_view = input_textures_[PIXEL_PLANE_U]->GetShaderResourceView();
 	ID3D11ShaderResourceView* v_texture_view = input_textures_[PIXEL_PLANE_V]->GetShaderResourceView();
 
-	D3D11_MAPPED_SUBRESOURCE map;
-	HRESULT hr = S_OK;
-	UINT sub_resource = ::D3D11CalcSubresource(0, 0, 1);
-	int half_width = (frame->width + 1) / 2;
-	int half_height = (frame->height + 1) / 2;
-
-	if (y_texture) {
-		hr = d3d11_context_->Map(y_texture, sub_resource, D3D11_MAP_WRITE_DISCARD, 0, &map);
-		if (SUCCEEDED(hr)) {
-			int src_pitch = frame->pitch[0];
-			int dst_pitch = map.RowPitch;
-			int pitch = (src_pitch <= dst_pitch) ? src_pitch : dst_pitch;
-			uint8_t* src_data = frame->plane[0];
-			uint8_t* dst_data = (uint8_t*)map.pData;
-
-			for (int i = 0; i < frame->height; i++) {
-				memcpy(dst_data, src_data, pitch);
-				dst_data += dst_pitch;
-				src_data += src_pitch;
-			}
-		}
-		d3d11_context_->Unmap((ID3D11Resource*)y_texture, sub_resource);
-	}
-
-	if (u_texture) {
-		hr = d3d11_context_->Map(u_texture, sub_resource, D3D11_MAP_WRITE_DISCARD, 0, &map);
-		if (SUCCEEDED(hr)) {
-			int src_pitch = frame->pitch[1];
-			int dst_pitch = map.RowPitch;
-			int pitch = (src_pitch <= dst_pitch) ? src_pitch : dst_pitch;
-			uint8_t* src_data = frame->plane[1];
-			uint8_t* dst_data = (uint8_t*)map.pData;
-
-			for (int i = 0; i < half_height; i++) {
-				memcpy(dst_data, src_data, pitch);
-				dst_data += dst_pitch;
-				src_data += src_pitch;
-			}
-		}
-
-		d3d11_context_->Unmap((ID3D11Resource*)u_texture, sub_resource);
-	}
-
-	if (v_texture) {
-		hr = d3d11_context_->Map(v_texture, sub_resource, D3D11_MAP_WRITE_DISCARD, 0, &map);
-		if (SUCCEEDED(hr)) {
-			int src_pitch = frame->pitch[2];
-			int dst_pitch = map.RowPitch;
-			int pitch = (src_pitch <= dst_pitch) ? src_pitch : dst_pitch;
-			uint8_t* src_data = frame->plane[2];
-			uint8_t* dst_data = (uint8_t*)map.pData;
-
-			for (int i = 0; i < half_height; i++) {
-				memcpy(dst_data, src_data, pitch);
-				dst_data += dst_pitch;
-				src_data += src_pitch;
-			}
-		}
-
-		d3d11_context_->Unmap((ID3D11Resource*)v_texture, sub_resource);
-	}
-
-	D3D11RenderTexture* render_target = render_targets_[PIXEL_SHADER_YUV_BT601].get();
+	D3D11RenderTexture* render_target = GetYUVRenderTarget(false, color_matrix_, color_range_);
 	if (render_target) {
-		render_target->Begin();
+		D3D11_RECT scissor_rect;
+		bool is_partial = GetScissorRect(render_target, 2, &scissor_rect);
+
+		render_target->Begin(is_partial ? &scissor_rect : NULL);
 		render_target->PSSetTexture(0, y_texture_view);
 		render_target->PSSetTexture(1, u_texture_view);
 		render_target->PSSetTexture(2, v_texture_view);
@@ -751,46 +891,65 @@ void D3D11Renderer::UpdateI420(PixelFrame* frame)
 void D3D11Renderer::UpdateNV12(PixelFrame* frame)
 {
 	ID3D11Texture2D* texture = input_textures_[PIXEL_PLANE_NV12]->GetTexture();
+	ID3D11Texture2D* staging_texture = GetStagingTexture(PIXEL_PLANE_NV12);
 	ID3D11ShaderResourceView* luminance_view = input_textures_[PIXEL_PLANE_NV12]->GetNV12YShaderResourceView();
 	ID3D11ShaderResourceView* chrominance_view = input_textures_[PIXEL_PLANE_NV12]->GetNV12UVShaderResourceView();
 
+	// P010 has the NV12 layout with 16-bit samples, the views are R16/R16G16.
+	int bytes_per_sample = frame->format == PIXEL_FORMAT_P010 ? 2 : 1;
+
 	D3D11_MAPPED_SUBRESOURCE map;
 	HRESULT hr = S_OK;
-	UINT sub_resource = ::D3D11CalcSubresource(0, 0, 1);
-	int half_width = (frame->width + 1) / 2;
-	int half_height = (frame->height + 1) / 2;
 
-	if (texture) {
-		hr = d3d11_context_->Map(texture, sub_resource, D3D11_MAP_WRITE_DISCARD, 0, &map);
+	if (texture && staging_texture) {
+		D3D11_TEXTURE2D_DESC desc;
+		staging_texture->GetDesc(&desc);
+
+		hr = d3d11_context_->Map(staging_texture, 0, D3D11_MAP_WRITE, 0, &map);
 		if (SUCCEEDED(hr)) {
-			uint8_t* src_data = (uint8_t*)frame->plane[0];
-			uint8_t* dst_data = (uint8_t*)map.pData;
-			int src_pitch = frame->pitch[0];
-			int dst_pitch = map.RowPitch;
-			int pitch = (src_pitch <= dst_pitch) ? src_pitch : dst_pitch;
-
-			for (int i = 0; i < frame->height; i++) {
-				memcpy(dst_data, src_data, pitch);
-				src_data += src_pitch;
-				dst_data += dst_pitch;
+			uint8_t* y_data = (uint8_t*)map.pData;
+			uint8_t* uv_data = y_data + map.RowPitch * desc.Height;
+
+			// Rects are aligned to even coordinates, see GetDirtyRects().
+			for (auto& rect : dirty_rects_) {
+				int width = rect.right - rect.left;
+				int height = rect.bottom - rect.top;
+				int uv_width = (width + 1) / 2 * 2;
+				int uv_height = (height + 1) / 2;
+				int left = rect.left * bytes_per_sample;
+
+				CopyPlane(y_data + rect.top * map.RowPitch + left, map.RowPitch,
+					frame->plane[0] + rect.top * frame->pitch[0] + left, frame->pitch[0],
+					width * bytes_per_sample, height);
+				CopyPlane(uv_data + rect.top / 2 * map.RowPitch + left, map.RowPitch,
+					frame->plane[1] + rect.top / 2 * frame->pitch[1] + left, frame->pitch[1],
+					uv_width * bytes_per_sample, uv_height);
 			}
 
-			src_data = (uint8_t*)frame->plane[1];
-			src_pitch = frame->pitch[1];
-			pitch = (src_pitch <= dst_pitch) ? src_pitch : dst_pitch;
-
-			for (int i = 0; i < half_height; i++) {
-				memcpy(dst_data, src_data, pitch);
-				src_data += src_pitch;
-				dst_data += dst_pitch;
+			d3d11_context_->Unmap(staging_texture, 0);
+
+			for (auto& rect : dirty_rects_) {
+				D3D11_BOX box;
+				box.left = rect.left;
+				box.top = rect.top;
+				box.front = 0;
+				box.right = (rect.right + 1) / 2 * 2;
+				box.bottom = (rect.bottom + 1) / 2 * 2;
+				box.back = 1;
+				d3d11_context_->CopySubresourceRegion(texture, 0, box.left, box.top, 0, staging_texture, 0, &box);
 			}
 		}
-		d3d11_context_->Unmap((ID3D11Resource*)texture, sub_resource);
+		else {
+			LOG("ID3D11DeviceContext::Map(NV12) failed, %x", hr);
+		}
 	}
 
-	D3D11RenderTexture* render_target = render_targets_[PIXEL_SHADER_NV12_BT601].get();
+	D3D11RenderTexture* render_target = GetYUVRenderTarget(true, color_matrix_, color_range_);
 	if (render_target) {
-		render_target->Begin();
+		D3D11_RECT scissor_rect;
+		bool is_partial = GetScissorRect(render_target, 2, &scissor_rect);
+
+		render_target->Begin(is_partial ? &scissor_rect : NULL);
 		render_target->PSSetTexture(0, luminance_view);
 		render_target->PSSetTexture(1, chrominance_view);
 		render_target->PSSetSamplers(0, linear_sampler_);
@@ -802,3 +961,108 @@ void D3D11Renderer::UpdateNV12(PixelFrame* frame)
 		output_texture_ = render_target;
 	}
 }
+
+void D3D11Renderer::UpdatePlane(PixelPlane plane, uint8_t* src_data, int src_pitch, int bytes_per_pixel,
+	int x_shift, int y_shift, bool is_10bit)
+{
+	D3D11_MAPPED_SUBRESOURCE map;
+	if (!MapPlane(plane, &map)) {
+		return;
+	}
+
+	for (auto& rect : dirty_rects_) {
+		D3D11_BOX box = GetPlaneBox(rect, x_shift, y_shift);
+		uint8_t* dst_data = (uint8_t*)map.pData + box.top * map.RowPitch + box.left * bytes_per_pixel;
+		if (is_10bit) {
+			CopyPlane10To16(dst_data, map.RowPitch, src_data + box.top * src_pitch + box.left * bytes_per_pixel, src_pitch,
+				box.right - box.left, box.bottom - box.top);
+		}
+		else {
+			CopyPlane(dst_data, map.RowPitch, src_data + box.top * src_pitch + box.left * bytes_per_pixel, src_pitch,
+				(box.right - box.left) * bytes_per_pixel, box.bottom - box.top);
+		}
+	}
+
+	UnmapPlane(plane, x_shift, y_shift);
+}
+
+ID3D11Texture2D* D3D11Renderer::GetStagingTexture(PixelPlane plane)
+{
+	std::shared_ptr<D3D11RenderTexture>& staging_texture = staging_textures_[staging_index_][plane];
+	return staging_texture ? staging_texture->GetTexture() : NULL;
+}
+
+bool D3D11Renderer::MapPlane(PixelPlane plane, D3D11_MAPPED_SUBRESOURCE* map)
+{
+	ID3D11Texture2D* texture = input_textures_[plane]->GetTexture();
+	ID3D11Texture2D* staging_texture = GetStagingTexture(plane);
+	if (!texture || !staging_texture) {
+		return false;
+	}
+
+	HRESULT hr = d3d11_context_->Map(staging_texture, 0, D3D11_MAP_WRITE, 0, map);
+	if (FAILED(hr)) {
+		LOG("ID3D11DeviceContext::Map() failed, %x", hr);
+		return false;
+	}
+
+	return true;
+}
+
+void D3D11Renderer::UnmapPlane(PixelPlane plane, int x_shift, int y_shift)
+{
+	ID3D11Texture2D* texture = input_textures_[plane]->GetTexture();
+	ID3D11Texture2D* staging_texture = GetStagingTexture(plane);
+
+	d3d11_context_->Unmap(staging_texture, 0);
+
+	for (auto& rect : dirty_rects_) {
+		D3D11_BOX box = GetPlaneBox(rect, x_shift, y_shift);
+		d3d11_context_->CopySubresourceRegion(texture, 0, box.left, box.top, 0, staging_texture, 0, &box);
+	}
+}
+
+bool D3D11Renderer::GetScissorRect(D3D11RenderTexture* render_target, int margin, D3D11_RECT* rect)
+{
+	// Subclasses feeding textures directly do not go through Copy().
+	if (!has_last_frame_) {
+		return false;
+	}
+
+	PixelRect bound;
+	bound.left = width_;
+	bound.top = height_;
+	for (auto& dirty_rect : dirty_rects_) {
+		bound.left = dirty_rect.left < bound.left ? dirty_rect.left : bound.left;
+		bound.top = dirty_rect.top < bound.top ? dirty_rect.top : bound.top;
+		bound.right = dirty_rect.right > bound.right ? dirty_rect.right : bound.right;
+		bound.bottom = dirty_rect.bottom > bound.bottom ? dirty_rect.bottom : bound.bottom;
+	}
+
+	if (bound.left == 0 && bound.top == 0 && bound.right == width_ && bound.bottom == height_) {
+		return false;
+	}
+
+	// Nothing changed, keep the render target as it is.
+	if (bound.left >= bound.right || bound.top >= bound.bottom) {
+		rect->left = rect->top = rect->right = rect->bottom = 0;
+		return true;
+	}
+
+	D3D11_TEXTURE2D_DESC desc;
+	render_target->GetTexture()->GetDesc(&desc);
+
+	// The frame is stretched over the render target, the margin covers
+	// the filter taps reaching into the dirty area.
+	LONG width = static_cast<LONG>(desc.Width);
+	LONG height = static_cast<LONG>(desc.Height);
+	rect->left = static_cast<LONG>(static_cast<int64_t>(bound.left) * width / width_) - margin;
+	rect->top = static_cast<LONG>(static_cast<int64_t>(bound.top) * height / height_) - margin;
+	rect->right = static_cast<LONG>((static_cast<int64_t>(bound.right) * width + width_ - 1) / width_) + margin;
+	rect->bottom = static_cast<LONG>((static_cast<int64_t>(bound.bottom) * height + height_ - 1) / height_) + margin;
+	rect->left = rect->left < 0 ? 0 : rect->left;
+	rect->top = rect->top < 0 ? 0 : rect->top;
+	rect->right = rect->right > width ? width : rect->right;
+	rect->bottom = rect->bottom > height ? height : rect->bottom;
+	return true;
+}
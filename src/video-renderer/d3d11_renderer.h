@@ -1,7 +1,9 @@
 #pragma once
 
 #include "renderer.h"
+#include "color_matrix.h"
 #include "d3d11_render_texture.h"
+#include "d3d11_texture_pool.h"
 #include <mutex>
 
 namespace DX {
@@ -25,10 +27,19 @@ public:
 	// sharpness: 0.0 to 10.0
 	virtual void SetSharpen(float unsharp);
 
+	virtual uint64_t GetPixelsTouched();
+
+	virtual uint64_t GetBytesHeld();
+
 protected:
 	bool InitDevice();
 	bool CreateRenderer();
 	bool CreateTexture(int width, int height, PixelFormat format);
+	// Created on first use, conversion passes share one pool texture and
+	// post-processing draws into the other.
+	D3D11RenderTexture* GetRenderTarget(PixelShader shader);
+	// YUV or NV12 target for the matrix and range, with their constants bound.
+	D3D11RenderTexture* GetYUVRenderTarget(bool is_nv12, ColorMatrix matrix, ColorRange range);
 	virtual void Begin();
 	virtual void Copy(PixelFrame* frame);
 	virtual void Process();
@@ -38,6 +49,21 @@ protected:
 	void UpdateI444(PixelFrame* frame);
 	void UpdateI420(PixelFrame* frame);
 	void UpdateNV12(PixelFrame* frame);
+	void UpdatePacked422(PixelFrame* frame);
+	void DrawYUV();
+	// is_10bit: 16-bit samples with 10 bits in the LSBs, widened for R16_UNORM.
+	void UpdatePlane(PixelPlane plane, uint8_t* src_data, int src_pitch, int bytes_per_pixel,
+		int x_shift, int y_shift, bool is_10bit = false);
+	// Staging texture of a plane for the current frame.
+	ID3D11Texture2D* GetStagingTexture(PixelPlane plane);
+	// Staging texture of a plane, unmapping copies the dirty rects to the input texture.
+	bool MapPlane(PixelPlane plane, D3D11_MAPPED_SUBRESOURCE* map);
+	void UnmapPlane(PixelPlane plane, int x_shift, int y_shift);
+	bool CreateColorConstants();
+	void ReleaseColorConstants();
+	void BindColorConstants(D3D11RenderTexture* render_target, PixelShader shader);
+	void BindColorConstants(D3D11RenderTexture* render_target, ColorMatrix matrix, ColorRange range);
+	bool GetScissorRect(D3D11RenderTexture* render_target, int margin, D3D11_RECT* rect);
 
 	std::mutex mutex_;
 
@@ -59,10 +85,28 @@ protected:
 
 	D3D11RenderTexture* output_texture_ = NULL;
 	std::shared_ptr<D3D11RenderTexture> input_textures_[PIXEL_PLANE_MAX];
+	// Enough sets that the GPU has finished copying from one before it is mapped again.
+	static const int kNumStagingTextures = 3;
+	std::shared_ptr<D3D11RenderTexture> staging_textures_[kNumStagingTextures][PIXEL_PLANE_MAX];
+	int staging_index_ = 0;
 	std::shared_ptr<D3D11RenderTexture> render_targets_[PIXEL_SHADER_MAX];
+	std::unique_ptr<D3D11TexturePool> texture_pool_;
+	UINT output_width_  = 0;
+	UINT output_height_ = 0;
+	DXGI_FORMAT output_format_ = DXGI_FORMAT_UNKNOWN;
 
 	float unsharp_ = 0.0;
 	ID3D11Buffer* sharpen_constants_ = NULL;
+	// b1 of the YUV and NV12 shaders, one per matrix and range.
+	ID3D11Buffer* color_constants_[COLOR_MATRIX_MAX][COLOR_RANGE_MAX] = {};
+
+	// Render targets hold the last frame, only dirty rects are redrawn.
+	bool has_last_frame_ = false;
+	float last_unsharp_ = 0.0;
+	ColorMatrix color_matrix_ = COLOR_MATRIX_BT601;
+	ColorRange color_range_ = COLOR_RANGE_LIMITED;
+	std::vector<PixelRect> dirty_rects_;
+	uint64_t pixels_touched_ = 0;
 };
 
 }
@@ -3,6 +3,7 @@
 #include "shader/d3d11/shader_d3d11_rgb_to_chroma420.h"
 
 #include "log.h"
+#include <d3d11_1.h>
 #include <wrl/client.h>
 
 using namespace DX;
@@ -177,7 +178,7 @@ bool D3D11RGBToYUVConverter::CreateBuffer()
 	return true;
 }
 
-bool D3D11RGBToYUVConverter::Convert(ID3D11Texture2D* rgba_texture)
+bool D3D11RGBToYUVConverter::Convert(ID3D11Texture2D* rgba_texture, const ChromaTileMask* mask)
 {
 	if (!yuv420_texture_) {
 		return false;
@@ -221,9 +222,51 @@ bool D3D11RGBToYUVConverter::Convert(ID3D11Texture2D* rgba_texture)
 	chroma420_texture_->End();
 	chroma420_texture_->PSSetTexture(0, NULL);
 
+	if (mask) {
+		ClearChroma420Tiles(*mask);
+	}
+
 	return true;
 }
 
+void D3D11RGBToYUVConverter::ClearChroma420Tiles(const ChromaTileMask& mask)
+{
+	if (!mask.Matches(width_, height_)) {
+		LOG("Chroma tile mask does not match %dx%d", width_, height_);
+		return;
+	}
+
+	Microsoft::WRL::ComPtr<ID3D11DeviceContext1> d3d11_context1;
+	HRESULT hr = d3d11_context_->QueryInterface(__uuidof(ID3D11DeviceContext1), (void**)d3d11_context1.GetAddressOf());
+	if (FAILED(hr)) {
+		return;
+	}
+
+	GetChromaTileRuns(mask, width_, height_, false, tile_rects_);
+	if (tile_rects_.empty()) {
+		return;
+	}
+
+	clear_rects_[0].clear();
+	clear_rects_[1].clear();
+	for (auto& rect : tile_rects_) {
+		PixelRect y_rects[2], uv_rects[2];
+		GetChroma420Rects(width_, rect, y_rects, uv_rects);
+		for (int i = 0; i < 2; i++) {
+			D3D11_RECT y_rect = { y_rects[i].left, y_rects[i].top, y_rects[i].right, y_rects[i].bottom };
+			D3D11_RECT uv_rect = { uv_rects[i].left, uv_rects[i].top, uv_rects[i].right, uv_rects[i].bottom };
+			clear_rects_[0].push_back(y_rect);
+			clear_rects_[1].push_back(uv_rect);
+		}
+	}
+
+	const FLOAT neutral[4] = { 128.0f / 255.0f, 128.0f / 255.0f, 0.0f, 0.0f };
+	d3d11_context1->ClearView(chroma420_texture_->GetNV12YRenderTargetView(), neutral,
+		clear_rects_[0].data(), static_cast<UINT>(clear_rects_[0].size()));
+	d3d11_context1->ClearView(chroma420_texture_->GetNV12UVRenderTargetView(), neutral,
+		clear_rects_[1].data(), static_cast<UINT>(clear_rects_[1].size()));
+}
+
 ID3D11Texture2D* D3D11RGBToYUVConverter::GetYUV420Texture()
 {
 	if (yuv420_texture_) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "d3d11_render_texture.h"
+#include "chroma_tile_mask.h"
 #include <memory>
 
 namespace DX {
@@ -14,7 +15,10 @@ public:
 	bool Init(int width, int height);
 	void Destroy();
 
-	bool Convert(ID3D11Texture2D* rgba_texture);
+	// Chroma420 samples of tiles outside mask are cleared to 128, see
+	// CPURGBToYUVConverter. Needs ID3D11DeviceContext1, without it the whole
+	// Chroma420 frame is kept.
+	bool Convert(ID3D11Texture2D* rgba_texture, const ChromaTileMask* mask = NULL);
 
 	ID3D11Texture2D* GetYUV420Texture();
 	ID3D11Texture2D* GetChroma420Texture();
@@ -23,6 +27,7 @@ private:
 	bool CreateTexture(int width, int height);
 	bool CreateSampler();
 	bool CreateBuffer();
+	void ClearChroma420Tiles(const ChromaTileMask& mask);
 
 	int width_ = 0;
 	int height_ = 0;
@@ -37,6 +42,9 @@ private:
 
 	std::unique_ptr<D3D11RenderTexture> yuv420_texture_;
 	std::unique_ptr<D3D11RenderTexture> chroma420_texture_;
+
+	std::vector<PixelRect> tile_rects_;
+	std::vector<D3D11_RECT> clear_rects_[2];
 };
 
 }
\ No newline at end of file
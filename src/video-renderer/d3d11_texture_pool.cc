@@ -0,0 +1,114 @@
+#include "d3d11_texture_pool.h"
+#include "log.h"
+
+#define DX_SAFE_RELEASE(p) { if(p) { (p)->Release(); (p) = NULL; } } 
+
+using namespace DX;
+
+uint64_t DX::GetTextureBytes(ID3D11Texture2D* texture)
+{
+	if (!texture) {
+		return 0;
+	}
+
+	D3D11_TEXTURE2D_DESC desc;
+	texture->GetDesc(&desc);
+
+	uint64_t pixels = static_cast<uint64_t>(desc.Width) * desc.Height * desc.ArraySize;
+
+	switch (desc.Format)
+	{
+	case DXGI_FORMAT_R8_UNORM:
+		return pixels;
+	case DXGI_FORMAT_R8G8_UNORM:
+	case DXGI_FORMAT_R16_UNORM:
+		return pixels * 2;
+	case DXGI_FORMAT_NV12:
+		return pixels * 3 / 2;
+	case DXGI_FORMAT_P010:
+		// 16-bit Y plane plus a half height 16-bit UV plane.
+		return pixels * 3;
+	default:
+		// R16G16_UNORM and the 8-bit RGBA formats. Formats not created here
+		// are counted as 32-bit too.
+		return pixels * 4;
+	}
+}
+
+D3D11TexturePool::D3D11TexturePool(ID3D11Device* d3d11_device)
+	: d3d11_device_(d3d11_device)
+{
+	d3d11_device_->AddRef();
+}
+
+D3D11TexturePool::~D3D11TexturePool()
+{
+	Clear();
+	DX_SAFE_RELEASE(d3d11_device_);
+}
+
+ID3D11Texture2D* D3D11TexturePool::GetTexture(UINT width, UINT height, DXGI_FORMAT format, int index)
+{
+	if (!d3d11_device_ || index < 0 || index >= kPingPongCount) {
+		return NULL;
+	}
+
+	Entry* entry = NULL;
+	for (auto& iter : entries_) {
+		if (iter.width == width && iter.height == height && iter.format == format) {
+			entry = &iter;
+			break;
+		}
+	}
+
+	if (!entry) {
+		entries_.emplace_back();
+		entry = &entries_.back();
+		entry->width = width;
+		entry->height = height;
+		entry->format = format;
+	}
+
+	if (!entry->textures[index]) {
+		D3D11_TEXTURE2D_DESC texture_desc;
+		memset(&texture_desc, 0, sizeof(D3D11_TEXTURE2D_DESC));
+		texture_desc.Width = width;
+		texture_desc.Height = height;
+		texture_desc.MipLevels = 1;
+		texture_desc.ArraySize = 1;
+		texture_desc.SampleDesc.Count = 1;
+		texture_desc.SampleDesc.Quality = 0;
+		texture_desc.Format = format;
+		texture_desc.Usage = D3D11_USAGE_DEFAULT;
+		texture_desc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
+
+		HRESULT hr = d3d11_device_->CreateTexture2D(&texture_desc, NULL, &entry->textures[index]);
+		if (FAILED(hr)) {
+			LOG("ID3D11Device::CreateTexture2D() failed, %x", hr);
+			return NULL;
+		}
+	}
+
+	return entry->textures[index];
+}
+
+void D3D11TexturePool::Clear()
+{
+	for (auto& entry : entries_) {
+		for (int i = 0; i < kPingPongCount; i++) {
+			DX_SAFE_RELEASE(entry.textures[i]);
+		}
+	}
+	entries_.clear();
+}
+
+uint64_t D3D11TexturePool::GetBytes()
+{
+	uint64_t bytes = 0;
+	for (auto& entry : entries_) {
+		for (int i = 0; i < kPingPongCount; i++) {
+			bytes += GetTextureBytes(entry.textures[i]);
+		}
+	}
+	return bytes;
+}
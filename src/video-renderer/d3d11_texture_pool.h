@@ -0,0 +1,44 @@
+#pragma once
+
+#include <windows.h>
+#include <d3d11.h>
+#include <cstdint>
+#include <vector>
+
+namespace DX {
+
+// Approximate video memory of a texture, mip levels and padding not included.
+uint64_t GetTextureBytes(ID3D11Texture2D* texture);
+
+// Render-target textures shared by the passes of a renderer. Each size and
+// format has a ping-pong pair, a pass reads one texture and draws into the
+// other, so a stream needs at most two backbuffer-sized intermediates.
+class D3D11TexturePool
+{
+public:
+	static const int kPingPongCount = 2;
+
+	D3D11TexturePool(ID3D11Device* d3d11_device);
+	virtual ~D3D11TexturePool();
+
+	// Texture index of the pair, created on first use.
+	ID3D11Texture2D* GetTexture(UINT width, UINT height, DXGI_FORMAT format, int index);
+
+	void Clear();
+
+	uint64_t GetBytes();
+
+private:
+	struct Entry
+	{
+		UINT width = 0;
+		UINT height = 0;
+		DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+		ID3D11Texture2D* textures[kPingPongCount] = { NULL };
+	};
+
+	ID3D11Device* d3d11_device_ = NULL;
+	std::vector<Entry> entries_;
+};
+
+}
@@ -0,0 +1,366 @@
+#include "d3d11_tile_reducer.h"
+#include "shader/d3d11/shader_d3d11_tile_diff.h"
+#include "shader/d3d11/shader_d3d11_chroma_detail.h"
+
+#include "log.h"
+#include <wrl/client.h>
+
+using namespace DX;
+
+struct TileParams
+{
+	uint32_t tile_size;
+	uint32_t width;
+	uint32_t height;
+	int32_t threshold;
+	uint32_t min_blocks;
+	uint32_t align0_;
+	uint32_t align1_;
+	uint32_t align2_;
+};
+
+D3D11TileReducer::D3D11TileReducer(ID3D11Device* d3d11_device)
+	: d3d11_device_(d3d11_device)
+{
+	d3d11_device_->AddRef();
+	d3d11_device_->GetImmediateContext(&d3d11_context_);
+}
+
+D3D11TileReducer::~D3D11TileReducer()
+{
+	Destroy();
+	d3d11_context_->Release();
+	d3d11_device_->Release();
+}
+
+bool D3D11TileReducer::Init(int width, int height, int tile_size)
+{
+	Destroy();
+
+	if (width <= 0 || height <= 0 || tile_size <= 0) {
+		return false;
+	}
+
+	tile_size_ = (tile_size + 3) & ~3;
+	tiles_x_ = (width + tile_size_ - 1) / tile_size_;
+	tiles_y_ = (height + tile_size_ - 1) / tile_size_;
+	width_ = width;
+	height_ = height;
+
+	if (!CreateBuffer()) {
+		Destroy();
+		return false;
+	}
+
+	D3D11_TEXTURE2D_DESC desc;
+	memset(&desc, 0, sizeof(D3D11_TEXTURE2D_DESC));
+	desc.Width = tiles_x_;
+	desc.Height = tiles_y_;
+	desc.MipLevels = 1;
+	desc.ArraySize = 1;
+	desc.Format = DXGI_FORMAT_R8_UNORM;
+	desc.SampleDesc.Count = 1;
+	desc.Usage = D3D11_USAGE_STAGING;
+	desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+
+	HRESULT hr = d3d11_device_->CreateTexture2D(&desc, NULL, &staging_);
+	if (FAILED(hr)) {
+		LOG("ID3D11Device::CreateTexture2D(STAGING) failed, %x", hr);
+		Destroy();
+		return false;
+	}
+
+	if (!InitTileTexture(diff_texture_, shader_d3d11_tile_diff, sizeof(shader_d3d11_tile_diff)) ||
+		!InitTileTexture(chroma_detail_texture_, shader_d3d11_chroma_detail, sizeof(shader_d3d11_chroma_detail))) {
+		Destroy();
+		return false;
+	}
+
+	tiles_.assign(static_cast<size_t>(tiles_x_) * tiles_y_, 0);
+	return true;
+}
+
+void D3D11TileReducer::Destroy()
+{
+	if (buffer_) {
+		buffer_->Release();
+		buffer_ = NULL;
+	}
+
+	if (staging_) {
+		staging_->Release();
+		staging_ = NULL;
+	}
+
+	diff_texture_ = nullptr;
+	chroma_detail_texture_ = nullptr;
+	threshold_ = -1;
+	min_blocks_ = -1;
+
+	if (last_nv12_y_srv_) {
+		last_nv12_y_srv_->Release();
+		last_nv12_y_srv_ = NULL;
+	}
+
+	if (last_nv12_uv_srv_) {
+		last_nv12_uv_srv_->Release();
+		last_nv12_uv_srv_ = NULL;
+	}
+
+	if (last_nv12_texture_) {
+		last_nv12_texture_->Release();
+		last_nv12_texture_ = NULL;
+	}
+
+	is_last_valid_ = false;
+	tiles_.clear();
+	tiles_x_ = 0;
+	tiles_y_ = 0;
+}
+
+bool D3D11TileReducer::CreateBuffer()
+{
+	D3D11_BUFFER_DESC buffer_desc;
+	memset(&buffer_desc, 0, sizeof(D3D11_BUFFER_DESC));
+	buffer_desc.Usage = D3D11_USAGE_DEFAULT;
+	buffer_desc.ByteWidth = sizeof(TileParams);
+	buffer_desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+	buffer_desc.CPUAccessFlags = 0;
+
+	HRESULT hr = d3d11_device_->CreateBuffer(&buffer_desc, NULL, &buffer_);
+	if (FAILED(hr)) {
+		LOG("ID3D11Device::CreateBuffer(CONSTANT_BUFFER) failed, %x", hr);
+		return false;
+	}
+
+	UpdateBuffer(0, 0);
+	return true;
+}
+
+void D3D11TileReducer::UpdateBuffer(int threshold, int min_blocks)
+{
+	if (threshold == threshold_ && min_blocks == min_blocks_) {
+		return;
+	}
+
+	TileParams params;
+	memset(&params, 0, sizeof(TileParams));
+	params.tile_size = tile_size_;
+	params.width = width_;
+	params.height = height_;
+	params.threshold = threshold;
+	params.min_blocks = min_blocks;
+	d3d11_context_->UpdateSubresource(buffer_, 0, NULL, &params, 0, 0);
+
+	threshold_ = threshold;
+	min_blocks_ = min_blocks;
+}
+
+bool D3D11TileReducer::InitTileTexture(std::unique_ptr<D3D11RenderTexture>& tile_texture, const BYTE* pixel_shader, size_t pixel_shader_size)
+{
+	tile_texture.reset(new D3D11RenderTexture(d3d11_device_));
+	return tile_texture->InitTexture(tiles_x_, tiles_y_, DXGI_FORMAT_R8_UNORM, D3D11_USAGE_DEFAULT, D3D11_BIND_RENDER_TARGET, 0, 0) &&
+		tile_texture->InitVertexShader() &&
+		tile_texture->InitRasterizerState() &&
+		tile_texture->InitPixelShader(NULL, pixel_shader, pixel_shader_size);
+}
+
+bool D3D11TileReducer::CreateNV12Views(ID3D11Texture2D* texture, ID3D11ShaderResourceView** y_srv, ID3D11ShaderResourceView** uv_srv)
+{
+	D3D11_SHADER_RESOURCE_VIEW_DESC srv_desc;
+	memset(&srv_desc, 0, sizeof(D3D11_SHADER_RESOURCE_VIEW_DESC));
+	srv_desc.Format = DXGI_FORMAT_R8_UNORM;
+	srv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+	srv_desc.Texture2D.MostDetailedMip = 0;
+	srv_desc.Texture2D.MipLevels = 1;
+
+	HRESULT hr = d3d11_device_->CreateShaderResourceView(texture, &srv_desc, y_srv);
+	if (FAILED(hr)) {
+		LOG("ID3D11Device::CreateShaderResourceView(R8) failed, %x", hr);
+		return false;
+	}
+
+	srv_desc.Format = DXGI_FORMAT_R8G8_UNORM;
+	hr = d3d11_device_->CreateShaderResourceView(texture, &srv_desc, uv_srv);
+	if (FAILED(hr)) {
+		LOG("ID3D11Device::CreateShaderResourceView(R8G8) failed, %x", hr);
+		(*y_srv)->Release();
+		*y_srv = NULL;
+		return false;
+	}
+
+	return true;
+}
+
+int D3D11TileReducer::UpdateNV12(ID3D11Texture2D* nv12_texture)
+{
+	if (!diff_texture_) {
+		return -1;
+	}
+
+	D3D11_TEXTURE2D_DESC desc;
+	nv12_texture->GetDesc(&desc);
+	if (desc.Format != DXGI_FORMAT_NV12 || desc.Width != static_cast<UINT>(width_) || desc.Height != static_cast<UINT>(height_)) {
+		LOG("Unexpected texture, format:%d size:%ux%u", desc.Format, desc.Width, desc.Height);
+		return -1;
+	}
+
+	if (!last_nv12_texture_) {
+		desc.Usage = D3D11_USAGE_DEFAULT;
+		desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+		desc.CPUAccessFlags = 0;
+		desc.MiscFlags = 0;
+		HRESULT hr = d3d11_device_->CreateTexture2D(&desc, NULL, &last_nv12_texture_);
+		if (FAILED(hr)) {
+			LOG("ID3D11Device::CreateTexture2D(NV12) failed, %x", hr);
+			return -1;
+		}
+
+		if (!CreateNV12Views(last_nv12_texture_, &last_nv12_y_srv_, &last_nv12_uv_srv_)) {
+			last_nv12_texture_->Release();
+			last_nv12_texture_ = NULL;
+			return -1;
+		}
+		is_last_valid_ = false;
+	}
+
+	int changed_tiles = tiles_x_ * tiles_y_;
+	if (is_last_valid_) {
+		Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> y_srv, uv_srv;
+		if (!CreateNV12Views(nv12_texture, y_srv.GetAddressOf(), uv_srv.GetAddressOf())) {
+			return -1;
+		}
+
+		diff_texture_->Begin();
+		diff_texture_->PSSetTexture(0, y_srv.Get());
+		diff_texture_->PSSetTexture(1, uv_srv.Get());
+		diff_texture_->PSSetTexture(2, last_nv12_y_srv_);
+		diff_texture_->PSSetTexture(3, last_nv12_uv_srv_);
+		diff_texture_->PSSetConstant(0, buffer_);
+		diff_texture_->Draw();
+		diff_texture_->End();
+		for (UINT slot = 0; slot < 4; slot++) {
+			diff_texture_->PSSetTexture(slot, NULL);
+		}
+
+		if (!ReadTiles(diff_texture_.get())) {
+			return -1;
+		}
+
+		changed_tiles = 0;
+		for (uint8_t tile : tiles_) {
+			changed_tiles += tile ? 1 : 0;
+		}
+	}
+	else {
+		tiles_.assign(tiles_.size(), 1);
+	}
+
+	if (changed_tiles > 0) {
+		d3d11_context_->CopyResource(last_nv12_texture_, nv12_texture);
+		is_last_valid_ = true;
+	}
+	return changed_tiles;
+}
+
+void D3D11TileReducer::Reset()
+{
+	is_last_valid_ = false;
+}
+
+bool D3D11TileReducer::ClassifyChromaDetail(ID3D11Texture2D* rgb_texture, ChromaTileMask* mask, int threshold, int min_blocks)
+{
+	if (!chroma_detail_texture_) {
+		return false;
+	}
+
+	D3D11_TEXTURE2D_DESC desc;
+	rgb_texture->GetDesc(&desc);
+	if (desc.Width != static_cast<UINT>(width_) || desc.Height != static_cast<UINT>(height_)) {
+		LOG("Unexpected texture size, %ux%u", desc.Width, desc.Height);
+		return false;
+	}
+
+	mask->tile_size = tile_size_;
+	mask->tiles_x = tiles_x_;
+	mask->tiles_y = tiles_y_;
+
+	if (min_blocks <= 0) {
+		mask->tiles.assign(tiles_.size(), 1);
+		return true;
+	}
+
+	D3D11_SHADER_RESOURCE_VIEW_DESC srv_desc;
+	memset(&srv_desc, 0, sizeof(D3D11_SHADER_RESOURCE_VIEW_DESC));
+	srv_desc.Format = desc.Format;
+	srv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+	srv_desc.Texture2D.MostDetailedMip = 0;
+	srv_desc.Texture2D.MipLevels = 1;
+
+	Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> rgb_srv;
+	HRESULT hr = d3d11_device_->CreateShaderResourceView(rgb_texture, &srv_desc, rgb_srv.GetAddressOf());
+	if (FAILED(hr)) {
+		LOG("ID3D11Device::CreateShaderResourceView() failed, %x", hr);
+		return false;
+	}
+
+	UpdateBuffer(threshold, min_blocks);
+
+	chroma_detail_texture_->Begin();
+	chroma_detail_texture_->PSSetTexture(0, rgb_srv.Get());
+	chroma_detail_texture_->PSSetConstant(0, buffer_);
+	chroma_detail_texture_->Draw();
+	chroma_detail_texture_->End();
+	chroma_detail_texture_->PSSetTexture(0, NULL);
+
+	if (!ReadTiles(chroma_detail_texture_.get())) {
+		return false;
+	}
+
+	mask->tiles = tiles_;
+	return true;
+}
+
+bool D3D11TileReducer::ReadTiles(D3D11RenderTexture* tile_texture)
+{
+	// Only tiles_x * tiles_y bytes are read back. The map still waits for the
+	// reduction, the results decide how the same frame is encoded.
+	d3d11_context_->CopyResource(staging_, tile_texture->GetTexture());
+
+	D3D11_MAPPED_SUBRESOURCE mapped_resource;
+	HRESULT hr = d3d11_context_->Map(staging_, 0, D3D11_MAP_READ, 0, &mapped_resource);
+	if (FAILED(hr)) {
+		LOG("ID3D11DeviceContext::Map(STAGING) failed, %x", hr);
+		return false;
+	}
+
+	for (int ty = 0; ty < tiles_y_; ty++) {
+		const uint8_t* row = static_cast<const uint8_t*>(mapped_resource.pData) + ty * mapped_resource.RowPitch;
+		for (int tx = 0; tx < tiles_x_; tx++) {
+			tiles_[ty * tiles_x_ + tx] = row[tx] >= 128 ? 1 : 0;
+		}
+	}
+
+	d3d11_context_->Unmap(staging_, 0);
+	return true;
+}
+
+const std::vector<uint8_t>& D3D11TileReducer::GetTiles()
+{
+	return tiles_;
+}
+
+int D3D11TileReducer::GetTileSize()
+{
+	return tile_size_;
+}
+
+int D3D11TileReducer::GetTilesX()
+{
+	return tiles_x_;
+}
+
+int D3D11TileReducer::GetTilesY()
+{
+	return tiles_y_;
+}
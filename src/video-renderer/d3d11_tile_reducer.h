@@ -0,0 +1,74 @@
+#pragma once
+
+#include "d3d11_render_texture.h"
+#include "chroma_tile_mask.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace DX {
+
+// Reduces textures to one byte per tile on the GPU, so only the tile results
+// are read back instead of whole frames.
+class D3D11TileReducer
+{
+public:
+	D3D11TileReducer(ID3D11Device* d3d11_device);
+	virtual ~D3D11TileReducer();
+
+	// width x height of the textures to reduce, tile_size in luma pixels,
+	// rounded up to a multiple of 4.
+	bool Init(int width, int height, int tile_size = 64);
+	void Destroy();
+
+	// Like TileHasher::Update() for an NV12 texture with D3D11_BIND_SHADER_RESOURCE:
+	// returns the number of tiles that differ from the texture of the previous
+	// Update(), all of them after Reset(), or -1 on failure. The texture is
+	// kept as a GPU copy for the next call.
+	int UpdateNV12(ID3D11Texture2D* nv12_texture);
+	void Reset();
+
+	// DX::ClassifyChromaDetail() for an RGB texture with D3D11_BIND_SHADER_RESOURCE,
+	// mask gets the tile size given to Init().
+	bool ClassifyChromaDetail(ID3D11Texture2D* rgb_texture, ChromaTileMask* mask, int threshold = 16, int min_blocks = 4);
+
+	// Tile results of the last call, tiles_x * tiles_y bytes, non-zero where set.
+	const std::vector<uint8_t>& GetTiles();
+
+	int GetTileSize();
+	int GetTilesX();
+	int GetTilesY();
+
+private:
+	bool CreateBuffer();
+	void UpdateBuffer(int threshold, int min_blocks);
+	bool InitTileTexture(std::unique_ptr<D3D11RenderTexture>& tile_texture, const BYTE* pixel_shader, size_t pixel_shader_size);
+	bool CreateNV12Views(ID3D11Texture2D* texture, ID3D11ShaderResourceView** y_srv, ID3D11ShaderResourceView** uv_srv);
+	bool ReadTiles(D3D11RenderTexture* tile_texture);
+
+	int width_ = 0;
+	int height_ = 0;
+	int tile_size_ = 64;
+	int tiles_x_ = 0;
+	int tiles_y_ = 0;
+
+	ID3D11Device*        d3d11_device_  = NULL;
+	ID3D11DeviceContext* d3d11_context_ = NULL;
+
+	ID3D11Buffer*    buffer_  = NULL;
+	ID3D11Texture2D* staging_ = NULL;
+
+	std::unique_ptr<D3D11RenderTexture> diff_texture_;
+	std::unique_ptr<D3D11RenderTexture> chroma_detail_texture_;
+	int threshold_ = -1;
+	int min_blocks_ = -1;
+
+	ID3D11Texture2D*          last_nv12_texture_ = NULL;
+	ID3D11ShaderResourceView* last_nv12_y_srv_   = NULL;
+	ID3D11ShaderResourceView* last_nv12_uv_srv_  = NULL;
+	bool is_last_valid_ = false;
+
+	std::vector<uint8_t> tiles_;
+};
+
+}
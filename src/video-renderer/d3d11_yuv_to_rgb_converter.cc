@@ -1,5 +1,7 @@
 #include "d3d11_yuv_to_rgb_converter.h"
 #include "shader/d3d11/shader_d3d11_yuv_to_rgb.h"
+#include "shader/d3d11/shader_d3d11_yuv420_to_rgb.h"
+#include "color_matrix.h"
 
 #include "log.h"
 #include <wrl/client.h>
@@ -53,11 +55,25 @@ void D3D11YUVToRGBConverter::Destroy()
 		point_sampler_ = nullptr;
 	}
 
+	if (linear_sampler_) {
+		linear_sampler_->Release();
+		linear_sampler_ = nullptr;
+	}
+
 	if (buffer_) {
 		buffer_->Release();
 		buffer_ = nullptr;
 	}
 
+	if (color_buffer_) {
+		color_buffer_->Release();
+		color_buffer_ = nullptr;
+	}
+
+	if (upsample_texture_) {
+		upsample_texture_ = nullptr;
+	}
+
 	if (rgba_texture_) {
 		rgba_texture_ = nullptr;
 	}
@@ -91,6 +107,24 @@ bool D3D11YUVToRGBConverter::CreateTexture(int width, int height)
 		return  false;
 	}
 
+	upsample_texture_.reset(new D3D11RenderTexture(d3d11_device_));
+
+	if (!upsample_texture_->InitTexture(rgba_texture_->GetTexture())) {
+		return  false;
+	}
+
+	if (!upsample_texture_->InitVertexShader()) {
+		return  false;
+	}
+
+	if (!upsample_texture_->InitRasterizerState()) {
+		return  false;
+	}
+
+	if (!upsample_texture_->InitPixelShader(NULL, shader_d3d11_yuv420_to_rgb, sizeof(shader_d3d11_yuv420_to_rgb))) {
+		return  false;
+	}
+
 	return true;
 }
 
@@ -100,6 +134,10 @@ bool D3D11YUVToRGBConverter::CreateSampler()
 		point_sampler_->Release();
 	}
 
+	if (linear_sampler_) {
+		linear_sampler_->Release();
+	}
+
 	D3D11_SAMPLER_DESC sampler_desc;
 	memset(&sampler_desc, 0, sizeof(D3D11_SAMPLER_DESC));
 	sampler_desc.Filter = D3D11_FILTER_MIN_MAG_MIP_POINT;//D3D11_FILTER_MIN_MAG_MIP_LINEAR;//D3D11_FILTER_MIN_MAG_MIP_POINT;
@@ -118,6 +156,18 @@ bool D3D11YUVToRGBConverter::CreateSampler()
 		return false;
 	}
 
+	// Chroma upsampling outside the tile mask, clamped at the frame edges.
+	sampler_desc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+	sampler_desc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
+	sampler_desc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
+	sampler_desc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
+
+	hr = d3d11_device_->CreateSamplerState(&sampler_desc, &linear_sampler_);
+	if (FAILED(hr)) {
+		LOG("ID3D11Device::CreateSamplerState(LINEAR) failed, %x", hr);
+		return false;
+	}
+
 	return true;
 }
 
@@ -140,10 +190,27 @@ bool D3D11YUVToRGBConverter::CreateBuffer()
 		return false;
 	}
 
+	if (color_buffer_) {
+		color_buffer_->Release();
+	}
+
+	YUVShaderConstants constants = GetYUVShaderConstants(COLOR_MATRIX_BT601, COLOR_RANGE_LIMITED);
+	D3D11_SUBRESOURCE_DATA init_data;
+	memset(&init_data, 0, sizeof(D3D11_SUBRESOURCE_DATA));
+	init_data.pSysMem = &constants;
+
+	buffer_desc.Usage = D3D11_USAGE_IMMUTABLE;
+	buffer_desc.ByteWidth = sizeof(YUVShaderConstants);
+	hr = d3d11_device_->CreateBuffer(&buffer_desc, &init_data, &color_buffer_);
+	if (FAILED(hr)) {
+		LOG("[D3D11Renderer] CreateBuffer(CONSTANT_BUFFER) failed, %x", hr);
+		return false;
+	}
+
 	return true;
 }
 
-bool D3D11YUVToRGBConverter::Combine(ID3D11Texture2D* yuv420_texture, ID3D11Texture2D* chroma420_texture)
+bool D3D11YUVToRGBConverter::Combine(ID3D11Texture2D* yuv420_texture, ID3D11Texture2D* chroma420_texture, const ChromaTileMask* mask)
 {
 	Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> yuv420_y_srv;
 	Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> yuv420_uv_srv;
@@ -179,29 +246,15 @@ bool D3D11YUVToRGBConverter::Combine(ID3D11Texture2D* yuv420_texture, ID3D11Text
 		return false;
 	}
 
-	YUVParams yuv_params;
-	yuv_params.width = static_cast<float>(width_);
-	yuv_params.height = static_cast<float>(height_);
-	d3d11_context_->UpdateSubresource((ID3D11Resource*)buffer_, 0, NULL, &yuv_params, 0, 0);
-
-	rgba_texture_->Begin();
-	rgba_texture_->PSSetTexture(0, yuv420_y_srv.Get());
-	rgba_texture_->PSSetTexture(1, yuv420_uv_srv.Get());
-	rgba_texture_->PSSetTexture(2, chroma420_y_srv.Get());
-	rgba_texture_->PSSetTexture(3, chroma420_uv_srv.Get());
-	rgba_texture_->PSSetConstant(0, buffer_);
-	rgba_texture_->PSSetSamplers(0, point_sampler_);
-	rgba_texture_->Draw();
-	rgba_texture_->End();
-	rgba_texture_->PSSetTexture(0, NULL);
-	rgba_texture_->PSSetTexture(1, NULL);
-	rgba_texture_->PSSetTexture(2, NULL);
-	rgba_texture_->PSSetTexture(3, NULL);
-
+	ID3D11ShaderResourceView* shader_resource_views[4] = {
+		yuv420_y_srv.Get(), yuv420_uv_srv.Get(), chroma420_y_srv.Get(), chroma420_uv_srv.Get()
+	};
+	Draw(shader_resource_views, mask);
 	return true;
 }
 
-bool D3D11YUVToRGBConverter::Combine(ID3D11Texture2D* yuv420_texture, int yuv420_index, ID3D11Texture2D* chroma420_texture, int chroma420_index)
+bool D3D11YUVToRGBConverter::Combine(ID3D11Texture2D* yuv420_texture, int yuv420_index, ID3D11Texture2D* chroma420_texture, int chroma420_index,
+	const ChromaTileMask* mask)
 {
 	Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> yuv420_y_srv;
 	Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> yuv420_uv_srv;
@@ -249,26 +302,67 @@ bool D3D11YUVToRGBConverter::Combine(ID3D11Texture2D* yuv420_texture, int yuv420
 		return false;
 	}
 
+	ID3D11ShaderResourceView* shader_resource_views[4] = {
+		yuv420_y_srv.Get(), yuv420_uv_srv.Get(), chroma420_y_srv.Get(), chroma420_uv_srv.Get()
+	};
+	Draw(shader_resource_views, mask);
+	return true;
+}
+
+void D3D11YUVToRGBConverter::Draw(ID3D11ShaderResourceView* const shader_resource_views[4], const ChromaTileMask* mask)
+{
 	YUVParams yuv_params;
 	yuv_params.width = static_cast<float>(width_);
 	yuv_params.height = static_cast<float>(height_);
 	d3d11_context_->UpdateSubresource((ID3D11Resource*)buffer_, 0, NULL, &yuv_params, 0, 0);
 
-	rgba_texture_->Begin();
-	rgba_texture_->PSSetTexture(0, yuv420_y_srv.Get());
-	rgba_texture_->PSSetTexture(1, yuv420_uv_srv.Get());
-	rgba_texture_->PSSetTexture(2, chroma420_y_srv.Get());
-	rgba_texture_->PSSetTexture(3, chroma420_uv_srv.Get());
-	rgba_texture_->PSSetConstant(0, buffer_);
-	rgba_texture_->PSSetSamplers(0, point_sampler_);
-	rgba_texture_->Draw();
-	rgba_texture_->End();
+	if (mask && !mask->Matches(width_, height_)) {
+		LOG("Chroma tile mask does not match %dx%d", width_, height_);
+		mask = NULL;
+	}
+
+	tile_rects_.clear();
+	if (mask) {
+		// Whole frame as 4:2:0 first, then the 4:4:4 tiles on top with scissor rects.
+		upsample_texture_->Begin();
+		upsample_texture_->PSSetTexture(0, shader_resource_views[0]);
+		upsample_texture_->PSSetTexture(1, shader_resource_views[1]);
+		upsample_texture_->PSSetConstant(0, buffer_);
+		upsample_texture_->PSSetConstant(1, color_buffer_);
+		upsample_texture_->PSSetSamplers(0, linear_sampler_);
+		upsample_texture_->PSSetSamplers(1, point_sampler_);
+		upsample_texture_->Draw();
+		upsample_texture_->End();
+		upsample_texture_->PSSetTexture(0, NULL);
+		upsample_texture_->PSSetTexture(1, NULL);
+
+		GetChromaTileRuns(*mask, width_, height_, true, tile_rects_);
+	}
+	else {
+		PixelRect rect;
+		rect.right = width_;
+		rect.bottom = height_;
+		tile_rects_.push_back(rect);
+	}
+
+	for (auto& rect : tile_rects_) {
+		D3D11_RECT scissor_rect = { rect.left, rect.top, rect.right, rect.bottom };
+		rgba_texture_->Begin(mask ? &scissor_rect : NULL);
+		rgba_texture_->PSSetTexture(0, shader_resource_views[0]);
+		rgba_texture_->PSSetTexture(1, shader_resource_views[1]);
+		rgba_texture_->PSSetTexture(2, shader_resource_views[2]);
+		rgba_texture_->PSSetTexture(3, shader_resource_views[3]);
+		rgba_texture_->PSSetConstant(0, buffer_);
+		rgba_texture_->PSSetConstant(1, color_buffer_);
+		rgba_texture_->PSSetSamplers(0, point_sampler_);
+		rgba_texture_->Draw();
+		rgba_texture_->End();
+	}
+
 	rgba_texture_->PSSetTexture(0, NULL);
 	rgba_texture_->PSSetTexture(1, NULL);
 	rgba_texture_->PSSetTexture(2, NULL);
 	rgba_texture_->PSSetTexture(3, NULL);
-
-	return true;
 }
 
 ID3D11Texture2D* D3D11YUVToRGBConverter::GetRGBATexture()
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "d3d11_render_texture.h"
+#include "chroma_tile_mask.h"
 #include <memory>
 
 namespace DX {
@@ -14,8 +15,11 @@ public:
 	bool Init(int width, int height);
 	void Destroy();
 
-	bool Combine(ID3D11Texture2D* yuv420_texture, ID3D11Texture2D* chroma420_texture);
-	bool Combine(ID3D11Texture2D* yuv420_texture, int yuv420_index, ID3D11Texture2D* chroma420_texture, int chroma420_index);
+	// Tiles outside mask are drawn from the YUV420 texture alone, with chroma
+	// interpolated between its co-sited samples. NULL combines the whole frame.
+	bool Combine(ID3D11Texture2D* yuv420_texture, ID3D11Texture2D* chroma420_texture, const ChromaTileMask* mask = NULL);
+	bool Combine(ID3D11Texture2D* yuv420_texture, int yuv420_index, ID3D11Texture2D* chroma420_texture, int chroma420_index,
+		const ChromaTileMask* mask = NULL);
 
 	ID3D11Texture2D* GetRGBATexture();
 
@@ -23,6 +27,7 @@ private:
 	bool CreateTexture(int width, int height);
 	bool CreateSampler();
 	bool CreateBuffer();
+	void Draw(ID3D11ShaderResourceView* const shader_resource_views[4], const ChromaTileMask* mask);
 
 	int width_ = 0;
 	int height_ = 0;
@@ -30,9 +35,15 @@ private:
 	ID3D11Device* d3d11_device_ = NULL;
 	ID3D11DeviceContext* d3d11_context_ = NULL;
 	ID3D11SamplerState* point_sampler_ = NULL;
+	ID3D11SamplerState* linear_sampler_ = NULL;
 	ID3D11Buffer* buffer_ = NULL;
+	// b1, BT.601 limited range like the encoder side.
+	ID3D11Buffer* color_buffer_ = NULL;
 
 	std::unique_ptr<D3D11RenderTexture> rgba_texture_;
+	// Same texture as rgba_texture_, drawn with d3d11_yuv420_to_rgb.hlsl.
+	std::unique_ptr<D3D11RenderTexture> upsample_texture_;
+	std::vector<PixelRect> tile_rects_;
 };
 
 }
\ No newline at end of file
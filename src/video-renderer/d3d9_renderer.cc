@@ -1,8 +1,10 @@
 #include "d3d9_renderer.h"
 #include "log.h"
+#include "plane_copy.h"
+#include "color_matrix.h"
+#include "cpu_color_converter.h"
 
-#include "shader/d3d9/shader_d3d9_yuv_bt601.h"
-#include "shader/d3d9/shader_d3d9_yuv_bt709.h"
+#include "shader/d3d9/shader_d3d9_yuv.h"
 #include "shader/d3d9/shader_d3d9_sharpness.h"
 
 using namespace DX;
@@ -131,6 +133,8 @@ void D3D9Renderer::Render(PixelFrame* frame)
 	Copy(frame);
 	Process();
 	End();
+
+	has_last_frame_ = true;
 }
 
 IDirect3DDevice9* D3D9Renderer::GetDevice()
@@ -143,6 +147,12 @@ void D3D9Renderer::SetSharpen(float unsharp)
 	unsharp_ = unsharp;
 }
 
+uint64_t D3D9Renderer::GetPixelsTouched()
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+	return pixels_touched_;
+}
+
 bool D3D9Renderer::CreateDevice()
 {
 	HRESULT hr = S_OK;
@@ -226,6 +236,7 @@ bool D3D9Renderer::CreateRender()
 	}
 
 	HRESULT hr = S_OK;
+	has_last_frame_ = false;
 
 	hr = d3d9_device_->GetBackBuffer(0, 0, D3DBACKBUFFER_TYPE_MONO, &back_buffer_);
 	if (FAILED(hr)) {
@@ -245,16 +256,13 @@ bool D3D9Renderer::CreateRender()
 		render_target_[i].reset(new D3D9RenderTexture(d3d9_device_));
 	}
 
-	render_target_[PIXEL_SHADER_YUV_BT601]->InitTexture(desc.Width, desc.Height, 1, D3DUSAGE_RENDERTARGET, desc.Format, D3DPOOL_DEFAULT);
-	render_target_[PIXEL_SHADER_YUV_BT709]->InitTexture(desc.Width, desc.Height, 1, D3DUSAGE_RENDERTARGET, desc.Format, D3DPOOL_DEFAULT);
+	render_target_[PIXEL_SHADER_YUV]->InitTexture(desc.Width, desc.Height, 1, D3DUSAGE_RENDERTARGET, desc.Format, D3DPOOL_DEFAULT);
 	render_target_[PIXEL_SHADER_SHARPEN]->InitTexture(desc.Width, desc.Height, 1, D3DUSAGE_RENDERTARGET, desc.Format, D3DPOOL_DEFAULT);
 	
-	render_target_[PIXEL_SHADER_YUV_BT601]->InitVertexShader();
-	render_target_[PIXEL_SHADER_YUV_BT709]->InitVertexShader();
+	render_target_[PIXEL_SHADER_YUV]->InitVertexShader();
 	render_target_[PIXEL_SHADER_SHARPEN]->InitVertexShader();
 
-	render_target_[PIXEL_SHADER_YUV_BT601]->InitPixelShader(NULL, shader_d3d9_yuv_bt601, sizeof(shader_d3d9_yuv_bt601));
-	render_target_[PIXEL_SHADER_YUV_BT709]->InitPixelShader(NULL, shader_d3d9_yuv_bt709, sizeof(shader_d3d9_yuv_bt709));
+	render_target_[PIXEL_SHADER_YUV]->InitPixelShader(NULL, shader_d3d9_yuv, sizeof(shader_d3d9_yuv));
 	render_target_[PIXEL_SHADER_SHARPEN]->InitPixelShader(NULL, shader_d3d9_sharpness, sizeof(shader_d3d9_sharpness));
 	
 	return true;
@@ -270,6 +278,8 @@ bool D3D9Renderer::CreateTexture(int width, int height, PixelFormat format)
 		input_texture_[i].reset(new D3D9RenderTexture(d3d9_device_));
 	}
 
+	has_last_frame_ = false;
+
 	if (format == PIXEL_FORMAT_I420) {
 		UINT half_width  = (width + 1) / 2;
 		UINT half_height = (height + 1) / 2;
@@ -277,12 +287,26 @@ bool D3D9Renderer::CreateTexture(int width, int height, PixelFormat format)
 		input_texture_[PIXEL_PLANE_U]->InitTexture(half_width, half_height, 1, D3DUSAGE_DYNAMIC, D3DFMT_L8, D3DPOOL_DEFAULT);
 		input_texture_[PIXEL_PLANE_V]->InitTexture(half_width, half_height, 1, D3DUSAGE_DYNAMIC, D3DFMT_L8, D3DPOOL_DEFAULT);
 	}
+	else if (format == PIXEL_FORMAT_I010 || format == PIXEL_FORMAT_P010) {
+		// Both are uploaded as planar 16-bit, P010 UV is split on the CPU.
+		UINT half_width  = (width + 1) / 2;
+		UINT half_height = (height + 1) / 2;
+		input_texture_[PIXEL_PLANE_Y]->InitTexture(width, height, 1, D3DUSAGE_DYNAMIC, D3DFMT_L16, D3DPOOL_DEFAULT);
+		input_texture_[PIXEL_PLANE_U]->InitTexture(half_width, half_height, 1, D3DUSAGE_DYNAMIC, D3DFMT_L16, D3DPOOL_DEFAULT);
+		input_texture_[PIXEL_PLANE_V]->InitTexture(half_width, half_height, 1, D3DUSAGE_DYNAMIC, D3DFMT_L16, D3DPOOL_DEFAULT);
+	}
 	else if (format == PIXEL_FORMAT_I444) {
 		input_texture_[PIXEL_PLANE_Y]->InitTexture(width, height, 1, D3DUSAGE_DYNAMIC, D3DFMT_L8, D3DPOOL_DEFAULT);
 		input_texture_[PIXEL_PLANE_U]->InitTexture(width, height, 1, D3DUSAGE_DYNAMIC, D3DFMT_L8, D3DPOOL_DEFAULT);
 		input_texture_[PIXEL_PLANE_V]->InitTexture(width, height, 1, D3DUSAGE_DYNAMIC, D3DFMT_L8, D3DPOOL_DEFAULT);
 	}	
-	else if (format == PIXEL_FORMAT_ARGB) {
+	else if (format == PIXEL_FORMAT_I422 || format == PIXEL_FORMAT_YUY2 || format == PIXEL_FORMAT_UYVY) {
+		UINT half_width = (width + 1) / 2;
+		input_texture_[PIXEL_PLANE_Y]->InitTexture(width, height, 1, D3DUSAGE_DYNAMIC, D3DFMT_L8, D3DPOOL_DEFAULT);
+		input_texture_[PIXEL_PLANE_U]->InitTexture(half_width, height, 1, D3DUSAGE_DYNAMIC, D3DFMT_L8, D3DPOOL_DEFAULT);
+		input_texture_[PIXEL_PLANE_V]->InitTexture(half_width, height, 1, D3DUSAGE_DYNAMIC, D3DFMT_L8, D3DPOOL_DEFAULT);
+	}
+	else if (format == PIXEL_FORMAT_ARGB || format == PIXEL_FORMAT_RGBA || format == PIXEL_FORMAT_RGB24) {
 		input_texture_[PIXEL_PLANE_ARGB]->InitTexture(width, height, 1, D3DUSAGE_DYNAMIC, D3DFMT_X8R8G8B8, D3DPOOL_DEFAULT);
 	}
 	else if (format == PIXEL_FORMAT_NV12) {
@@ -359,13 +383,30 @@ void D3D9Renderer::Copy(PixelFrame* frame)
 		return ;
 	}
 
-	if (frame->format == PIXEL_FORMAT_I420) {
+	GetDirtyRects(frame, !has_last_frame_, dirty_rects_);
+	color_matrix_ = frame->color_matrix;
+	color_range_ = frame->color_range;
+
+	pixels_touched_ = 0;
+	for (auto& rect : dirty_rects_) {
+		pixels_touched_ += static_cast<uint64_t>(rect.right - rect.left) * (rect.bottom - rect.top);
+	}
+
+	if (frame->format == PIXEL_FORMAT_I420 || frame->format == PIXEL_FORMAT_I010 ||
+		frame->format == PIXEL_FORMAT_I422) {
 		if (input_texture_[PIXEL_PLANE_Y] &&
 			input_texture_[PIXEL_PLANE_U] &&
 			input_texture_[PIXEL_PLANE_V]) {
 			UpdateI420(frame);
 		}
 	}
+	else if (frame->format == PIXEL_FORMAT_P010) {
+		if (input_texture_[PIXEL_PLANE_Y] &&
+			input_texture_[PIXEL_PLANE_U] &&
+			input_texture_[PIXEL_PLANE_V]) {
+			UpdateP010(frame);
+		}
+	}
 	else if (frame->format == PIXEL_FORMAT_I444) {
 		if (input_texture_[PIXEL_PLANE_Y] && 
 			input_texture_[PIXEL_PLANE_U] && 
@@ -373,7 +414,15 @@ void D3D9Renderer::Copy(PixelFrame* frame)
 			UpdateI444(frame);
 		}
 	}
-	else if (frame->format == PIXEL_FORMAT_ARGB) {
+	else if (frame->format == PIXEL_FORMAT_YUY2 || frame->format == PIXEL_FORMAT_UYVY) {
+		if (input_texture_[PIXEL_PLANE_Y] &&
+			input_texture_[PIXEL_PLANE_U] &&
+			input_texture_[PIXEL_PLANE_V]) {
+			UpdatePacked422(frame);
+		}
+	}
+	else if (frame->format == PIXEL_FORMAT_ARGB || frame->format == PIXEL_FORMAT_RGBA ||
+		frame->format == PIXEL_FORMAT_RGB24) {
 		if (input_texture_[PIXEL_PLANE_ARGB]) {
 			UpdateARGB(frame);
 		}		
@@ -430,27 +479,42 @@ void D3D9Renderer::End()
 
 void D3D9Renderer::UpdateARGB(PixelFrame* frame)
 {
-	HRESULT hr = S_OK;
-	D3DLOCKED_RECT rect;
-
 	IDirect3DTexture9* texture = input_texture_[PIXEL_PLANE_ARGB]->GetTexture();
-	if (texture) {
+	if (!texture) {
+		return;
+	}
+
+	if (frame->format == PIXEL_FORMAT_ARGB) {
+		UpdatePlane(texture, frame->plane[0], frame->pitch[0], 4, 0, 0);
+	}
+	else {
+		// RGBA and RGB24 are converted to BGRA while they are written to the texture.
+		D3DLOCKED_RECT rect;
 		HRESULT hr = texture->LockRect(0, &rect, 0, 0);
-		if (SUCCEEDED(hr)) {
-			int src_pitch = frame->pitch[0];
-			int dst_pitch = rect.Pitch;
-			int pitch = (src_pitch <= dst_pitch) ? src_pitch : dst_pitch;
-			uint8_t* src_data = frame->plane[0];
-			uint8_t* dst_data = (uint8_t*)rect.pBits;
-			for (int i = 0; i < frame->height; i++) {
-				memcpy(dst_data, src_data, pitch);
-				dst_data += dst_pitch;
-				src_data += src_pitch;
+		if (FAILED(hr)) {
+			LOG("IDirect3DTexture9::LockRect() failed, %x", hr);
+			return;
+		}
+
+		for (auto& dirty_rect : dirty_rects_) {
+			uint8_t* dst_data = (uint8_t*)rect.pBits + dirty_rect.top * rect.Pitch + dirty_rect.left * 4;
+			int width = dirty_rect.right - dirty_rect.left;
+			int height = dirty_rect.bottom - dirty_rect.top;
+
+			if (frame->format == PIXEL_FORMAT_RGBA) {
+				RGBAToBGRA(frame->plane[0] + dirty_rect.top * frame->pitch[0] + dirty_rect.left * 4, frame->pitch[0],
+					dst_data, rect.Pitch, width, height);
+			}
+			else {
+				RGB24ToBGRA(frame->plane[0] + dirty_rect.top * frame->pitch[0] + dirty_rect.left * 3, frame->pitch[0],
+					dst_data, rect.Pitch, width, height);
 			}
 		}
+
 		texture->UnlockRect(0);
-		output_texture_ = input_texture_[PIXEL_PLANE_ARGB].get();
 	}
+
+	output_texture_ = input_texture_[PIXEL_PLANE_ARGB].get();
 }
 
 void D3D9Renderer::UpdateI444(PixelFrame* frame)
@@ -459,140 +523,202 @@ void D3D9Renderer::UpdateI444(PixelFrame* frame)
 	IDirect3DTexture9* u_texture = input_texture_[PIXEL_PLANE_U]->GetTexture();
 	IDirect3DTexture9* v_texture = input_texture_[PIXEL_PLANE_V]->GetTexture();
 
-	D3DLOCKED_RECT rect;
-	HRESULT hr = S_OK;
+	UpdatePlane(y_texture, frame->plane[0], frame->pitch[0], 1, 0, 0);
+	UpdatePlane(u_texture, frame->plane[1], frame->pitch[1], 1, 0, 0);
+	UpdatePlane(v_texture, frame->plane[2], frame->pitch[2], 1, 0, 0);
 
-	if (y_texture) {
-		hr = y_texture->LockRect(0, &rect, 0, 0);
-		if (SUCCEEDED(hr)) {
-			int src_pitch = frame->pitch[0];
-			int dst_pitch = rect.Pitch;
-			int pitch = (src_pitch <= dst_pitch) ? src_pitch : dst_pitch;
-			uint8_t* src_data = frame->plane[0];
-			uint8_t* dst_data = (uint8_t*)rect.pBits;
-			for (int i = 0; i < frame->height; i++) {
-				memcpy(dst_data, src_data, pitch);
-				dst_data += dst_pitch;
-				src_data += src_pitch;
-			}
-			y_texture->UnlockRect(0);
-		}
-	}
+	DrawYUV(y_texture, u_texture, v_texture);
+}
 
-	if (u_texture) {
-		hr = u_texture->LockRect(0, &rect, 0, 0);
-		if (SUCCEEDED(hr)) {
-			int src_pitch = frame->pitch[1];
-			int dst_pitch = rect.Pitch;
-			int pitch = (src_pitch <= dst_pitch) ? src_pitch : dst_pitch;
-			uint8_t* src_data = frame->plane[1];
-			uint8_t* dst_data = (uint8_t*)rect.pBits;
-			for (int i = 0; i < frame->height; i++) {
-				memcpy(dst_data, src_data, pitch);
-				dst_data += dst_pitch;
-				src_data += src_pitch;
-			}
-			u_texture->UnlockRect(0);
-		}
-	}
+void D3D9Renderer::UpdateI420(PixelFrame* frame)
+{
+	IDirect3DTexture9* y_texture = input_texture_[PIXEL_PLANE_Y]->GetTexture();
+	IDirect3DTexture9* u_texture = input_texture_[PIXEL_PLANE_U]->GetTexture();
+	IDirect3DTexture9* v_texture = input_texture_[PIXEL_PLANE_V]->GetTexture();
+
+	// I422 only differs by the full height chroma planes.
+	bool is_10bit = frame->format == PIXEL_FORMAT_I010;
+	int bytes_per_pixel = is_10bit ? 2 : 1;
+	int y_shift = frame->format == PIXEL_FORMAT_I422 ? 0 : 1;
+	UpdatePlane(y_texture, frame->plane[0], frame->pitch[0], bytes_per_pixel, 0, 0, is_10bit);
+	UpdatePlane(u_texture, frame->plane[1], frame->pitch[1], bytes_per_pixel, 1, y_shift, is_10bit);
+	UpdatePlane(v_texture, frame->plane[2], frame->pitch[2], bytes_per_pixel, 1, y_shift, is_10bit);
+
+	DrawYUV(y_texture, u_texture, v_texture);
+}
+
+void D3D9Renderer::UpdateNV12(PixelFrame* frame)
+{
+	IDirect3DSurface9* surface = input_texture_[PIXEL_PLANE_NV12]->GetSurface();
+	D3DLOCKED_RECT rect;
 
-	if (v_texture) {
-		hr = v_texture->LockRect(0, &rect, 0, 0);
+	if (surface) {
+		HRESULT hr = surface->LockRect(&rect, NULL, 0);
 		if (SUCCEEDED(hr)) {
-			int src_pitch = frame->pitch[2];
-			int dst_pitch = rect.Pitch;
-			int pitch = (src_pitch <= dst_pitch) ? src_pitch : dst_pitch;
-			uint8_t* src_data = frame->plane[2];
-			uint8_t* dst_data = (uint8_t*)rect.pBits;
-			for (int i = 0; i < frame->height; i++) {
-				memcpy(dst_data, src_data, pitch);
-				dst_data += dst_pitch;
-				src_data += src_pitch;
+			uint8_t* y_data = (uint8_t*)rect.pBits;
+			uint8_t* uv_data = y_data + rect.Pitch * frame->height;
+
+			// Rects are aligned to even coordinates, see GetDirtyRects().
+			for (auto& dirty_rect : dirty_rects_) {
+				int width = dirty_rect.right - dirty_rect.left;
+				int height = dirty_rect.bottom - dirty_rect.top;
+
+				CopyPlane(y_data + dirty_rect.top * rect.Pitch + dirty_rect.left, rect.Pitch,
+					frame->plane[0] + dirty_rect.top * frame->pitch[0] + dirty_rect.left, frame->pitch[0],
+					width, height);
+				CopyPlane(uv_data + dirty_rect.top / 2 * rect.Pitch + dirty_rect.left, rect.Pitch,
+					frame->plane[1] + dirty_rect.top / 2 * frame->pitch[1] + dirty_rect.left, frame->pitch[1],
+					(width + 1) / 2 * 2, height / 2);
 			}
-			v_texture->UnlockRect(0);
-		}
-	}
+			surface->UnlockRect();
+		}	
 
-	D3D9RenderTexture* render_target = render_target_[PIXEL_SHADER_YUV_BT601].get();
-	if (render_target) {
-		render_target->Begin();		
-		render_target->SetTexture(0, y_texture);
-		render_target->SetTexture(1, u_texture);
-		render_target->SetTexture(2, v_texture);
-		render_target->Draw();
-		render_target->End();
-		render_target->SetTexture(0, NULL);
-		render_target->SetTexture(1, NULL);
-		render_target->SetTexture(2, NULL);
-		output_texture_ = render_target;
+		// NV12 To ARGB
+		output_texture_ = input_texture_[PIXEL_PLANE_ARGB].get();
+		d3d9_device_->StretchRect(surface, NULL, output_texture_->GetSurface(), NULL, D3DTEXF_LINEAR);
 	}
 }
 
-void D3D9Renderer::UpdateI420(PixelFrame* frame)
+void D3D9Renderer::UpdateP010(PixelFrame* frame)
 {
 	IDirect3DTexture9* y_texture = input_texture_[PIXEL_PLANE_Y]->GetTexture();
 	IDirect3DTexture9* u_texture = input_texture_[PIXEL_PLANE_U]->GetTexture();
 	IDirect3DTexture9* v_texture = input_texture_[PIXEL_PLANE_V]->GetTexture();
+	if (!y_texture || !u_texture || !v_texture) {
+		return;
+	}
 
-	D3DLOCKED_RECT rect;
-	HRESULT hr = S_OK;
-	int half_width = (frame->width + 1) / 2;
-	int half_height = (frame->height + 1) / 2;
+	// The samples are MSB aligned, Y copies as is into L16.
+	UpdatePlane(y_texture, frame->plane[0], frame->pitch[0], 2, 0, 0);
 
-	if (y_texture) {
-		hr = y_texture->LockRect(0, &rect, 0, 0);
-		if (SUCCEEDED(hr)) {
-			int src_pitch = frame->pitch[0];
-			int dst_pitch = rect.Pitch;
-			int pitch = (src_pitch <= dst_pitch) ? src_pitch : dst_pitch;
-			uint8_t* src_data = frame->plane[0];
-			uint8_t* dst_data = (uint8_t*)rect.pBits;
-			for (int i = 0; i < frame->height; i++) {
-				memcpy(dst_data, src_data, pitch);
-				dst_data += dst_pitch;
-				src_data += src_pitch;
-			}
-			y_texture->UnlockRect(0);
-		}
+	D3DLOCKED_RECT u_rect, v_rect;
+	HRESULT hr = u_texture->LockRect(0, &u_rect, 0, 0);
+	if (FAILED(hr)) {
+		LOG("IDirect3DTexture9::LockRect() failed, %x", hr);
+		return;
 	}
 
-	if (u_texture) {
-		hr = u_texture->LockRect(0, &rect, 0, 0);
-		if (SUCCEEDED(hr)) {
-			int src_pitch = frame->pitch[1];
-			int dst_pitch = rect.Pitch;
-			int pitch = (src_pitch <= dst_pitch) ? src_pitch : dst_pitch;
-			uint8_t* src_data = frame->plane[1];
-			uint8_t* dst_data = (uint8_t*)rect.pBits;
-			for (int i = 0; i < half_height; i++) {
-				memcpy(dst_data, src_data, pitch);
-				dst_data += dst_pitch;
-				src_data += src_pitch;
+	hr = v_texture->LockRect(0, &v_rect, 0, 0);
+	if (FAILED(hr)) {
+		LOG("IDirect3DTexture9::LockRect() failed, %x", hr);
+		u_texture->UnlockRect(0);
+		return;
+	}
+
+	// Rects are aligned to even coordinates, see GetDirtyRects().
+	for (auto& dirty_rect : dirty_rects_) {
+		int left = dirty_rect.left / 2;
+		int top = dirty_rect.top / 2;
+		int width = (dirty_rect.right + 1) / 2 - left;
+		int height = (dirty_rect.bottom + 1) / 2 - top;
+
+		SplitUVPlane16((uint8_t*)u_rect.pBits + top * u_rect.Pitch + left * 2, u_rect.Pitch,
+			(uint8_t*)v_rect.pBits + top * v_rect.Pitch + left * 2, v_rect.Pitch,
+			frame->plane[1] + top * frame->pitch[1] + left * 4, frame->pitch[1], width, height);
+	}
+
+	v_texture->UnlockRect(0);
+	u_texture->UnlockRect(0);
+
+	DrawYUV(y_texture, u_texture, v_texture);
+}
+
+void D3D9Renderer::UpdatePacked422(PixelFrame* frame)
+{
+	IDirect3DTexture9* textures[3] = {
+		input_texture_[PIXEL_PLANE_Y]->GetTexture(),
+		input_texture_[PIXEL_PLANE_U]->GetTexture(),
+		input_texture_[PIXEL_PLANE_V]->GetTexture()
+	};
+	D3DLOCKED_RECT rects[3];
+
+	int num_locked = 0;
+	while (num_locked < 3 && textures[num_locked] &&
+		SUCCEEDED(textures[num_locked]->LockRect(0, &rects[num_locked], 0, 0))) {
+		num_locked++;
+	}
+
+	if (num_locked == 3) {
+		// Split into I422 planes while copying, rects are aligned to even coordinates.
+		for (auto& dirty_rect : dirty_rects_) {
+			const uint8_t* src_data = frame->plane[0] + dirty_rect.top * frame->pitch[0] + dirty_rect.left * 2;
+			uint8_t* y_data = (uint8_t*)rects[0].pBits + dirty_rect.top * rects[0].Pitch + dirty_rect.left;
+			uint8_t* u_data = (uint8_t*)rects[1].pBits + dirty_rect.top * rects[1].Pitch + dirty_rect.left / 2;
+			uint8_t* v_data = (uint8_t*)rects[2].pBits + dirty_rect.top * rects[2].Pitch + dirty_rect.left / 2;
+			int width = dirty_rect.right - dirty_rect.left;
+			int height = dirty_rect.bottom - dirty_rect.top;
+
+			if (frame->format == PIXEL_FORMAT_YUY2) {
+				YUY2ToI422(src_data, frame->pitch[0], y_data, rects[0].Pitch,
+					u_data, rects[1].Pitch, v_data, rects[2].Pitch, width, height);
+			}
+			else {
+				UYVYToI422(src_data, frame->pitch[0], y_data, rects[0].Pitch,
+					u_data, rects[1].Pitch, v_data, rects[2].Pitch, width, height);
 			}
-			u_texture->UnlockRect(0);
 		}
 	}
+	else {
+		LOG("IDirect3DTexture9::LockRect() failed");
+	}
 
-	if (v_texture) {
-		hr = v_texture->LockRect(0, &rect, 0, 0);
-		if (SUCCEEDED(hr)) {
-			int src_pitch = frame->pitch[2];
-			int dst_pitch = rect.Pitch;
-			int pitch = (src_pitch <= dst_pitch) ? src_pitch : dst_pitch;
-			uint8_t* src_data = frame->plane[2];
-			uint8_t* dst_data = (uint8_t*)rect.pBits;
-			for (int i = 0; i < half_height; i++) {
-				memcpy(dst_data, src_data, pitch);
-				dst_data += dst_pitch;
-				src_data += src_pitch;
-			}
-			v_texture->UnlockRect(0);
+	for (int i = 0; i < num_locked; i++) {
+		textures[i]->UnlockRect(0);
+	}
+
+	if (num_locked == 3) {
+		DrawYUV(textures[0], textures[1], textures[2]);
+	}
+}
+
+void D3D9Renderer::UpdatePlane(IDirect3DTexture9* texture, uint8_t* src_data, int src_pitch, int bytes_per_pixel,
+	int x_shift, int y_shift, bool is_10bit)
+{
+	if (!texture) {
+		return;
+	}
+
+	// Without D3DLOCK_DISCARD the texture keeps the last frame.
+	D3DLOCKED_RECT rect;
+	HRESULT hr = texture->LockRect(0, &rect, 0, 0);
+	if (FAILED(hr)) {
+		LOG("IDirect3DTexture9::LockRect() failed, %x", hr);
+		return;
+	}
+
+	for (auto& dirty_rect : dirty_rects_) {
+		int left = dirty_rect.left >> x_shift;
+		int top = dirty_rect.top >> y_shift;
+		int right = (dirty_rect.right + (1 << x_shift) - 1) >> x_shift;
+		int bottom = (dirty_rect.bottom + (1 << y_shift) - 1) >> y_shift;
+
+		if (is_10bit) {
+			CopyPlane10To16((uint8_t*)rect.pBits + top * rect.Pitch + left * bytes_per_pixel, rect.Pitch,
+				src_data + top * src_pitch + left * bytes_per_pixel, src_pitch,
+				right - left, bottom - top);
+		}
+		else {
+			CopyPlane((uint8_t*)rect.pBits + top * rect.Pitch + left * bytes_per_pixel, rect.Pitch,
+				src_data + top * src_pitch + left * bytes_per_pixel, src_pitch,
+				(right - left) * bytes_per_pixel, bottom - top);
 		}
 	}
 
-	D3D9RenderTexture* render_target = render_target_[PIXEL_SHADER_YUV_BT601].get();
+	texture->UnlockRect(0);
+}
+
+void D3D9Renderer::DrawYUV(IDirect3DTexture9* y_texture, IDirect3DTexture9* u_texture, IDirect3DTexture9* v_texture)
+{
+	ColorMatrix matrix = (color_matrix_ >= 0 && color_matrix_ < COLOR_MATRIX_MAX) ? color_matrix_ : COLOR_MATRIX_BT601;
+	ColorRange range = (color_range_ >= 0 && color_range_ < COLOR_RANGE_MAX) ? color_range_ : COLOR_RANGE_LIMITED;
+
+	// c0-c3, offset and the R, G, B rows.
+	YUVShaderConstants constants = GetYUVShaderConstants(matrix, range);
+
+	D3D9RenderTexture* render_target = render_target_[PIXEL_SHADER_YUV].get();
 	if (render_target) {
 		render_target->Begin();
+		render_target->SetConstant(0, reinterpret_cast<const float*>(&constants), 4);
 		render_target->SetTexture(0, y_texture);
 		render_target->SetTexture(1, u_texture);
 		render_target->SetTexture(2, v_texture);
@@ -604,42 +730,3 @@ void D3D9Renderer::UpdateI420(PixelFrame* frame)
 		output_texture_ = render_target;
 	}
 }
-
-void D3D9Renderer::UpdateNV12(PixelFrame* frame)
-{
-	IDirect3DSurface9* surface = input_texture_[PIXEL_PLANE_NV12]->GetSurface();
-	D3DLOCKED_RECT rect;
-
-	if (surface) {
-		HRESULT hr = surface->LockRect(&rect, NULL, 0);
-		if (SUCCEEDED(hr)) {
-			uint8_t* src_data = (uint8_t*)frame->plane[0];
-			uint8_t* dst_data = (uint8_t*)rect.pBits;
-			int src_pitch = frame->pitch[0];
-			int dst_pitch = rect.Pitch;
-			int pitch = (src_pitch <= dst_pitch) ? src_pitch : dst_pitch;
-
-			for (int i = 0; i < frame->height; i++) {
-				memcpy(dst_data, src_data, pitch);
-				src_data += src_pitch;
-				dst_data += dst_pitch;
-			}
-			
-			src_data = (uint8_t*)frame->plane[1];
-			src_pitch = frame->pitch[1];
-			pitch = (src_pitch <= dst_pitch) ? src_pitch : dst_pitch;
-			int half_height = frame->height / 2;
-
-			for (int i = 0; i < half_height; i++) {
-				memcpy(dst_data, src_data, pitch);
-				src_data += src_pitch;
-				dst_data += dst_pitch;
-			}
-			surface->UnlockRect();
-		}	
-
-		// NV12 To ARGB
-		output_texture_ = input_texture_[PIXEL_PLANE_ARGB].get();
-		d3d9_device_->StretchRect(surface, NULL, output_texture_->GetSurface(), NULL, D3DTEXF_LINEAR);
-	}
-}
@@ -25,6 +25,8 @@ public:
 	// sharpness: 0.0 to 10.0
 	virtual void SetSharpen(float unsharp);
 
+	virtual uint64_t GetPixelsTouched();
+
 protected:
 	bool CreateDevice();
 	bool CreateRender();
@@ -39,6 +41,12 @@ protected:
 	void UpdateI444(PixelFrame* frame);
 	void UpdateI420(PixelFrame* frame);
 	void UpdateNV12(PixelFrame* frame);
+	void UpdateP010(PixelFrame* frame);
+	void UpdatePacked422(PixelFrame* frame);
+	// is_10bit: 16-bit samples with 10 bits in the LSBs, widened for L16.
+	void UpdatePlane(IDirect3DTexture9* texture, uint8_t* src_data, int src_pitch, int bytes_per_pixel,
+		int x_shift, int y_shift, bool is_10bit = false);
+	void DrawYUV(IDirect3DTexture9* y_texture, IDirect3DTexture9* u_texture, IDirect3DTexture9* v_texture);
 
 	std::mutex mutex_;
 
@@ -58,8 +66,15 @@ protected:
 	D3D9RenderTexture* output_texture_ = NULL;
 	std::unique_ptr<D3D9RenderTexture> input_texture_[PIXEL_PLANE_MAX];
 	std::unique_ptr<D3D9RenderTexture> render_target_[PIXEL_SHADER_MAX];
+	ColorMatrix color_matrix_ = COLOR_MATRIX_BT601;
+	ColorRange color_range_ = COLOR_RANGE_LIMITED;
 
 	float unsharp_ = 0.0;
+
+	// Input textures hold the last frame, only dirty rects are uploaded.
+	bool has_last_frame_ = false;
+	std::vector<PixelRect> dirty_rects_;
+	uint64_t pixels_touched_ = 0;
 };
 
 }
@@ -0,0 +1,200 @@
+#include "damage_detector.h"
+#include "cpu_features.h"
+
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define DAMAGE_DETECTOR_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#ifdef CPU_FEATURES_AVX2
+#include <immintrin.h>
+#endif
+
+using namespace DX;
+
+// Each kernel compares whole 64 byte blocks and returns how many bytes it
+// checked, or -1 at the first block that differs.
+#ifdef DAMAGE_DETECTOR_SSE2
+static int CompareBlocksSSE2(const uint8_t* a, const uint8_t* b, int size)
+{
+	const __m128i zero = _mm_setzero_si128();
+
+	int i = 0;
+	for (; i + 64 <= size; i += 64) {
+		__m128i x0 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(a + i)), _mm_loadu_si128((const __m128i*)(b + i)));
+		__m128i x1 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(a + i + 16)), _mm_loadu_si128((const __m128i*)(b + i + 16)));
+		__m128i x2 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(a + i + 32)), _mm_loadu_si128((const __m128i*)(b + i + 32)));
+		__m128i x3 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(a + i + 48)), _mm_loadu_si128((const __m128i*)(b + i + 48)));
+		__m128i x = _mm_or_si128(_mm_or_si128(x0, x1), _mm_or_si128(x2, x3));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(x, zero)) != 0xffff) {
+			return -1;
+		}
+	}
+
+	return i;
+}
+#endif
+
+#ifdef CPU_FEATURES_AVX2
+CPU_AVX2_TARGET
+static int CompareBlocksAVX2(const uint8_t* a, const uint8_t* b, int size)
+{
+	int i = 0;
+	for (; i + 64 <= size; i += 64) {
+		__m256i x0 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(a + i)), _mm256_loadu_si256((const __m256i*)(b + i)));
+		__m256i x1 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(a + i + 32)), _mm256_loadu_si256((const __m256i*)(b + i + 32)));
+		__m256i x = _mm256_or_si256(x0, x1);
+		if (!_mm256_testz_si256(x, x)) {
+			return -1;
+		}
+	}
+
+	return i;
+}
+#endif
+
+static bool IsRowChanged(const uint8_t* a, const uint8_t* b, int size)
+{
+	int i = 0;
+
+#if defined(CPU_FEATURES_AVX2)
+	if (CPUHasAVX2()) {
+		i = CompareBlocksAVX2(a, b, size);
+	}
+	else
+#endif
+	{
+#if defined(DAMAGE_DETECTOR_SSE2)
+		i = CompareBlocksSSE2(a, b, size);
+#endif
+	}
+
+	return i < 0 || memcmp(a + i, b + i, size - i) != 0;
+}
+
+DamageDetector::DamageDetector(int tile_size)
+{
+	tile_size_ = tile_size < 16 ? 16 : (tile_size + 15) & ~15;
+}
+
+DamageDetector::~DamageDetector()
+{
+
+}
+
+int DamageDetector::Detect(const PixelFrame* last_frame, const PixelFrame* frame)
+{
+	damage_rects_.clear();
+
+	if (!last_frame || !frame || last_frame->width != frame->width || last_frame->height != frame->height ||
+		last_frame->format != frame->format || (frame->format != PIXEL_FORMAT_ARGB && frame->format != PIXEL_FORMAT_RGBA) ||
+		frame->width <= 0 || frame->height <= 0) {
+		return -1;
+	}
+
+	width_ = frame->width;
+	height_ = frame->height;
+	tiles_x_ = (width_ + tile_size_ - 1) / tile_size_;
+	tiles_y_ = (height_ + tile_size_ - 1) / tile_size_;
+	changed_.assign(static_cast<size_t>(tiles_x_) * tiles_y_, 0);
+
+	const int bytes_per_pixel = 4;
+	int changed_count = 0;
+
+	// Row by row through each band of tiles, skipping tiles already found changed.
+	for (int ty = 0; ty < tiles_y_; ty++) {
+		uint8_t* changed = &changed_[ty * tiles_x_];
+		int unchanged = tiles_x_;
+		int top = ty * tile_size_;
+		int bottom = top + tile_size_ < height_ ? top + tile_size_ : height_;
+
+		for (int y = top; y < bottom && unchanged > 0; y++) {
+			const uint8_t* last_row = last_frame->plane[0] + y * last_frame->pitch[0];
+			const uint8_t* row = frame->plane[0] + y * frame->pitch[0];
+
+			for (int tx = 0; tx < tiles_x_; tx++) {
+				if (changed[tx]) {
+					continue;
+				}
+
+				int left = tx * tile_size_;
+				int right = left + tile_size_ < width_ ? left + tile_size_ : width_;
+				int offset = left * bytes_per_pixel;
+				if (IsRowChanged(last_row + offset, row + offset, (right - left) * bytes_per_pixel)) {
+					changed[tx] = 1;
+					unchanged -= 1;
+				}
+			}
+		}
+
+		changed_count += tiles_x_ - unchanged;
+	}
+
+	MergeTiles();
+	return changed_count;
+}
+
+void DamageDetector::MergeTiles()
+{
+	// Runs of changed tiles in a tile row, extended downwards while the row
+	// below has a run with the same span.
+	std::vector<size_t> open_rects;
+	std::vector<size_t> next_open_rects;
+
+	for (int ty = 0; ty < tiles_y_; ty++) {
+		const uint8_t* changed = &changed_[ty * tiles_x_];
+		next_open_rects.clear();
+
+		for (int tx = 0; tx < tiles_x_; ) {
+			if (!changed[tx]) {
+				tx++;
+				continue;
+			}
+
+			int first = tx;
+			while (tx < tiles_x_ && changed[tx]) {
+				tx++;
+			}
+
+			PixelRect rect;
+			rect.left = first * tile_size_;
+			rect.top = ty * tile_size_;
+			rect.right = tx * tile_size_ < width_ ? tx * tile_size_ : width_;
+			rect.bottom = rect.top + tile_size_ < height_ ? rect.top + tile_size_ : height_;
+
+			size_t index = damage_rects_.size();
+			for (size_t open_index : open_rects) {
+				PixelRect& above = damage_rects_[open_index];
+				if (above.left == rect.left && above.right == rect.right) {
+					above.bottom = rect.bottom;
+					index = open_index;
+					break;
+				}
+			}
+
+			if (index == damage_rects_.size()) {
+				damage_rects_.push_back(rect);
+			}
+			next_open_rects.push_back(index);
+		}
+
+		open_rects.swap(next_open_rects);
+	}
+}
+
+const std::vector<PixelRect>& DamageDetector::GetDamageRects()
+{
+	return damage_rects_;
+}
+
+int DamageDetector::GetTileCount()
+{
+	return tiles_x_ * tiles_y_;
+}
+
+int DamageDetector::GetTileSize()
+{
+	return tile_size_;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "renderer.h"
+#include <cstdint>
+#include <vector>
+
+namespace DX {
+
+// Finds the tiles that differ between two consecutive frames, for sources that
+// do not report dirty rects. A tile stops being compared at its first differing
+// 64 bytes, so changed regions cost less than unchanged ones.
+// Supports ARGB and RGBA.
+class DamageDetector
+{
+public:
+	// tile_size in pixels, rounded up to a multiple of 16.
+	DamageDetector(int tile_size = 64);
+	virtual ~DamageDetector();
+
+	// Returns the number of tiles of frame that differ from last_frame, or -1 if
+	// the frames differ in size or format or the format is not supported.
+	int Detect(const PixelFrame* last_frame, const PixelFrame* frame);
+
+	// Changed tiles of the last Detect(), merged into rects and clipped to the frame.
+	const std::vector<PixelRect>& GetDamageRects();
+
+	int GetTileCount();
+	int GetTileSize();
+
+private:
+	void MergeTiles();
+
+	int tile_size_ = 64;
+	int width_ = 0;
+	int height_ = 0;
+	int tiles_x_ = 0;
+	int tiles_y_ = 0;
+
+	std::vector<uint8_t> changed_;
+	std::vector<PixelRect> damage_rects_;
+};
+
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace DX {
+
+// Single-producer/single-consumer slot that only keeps the latest item.
+// It is a triple buffer: Post() and Fetch() never block or allocate, and
+// an item replaced before it was fetched is counted as dropped.
+template<typename T>
+class FrameMailbox
+{
+public:
+	FrameMailbox() {}
+	FrameMailbox(const FrameMailbox&) = delete;
+	FrameMailbox& operator=(const FrameMailbox&) = delete;
+
+	// Producer thread.
+	void Post(T item)
+	{
+		items_[back_] = std::move(item);
+		int index = middle_.exchange(back_ | kNewItem, std::memory_order_acq_rel);
+		back_ = index & kIndexMask;
+
+		posted_count_.fetch_add(1, std::memory_order_relaxed);
+		if (index & kNewItem) {
+			dropped_count_.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		// Release what the dropped item holds right away.
+		items_[back_] = T();
+	}
+
+	// Consumer thread, returns false if nothing new was posted.
+	bool Fetch(T& item)
+	{
+		if (!(middle_.load(std::memory_order_acquire) & kNewItem)) {
+			return false;
+		}
+
+		int index = middle_.exchange(front_, std::memory_order_acq_rel);
+		front_ = index & kIndexMask;
+		item = std::move(items_[front_]);
+		items_[front_] = T();
+		return true;
+	}
+
+	bool HasItem()
+	{
+		return (middle_.load(std::memory_order_acquire) & kNewItem) != 0;
+	}
+
+	uint64_t GetPostedCount()
+	{
+		return posted_count_.load(std::memory_order_relaxed);
+	}
+
+	uint64_t GetDroppedCount()
+	{
+		return dropped_count_.load(std::memory_order_relaxed);
+	}
+
+private:
+	static const int kIndexMask = 0x3;
+	static const int kNewItem = 0x4;
+
+	T items_[3];
+	int back_ = 0;
+	int front_ = 1;
+	std::atomic<int> middle_{ 2 };
+
+	std::atomic<uint64_t> posted_count_{ 0 };
+	std::atomic<uint64_t> dropped_count_{ 0 };
+};
+
+}
@@ -0,0 +1,106 @@
+#include "frame_ring.h"
+#include "log.h"
+
+#include <atomic>
+
+using namespace DX;
+
+FrameRing::FrameRing(int capacity)
+	: frame_pool_(capacity > 0 ? capacity : 1)
+{
+	if (capacity < 1) {
+		capacity = 1;
+	}
+
+	for (int i = 0; i < capacity; i++) {
+		buffers_.emplace_back(new PixelFrame);
+	}
+}
+
+FrameRing::~FrameRing()
+{
+
+}
+
+PixelFrame* FrameRing::BeginWrite(int width, int height, PixelFormat format)
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+
+	if (write_index_ >= 0) {
+		LOG("BeginWrite() called twice without EndWrite()");
+		return NULL;
+	}
+
+	// Held only by the ring: not the latest frame, no view left and no
+	// PixelFrame copy still sharing its planes.
+	int index = -1;
+	for (int i = 0; i < static_cast<int>(buffers_.size()); i++) {
+		const std::shared_ptr<void>& storage = buffers_[i]->storage;
+		if (buffers_[i].use_count() == 1 && (!storage || storage.use_count() == 1)) {
+			index = i;
+			break;
+		}
+	}
+
+	if (index < 0) {
+		dropped_count_ += 1;
+		return NULL;
+	}
+
+	// Pairs with the release of the last view, its reads are done before we write.
+	std::atomic_thread_fence(std::memory_order_acquire);
+
+	PixelFrame* frame = buffers_[index].get();
+	if (!frame->storage || frame->width != width || frame->height != height || frame->format != format) {
+		frame->storage.reset();
+		if (!frame_pool_.Alloc(width, height, format, frame)) {
+			return NULL;
+		}
+	}
+
+	frame->dirty_rects.clear();
+	frame->is_unchanged = false;
+	frame->color_matrix = COLOR_MATRIX_BT601;
+	frame->color_range = COLOR_RANGE_LIMITED;
+	write_index_ = index;
+	return frame;
+}
+
+void FrameRing::EndWrite(bool publish)
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+
+	if (write_index_ < 0) {
+		return;
+	}
+
+	if (publish) {
+		latest_ = buffers_[write_index_];
+		sequence_ += 1;
+	}
+	write_index_ = -1;
+}
+
+std::shared_ptr<const PixelFrame> FrameRing::GetLatest()
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+	return latest_;
+}
+
+uint64_t FrameRing::GetSequence()
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+	return sequence_;
+}
+
+uint64_t FrameRing::GetDroppedCount()
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+	return dropped_count_;
+}
+
+void FrameRing::Clear()
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+	latest_.reset();
+}
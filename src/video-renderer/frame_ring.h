@@ -0,0 +1,52 @@
+#pragma once
+
+#include "renderer.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace DX {
+
+// Fixed set of pooled frame buffers between a capture thread and its consumers.
+// The producer fills a buffer in place and publishes it, consumers get the latest
+// frame as a shared read-only view. A buffer is only written again after the last
+// view of it, and every PixelFrame copied from it, went away, so a frame never
+// changes while it is held.
+// With the default three buffers one is being written, one is the latest frame
+// and one may still be held by a consumer.
+class FrameRing
+{
+public:
+	FrameRing(int capacity = 3);
+	virtual ~FrameRing();
+
+	// Producer: buffer for the next frame, NULL if every buffer is still held.
+	// Planes keep the contents of the frame last written into that buffer.
+	PixelFrame* BeginWrite(int width, int height, PixelFormat format);
+	// Publishes the frame from BeginWrite(), or gives the buffer back unpublished.
+	void EndWrite(bool publish = true);
+
+	// Latest published frame, NULL before the first one.
+	std::shared_ptr<const PixelFrame> GetLatest();
+	// Number of frames published so far.
+	uint64_t GetSequence();
+	// Frames not captured because no buffer was free.
+	uint64_t GetDroppedCount();
+
+	// Forgets the latest frame, views still held stay valid.
+	void Clear();
+
+private:
+	std::mutex mutex_;
+	std::vector<std::shared_ptr<PixelFrame>> buffers_;
+	std::shared_ptr<PixelFrame> latest_;
+	int write_index_ = -1;
+	uint64_t sequence_ = 0;
+	uint64_t dropped_count_ = 0;
+
+	PixelFramePool frame_pool_;
+};
+
+}
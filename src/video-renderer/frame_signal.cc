@@ -0,0 +1,67 @@
+#include "frame_signal.h"
+
+#include <chrono>
+
+using namespace DX;
+
+uint64_t FrameSignal::Notify(int64_t timestamp_us)
+{
+	uint64_t sequence = 0;
+	{
+		std::lock_guard<std::mutex> locker(mutex_);
+		sequence_ += 1;
+		timestamp_us_ = timestamp_us;
+		sequence = sequence_;
+	}
+
+	cond_.notify_all();
+	return sequence;
+}
+
+bool FrameSignal::Wait(uint64_t sequence, int timeout_ms)
+{
+	std::unique_lock<std::mutex> locker(mutex_);
+
+	if (sequence < reset_sequence_) {
+		sequence = reset_sequence_;
+	}
+
+	auto is_ready = [this, &sequence] {
+		return is_cancelled_ || sequence_ > sequence;
+	};
+
+	if (timeout_ms < 0) {
+		cond_.wait(locker, is_ready);
+	}
+	else {
+		cond_.wait_for(locker, std::chrono::milliseconds(timeout_ms), is_ready);
+	}
+
+	return !is_cancelled_ && sequence_ > sequence;
+}
+
+uint64_t FrameSignal::GetSequence(int64_t* timestamp_us)
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+	if (timestamp_us) {
+		*timestamp_us = timestamp_us_;
+	}
+	return sequence_;
+}
+
+void FrameSignal::Cancel()
+{
+	{
+		std::lock_guard<std::mutex> locker(mutex_);
+		is_cancelled_ = true;
+	}
+
+	cond_.notify_all();
+}
+
+void FrameSignal::Reset()
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+	is_cancelled_ = false;
+	reset_sequence_ = sequence_;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace DX {
+
+// Tells waiting threads that a producer has a new frame. Frames are numbered
+// from 1 and carry a monotonic timestamp in microseconds.
+class FrameSignal
+{
+public:
+	FrameSignal() {}
+	FrameSignal(const FrameSignal&) = delete;
+	FrameSignal& operator=(const FrameSignal&) = delete;
+
+	// Producer thread, returns the sequence number of the new frame.
+	uint64_t Notify(int64_t timestamp_us);
+
+	// Blocks until a frame newer than sequence exists, returns false on timeout
+	// or once Cancel() was called. timeout_ms < 0 waits without a limit.
+	bool Wait(uint64_t sequence, int timeout_ms);
+
+	// Latest frame, sequence 0 before the first Notify().
+	uint64_t GetSequence(int64_t* timestamp_us = NULL);
+
+	// Wakes all waiters, Wait() fails until Reset().
+	void Cancel();
+	// Wait() only returns for frames notified after this. Sequence numbers
+	// keep counting up.
+	void Reset();
+
+private:
+	std::mutex mutex_;
+	std::condition_variable cond_;
+	uint64_t sequence_ = 0;
+	int64_t timestamp_us_ = 0;
+	uint64_t reset_sequence_ = 0;
+	bool is_cancelled_ = false;
+};
+
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+
+namespace DX {
+
+// Log2 histogram of durations in microseconds, bucket i counts [2^i, 2^(i+1)).
+class LatencyHistogram
+{
+public:
+	static const int kBuckets = 32;
+
+	void Add(int64_t us)
+	{
+		int index = 0;
+		while (index < kBuckets - 1 && us >= (int64_t(2) << index)) {
+			index++;
+		}
+		buckets_[index] += 1;
+		count_ += 1;
+	}
+
+	void Reset()
+	{
+		for (int i = 0; i < kBuckets; i++) {
+			buckets_[i] = 0;
+		}
+		count_ = 0;
+	}
+
+	uint64_t GetCount() const
+	{
+		return count_;
+	}
+
+	uint64_t GetBucket(int index) const
+	{
+		return buckets_[index];
+	}
+
+	// Upper bound of the bucket holding the percentile (0-100), in milliseconds.
+	double GetPercentile(double percentile) const
+	{
+		if (count_ == 0) {
+			return 0.0;
+		}
+
+		uint64_t target = static_cast<uint64_t>(percentile / 100.0 * count_ + 0.5);
+		target = target < 1 ? 1 : (target > count_ ? count_ : target);
+
+		uint64_t count = 0;
+		for (int i = 0; i < kBuckets; i++) {
+			count += buckets_[i];
+			if (count >= target) {
+				return static_cast<double>(int64_t(2) << i) / 1000.0;
+			}
+		}
+		return static_cast<double>(int64_t(2) << (kBuckets - 1)) / 1000.0;
+	}
+
+private:
+	uint64_t buckets_[kBuckets] = { 0 };
+	uint64_t count_ = 0;
+};
+
+}
@@ -0,0 +1,186 @@
+#include "plane_copy.h"
+#include "worker_pool.h"
+
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define PLANE_COPY_SSE2 1
+#include <emmintrin.h>
+#endif
+
+using namespace DX;
+
+// Planes larger than this bypass the cache.
+static const size_t kStreamThreshold = 2 * 1024 * 1024;
+
+// Planes larger than this are split into stripes (3840x2160 Y plane is ~8MB).
+static const size_t kParallelThreshold = 8 * 1024 * 1024;
+static const int kMinStripeRows = 64;
+
+#ifdef PLANE_COPY_SSE2
+static void StreamCopy(uint8_t* dst, const uint8_t* src, size_t size)
+{
+	size_t head = (16 - (reinterpret_cast<uintptr_t>(dst) & 15)) & 15;
+	if (head > size) {
+		head = size;
+	}
+
+	memcpy(dst, src, head);
+	dst += head;
+	src += head;
+	size -= head;
+
+	for (; size >= 64; size -= 64, dst += 64, src += 64) {
+		__m128i x0 = _mm_loadu_si128((const __m128i*)(src));
+		__m128i x1 = _mm_loadu_si128((const __m128i*)(src + 16));
+		__m128i x2 = _mm_loadu_si128((const __m128i*)(src + 32));
+		__m128i x3 = _mm_loadu_si128((const __m128i*)(src + 48));
+		_mm_stream_si128((__m128i*)(dst), x0);
+		_mm_stream_si128((__m128i*)(dst + 16), x1);
+		_mm_stream_si128((__m128i*)(dst + 32), x2);
+		_mm_stream_si128((__m128i*)(dst + 48), x3);
+	}
+
+	for (; size >= 16; size -= 16, dst += 16, src += 16) {
+		_mm_stream_si128((__m128i*)(dst), _mm_loadu_si128((const __m128i*)(src)));
+	}
+
+	memcpy(dst, src, size);
+}
+#endif
+
+static void CopyRows(uint8_t* dst, int dst_pitch, const uint8_t* src, int src_pitch,
+	int row_bytes, int height, bool stream)
+{
+	if (dst_pitch == src_pitch && row_bytes <= dst_pitch) {
+		size_t size = static_cast<size_t>(dst_pitch) * (height - 1) + row_bytes;
+#ifdef PLANE_COPY_SSE2
+		if (stream) {
+			StreamCopy(dst, src, size);
+			return;
+		}
+#endif
+		memcpy(dst, src, size);
+		return;
+	}
+
+	for (int i = 0; i < height; i++) {
+#ifdef PLANE_COPY_SSE2
+		if (stream) {
+			StreamCopy(dst, src, row_bytes);
+		}
+		else
+#endif
+		{
+			memcpy(dst, src, row_bytes);
+		}
+		dst += dst_pitch;
+		src += src_pitch;
+	}
+}
+
+void DX::CopyPlane(uint8_t* dst, int dst_pitch, const uint8_t* src, int src_pitch, int row_bytes, int height)
+{
+	if (!dst || !src || row_bytes <= 0 || height <= 0) {
+		return;
+	}
+
+	size_t size = static_cast<size_t>(row_bytes) * height;
+	bool stream = size >= kStreamThreshold;
+
+	int num_stripes = 1;
+	if (size >= kParallelThreshold) {
+		WorkerPool& worker_pool = WorkerPool::Instance();
+		num_stripes = worker_pool.GetConcurrency();
+		if (num_stripes > height / kMinStripeRows) {
+			num_stripes = height / kMinStripeRows;
+		}
+
+		if (num_stripes > 1) {
+			int stripe_rows = (height + num_stripes - 1) / num_stripes;
+			worker_pool.Run(num_stripes, [=](int index) {
+				int first_row = index * stripe_rows;
+				int rows = (first_row + stripe_rows <= height) ? stripe_rows : height - first_row;
+				if (rows > 0) {
+					CopyRows(dst + static_cast<size_t>(first_row) * dst_pitch, dst_pitch,
+						src + static_cast<size_t>(first_row) * src_pitch, src_pitch, row_bytes, rows, stream);
+				}
+#ifdef PLANE_COPY_SSE2
+				if (stream) {
+					_mm_sfence();
+				}
+#endif
+			});
+			return;
+		}
+	}
+
+	CopyRows(dst, dst_pitch, src, src_pitch, row_bytes, height, stream);
+
+#ifdef PLANE_COPY_SSE2
+	if (stream) {
+		_mm_sfence();
+	}
+#endif
+}
+
+void DX::CopyPlane10To16(uint8_t* dst, int dst_pitch, const uint8_t* src, int src_pitch, int width, int height)
+{
+	if (!dst || !src || width <= 0 || height <= 0) {
+		return;
+	}
+
+	for (int i = 0; i < height; i++) {
+		uint16_t* dst_row = reinterpret_cast<uint16_t*>(dst + static_cast<size_t>(i) * dst_pitch);
+		const uint16_t* src_row = reinterpret_cast<const uint16_t*>(src + static_cast<size_t>(i) * src_pitch);
+		int x = 0;
+
+#ifdef PLANE_COPY_SSE2
+		const __m128i mask = _mm_set1_epi16(0x3ff);
+		for (; x + 8 <= width; x += 8) {
+			__m128i value = _mm_and_si128(_mm_loadu_si128((const __m128i*)(src_row + x)), mask);
+			value = _mm_or_si128(_mm_slli_epi16(value, 6), _mm_srli_epi16(value, 4));
+			_mm_storeu_si128((__m128i*)(dst_row + x), value);
+		}
+#endif
+
+		for (; x < width; x++) {
+			int value = src_row[x] & 0x3ff;
+			dst_row[x] = static_cast<uint16_t>((value << 6) | (value >> 4));
+		}
+	}
+}
+
+void DX::SplitUVPlane16(uint8_t* dst_u, int dst_pitch_u, uint8_t* dst_v, int dst_pitch_v,
+	const uint8_t* src_uv, int src_pitch_uv, int width, int height)
+{
+	if (!dst_u || !dst_v || !src_uv || width <= 0 || height <= 0) {
+		return;
+	}
+
+	for (int i = 0; i < height; i++) {
+		uint16_t* u_row = reinterpret_cast<uint16_t*>(dst_u + static_cast<size_t>(i) * dst_pitch_u);
+		uint16_t* v_row = reinterpret_cast<uint16_t*>(dst_v + static_cast<size_t>(i) * dst_pitch_v);
+		const uint16_t* uv_row = reinterpret_cast<const uint16_t*>(src_uv + static_cast<size_t>(i) * src_pitch_uv);
+		int x = 0;
+
+#ifdef PLANE_COPY_SSE2
+		for (; x + 8 <= width; x += 8) {
+			__m128i uv0 = _mm_loadu_si128((const __m128i*)(uv_row + x * 2));
+			__m128i uv1 = _mm_loadu_si128((const __m128i*)(uv_row + x * 2 + 8));
+			// Sign extend the 16-bit halves so packs_epi32 keeps them unchanged.
+			__m128i u0 = _mm_srai_epi32(_mm_slli_epi32(uv0, 16), 16);
+			__m128i u1 = _mm_srai_epi32(_mm_slli_epi32(uv1, 16), 16);
+			__m128i v0 = _mm_srai_epi32(uv0, 16);
+			__m128i v1 = _mm_srai_epi32(uv1, 16);
+			_mm_storeu_si128((__m128i*)(u_row + x), _mm_packs_epi32(u0, u1));
+			_mm_storeu_si128((__m128i*)(v_row + x), _mm_packs_epi32(v0, v1));
+		}
+#endif
+
+		for (; x < width; x++) {
+			u_row[x] = uv_row[x * 2];
+			v_row[x] = uv_row[x * 2 + 1];
+		}
+	}
+}
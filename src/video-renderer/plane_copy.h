@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+namespace DX {
+
+// Copies rows bytes of each of the height rows from src to dst.
+// - one bulk copy when both pitches match
+// - non-temporal stores for large planes, so upload buffers do not evict the cache
+// - row stripes across WorkerPool for 4K/8K planes
+void CopyPlane(uint8_t* dst, int dst_pitch, const uint8_t* src, int src_pitch, int row_bytes, int height);
+
+// Copies width 16-bit samples of each row, widening 10-bit samples held in
+// the low bits (I010) to the full 16-bit range expected by R16/L16 textures.
+void CopyPlane10To16(uint8_t* dst, int dst_pitch, const uint8_t* src, int src_pitch, int width, int height);
+
+// Splits width interleaved 16-bit UV pairs of each row into two planes.
+void SplitUVPlane16(uint8_t* dst_u, int dst_pitch_u, uint8_t* dst_v, int dst_pitch_v,
+	const uint8_t* src_uv, int src_pitch_uv, int width, int height);
+
+}
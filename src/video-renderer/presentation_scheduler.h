@@ -0,0 +1,318 @@
+#pragma once
+
+#include "latency_histogram.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+namespace DX {
+
+static const int64_t kNoPts = INT64_MIN;
+
+class Clock
+{
+public:
+	virtual ~Clock() {}
+
+	// Monotonic time in microseconds.
+	virtual int64_t GetTimeUs() = 0;
+};
+
+class SteadyClock : public Clock
+{
+public:
+	virtual int64_t GetTimeUs()
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+};
+
+// Only moves when told to, drives the scheduler without a display.
+class ManualClock : public Clock
+{
+public:
+	virtual int64_t GetTimeUs()
+	{
+		return time_.load();
+	}
+
+	void SetTime(int64_t us)
+	{
+		time_ = us;
+	}
+
+	void Advance(int64_t us)
+	{
+		time_ += us;
+	}
+
+private:
+	std::atomic<int64_t> time_{ 0 };
+};
+
+struct PresentationStats
+{
+	uint64_t queued_frames    = 0;
+	uint64_t presented_frames = 0;
+	// Superseded by a later frame that was also due, or pushed out of a full queue.
+	uint64_t dropped_frames   = 0;
+	// Frame intervals the last frame stayed on screen because the queue ran dry.
+	uint64_t repeated_frames  = 0;
+
+	// Average time from Poll() to Presented().
+	double render_cost_ms = 0.0;
+
+	// |presented interval - pts interval| of consecutive frames.
+	LatencyHistogram jitter;
+};
+
+// Paces decoded frames by pts against a monotonic clock. A decoder thread
+// pushes frames, the render thread polls for the frame due now, renders it
+// and calls Presented(). Frames are started early by the measured render
+// cost, so a frame that can no longer make its slot is dropped in favour of
+// the next one.
+template<typename T>
+class PresentationScheduler
+{
+public:
+	PresentationScheduler(Clock* clock, size_t max_queued_frames = 3)
+		: clock_(clock)
+		, max_queued_frames_(max_queued_frames < 1 ? 1 : max_queued_frames)
+	{
+
+	}
+
+	PresentationScheduler(const PresentationScheduler&) = delete;
+	PresentationScheduler& operator=(const PresentationScheduler&) = delete;
+
+	// Used for frames without pts and for counting repeats.
+	void SetFrameDuration(int64_t us)
+	{
+		std::lock_guard<std::mutex> locker(mutex_);
+		if (us > 0) {
+			frame_duration_ = us;
+		}
+	}
+
+	// Decoder thread, returns false if the queue is still full after timeout_ms.
+	bool WaitForSpace(int timeout_ms)
+	{
+		std::unique_lock<std::mutex> locker(mutex_);
+		return space_cond_.wait_for(locker, std::chrono::milliseconds(timeout_ms), [this] {
+			return queue_.size() < max_queued_frames_;
+		});
+	}
+
+	// Decoder thread, pts in microseconds or kNoPts. Pushing into a full
+	// queue drops the oldest frame.
+	void Push(T frame, int64_t pts)
+	{
+		std::lock_guard<std::mutex> locker(mutex_);
+
+		if (pts == kNoPts) {
+			pts = (last_pts_ == kNoPts) ? 0 : last_pts_ + frame_duration_ - pts_offset_;
+		}
+
+		// The stream restarted, was spliced or its clock wrapped, continue
+		// the timeline one frame after the last pts in either direction.
+		if (last_pts_ != kNoPts) {
+			int64_t jump = pts + pts_offset_ - last_pts_;
+			if (jump > kMaxPtsJump || jump < -kMaxPtsJump) {
+				pts_offset_ = last_pts_ + frame_duration_ - pts;
+			}
+		}
+		pts += pts_offset_;
+		last_pts_ = pts;
+
+		if (queue_.size() >= max_queued_frames_) {
+			queue_.pop_front();
+			stats_.dropped_frames += 1;
+		}
+
+		// Keep the queue sorted, decoders may output slightly out of order.
+		auto iter = queue_.end();
+		while (iter != queue_.begin() && (iter - 1)->pts > pts) {
+			--iter;
+		}
+		QueuedFrame queued_frame;
+		queued_frame.frame = std::move(frame);
+		queued_frame.pts = pts;
+		queue_.insert(iter, std::move(queued_frame));
+		stats_.queued_frames += 1;
+	}
+
+	// Render thread, returns the frame to present now.
+	bool Poll(T& frame)
+	{
+		std::unique_lock<std::mutex> locker(mutex_);
+
+		int64_t now = clock_->GetTimeUs();
+		int64_t lead = render_cost_;
+
+		if (queue_.empty()) {
+			if (present_target_ != kNoPts && now + lead >= present_target_ + frame_duration_ * (repeats_ + 1)) {
+				repeats_ += 1;
+				stats_.repeated_frames += 1;
+			}
+			return false;
+		}
+
+		if (base_time_ == kNoPts) {
+			base_time_ = now + lead;
+			base_pts_ = queue_.front().pts;
+		}
+
+		size_t dropped = 0;
+		while (queue_.size() > 1 && GetTargetTime(queue_[1].pts) <= now + lead) {
+			queue_.pop_front();
+			dropped += 1;
+		}
+		stats_.dropped_frames += dropped;
+
+		int64_t target = GetTargetTime(queue_.front().pts);
+		if (target > now + lead) {
+			if (dropped > 0) {
+				locker.unlock();
+				space_cond_.notify_one();
+			}
+			return false;
+		}
+
+		// Far behind after a stall or underrun, restart the timeline here
+		// instead of rushing through the following frames.
+		if (now + lead - target > frame_duration_ * 2) {
+			base_time_ += now + lead - target;
+			target = now + lead;
+		}
+
+		frame = std::move(queue_.front().frame);
+		pending_pts_ = queue_.front().pts;
+		pending_target_ = target;
+		poll_time_ = now;
+		queue_.pop_front();
+
+		locker.unlock();
+		space_cond_.notify_one();
+		return true;
+	}
+
+	// Render thread, after the frame returned by Poll() was rendered.
+	void Presented()
+	{
+		std::lock_guard<std::mutex> locker(mutex_);
+
+		if (poll_time_ == kNoPts) {
+			return;
+		}
+
+		int64_t now = clock_->GetTimeUs();
+		int64_t cost = now - poll_time_;
+		render_cost_ += (cost - render_cost_) / 8;
+
+		if (present_time_ != kNoPts) {
+			int64_t interval = now - present_time_;
+			int64_t expected = pending_pts_ - present_pts_;
+			int64_t jitter = interval - expected;
+			stats_.jitter.Add(jitter < 0 ? -jitter : jitter);
+		}
+
+		present_time_ = now;
+		present_pts_ = pending_pts_;
+		present_target_ = pending_target_;
+		poll_time_ = kNoPts;
+		repeats_ = 0;
+		stats_.presented_frames += 1;
+	}
+
+	// Microseconds until the next frame should be polled, -1 when the queue is empty.
+	int64_t GetWaitTime()
+	{
+		std::lock_guard<std::mutex> locker(mutex_);
+
+		if (queue_.empty()) {
+			return -1;
+		}
+		if (base_time_ == kNoPts) {
+			return 0;
+		}
+
+		int64_t wait_time = GetTargetTime(queue_.front().pts) - render_cost_ - clock_->GetTimeUs();
+		return wait_time > 0 ? wait_time : 0;
+	}
+
+	// Drops queued frames and the timeline, e.g. after a seek.
+	void Reset()
+	{
+		std::unique_lock<std::mutex> locker(mutex_);
+
+		stats_.dropped_frames += queue_.size();
+		queue_.clear();
+		base_time_ = kNoPts;
+		base_pts_ = 0;
+		pts_offset_ = 0;
+		last_pts_ = kNoPts;
+		present_time_ = kNoPts;
+		present_target_ = kNoPts;
+		poll_time_ = kNoPts;
+		repeats_ = 0;
+
+		locker.unlock();
+		space_cond_.notify_one();
+	}
+
+	PresentationStats GetStats()
+	{
+		std::lock_guard<std::mutex> locker(mutex_);
+
+		PresentationStats stats = stats_;
+		stats.render_cost_ms = static_cast<double>(render_cost_) / 1000.0;
+		return stats;
+	}
+
+private:
+	static const int64_t kMaxPtsJump = 1000000;
+
+	struct QueuedFrame
+	{
+		T frame;
+		int64_t pts = 0;
+	};
+
+	int64_t GetTargetTime(int64_t pts)
+	{
+		return base_time_ + (pts - base_pts_);
+	}
+
+	std::mutex mutex_;
+	std::condition_variable space_cond_;
+
+	Clock* clock_ = NULL;
+	size_t max_queued_frames_ = 3;
+	int64_t frame_duration_ = 33333;
+
+	std::deque<QueuedFrame> queue_;
+	int64_t pts_offset_ = 0;
+	int64_t last_pts_ = kNoPts;
+
+	int64_t base_time_ = kNoPts;
+	int64_t base_pts_ = 0;
+	int64_t render_cost_ = 0;
+
+	int64_t poll_time_ = kNoPts;
+	int64_t pending_pts_ = 0;
+	int64_t pending_target_ = 0;
+
+	int64_t present_time_ = kNoPts;
+	int64_t present_pts_ = 0;
+	int64_t present_target_ = kNoPts;
+	int64_t repeats_ = 0;
+
+	PresentationStats stats_;
+};
+
+}
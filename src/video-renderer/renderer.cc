@@ -0,0 +1,325 @@
+#include "renderer.h"
+#include "log.h"
+#include "plane_copy.h"
+
+#include <cstdlib>
+
+using namespace DX;
+
+static const int kPlaneAlignment = 64;
+
+struct PixelFramePool::Buffer
+{
+	int          width  = 0;
+	int          height = 0;
+	PixelFormat  format = PIXEL_FORMAT_UNKNOW;
+	int          pitch[3]  = { 0, 0, 0 };
+	size_t       offset[3] = { 0, 0, 0 };
+	size_t       size = 0;
+	uint8_t*     data = NULL;
+};
+
+struct PixelFramePool::State
+{
+	std::mutex mutex;
+	std::vector<Buffer*> free_buffers;
+	size_t   max_free_buffers = 0;
+	uint64_t hit_count  = 0;
+	uint64_t miss_count = 0;
+
+	~State();
+};
+
+static inline int AlignPitch(int pitch)
+{
+	return (pitch + kPlaneAlignment - 1) & ~(kPlaneAlignment - 1);
+}
+
+static uint8_t* AlignedMalloc(size_t size)
+{
+#ifdef _WIN32
+	return static_cast<uint8_t*>(_aligned_malloc(size, kPlaneAlignment));
+#else
+	void* data = NULL;
+	if (posix_memalign(&data, kPlaneAlignment, size) != 0) {
+		return NULL;
+	}
+	return static_cast<uint8_t*>(data);
+#endif
+}
+
+static void AlignedFree(uint8_t* data)
+{
+#ifdef _WIN32
+	_aligned_free(data);
+#else
+	free(data);
+#endif
+}
+
+PixelFramePool::State::~State()
+{
+	// A frame released on another thread may have returned its buffer
+	// after the pool was cleared, the last reference frees it.
+	for (auto buffer : free_buffers) {
+		AlignedFree(buffer->data);
+		delete buffer;
+	}
+}
+
+bool DX::GetPlaneSize(PixelFormat format, int width, int height, int row_bytes[3], int rows[3])
+{
+	int half_width  = (width + 1) / 2;
+	int half_height = (height + 1) / 2;
+
+	for (int i = 0; i < 3; i++) {
+		row_bytes[i] = 0;
+		rows[i] = 0;
+	}
+
+	switch (format)
+	{
+	case PIXEL_FORMAT_ARGB:
+		row_bytes[0] = width * 4;
+		rows[0] = height;
+		break;
+	case PIXEL_FORMAT_I420:
+		row_bytes[0] = width;
+		row_bytes[1] = row_bytes[2] = half_width;
+		rows[0] = height;
+		rows[1] = rows[2] = half_height;
+		break;
+	case PIXEL_FORMAT_NV12:
+		row_bytes[0] = width;
+		row_bytes[1] = half_width * 2;
+		rows[0] = height;
+		rows[1] = half_height;
+		break;
+	case PIXEL_FORMAT_I444:
+		row_bytes[0] = row_bytes[1] = row_bytes[2] = width;
+		rows[0] = rows[1] = rows[2] = height;
+		break;
+	case PIXEL_FORMAT_P010:
+		row_bytes[0] = width * 2;
+		row_bytes[1] = half_width * 4;
+		rows[0] = height;
+		rows[1] = half_height;
+		break;
+	case PIXEL_FORMAT_I010:
+		row_bytes[0] = width * 2;
+		row_bytes[1] = row_bytes[2] = half_width * 2;
+		rows[0] = height;
+		rows[1] = rows[2] = half_height;
+		break;
+	case PIXEL_FORMAT_YUY2:
+	case PIXEL_FORMAT_UYVY:
+		row_bytes[0] = half_width * 4;
+		rows[0] = height;
+		break;
+	case PIXEL_FORMAT_I422:
+		row_bytes[0] = width;
+		row_bytes[1] = row_bytes[2] = half_width;
+		rows[0] = rows[1] = rows[2] = height;
+		break;
+	case PIXEL_FORMAT_RGB24:
+		row_bytes[0] = width * 3;
+		rows[0] = height;
+		break;
+	case PIXEL_FORMAT_RGBA:
+		row_bytes[0] = width * 4;
+		rows[0] = height;
+		break;
+	default:
+		return false;
+	}
+
+	return true;
+}
+
+void DX::GetDirtyRects(const PixelFrame* frame, bool whole_frame, std::vector<PixelRect>& rects)
+{
+	rects.clear();
+
+	if (!whole_frame && frame->is_unchanged) {
+		return;
+	}
+
+	if (whole_frame || frame->dirty_rects.empty()) {
+		PixelRect rect;
+		rect.right = frame->width;
+		rect.bottom = frame->height;
+		rects.push_back(rect);
+		return;
+	}
+
+	// Chroma subsampled formats keep whole chroma samples in each rect.
+	int align = (frame->format == PIXEL_FORMAT_ARGB || frame->format == PIXEL_FORMAT_I444 ||
+		frame->format == PIXEL_FORMAT_RGB24 || frame->format == PIXEL_FORMAT_RGBA) ? 1 : 2;
+
+	for (auto dirty_rect : frame->dirty_rects) {
+		PixelRect rect;
+		rect.left = dirty_rect.left < 0 ? 0 : dirty_rect.left;
+		rect.top = dirty_rect.top < 0 ? 0 : dirty_rect.top;
+		rect.right = dirty_rect.right > frame->width ? frame->width : dirty_rect.right;
+		rect.bottom = dirty_rect.bottom > frame->height ? frame->height : dirty_rect.bottom;
+
+		rect.left = rect.left / align * align;
+		rect.top = rect.top / align * align;
+		rect.right = (rect.right + align - 1) / align * align;
+		rect.bottom = (rect.bottom + align - 1) / align * align;
+		rect.right = rect.right > frame->width ? frame->width : rect.right;
+		rect.bottom = rect.bottom > frame->height ? frame->height : rect.bottom;
+
+		if (rect.left < rect.right && rect.top < rect.bottom) {
+			rects.push_back(rect);
+		}
+	}
+}
+
+PixelFramePool::PixelFramePool(size_t max_free_buffers)
+	: state_(new State)
+{
+	state_->max_free_buffers = max_free_buffers;
+}
+
+PixelFramePool::~PixelFramePool()
+{
+	// Frames still in flight keep their buffers, they are freed on release.
+	Clear();
+}
+
+bool PixelFramePool::Alloc(int width, int height, PixelFormat format, PixelFrame* frame)
+{
+	if (width <= 0 || height <= 0) {
+		LOG("Invalid frame size, %dx%d", width, height);
+		return false;
+	}
+
+	int pitch[3], rows[3];
+	if (!GetPlaneSize(format, width, height, pitch, rows)) {
+		LOG("Unsupported pixel format: %d", format);
+		return false;
+	}
+
+	for (int i = 0; i < 3; i++) {
+		pitch[i] = AlignPitch(pitch[i]);
+	}
+
+	Buffer* buffer = NULL;
+	{
+		std::lock_guard<std::mutex> locker(state_->mutex);
+
+		auto& free_buffers = state_->free_buffers;
+		for (auto iter = free_buffers.begin(); iter != free_buffers.end(); iter++) {
+			if ((*iter)->width == width && (*iter)->height == height && (*iter)->format == format) {
+				buffer = *iter;
+				free_buffers.erase(iter);
+				break;
+			}
+		}
+
+		if (buffer) {
+			state_->hit_count += 1;
+		}
+		else {
+			state_->miss_count += 1;
+		}
+	}
+
+	if (!buffer) {
+		buffer = new Buffer;
+		buffer->width = width;
+		buffer->height = height;
+		buffer->format = format;
+		for (int i = 0; i < 3; i++) {
+			buffer->pitch[i] = pitch[i];
+			buffer->offset[i] = buffer->size;
+			buffer->size += static_cast<size_t>(pitch[i]) * rows[i];
+		}
+
+		buffer->data = AlignedMalloc(buffer->size);
+		if (!buffer->data) {
+			LOG("Alloc pixel buffer failed, size:%u", static_cast<uint32_t>(buffer->size));
+			delete buffer;
+			return false;
+		}
+	}
+
+	std::weak_ptr<State> weak_state = state_;
+	std::shared_ptr<void> storage(buffer, [weak_state](Buffer* buffer) {
+		std::shared_ptr<State> state = weak_state.lock();
+		if (state) {
+			std::lock_guard<std::mutex> locker(state->mutex);
+			if (state->free_buffers.size() < state->max_free_buffers) {
+				state->free_buffers.push_back(buffer);
+				return;
+			}
+		}
+
+		AlignedFree(buffer->data);
+		delete buffer;
+	});
+
+	frame->width = width;
+	frame->height = height;
+	frame->format = format;
+	for (int i = 0; i < 3; i++) {
+		frame->pitch[i] = buffer->pitch[i];
+		frame->plane[i] = buffer->pitch[i] > 0 ? buffer->data + buffer->offset[i] : NULL;
+	}
+	// A reused frame must not carry damage or colors of its previous contents.
+	frame->color_matrix = COLOR_MATRIX_BT601;
+	frame->color_range = COLOR_RANGE_LIMITED;
+	frame->dirty_rects.clear();
+	frame->is_unchanged = false;
+	frame->storage = storage;
+	return true;
+}
+
+bool PixelFramePool::Clone(const PixelFrame* src, PixelFrame* dst)
+{
+	if (!Alloc(src->width, src->height, src->format, dst)) {
+		return false;
+	}
+
+	int row_bytes[3], rows[3];
+	GetPlaneSize(src->format, src->width, src->height, row_bytes, rows);
+
+	for (int i = 0; i < 3; i++) {
+		if (row_bytes[i] > 0) {
+			CopyPlane(dst->plane[i], dst->pitch[i], src->plane[i], src->pitch[i], row_bytes[i], rows[i]);
+		}
+	}
+
+	dst->color_matrix = src->color_matrix;
+	dst->color_range = src->color_range;
+	dst->dirty_rects = src->dirty_rects;
+	dst->is_unchanged = src->is_unchanged;
+	return true;
+}
+
+void PixelFramePool::Clear()
+{
+	std::vector<Buffer*> free_buffers;
+	{
+		std::lock_guard<std::mutex> locker(state_->mutex);
+		free_buffers.swap(state_->free_buffers);
+	}
+
+	for (auto buffer : free_buffers) {
+		AlignedFree(buffer->data);
+		delete buffer;
+	}
+}
+
+uint64_t PixelFramePool::GetHitCount()
+{
+	std::lock_guard<std::mutex> locker(state_->mutex);
+	return state_->hit_count;
+}
+
+uint64_t PixelFramePool::GetMissCount()
+{
+	std::lock_guard<std::mutex> locker(state_->mutex);
+	return state_->miss_count;
+}
@@ -1,7 +1,16 @@
 #pragma once
 
+#ifdef _WIN32
 #include <Windows.h>
+#else
+typedef void* HWND;
+#endif
+
+#include "color_matrix.h"
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace DX {
 
@@ -12,6 +21,13 @@ enum PixelFormat
 	PIXEL_FORMAT_I420,
 	PIXEL_FORMAT_NV12,
 	PIXEL_FORMAT_I444,
+	PIXEL_FORMAT_P010,  // NV12 layout, 16-bit samples with 10 bits in the MSBs
+	PIXEL_FORMAT_I010,  // I420 layout, 16-bit samples with 10 bits in the LSBs
+	PIXEL_FORMAT_YUY2,  // packed 4:2:2, Y0 U Y1 V
+	PIXEL_FORMAT_UYVY,  // packed 4:2:2, U Y0 V Y1
+	PIXEL_FORMAT_I422,  // planar 4:2:2, half width U and V
+	PIXEL_FORMAT_RGB24, // B G R in memory
+	PIXEL_FORMAT_RGBA,  // R G B A in memory
 	PIXEL_FORMAT_MAX,
 };
 
@@ -19,10 +35,8 @@ enum PixelShader
 {
 	PIXEL_SHADER_UNKNOW = 0,
 	PIXEL_SHADER_ARGB,
-	PIXEL_SHADER_YUV_BT601,
-	PIXEL_SHADER_YUV_BT709,
-	PIXEL_SHADER_NV12_BT601,
-	PIXEL_SHADER_NV12_BT709,
+	PIXEL_SHADER_YUV,   // planar YUV, the color matrix comes from YUVShaderConstants
+	PIXEL_SHADER_NV12,
 	PIXEL_SHADER_SHARPEN,
 	PIXEL_SHADER_MAX,
 };
@@ -39,6 +53,15 @@ enum PixelPlane
 	PIXEL_PLANE_MAX,
 };
 
+// Damaged area in luma pixels, right and bottom are exclusive.
+struct PixelRect
+{
+	int left   = 0;
+	int top    = 0;
+	int right  = 0;
+	int bottom = 0;
+};
+
 struct PixelFrame
 {
 	int          width  = 0;
@@ -46,6 +69,52 @@ struct PixelFrame
 	int          pitch[3] = { 0, 0, 0 };
 	uint8_t*     plane[3] = { NULL, NULL, NULL };
 	PixelFormat  format = PIXEL_FORMAT_UNKNOW;
+
+	// YUV to RGB matrix and range, ignored for RGB formats.
+	ColorMatrix  color_matrix = COLOR_MATRIX_BT601;
+	ColorRange   color_range  = COLOR_RANGE_LIMITED;
+
+	// Regions that changed since the previous frame, empty means the whole frame.
+	std::vector<PixelRect> dirty_rects;
+	// Same pixels as the previous frame, dirty_rects is ignored.
+	bool         is_unchanged = false;
+
+	// Owner of the plane memory, set by PixelFramePool. Copies of the frame
+	// share it and the buffer is recycled when the last copy goes away.
+	std::shared_ptr<void> storage;
+};
+
+// Bytes per row and number of rows of each plane, 0 for unused planes.
+bool GetPlaneSize(PixelFormat format, int width, int height, int row_bytes[3], int rows[3]);
+
+// Clips frame->dirty_rects to the frame and aligns them to the chroma grid.
+// Yields one rect covering the whole frame if the frame has no dirty rects
+// or whole_frame is set (nothing kept from the previous frame), and no rects
+// if the frame is unchanged.
+void GetDirtyRects(const PixelFrame* frame, bool whole_frame, std::vector<PixelRect>& rects);
+
+// Recycles aligned plane buffers keyed by (width, height, format).
+class PixelFramePool
+{
+public:
+	PixelFramePool(size_t max_free_buffers = 4);
+	virtual ~PixelFramePool();
+
+	// Fills frame with new planes, BT.601 limited range and no damage info.
+	bool Alloc(int width, int height, PixelFormat format, PixelFrame* frame);
+
+	// Copies src into a pooled buffer, for frames that must outlive the caller's planes.
+	bool Clone(const PixelFrame* src, PixelFrame* dst);
+	void Clear();
+
+	uint64_t GetHitCount();
+	uint64_t GetMissCount();
+
+private:
+	struct Buffer;
+	struct State;
+
+	std::shared_ptr<State> state_;
 };
 
 class Renderer
@@ -63,6 +132,12 @@ public:
 
 	virtual void SetSharpen(float unsharp) {}
 
+	// Pixels uploaded and converted by the last Render().
+	virtual uint64_t GetPixelsTouched() { return 0; }
+
+	// Bytes of textures and buffers held by the renderer, swap chain excluded.
+	virtual uint64_t GetBytesHeld() { return 0; }
+
 };
 
 }
@@ -0,0 +1,60 @@
+Texture2D<float4> RGBTexture : register(t0);
+
+cbuffer Tiles : register(b0)
+{
+    uint tile_size;
+    uint width;
+    uint height;
+    int  threshold;
+    uint min_blocks;
+};
+
+struct PixelShaderInput
+{
+    float4 pos   : SV_POSITION;
+    float2 uv    : TEXCOORD0;
+    float4 color : COLOR0;
+};
+
+// B-G and R-G of a pixel in 8-bit steps.
+int2 ChromaDiff(uint x, uint y)
+{
+    int3 rgb = int3(RGBTexture.Load(int3(x, y, 0)).rgb * 255.0 + 0.5);
+    return int2(rgb.b - rgb.g, rgb.r - rgb.g);
+}
+
+// One output pixel per tile, 1 where at least min_blocks 2x2 blocks have a B-G
+// or R-G spread above threshold, as DX::ClassifyChromaDetail() does on the CPU.
+float main(PixelShaderInput input) : SV_TARGET
+{
+    uint2 start = uint2(input.pos.xy) * tile_size;
+    uint2 end = min(start + tile_size, uint2(width, height));
+    uint count = 0;
+
+    [loop]
+    for (uint y = start.y; y < end.y; y += 2)
+    {
+        uint y1 = min(y + 1, end.y - 1);
+
+        [loop]
+        for (uint x = start.x; x < end.x; x += 2)
+        {
+            uint x1 = min(x + 1, end.x - 1);
+            int2 d0 = ChromaDiff(x, y);
+            int2 d1 = ChromaDiff(x1, y);
+            int2 d2 = ChromaDiff(x, y1);
+            int2 d3 = ChromaDiff(x1, y1);
+            int2 spread = max(max(d0, d1), max(d2, d3)) - min(min(d0, d1), min(d2, d3));
+            if (spread.x > threshold || spread.y > threshold)
+            {
+                count++;
+                if (count >= min_blocks)
+                {
+                    return 1.0;
+                }
+            }
+        }
+    }
+
+    return 0.0;
+}
@@ -3,6 +3,15 @@
 Texture2D YTexture : register(t0);
 Texture2D UVTexture : register(t1);
 
+// YUVShaderConstants from color_matrix.h, b0 is left to the other passes.
+cbuffer ColorMatrix : register(b1)
+{
+    float4 Offset;
+    float4 Rcoeff;
+    float4 Gcoeff;
+    float4 Bcoeff;
+};
+
 SamplerState LinearSampler : register(s0);
 SamplerState PointSampler  : register(s1);
 
@@ -15,21 +24,16 @@ struct PixelShaderInput
 
 float4 main(PixelShaderInput input) : SV_TARGET
 {
-    const float3 offset = {-0.0627451017, -0.501960814, -0.501960814};
-    const float3 Rcoeff = {1.1644,  0.0000,  1.5960};
-    const float3 Gcoeff = {1.1644, -0.3918, -0.8130};
-    const float3 Bcoeff = {1.1644,  2.0172,  0.0000};
-
     float4 Output;
 
     float3 yuv;
     yuv.x = YTexture.Sample(LinearSampler, input.tex).r;
     yuv.yz = UVTexture.Sample(LinearSampler, input.tex).rg;
-    yuv += offset;
+    yuv += Offset.xyz;
 
-    Output.r = dot(yuv, Rcoeff);
-    Output.g = dot(yuv, Gcoeff);
-    Output.b = dot(yuv, Bcoeff);
+    Output.r = dot(yuv, Rcoeff.xyz);
+    Output.g = dot(yuv, Gcoeff.xyz);
+    Output.b = dot(yuv, Bcoeff.xyz);
     Output.a = 1.0f;
 
     return Output;
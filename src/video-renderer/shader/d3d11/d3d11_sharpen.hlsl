@@ -19,21 +19,28 @@ struct PixelShaderInput
     float4 color : COLOR0;
 };
 
+// The taps fall between texels and are linearly interpolated, as in mpv.
+// The samplers wrap, so the coordinates are clamped to the edge texels.
+float4 SampleClamped(float2 uv, float2 ps)
+{
+    return Texture.Sample(LinearSampler, clamp(uv, ps * 0.5, 1.0 - ps * 0.5));
+}
+
 // unsharp :0.0 to 10.0
 float4 main(PixelShaderInput input) : SV_Target
 {
     float2 ps = float2(1.0 / width, 1.0 / height);
     float2 st1 = ps * 1.2;
     float4 p = Texture.Sample(PointSampler, input.uv);
-    float4 sum1 = Texture.Sample(PointSampler, input.uv + st1 * float2(+1, +1))
-                + Texture.Sample(PointSampler, input.uv + st1 * float2(+1, -1))
-                + Texture.Sample(PointSampler, input.uv + st1 * float2(-1, +1))
-                + Texture.Sample(PointSampler, input.uv + st1 * float2(-1, -1));
+    float4 sum1 = SampleClamped(input.uv + st1 * float2(+1, +1), ps)
+                + SampleClamped(input.uv + st1 * float2(+1, -1), ps)
+                + SampleClamped(input.uv + st1 * float2(-1, +1), ps)
+                + SampleClamped(input.uv + st1 * float2(-1, -1), ps);
     float2 st2 = ps * 1.5;
-    float4 sum2 = Texture.Sample(PointSampler, input.uv + st2 * float2(+1,  0))
-                + Texture.Sample(PointSampler, input.uv + st2 * float2(0, +1))
-                + Texture.Sample(PointSampler, input.uv + st2 * float2(-1,  0))
-                + Texture.Sample(PointSampler, input.uv + st2 * float2(0, -1));
+    float4 sum2 = SampleClamped(input.uv + st2 * float2(+1,  0), ps)
+                + SampleClamped(input.uv + st2 * float2(0, +1), ps)
+                + SampleClamped(input.uv + st2 * float2(-1,  0), ps)
+                + SampleClamped(input.uv + st2 * float2(0, -1), ps);
     float4 t = p * 0.859375 + sum2 * -0.1171875 + sum1 * -0.09765625;
     return float4(p + t * unsharp);
 }
@@ -0,0 +1,59 @@
+Texture2D<float>  YTexture      : register(t0);
+Texture2D<float2> UVTexture     : register(t1);
+Texture2D<float>  LastYTexture  : register(t2);
+Texture2D<float2> LastUVTexture : register(t3);
+
+cbuffer Tiles : register(b0)
+{
+    uint tile_size;
+    uint width;
+    uint height;
+    int  threshold;
+    uint min_blocks;
+};
+
+struct PixelShaderInput
+{
+    float4 pos   : SV_POSITION;
+    float2 uv    : TEXCOORD0;
+    float4 color : COLOR0;
+};
+
+// One output pixel per tile of an NV12 texture, 1 where any Y or UV sample
+// of the tile differs from the last texture.
+float main(PixelShaderInput input) : SV_TARGET
+{
+    uint2 start = uint2(input.pos.xy) * tile_size;
+    uint2 end = min(start + tile_size, uint2(width, height));
+
+    [loop]
+    for (uint y = start.y; y < end.y; y++)
+    {
+        [loop]
+        for (uint x = start.x; x < end.x; x++)
+        {
+            if (YTexture.Load(int3(x, y, 0)) != LastYTexture.Load(int3(x, y, 0)))
+            {
+                return 1.0;
+            }
+        }
+    }
+
+    start = start / 2;
+    end = (end + 1) / 2;
+
+    [loop]
+    for (uint v = start.y; v < end.y; v++)
+    {
+        [loop]
+        for (uint u = start.x; u < end.x; u++)
+        {
+            if (any(UVTexture.Load(int3(u, v, 0)) != LastUVTexture.Load(int3(u, v, 0))))
+            {
+                return 1.0;
+            }
+        }
+    }
+
+    return 0.0;
+}
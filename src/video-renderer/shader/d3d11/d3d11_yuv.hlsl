@@ -4,6 +4,15 @@ Texture2D YTexture : register(t0);
 Texture2D UTexture : register(t1);
 Texture2D VTexture : register(t2);
 
+// YUVShaderConstants from color_matrix.h, b0 is left to the other passes.
+cbuffer ColorMatrix : register(b1)
+{
+    float4 Offset;
+    float4 Rcoeff;
+    float4 Gcoeff;
+    float4 Bcoeff;
+};
+
 SamplerState LinearSampler : register(s0);
 SamplerState PointSampler  : register(s1);
 
@@ -16,11 +25,6 @@ struct PixelShaderInput
 
 float4 main(PixelShaderInput input) : SV_TARGET
 {
-    const float3 offset = {-0.0627451017, -0.501960814, -0.501960814};
-    const float3 Rcoeff = {1.1644,  0.0000,  1.7927};
-    const float3 Gcoeff = {1.1644, -0.2132, -0.5329};
-    const float3 Bcoeff = {1.1644,  2.1124,  0.0000};
-
     float4 Output;
 
     float3 yuv;
@@ -28,10 +32,10 @@ float4 main(PixelShaderInput input) : SV_TARGET
     yuv.y = UTexture.Sample(LinearSampler, input.tex).r;
     yuv.z = VTexture.Sample(LinearSampler, input.tex).r;
 
-    yuv += offset;
-    Output.r = dot(yuv, Rcoeff);
-    Output.g = dot(yuv, Gcoeff);
-    Output.b = dot(yuv, Bcoeff);
+    yuv += Offset.xyz;
+    Output.r = dot(yuv, Rcoeff.xyz);
+    Output.g = dot(yuv, Gcoeff.xyz);
+    Output.b = dot(yuv, Bcoeff.xyz);
     Output.a = 1.0f;
 
     return Output;
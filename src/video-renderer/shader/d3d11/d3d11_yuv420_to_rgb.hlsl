@@ -0,0 +1,50 @@
+Texture2D YUV420YTexture      : register(t0);
+Texture2D YUV420UVTexture     : register(t1);
+
+SamplerState LinearSampler    : register(s0);
+SamplerState PointSampler     : register(s1);
+
+cbuffer Image : register(b0)
+{
+	float width;
+	float height;
+};
+
+// YUVShaderConstants from color_matrix.h
+cbuffer ColorMatrix : register(b1)
+{
+	float4 Offset;
+	float4 Rcoeff;
+	float4 Gcoeff;
+	float4 Bcoeff;
+};
+
+struct PixelShaderInput
+{
+	float4 pos   : SV_POSITION;
+	float2 uv    : TEXCOORD0;
+	float4 color : COLOR0;
+};
+
+// The YUV420 texture alone, for tiles without Chroma420 samples.
+float4 main(PixelShaderInput input) : SV_TARGET
+{
+	float4 Output;
+	float3 yuv444;
+
+	// B1
+	yuv444.r = YUV420YTexture.Sample(PointSampler, input.uv).r;
+
+	// B2 B3 are U444(2x, 2y) V444(2x, 2y), co-sited with the top left pixel of
+	// each 2x2 block. Half a luma pixel right and down, even pixels land on a
+	// chroma texel centre and odd ones halfway between two.
+	yuv444.gb = YUV420UVTexture.Sample(LinearSampler, input.uv + 0.5 / float2(width, height)).rg;
+
+	// yuv to rgb
+	yuv444 += Offset.xyz;
+	Output.r = dot(yuv444, Rcoeff.xyz);
+	Output.g = dot(yuv444, Gcoeff.xyz);
+	Output.b = dot(yuv444, Bcoeff.xyz);
+	Output.a = 1.0f;
+	return Output;
+}
@@ -11,6 +11,15 @@ cbuffer Image : register(b0)
 	float height;
 };
 
+// YUVShaderConstants from color_matrix.h
+cbuffer ColorMatrix : register(b1)
+{
+	float4 Offset;
+	float4 Rcoeff;
+	float4 Gcoeff;
+	float4 Bcoeff;
+};
+
 struct PixelShaderInput
 {
 	float4 pos   : SV_POSITION;
@@ -22,13 +31,8 @@ float4 main(PixelShaderInput input) : SV_TARGET
 {
 	float4 Output;
 
-	const float3 offset = float3(-0.062, -0.501, -0.501);
-	const float3 Rcoeff = float3( 1.164,  0.000,  1.596);
-	const float3 Gcoeff = float3( 1.164, -0.392, -0.813);
-	const float3 Bcoeff = float3( 1.164,  2.017,  0.000);
-
 	uint2 pos = uint2(input.uv * float2(width, height));
-	float3 yuv444 = offset;
+	float3 yuv444 = Offset.xyz;
 
 	// B1
 	yuv444.r = YUV420YTexture.Sample(PointSampler, input.uv).r;
@@ -58,10 +62,10 @@ float4 main(PixelShaderInput input) : SV_TARGET
 	}
 
 	// yuv to rgb
-	yuv444 += offset;
-	Output.r = dot(yuv444, Rcoeff);
-	Output.g = dot(yuv444, Gcoeff);
-	Output.b = dot(yuv444, Bcoeff);
+	yuv444 += Offset.xyz;
+	Output.r = dot(yuv444, Rcoeff.xyz);
+	Output.g = dot(yuv444, Gcoeff.xyz);
+	Output.b = dot(yuv444, Bcoeff.xyz);
 	Output.a = 1.0f;
 	return Output;
 }
\ No newline at end of file
@@ -1,4075 +0,0 @@
-#if 0
-//
-// Generated by Microsoft (R) HLSL Shader Compiler 10.1
-//
-//
-// Buffer Definitions: 
-//
-// cbuffer Image
-// {
-//
-//   float width;                       // Offset:    0 Size:     4
-//   float height;                      // Offset:    4 Size:     4
-//
-// }
-//
-//
-// Resource Bindings:
-//
-// Name                                 Type  Format         Dim      HLSL Bind  Count
-// ------------------------------ ---------- ------- ----------- -------------- ------
-// PointSampler                      sampler      NA          NA             s0      1 
-// YUV420YTexture                    texture  float4          2d             t0      1 
-// YUV420UVTexture                   texture  float4          2d             t1      1 
-// Chroma420YTexture                 texture  float4          2d             t2      1 
-// Chroma420UVTexture                texture  float4          2d             t3      1 
-// Image                             cbuffer      NA          NA            cb0      1 
-//
-//
-//
-// Input signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// SV_POSITION              0   xyzw        0      POS   float       
-// TEXCOORD                 0   xy          1     NONE   float   xy  
-// COLOR                    0   xyzw        2     NONE   float       
-//
-//
-// Output signature:
-//
-// Name                 Index   Mask Register SysValue  Format   Used
-// -------------------- ----- ------ -------- -------- ------- ------
-// SV_TARGET                0   xyzw        0   TARGET   float   xyzw
-//
-ps_4_0
-dcl_constantbuffer CB0[1], immediateIndexed
-dcl_sampler s0, mode_default
-dcl_resource_texture2d (float,float,float,float) t0
-dcl_resource_texture2d (float,float,float,float) t1
-dcl_resource_texture2d (float,float,float,float) t2
-dcl_resource_texture2d (float,float,float,float) t3
-dcl_input_ps linear v1.xy
-dcl_output o0.xyzw
-dcl_temps 7
-//
-// Initial variable locations:
-//   v0.x <- input.pos.x; v0.y <- input.pos.y; v0.z <- input.pos.z; v0.w <- input.pos.w; 
-//   v1.x <- input.uv.x; v1.y <- input.uv.y; 
-//   v2.x <- input.color.x; v2.y <- input.color.y; v2.z <- input.color.z; v2.w <- input.color.w; 
-//   o0.x <- <main return value>.x; o0.y <- <main return value>.y; o0.z <- <main return value>.z; o0.w <- <main return value>.w
-//
-#line 25 "D:\work\share\phz\video-renderer\src\video-renderer\shader\d3d11\d3d11_yuv_to_rgb.hlsl"
-mov r0.xyz, l(-0.062000,-0.501000,-0.501000,0)  // r0.x <- offset.x; r0.y <- offset.y; r0.z <- offset.z
-
-#line 26
-mov r1.xyz, l(1.164000,0,1.596000,0)  // r1.x <- Rcoeff.x; r1.y <- Rcoeff.y; r1.z <- Rcoeff.z
-
-#line 27
-mov r2.xyz, l(1.164000,-0.392000,-0.813000,0)  // r2.x <- Gcoeff.x; r2.y <- Gcoeff.y; r2.z <- Gcoeff.z
-
-#line 28
-mov r3.xyz, l(1.164000,2.017000,0,0)  // r3.x <- Bcoeff.x; r3.y <- Bcoeff.y; r3.z <- Bcoeff.z
-
-#line 30
-mul r4.xy, v1.xyxx, cb0[0].xyxx
-ftou r4.xy, r4.xyxx  // r4.x <- pos.x; r4.y <- pos.y
-
-#line 31
-mov r5.yz, r0.yyzy  // r5.y <- yuv444.y; r5.z <- yuv444.z
-
-#line 34
-sample r6.xyzw, v1.xyxx, t0.xyzw, s0
-mov r5.x, r6.x  // r5.x <- yuv444.x
-
-#line 36
-mov r0.w, l(2)
-udiv null, r0.w, r4.x, r0.w
-mov r1.w, l(0)
-ieq r0.w, r0.w, r1.w
-mov r1.w, l(2)
-udiv null, r1.w, r4.y, r1.w
-mov r2.w, l(0)
-ieq r1.w, r1.w, r2.w
-and r0.w, r0.w, r1.w
-if_nz r0.w
-
-#line 39
-  sample r6.xyzw, v1.xyxx, t1.xyzw, s0  // r6.x <- yuv444.y; r6.y <- yuv444.z
-  mov r5.yz, r6.xxyx  // r5.y <- yuv444.y; r5.z <- yuv444.z
-
-#line 40
-else 
-
-#line 41
-  mov r0.w, l(2)
-  udiv null, r0.w, r4.x, r0.w
-  mov r1.w, l(1)
-  ieq r0.w, r0.w, r1.w
-  if_nz r0.w
-
-#line 44
-    itof r0.w, l(2)
-    div r6.x, v1.x, r0.w
-    mov r6.y, v1.y
-    sample r6.xyzw, r6.xyxx, t2.xyzw, s0  // r6.x <- yuv444.y
-    mov r5.y, r6.x  // r5.y <- yuv444.y
-
-#line 45
-    itof r0.w, l(2)
-    div r0.w, v1.x, r0.w
-    add r6.x, r0.w, l(0.500000)
-    mov r6.y, v1.y
-    sample r6.xyzw, r6.xyxx, t2.xyzw, s0  // r6.x <- yuv444.z
-    mov r5.z, r6.x  // r5.z <- yuv444.z
-
-#line 46
-  else 
-
-#line 47
-    mov r0.w, l(4)
-    udiv null, r0.w, r4.x, r0.w
-    mov r1.w, l(0)
-    ieq r0.w, r0.w, r1.w
-    mov r1.w, l(2)
-    udiv null, r1.w, r4.y, r1.w
-    mov r2.w, l(1)
-    ieq r1.w, r1.w, r2.w
-    and r0.w, r0.w, r1.w
-    if_nz r0.w
-
-#line 50
-      itof r0.w, l(2)
-      div r6.x, v1.x, r0.w
-      mov r6.y, v1.y
-      sample r6.xyzw, r6.xyxx, t3.xyzw, s0  // r6.x <- yuv444.y
-      mov r5.y, r6.x  // r5.y <- yuv444.y
-
-#line 51
-      itof r0.w, l(2)
-      div r0.w, v1.x, r0.w
-      add r6.x, r0.w, l(0.500000)
-      mov r6.y, v1.y
-      sample r6.xyzw, r6.xyxx, t3.xyzw, s0  // r6.x <- yuv444.z
-      mov r5.z, r6.x  // r5.z <- yuv444.z
-
-#line 52
-    else 
-
-#line 53
-      mov r0.w, l(4)
-      udiv null, r0.w, r4.x, r0.w
-      mov r1.w, l(2)
-      ieq r0.w, r0.w, r1.w
-      mov r1.w, l(2)
-      udiv null, r1.w, r4.y, r1.w
-      mov r2.w, l(1)
-      ieq r1.w, r1.w, r2.w
-      and r0.w, r0.w, r1.w
-      if_nz r0.w
-
-#line 56
-        itof r0.w, l(2)
-        div r4.x, v1.x, r0.w
-        mov r4.y, v1.y
-        sample r4.xyzw, r4.xyxx, t3.xyzw, s0  // r4.y <- yuv444.y
-        mov r5.y, r4.y  // r5.y <- yuv444.y
-
-#line 57
-        itof r0.w, l(2)
-        div r0.w, v1.x, r0.w
-        add r4.x, r0.w, l(0.500000)
-        mov r4.y, v1.y
-        sample r4.xyzw, r4.xyxx, t3.xyzw, s0  // r4.y <- yuv444.z
-        mov r5.z, r4.y  // r5.z <- yuv444.z
-
-#line 58
-      endif 
-    endif 
-  endif 
-endif 
-
-#line 61
-add r0.xyz, r0.xyzx, r5.xyzx  // r0.x <- yuv444.x; r0.y <- yuv444.y; r0.z <- yuv444.z
-
-#line 62
-dp3 r0.w, r0.xyzx, r1.xyzx  // r0.w <- Output.x
-
-#line 63
-dp3 r1.x, r0.xyzx, r2.xyzx  // r1.x <- Output.y
-
-#line 64
-dp3 r0.x, r0.xyzx, r3.xyzx  // r0.x <- Output.z
-
-#line 65
-mov r0.y, l(1.000000)  // r0.y <- Output.w
-
-#line 66
-mov o0.x, r0.w
-mov o0.y, r1.x
-mov o0.z, r0.x
-mov o0.w, r0.y
-ret 
-// Approximately 96 instruction slots used
-#endif
-
-const BYTE shader_d3d11_yuv_to_rgb[] =
-{
-     68,  88,  66,  67, 186, 205, 
-    242, 118, 230,  78, 176, 237, 
-    123,  56, 132, 120, 190, 140, 
-    147, 134,   1,   0,   0,   0, 
-    100,  90,   0,   0,   6,   0, 
-      0,   0,  56,   0,   0,   0, 
-      4,   2,   0,   0, 120,   2, 
-      0,   0, 172,   2,   0,   0, 
-    224,  11,   0,   0,  92,  12, 
-      0,   0,  82,  68,  69,  70, 
-    196,   1,   0,   0,   1,   0, 
-      0,   0,  52,   1,   0,   0, 
-      6,   0,   0,   0,  28,   0, 
-      0,   0,   0,   4, 255, 255, 
-      5,   1,   0,   0, 155,   1, 
-      0,   0, 220,   0,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0, 233,   0, 
-      0,   0,   2,   0,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,  13,   0,   0,   0, 
-    248,   0,   0,   0,   2,   0, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,   0,   0, 255, 255, 
-    255, 255,   1,   0,   0,   0, 
-      1,   0,   0,   0,  13,   0, 
-      0,   0,   8,   1,   0,   0, 
-      2,   0,   0,   0,   5,   0, 
-      0,   0,   4,   0,   0,   0, 
-    255, 255, 255, 255,   2,   0, 
-      0,   0,   1,   0,   0,   0, 
-     13,   0,   0,   0,  26,   1, 
-      0,   0,   2,   0,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-      0,   0, 255, 255, 255, 255, 
-      3,   0,   0,   0,   1,   0, 
-      0,   0,  13,   0,   0,   0, 
-     45,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,  80, 111, 105, 110, 
-    116,  83,  97, 109, 112, 108, 
-    101, 114,   0,  89,  85,  86, 
-     52,  50,  48,  89,  84, 101, 
-    120, 116, 117, 114, 101,   0, 
-     89,  85,  86,  52,  50,  48, 
-     85,  86,  84, 101, 120, 116, 
-    117, 114, 101,   0,  67, 104, 
-    114, 111, 109,  97,  52,  50, 
-     48,  89,  84, 101, 120, 116, 
-    117, 114, 101,   0,  67, 104, 
-    114, 111, 109,  97,  52,  50, 
-     48,  85,  86,  84, 101, 120, 
-    116, 117, 114, 101,   0,  73, 
-    109,  97, 103, 101,   0, 171, 
-     45,   1,   0,   0,   2,   0, 
-      0,   0,  76,   1,   0,   0, 
-     16,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    124,   1,   0,   0,   0,   0, 
-      0,   0,   4,   0,   0,   0, 
-      2,   0,   0,   0, 132,   1, 
-      0,   0,   0,   0,   0,   0, 
-    148,   1,   0,   0,   4,   0, 
-      0,   0,   4,   0,   0,   0, 
-      2,   0,   0,   0, 132,   1, 
-      0,   0,   0,   0,   0,   0, 
-    119, 105, 100, 116, 104,   0, 
-    171, 171,   0,   0,   3,   0, 
-      1,   0,   1,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    104, 101, 105, 103, 104, 116, 
-      0,  77, 105,  99, 114, 111, 
-    115, 111, 102, 116,  32,  40, 
-     82,  41,  32,  72,  76,  83, 
-     76,  32,  83, 104,  97, 100, 
-    101, 114,  32,  67, 111, 109, 
-    112, 105, 108, 101, 114,  32, 
-     49,  48,  46,  49,   0, 171, 
-     73,  83,  71,  78, 108,   0, 
-      0,   0,   3,   0,   0,   0, 
-      8,   0,   0,   0,  80,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-     15,   0,   0,   0,  92,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   1,   0,   0,   0, 
-      3,   3,   0,   0, 101,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   3,   0, 
-      0,   0,   2,   0,   0,   0, 
-     15,   0,   0,   0,  83,  86, 
-     95,  80,  79,  83,  73,  84, 
-     73,  79,  78,   0,  84,  69, 
-     88,  67,  79,  79,  82,  68, 
-      0,  67,  79,  76,  79,  82, 
-      0, 171,  79,  83,  71,  78, 
-     44,   0,   0,   0,   1,   0, 
-      0,   0,   8,   0,   0,   0, 
-     32,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,  15,   0,   0,   0, 
-     83,  86,  95,  84,  65,  82, 
-     71,  69,  84,   0, 171, 171, 
-     83,  72,  68,  82,  44,   9, 
-      0,   0,  64,   0,   0,   0, 
-     75,   2,   0,   0,  89,   0, 
-      0,   4,  70, 142,  32,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,  90,   0,   0,   3, 
-      0,  96,  16,   0,   0,   0, 
-      0,   0,  88,  24,   0,   4, 
-      0, 112,  16,   0,   0,   0, 
-      0,   0,  85,  85,   0,   0, 
-     88,  24,   0,   4,   0, 112, 
-     16,   0,   1,   0,   0,   0, 
-     85,  85,   0,   0,  88,  24, 
-      0,   4,   0, 112,  16,   0, 
-      2,   0,   0,   0,  85,  85, 
-      0,   0,  88,  24,   0,   4, 
-      0, 112,  16,   0,   3,   0, 
-      0,   0,  85,  85,   0,   0, 
-     98,  16,   0,   3,  50,  16, 
-     16,   0,   1,   0,   0,   0, 
-    101,   0,   0,   3, 242,  32, 
-     16,   0,   0,   0,   0,   0, 
-    104,   0,   0,   2,   7,   0, 
-      0,   0,  54,   0,   0,   8, 
-    114,   0,  16,   0,   0,   0, 
-      0,   0,   2,  64,   0,   0, 
-    182, 243, 125, 189, 137,  65, 
-      0, 191, 137,  65,   0, 191, 
-      0,   0,   0,   0,  54,   0, 
-      0,   8, 114,   0,  16,   0, 
-      1,   0,   0,   0,   2,  64, 
-      0,   0, 244, 253, 148,  63, 
-      0,   0,   0,   0, 186,  73, 
-    204,  63,   0,   0,   0,   0, 
-     54,   0,   0,   8, 114,   0, 
-     16,   0,   2,   0,   0,   0, 
-      2,  64,   0,   0, 244, 253, 
-    148,  63,  57, 180, 200, 190, 
-    197,  32,  80, 191,   0,   0, 
-      0,   0,  54,   0,   0,   8, 
-    114,   0,  16,   0,   3,   0, 
-      0,   0,   2,  64,   0,   0, 
-    244, 253, 148,  63, 135,  22, 
-      1,  64,   0,   0,   0,   0, 
-      0,   0,   0,   0,  56,   0, 
-      0,   8,  50,   0,  16,   0, 
-      4,   0,   0,   0,  70,  16, 
-     16,   0,   1,   0,   0,   0, 
-     70, 128,  32,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     28,   0,   0,   5,  50,   0, 
-     16,   0,   4,   0,   0,   0, 
-     70,   0,  16,   0,   4,   0, 
-      0,   0,  54,   0,   0,   5, 
-     98,   0,  16,   0,   5,   0, 
-      0,   0,  86,   6,  16,   0, 
-      0,   0,   0,   0,  69,   0, 
-      0,   9, 242,   0,  16,   0, 
-      6,   0,   0,   0,  70,  16, 
-     16,   0,   1,   0,   0,   0, 
-     70, 126,  16,   0,   0,   0, 
-      0,   0,   0,  96,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5,  18,   0,  16,   0, 
-      5,   0,   0,   0,  10,   0, 
-     16,   0,   6,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-      1,  64,   0,   0,   2,   0, 
-      0,   0,  78,   0,   0,   8, 
-      0, 208,   0,   0, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-     10,   0,  16,   0,   4,   0, 
-      0,   0,  58,   0,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      1,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0,   0,   0, 
-     32,   0,   0,   7, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-     58,   0,  16,   0,   0,   0, 
-      0,   0,  58,   0,  16,   0, 
-      1,   0,   0,   0,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      1,   0,   0,   0,   1,  64, 
-      0,   0,   2,   0,   0,   0, 
-     78,   0,   0,   8,   0, 208, 
-      0,   0, 130,   0,  16,   0, 
-      1,   0,   0,   0,  26,   0, 
-     16,   0,   4,   0,   0,   0, 
-     58,   0,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   5, 
-    130,   0,  16,   0,   2,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0,   0,   0,  32,   0, 
-      0,   7, 130,   0,  16,   0, 
-      1,   0,   0,   0,  58,   0, 
-     16,   0,   1,   0,   0,   0, 
-     58,   0,  16,   0,   2,   0, 
-      0,   0,   1,   0,   0,   7, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,  58,   0,  16,   0, 
-      0,   0,   0,   0,  58,   0, 
-     16,   0,   1,   0,   0,   0, 
-     31,   0,   4,   3,  58,   0, 
-     16,   0,   0,   0,   0,   0, 
-     69,   0,   0,   9, 242,   0, 
-     16,   0,   6,   0,   0,   0, 
-     70,  16,  16,   0,   1,   0, 
-      0,   0,  70, 126,  16,   0, 
-      1,   0,   0,   0,   0,  96, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5,  98,   0, 
-     16,   0,   5,   0,   0,   0, 
-      6,   1,  16,   0,   6,   0, 
-      0,   0,  18,   0,   0,   1, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-      1,  64,   0,   0,   2,   0, 
-      0,   0,  78,   0,   0,   8, 
-      0, 208,   0,   0, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-     10,   0,  16,   0,   4,   0, 
-      0,   0,  58,   0,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      1,   0,   0,   0,   1,  64, 
-      0,   0,   1,   0,   0,   0, 
-     32,   0,   0,   7, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-     58,   0,  16,   0,   0,   0, 
-      0,   0,  58,   0,  16,   0, 
-      1,   0,   0,   0,  31,   0, 
-      4,   3,  58,   0,  16,   0, 
-      0,   0,   0,   0,  43,   0, 
-      0,   5, 130,   0,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0,   2,   0,   0,   0, 
-     14,   0,   0,   7,  18,   0, 
-     16,   0,   6,   0,   0,   0, 
-     10,  16,  16,   0,   1,   0, 
-      0,   0,  58,   0,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5,  34,   0,  16,   0, 
-      6,   0,   0,   0,  26,  16, 
-     16,   0,   1,   0,   0,   0, 
-     69,   0,   0,   9, 242,   0, 
-     16,   0,   6,   0,   0,   0, 
-     70,   0,  16,   0,   6,   0, 
-      0,   0,  70, 126,  16,   0, 
-      2,   0,   0,   0,   0,  96, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5,  34,   0, 
-     16,   0,   5,   0,   0,   0, 
-     10,   0,  16,   0,   6,   0, 
-      0,   0,  43,   0,   0,   5, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,   1,  64,   0,   0, 
-      2,   0,   0,   0,  14,   0, 
-      0,   7, 130,   0,  16,   0, 
-      0,   0,   0,   0,  10,  16, 
-     16,   0,   1,   0,   0,   0, 
-     58,   0,  16,   0,   0,   0, 
-      0,   0,   0,   0,   0,   7, 
-     18,   0,  16,   0,   6,   0, 
-      0,   0,  58,   0,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0,   0,   0,   0,  63, 
-     54,   0,   0,   5,  34,   0, 
-     16,   0,   6,   0,   0,   0, 
-     26,  16,  16,   0,   1,   0, 
-      0,   0,  69,   0,   0,   9, 
-    242,   0,  16,   0,   6,   0, 
-      0,   0,  70,   0,  16,   0, 
-      6,   0,   0,   0,  70, 126, 
-     16,   0,   2,   0,   0,   0, 
-      0,  96,  16,   0,   0,   0, 
-      0,   0,  54,   0,   0,   5, 
-     66,   0,  16,   0,   5,   0, 
-      0,   0,  10,   0,  16,   0, 
-      6,   0,   0,   0,  18,   0, 
-      0,   1,  54,   0,   0,   5, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,   1,  64,   0,   0, 
-      4,   0,   0,   0,  78,   0, 
-      0,   8,   0, 208,   0,   0, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,  10,   0,  16,   0, 
-      4,   0,   0,   0,  58,   0, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   1,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-      0,   0,  32,   0,   0,   7, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,  58,   0,  16,   0, 
-      0,   0,   0,   0,  58,   0, 
-     16,   0,   1,   0,   0,   0, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   1,   0,   0,   0, 
-      1,  64,   0,   0,   2,   0, 
-      0,   0,  78,   0,   0,   8, 
-      0, 208,   0,   0, 130,   0, 
-     16,   0,   1,   0,   0,   0, 
-     26,   0,  16,   0,   4,   0, 
-      0,   0,  58,   0,  16,   0, 
-      1,   0,   0,   0,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      2,   0,   0,   0,   1,  64, 
-      0,   0,   1,   0,   0,   0, 
-     32,   0,   0,   7, 130,   0, 
-     16,   0,   1,   0,   0,   0, 
-     58,   0,  16,   0,   1,   0, 
-      0,   0,  58,   0,  16,   0, 
-      2,   0,   0,   0,   1,   0, 
-      0,   7, 130,   0,  16,   0, 
-      0,   0,   0,   0,  58,   0, 
-     16,   0,   0,   0,   0,   0, 
-     58,   0,  16,   0,   1,   0, 
-      0,   0,  31,   0,   4,   3, 
-     58,   0,  16,   0,   0,   0, 
-      0,   0,  43,   0,   0,   5, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,   1,  64,   0,   0, 
-      2,   0,   0,   0,  14,   0, 
-      0,   7,  18,   0,  16,   0, 
-      6,   0,   0,   0,  10,  16, 
-     16,   0,   1,   0,   0,   0, 
-     58,   0,  16,   0,   0,   0, 
-      0,   0,  54,   0,   0,   5, 
-     34,   0,  16,   0,   6,   0, 
-      0,   0,  26,  16,  16,   0, 
-      1,   0,   0,   0,  69,   0, 
-      0,   9, 242,   0,  16,   0, 
-      6,   0,   0,   0,  70,   0, 
-     16,   0,   6,   0,   0,   0, 
-     70, 126,  16,   0,   3,   0, 
-      0,   0,   0,  96,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5,  34,   0,  16,   0, 
-      5,   0,   0,   0,  10,   0, 
-     16,   0,   6,   0,   0,   0, 
-     43,   0,   0,   5, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-      1,  64,   0,   0,   2,   0, 
-      0,   0,  14,   0,   0,   7, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,  10,  16,  16,   0, 
-      1,   0,   0,   0,  58,   0, 
-     16,   0,   0,   0,   0,   0, 
-      0,   0,   0,   7,  18,   0, 
-     16,   0,   6,   0,   0,   0, 
-     58,   0,  16,   0,   0,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0,   0,  63,  54,   0, 
-      0,   5,  34,   0,  16,   0, 
-      6,   0,   0,   0,  26,  16, 
-     16,   0,   1,   0,   0,   0, 
-     69,   0,   0,   9, 242,   0, 
-     16,   0,   6,   0,   0,   0, 
-     70,   0,  16,   0,   6,   0, 
-      0,   0,  70, 126,  16,   0, 
-      3,   0,   0,   0,   0,  96, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5,  66,   0, 
-     16,   0,   5,   0,   0,   0, 
-     10,   0,  16,   0,   6,   0, 
-      0,   0,  18,   0,   0,   1, 
-     54,   0,   0,   5, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-      1,  64,   0,   0,   4,   0, 
-      0,   0,  78,   0,   0,   8, 
-      0, 208,   0,   0, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-     10,   0,  16,   0,   4,   0, 
-      0,   0,  58,   0,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      1,   0,   0,   0,   1,  64, 
-      0,   0,   2,   0,   0,   0, 
-     32,   0,   0,   7, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-     58,   0,  16,   0,   0,   0, 
-      0,   0,  58,   0,  16,   0, 
-      1,   0,   0,   0,  54,   0, 
-      0,   5, 130,   0,  16,   0, 
-      1,   0,   0,   0,   1,  64, 
-      0,   0,   2,   0,   0,   0, 
-     78,   0,   0,   8,   0, 208, 
-      0,   0, 130,   0,  16,   0, 
-      1,   0,   0,   0,  26,   0, 
-     16,   0,   4,   0,   0,   0, 
-     58,   0,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   5, 
-    130,   0,  16,   0,   2,   0, 
-      0,   0,   1,  64,   0,   0, 
-      1,   0,   0,   0,  32,   0, 
-      0,   7, 130,   0,  16,   0, 
-      1,   0,   0,   0,  58,   0, 
-     16,   0,   1,   0,   0,   0, 
-     58,   0,  16,   0,   2,   0, 
-      0,   0,   1,   0,   0,   7, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,  58,   0,  16,   0, 
-      0,   0,   0,   0,  58,   0, 
-     16,   0,   1,   0,   0,   0, 
-     31,   0,   4,   3,  58,   0, 
-     16,   0,   0,   0,   0,   0, 
-     43,   0,   0,   5, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-      1,  64,   0,   0,   2,   0, 
-      0,   0,  14,   0,   0,   7, 
-     18,   0,  16,   0,   4,   0, 
-      0,   0,  10,  16,  16,   0, 
-      1,   0,   0,   0,  58,   0, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5,  34,   0, 
-     16,   0,   4,   0,   0,   0, 
-     26,  16,  16,   0,   1,   0, 
-      0,   0,  69,   0,   0,   9, 
-    242,   0,  16,   0,   4,   0, 
-      0,   0,  70,   0,  16,   0, 
-      4,   0,   0,   0,  70, 126, 
-     16,   0,   3,   0,   0,   0, 
-      0,  96,  16,   0,   0,   0, 
-      0,   0,  54,   0,   0,   5, 
-     34,   0,  16,   0,   5,   0, 
-      0,   0,  26,   0,  16,   0, 
-      4,   0,   0,   0,  43,   0, 
-      0,   5, 130,   0,  16,   0, 
-      0,   0,   0,   0,   1,  64, 
-      0,   0,   2,   0,   0,   0, 
-     14,   0,   0,   7, 130,   0, 
-     16,   0,   0,   0,   0,   0, 
-     10,  16,  16,   0,   1,   0, 
-      0,   0,  58,   0,  16,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   7,  18,   0,  16,   0, 
-      4,   0,   0,   0,  58,   0, 
-     16,   0,   0,   0,   0,   0, 
-      1,  64,   0,   0,   0,   0, 
-      0,  63,  54,   0,   0,   5, 
-     34,   0,  16,   0,   4,   0, 
-      0,   0,  26,  16,  16,   0, 
-      1,   0,   0,   0,  69,   0, 
-      0,   9, 242,   0,  16,   0, 
-      4,   0,   0,   0,  70,   0, 
-     16,   0,   4,   0,   0,   0, 
-     70, 126,  16,   0,   3,   0, 
-      0,   0,   0,  96,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5,  66,   0,  16,   0, 
-      5,   0,   0,   0,  26,   0, 
-     16,   0,   4,   0,   0,   0, 
-     21,   0,   0,   1,  21,   0, 
-      0,   1,  21,   0,   0,   1, 
-     21,   0,   0,   1,   0,   0, 
-      0,   7, 114,   0,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,   0,   0,   0,   0, 
-     70,   2,  16,   0,   5,   0, 
-      0,   0,  16,   0,   0,   7, 
-    130,   0,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,   1,   0,   0,   0, 
-     16,   0,   0,   7,  18,   0, 
-     16,   0,   1,   0,   0,   0, 
-     70,   2,  16,   0,   0,   0, 
-      0,   0,  70,   2,  16,   0, 
-      2,   0,   0,   0,  16,   0, 
-      0,   7,  18,   0,  16,   0, 
-      0,   0,   0,   0,  70,   2, 
-     16,   0,   0,   0,   0,   0, 
-     70,   2,  16,   0,   3,   0, 
-      0,   0,  54,   0,   0,   5, 
-     34,   0,  16,   0,   0,   0, 
-      0,   0,   1,  64,   0,   0, 
-      0,   0, 128,  63,  54,   0, 
-      0,   5,  18,  32,  16,   0, 
-      0,   0,   0,   0,  58,   0, 
-     16,   0,   0,   0,   0,   0, 
-     54,   0,   0,   5,  34,  32, 
-     16,   0,   0,   0,   0,   0, 
-     10,   0,  16,   0,   1,   0, 
-      0,   0,  54,   0,   0,   5, 
-     66,  32,  16,   0,   0,   0, 
-      0,   0,  10,   0,  16,   0, 
-      0,   0,   0,   0,  54,   0, 
-      0,   5, 130,  32,  16,   0, 
-      0,   0,   0,   0,  26,   0, 
-     16,   0,   0,   0,   0,   0, 
-     62,   0,   0,   1,  83,  84, 
-     65,  84, 116,   0,   0,   0, 
-     96,   0,   0,   0,   7,   0, 
-      0,   0,   0,   0,   0,   0, 
-      2,   0,   0,   0,  14,   0, 
-      0,   0,   7,   0,   0,   0, 
-     10,   0,   0,   0,   4,   0, 
-      0,   0,   4,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   8,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  38,   0, 
-      0,   0,   0,   0,   0,   0, 
-      7,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  83,  80,  68,  66, 
-      0,  78,   0,   0,  77, 105, 
-     99, 114, 111, 115, 111, 102, 
-    116,  32,  67,  47,  67,  43, 
-     43,  32,  77,  83,  70,  32, 
-     55,  46,  48,  48,  13,  10, 
-     26,  68,  83,   0,   0,   0, 
-      0,   2,   0,   0,   2,   0, 
-      0,   0,  39,   0,   0,   0, 
-    188,   0,   0,   0,   0,   0, 
-      0,   0,  36,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    192, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255,  56,   0,   0,   0, 
-    224, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255, 255, 255, 255,   5,   0, 
-      0,   0,  32,   0,   0,   0, 
-     60,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,   6,   0, 
-      0,   0,   5,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      3,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 148,  46,  49,   1, 
-    209, 166,  49,  98,   1,   0, 
-      0,   0,  96, 210,  98, 137, 
-    134,  16,   3,  77, 163, 252, 
-    140, 199,  50,  19, 237, 237, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   1,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 220,  81, 
-     51,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 100, 101, 
-    114,  73, 110, 112, 117, 116, 
-     13,  10, 123,  13,  10,   9, 
-    102, 108, 111,  97, 116,  52, 
-     32, 112, 111, 115,  32,  32, 
-     32,  58,  32,  83,  86,  95, 
-     80,  79,  83,  73,  84,  73, 
-     79,  78,  59,  13,  10,   9, 
-    102, 108, 111,  97, 116,  50, 
-     32, 117, 118,  32,  32,  32, 
-     32,  58,  32,  84,  69,  88, 
-     67,  79,  79,  82,  68,  48, 
-     59,  13,  10,   9, 102, 108, 
-    111,  97, 116,  52,  32,  99, 
-    111, 108, 111, 114,  32,  58, 
-     32,  67,  79,  76,  79,  82, 
-     48,  59,  13,  10, 125,  59, 
-     13,  10,  13,  10, 102, 108, 
-    111,  97, 116,  52,  32, 109, 
-     97, 105, 110,  40,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-    100, 101, 114,  73, 110, 112, 
-    117, 116,  32, 105, 110, 112, 
-    117, 116,  41,  32,  58,  32, 
-     83,  86,  95,  84,  65,  82, 
-     71,  69,  84,  13,  10, 123, 
-     13,  10,   9, 102, 108, 111, 
-     97, 116,  52,  32,  79, 117, 
-    116, 112, 117, 116,  59,  13, 
-     10,  13,  10,   9,  99, 111, 
-    110, 115, 116,  32, 102, 108, 
-    111,  97, 116,  51,  32, 111, 
-    102, 102, 115, 101, 116,  32, 
-     61,  32, 102, 108, 111,  97, 
-    116,  51,  40,  45,  48,  46, 
-     48,  54,  50,  44,  32,  45, 
-     48,  46,  53,  48,  49,  44, 
-     32,  45,  48,  46,  53,  48, 
-     49,  41,  59,  13,  10,   9, 
-     99, 111, 110, 115, 116,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  82,  99, 111, 101, 102, 
-    102,  32,  61,  32, 102, 108, 
-    111,  97, 116,  51,  40,  32, 
-     49,  46,  49,  54,  52,  44, 
-     32,  32,  48,  46,  48,  48, 
-     48,  44,  32,  32,  49,  46, 
-     53,  57,  54,  41,  59,  13, 
-     10,   9,  99, 111, 110, 115, 
-    116,  32, 102, 108, 111,  97, 
-    116,  51,  32,  71,  99, 111, 
-    101, 102, 102,  32,  61,  32, 
-    102, 108, 111,  97, 116,  51, 
-     40,  32,  49,  46,  49,  54, 
-     52,  44,  32,  45,  48,  46, 
-     51,  57,  50,  44,  32,  45, 
-     48,  46,  56,  49,  51,  41, 
-     59,  13,  10,   9,  99, 111, 
-    110, 115, 116,  32, 102, 108, 
-    111,  97, 116,  51,  32,  66, 
-     99, 111, 101, 102, 102,  32, 
-     61,  32, 102, 108, 111,  97, 
-    116,  51,  40,  32,  49,  46, 
-     49,  54,  52,  44,  32,  32, 
-     50,  46,  48,  49,  55,  44, 
-     32,  32,  48,  46,  48,  48, 
-     48,  41,  59,  13,  10,  13, 
-     10,   9, 117, 105, 110, 116, 
-     50,  32, 112, 111, 115,  32, 
-     61,  32, 117, 105, 110, 116, 
-     50,  40, 105, 110, 112, 117, 
-    116,  46, 117, 118,  32,  42, 
-     32, 102, 108, 111,  97, 116, 
-     50,  40, 119, 105, 100, 116, 
-    104,  44,  32, 104, 101, 105, 
-    103, 104, 116,  41,  41,  59, 
-     13,  10,   9, 102, 108, 111, 
-     97, 116,  51,  32, 121, 117, 
-    118,  52,  52,  52,  32,  61, 
-     32, 111, 102, 102, 115, 101, 
-    116,  59,  13,  10,  13,  10, 
-      9,  47,  47,  32,  66,  49, 
-     13,  10,   9, 121, 117, 118, 
-     52,  52,  52,  46, 114,  32, 
-     61,  32,  89,  85,  86,  52, 
-     50,  48,  89,  84, 101, 120, 
-    198,  90,   0,   0, 117, 131, 
-      1,   0, 142,  60,   1,   0, 
-     47,  63,   0,   0,  38, 247, 
-      2,   0,  65,  36,   1,   0, 
-     39,  82,   3,   0,  76, 232, 
-      3,   0, 217,  42,   2,   0, 
-     63, 252,   2,   0, 143,  38, 
-      0,   0,  73,  20,   1,   0, 
-    153, 189,   3,   0, 196,  76, 
-      2,   0, 209,  10,   2,   0, 
-     53, 174,   3,   0, 146, 230, 
-      3,   0,  98, 163,   2,   0, 
-      0,  16,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  84, 101, 120, 116, 
-    117, 114, 101,  50,  68,  32, 
-     89,  85,  86,  52,  50,  48, 
-     89,  84, 101, 120, 116, 117, 
-    114, 101,  32,  32,  32,  32, 
-     32,  32,  58,  32, 114, 101, 
-    103, 105, 115, 116, 101, 114, 
-     40, 116,  48,  41,  59,  13, 
-     10,  84, 101, 120, 116, 117, 
-    114, 101,  50,  68,  32,  89, 
-     85,  86,  52,  50,  48,  85, 
-     86,  84, 101, 120, 116, 117, 
-    114, 101,  32,  32,  32,  32, 
-     32,  58,  32, 114, 101, 103, 
-    105, 115, 116, 101, 114,  40, 
-    116,  49,  41,  59,  13,  10, 
-     84, 101, 120, 116, 117, 114, 
-    101,  50,  68,  32,  67, 104, 
-    114, 111, 109,  97,  52,  50, 
-     48,  89,  84, 101, 120, 116, 
-    117, 114, 101,  32,  32,  32, 
-     58,  32, 114, 101, 103, 105, 
-    115, 116, 101, 114,  40, 116, 
-     50,  41,  59,  13,  10,  84, 
-    101, 120, 116, 117, 114, 101, 
-     50,  68,  32,  67, 104, 114, 
-    111, 109,  97,  52,  50,  48, 
-     85,  86,  84, 101, 120, 116, 
-    117, 114, 101,  32,  32,  58, 
-     32, 114, 101, 103, 105, 115, 
-    116, 101, 114,  40, 116,  51, 
-     41,  59,  13,  10,  13,  10, 
-     83,  97, 109, 112, 108, 101, 
-    114,  83, 116,  97, 116, 101, 
-     32,  80, 111, 105, 110, 116, 
-     83,  97, 109, 112, 108, 101, 
-    114,  32,  32,  32,  32,  32, 
-     58,  32, 114, 101, 103, 105, 
-    115, 116, 101, 114,  40, 115, 
-     48,  41,  59,  13,  10,  13, 
-     10,  99,  98, 117, 102, 102, 
-    101, 114,  32,  73, 109,  97, 
-    103, 101,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40,  98,  48,  41,  13, 
-     10, 123,  13,  10,   9, 102, 
-    108, 111,  97, 116,  32, 119, 
-    105, 100, 116, 104,  59,  13, 
-     10,   9, 102, 108, 111,  97, 
-    116,  32, 104, 101, 105, 103, 
-    104, 116,  59,  13,  10, 125, 
-     59,  13,  10,  13,  10, 115, 
-    116, 114, 117,  99, 116,  32, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  73, 
-    110, 112, 117, 116,  13,  10, 
-    123,  13,  10,   9, 102, 108, 
-    111,  97, 116,  52,  32, 112, 
-    111, 115,  32,  32,  32,  58, 
-     32,  83,  86,  95,  80,  79, 
-     83,  73,  84,  73,  79,  78, 
-     59,  13,  10,   9, 102, 108, 
-    111,  97, 116,  50,  32, 117, 
-    118,  32,  32,  32,  32,  58, 
-     32,  84,  69,  88,  67,  79, 
-     79,  82,  68,  48,  59,  13, 
-     10,   9, 102, 108, 111,  97, 
-    116,  52,  32,  99, 111, 108, 
-    111, 114,  32,  58,  32,  67, 
-     79,  76,  79,  82,  48,  59, 
-     13,  10, 125,  59,  13,  10, 
-     13,  10, 102, 108, 111,  97, 
-    116,  52,  32, 109,  97, 105, 
-    110,  40,  80, 105, 120, 101, 
-    108,  83, 104,  97, 100, 101, 
-    114,  73, 110, 112, 117, 116, 
-     32, 105, 110, 112, 117, 116, 
-     41,  32,  58,  32,  83,  86, 
-     95,  84,  65,  82,  71,  69, 
-     84,  13,  10, 123,  13,  10, 
-      9, 102, 108, 111,  97, 116, 
-     52,  32,  79, 117, 116, 112, 
-    117, 116,  59,  13,  10,  13, 
-     10,   9,  99, 111, 110, 115, 
-    116,  32, 102, 108, 111,  97, 
-    116,  51,  32, 111, 102, 102, 
-    115, 101, 116,  32,  61,  32, 
-    102, 108, 111,  97, 116,  51, 
-     40,  45,  48,  46,  48,  54, 
-     50,  44,  32,  45,  48,  46, 
-     53,  48,  49,  44,  32,  45, 
-     48,  46,  53,  48,  49,  41, 
-     59,  13,  10,   9,  99, 111, 
-    110, 115, 116,  32, 102, 108, 
-    111,  97, 116,  51,  32,  82, 
-     99, 111, 101, 102, 102,  32, 
-     61,  32, 102, 108, 111,  97, 
-    116,  51,  40,  32,  49,  46, 
-     49,  54,  52,  44,  32,  32, 
-     48,  46,  48,  48,  48,  44, 
-     32,  32,  49,  46,  53,  57, 
-     54,  41,  59,  13,  10,   9, 
-     99, 111, 110, 115, 116,  32, 
-    102, 108, 111,  97, 116,  51, 
-     32,  71,  99, 111, 101, 102, 
-    102,  32,  61,  32, 102, 108, 
-    111,  97, 116,  51,  40,  32, 
-     49,  46,  49,  54,  52,  44, 
-     32,  45,  48,  46,  51,  57, 
-     50,  44,  32,  45,  48,  46, 
-     56,  49,  51,  41,  59,  13, 
-     10,   9,  99, 111, 110, 115, 
-    116,  32, 102, 108, 111,  97, 
-    116,  51,  32,  66,  99, 111, 
-    101, 102, 102,  32,  61,  32, 
-    102, 108, 111,  97, 116,  51, 
-     40,  32,  49,  46,  49,  54, 
-     52,  44,  32,  32,  50,  46, 
-     48,  49,  55,  44,  32,  32, 
-     48,  46,  48,  48,  48,  41, 
-     59,  13,  10,  13,  10,   9, 
-    117, 105, 110, 116,  50,  32, 
-    112, 111, 115,  32,  61,  32, 
-    117, 105, 110, 116,  50,  40, 
-    105, 110, 112, 117, 116,  46, 
-    117, 118,  32,  42,  32, 102, 
-    108, 111,  97, 116,  50,  40, 
-    119, 105, 100, 116, 104,  44, 
-     32, 104, 101, 105, 103, 104, 
-    116,  41,  41,  59,  13,  10, 
-      9, 102, 108, 111,  97, 116, 
-     51,  32, 121, 117, 118,  52, 
-     52,  52,  32,  61,  32, 111, 
-    102, 102, 115, 101, 116,  59, 
-     13,  10,  13,  10,   9,  47, 
-     47,  32,  66,  49,  13,  10, 
-      9, 121, 117, 118,  52,  52, 
-     52,  46, 114,  32,  61,  32, 
-     89,  85,  86,  52,  50,  48, 
-     89,  84, 101, 120, 116, 117, 
-    114, 101,  46,  83,  97, 109, 
-    112, 108, 101,  40,  80, 111, 
-    105, 110, 116,  83,  97, 109, 
-    112, 108, 101, 114,  44,  32, 
-    105, 110, 112, 117, 116,  46, 
-    117, 118,  41,  46, 114,  59, 
-     13,  10,  13,  10,   9, 105, 
-    102,  32,  40, 112, 111, 115, 
-     46, 120,  32,  37,  32,  50, 
-     32,  61,  61,  32,  48,  32, 
-     38,  38,  32, 112, 111, 115, 
-     46, 121,  32,  37,  32,  50, 
-     32,  61,  61,  32,  48,  41, 
-     13,  10,   9, 123,  13,  10, 
-      9,   9,  47,  47,  32,  66, 
-     50,  32,  66,  51,  13,  10, 
-      9,   9, 121, 117, 118,  52, 
-     52,  52,  46, 103,  98,  32, 
-     61,  32,  89,  85,  86,  52, 
-     50,  48,  85,  86,  84, 101, 
-    120, 116, 117, 114, 101,  46, 
-     83,  97, 109, 112, 108, 101, 
-     40,  80, 111, 105, 110, 116, 
-     83,  97, 109, 112, 108, 101, 
-    114,  44,  32, 105, 110, 112, 
-    117, 116,  46, 117, 118,  41, 
-     46, 114, 103,  59,  13,  10, 
-      9, 125,  13,  10,   9, 101, 
-    108, 115, 101,  32, 105, 102, 
-     32,  40, 112, 111, 115,  46, 
-    120,  32,  37,  32,  50,  32, 
-     61,  61,  32,  49,  41,  13, 
-     10,   9, 123,  13,  10,   9, 
-      9,  47,  47,  32,  66,  52, 
-     32,  66,  53,  13,  10,   9, 
-      9, 121, 117, 118,  52,  52, 
-     52,  46, 103,  32,  61,  32, 
-     67, 104, 114, 111, 109,  97, 
-     52,  50,  48,  89,  84, 101, 
-    120, 116, 117, 114, 101,  46, 
-     83,  97, 109, 112, 108, 101, 
-     40,  80, 111, 105, 110, 116, 
-     83,  97, 109, 112, 108, 101, 
-    114,  44,  32, 102, 108, 111, 
-     97, 116,  50,  40, 105, 110, 
-    112, 117, 116,  46, 117, 118, 
-     46, 120,  32,  47,  32,  50, 
-     44,  32, 105, 110, 112, 117, 
-    116,  46, 117, 118,  46, 121, 
-     41,  41,  46, 114,  59,  13, 
-     10,   9,   9, 121, 117, 118, 
-     52,  52,  52,  46,  98,  32, 
-     61,  32,  67, 104, 114, 111, 
-    109,  97,  52,  50,  48,  89, 
-     84, 101, 120, 116, 117, 114, 
-    101,  46,  83,  97, 109, 112, 
-    108, 101,  40,  80, 111, 105, 
-    110, 116,  83,  97, 109, 112, 
-    108, 101, 114,  44,  32, 102, 
-    108, 111,  97, 116,  50,  40, 
-    105, 110, 112, 117, 116,  46, 
-    117, 118,  46, 120,  32,  47, 
-     32,  50,  32,  43,  32,  48, 
-     46,  53,  44,  32, 105, 110, 
-    112, 117, 116,  46, 117, 118, 
-     46, 121,  41,  41,  46, 114, 
-     59,  13,  10,   9, 125,  13, 
-     10,   9, 101, 108, 115, 101, 
-     32, 105, 102,  32,  40, 112, 
-    111, 115,  46, 120,  32,  37, 
-     32,  52,  32,  61,  61,  32, 
-     48,  32,  38,  38,  32, 112, 
-    111, 115,  46, 121,  32,  37, 
-     32,  50,  32,  61,  61,  32, 
-     49,  41,  13,  10,   9, 123, 
-     13,  10,   9,   9,  47,  47, 
-     32,  66,  54,  32,  66,  55, 
-     13,  10,   9,   9, 121, 117, 
-    118,  52,  52,  52,  46, 103, 
-     32,  61,  32,  67, 104, 114, 
-    111, 109,  97,  52,  50,  48, 
-     85,  86,  84, 101, 120, 116, 
-    117, 114, 101,  46,  83,  97, 
-    109, 112, 108, 101,  40,  80, 
-    111, 105, 110, 116,  83,  97, 
-    109, 112, 108, 101, 114,  44, 
-     32, 102, 108, 111,  97, 116, 
-     50,  40, 105, 110, 112, 117, 
-    116,  46, 117, 118,  46, 120, 
-     32,  47,  32,  50,  44,  32, 
-    105, 110, 112, 117, 116,  46, 
-    117, 118,  46, 121,  41,  41, 
-     46, 114,  59,  13,  10,   9, 
-      9, 121, 117, 118,  52,  52, 
-     52,  46,  98,  32,  61,  32, 
-     67, 104, 114, 111, 109,  97, 
-     52,  50,  48,  85,  86,  84, 
-    101, 120, 116, 117, 114, 101, 
-     46,  83,  97, 109, 112, 108, 
-    101,  40,  80, 111, 105, 110, 
-    116,  83,  97, 109, 112, 108, 
-    101, 114,  44,  32, 102, 108, 
-    111,  97, 116,  50,  40, 105, 
-    110, 112, 117, 116,  46, 117, 
-    118,  46, 120,  32,  47,  32, 
-     50,  32,  43,  32,  48,  46, 
-     53,  44,  32, 105, 110, 112, 
-    117, 116,  46, 117, 118,  46, 
-    121,  41,  41,  46, 114,  59, 
-     13,  10,   9, 125,  13,  10, 
-      9, 101, 108, 115, 101,  32, 
-    105, 102,  32,  40, 112, 111, 
-    115,  46, 120,  32,  37,  32, 
-     52,  32,  61,  61,  32,  50, 
-     32,  38,  38,  32, 112, 111, 
-    115,  46, 121,  32,  37,  32, 
-     50,  32,  61,  61,  32,  49, 
-     41,  13,  10,   9, 123,  13, 
-     10,   9,   9,  47,  47,  32, 
-     66,  56,  32,  66,  57,  13, 
-     10,   9,   9, 121, 117, 118, 
-     52,  52,  52,  46, 103,  32, 
-     61,  32,  67, 104, 114, 111, 
-    109,  97,  52,  50,  48,  85, 
-     86,  84, 101, 120, 116, 117, 
-    114, 101,  46,  83,  97, 109, 
-    112, 108, 101,  40,  80, 111, 
-    105, 110, 116,  83,  97, 109, 
-    112, 108, 101, 114,  44,  32, 
-    102, 108, 111,  97, 116,  50, 
-     40, 105, 110, 112, 117, 116, 
-     46, 117, 118,  46, 120,  32, 
-     47,  32,  50,  44,  32, 105, 
-    110, 112, 117, 116,  46, 117, 
-    118,  46, 121,  41,  41,  46, 
-    103,  59,  13,  10,   9,   9, 
-    121, 117, 118,  52,  52,  52, 
-     46,  98,  32,  61,  32,  67, 
-    104, 114, 111, 109,  97,  52, 
-     50,  48,  85,  86,  84, 101, 
-    120, 116, 117, 114, 101,  46, 
-     83,  97, 109, 112, 108, 101, 
-     40,  80, 111, 105, 110, 116, 
-     83,  97, 109, 112, 108, 101, 
-    114,  44,  32, 102, 108, 111, 
-     97, 116,  50,  40, 105, 110, 
-    112, 117, 116,  46, 117, 118, 
-     46, 120,  32,  47,  32,  50, 
-     32,  43,  32,  48,  46,  53, 
-     44,  32, 105, 110, 112, 117, 
-    116,  46, 117, 118,  46, 121, 
-     41,  41,  46, 103,  59,  13, 
-     10,   9, 125,  13,  10,  13, 
-     10,   9,  47,  47,  32, 121, 
-    117, 118,  32, 116, 111,  32, 
-    114, 103,  98,  13,  10,   9, 
-    121, 117, 118,  52,  52,  52, 
-     32,  43,  61,  32, 111, 102, 
-    102, 115, 101, 116,  59,  13, 
-     10,   9,  79, 117, 116, 112, 
-    117, 116,  46, 114,  32,  61, 
-     32, 100, 111, 116,  40, 121, 
-    117, 118,  52,  52,  52,  44, 
-     32,  82,  99, 111, 101, 102, 
-    102,  41,  59,  13,  10,   9, 
-     79, 117, 116, 112, 117, 116, 
-     46, 103,  32,  61,  32, 100, 
-    111, 116,  40, 121, 117, 118, 
-     52,  52,  52,  44,  32,  71, 
-     99, 111, 101, 102, 102,  41, 
-     59,  13,  10,   9,  79, 117, 
-    116, 112, 117, 116,  46,  98, 
-     32,  61,  32, 100, 111, 116, 
-     40, 121, 117, 118,  52,  52, 
-     52,  44,  32,  66,  99, 111, 
-    101, 102, 102,  41,  59,  13, 
-     10,   9,  79, 117, 116, 112, 
-    117, 116,  46,  97,  32,  61, 
-     32,  49,  46,  48, 102,  59, 
-     13,  10,   9, 114, 101, 116, 
-    117, 114, 110,  32,  79, 117, 
-    116, 112, 117, 116,  59,  13, 
-     10, 125,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 254, 239, 
-    254, 239,   1,   0,   0,   0, 
-     61,   8,   0,   0,   0,  68, 
-     58,  92, 119, 111, 114, 107, 
-     92, 115, 104,  97, 114, 101, 
-     92, 112, 104, 122,  92, 118, 
-    105, 100, 101, 111,  45, 114, 
-    101, 110, 100, 101, 114, 101, 
-    114,  92, 115, 114,  99,  92, 
-    118, 105, 100, 101, 111,  45, 
-    114, 101, 110, 100, 101, 114, 
-    101, 114,  92, 115, 104,  97, 
-    100, 101, 114,  92, 100,  51, 
-    100,  49,  49,  92, 100,  51, 
-    100,  49,  49,  95, 121, 117, 
-    118,  95, 116, 111,  95, 114, 
-    103,  98,  46, 104, 108, 115, 
-    108,   0,   0, 100,  58,  92, 
-    119, 111, 114, 107,  92, 115, 
-    104,  97, 114, 101,  92, 112, 
-    104, 122,  92, 118, 105, 100, 
-    101, 111,  45, 114, 101, 110, 
-    100, 101, 114, 101, 114,  92, 
-    115, 114,  99,  92, 118, 105, 
-    100, 101, 111,  45, 114, 101, 
-    110, 100, 101, 114, 101, 114, 
-     92, 115, 104,  97, 100, 101, 
-    114,  92, 100,  51, 100,  49, 
-     49,  92, 100,  51, 100,  49, 
-     49,  95, 121, 117, 118,  95, 
-    116, 111,  95, 114, 103,  98, 
-     46, 104, 108, 115, 108,   0, 
-     84, 101, 120, 116, 117, 114, 
-    101,  50,  68,  32,  89,  85, 
-     86,  52,  50,  48,  89,  84, 
-    101, 120, 116, 117, 114, 101, 
-     32,  32,  32,  32,  32,  32, 
-     58,  32, 114, 101, 103, 105, 
-    115, 116, 101, 114,  40, 116, 
-     48,  41,  59,  13,  10,  84, 
-    101, 120, 116, 117, 114, 101, 
-     50,  68,  32,  89,  85,  86, 
-     52,  50,  48,  85,  86,  84, 
-    101, 120, 116, 117, 114, 101, 
-     32,  32,  32,  32,  32,  58, 
-     32, 114, 101, 103, 105, 115, 
-    116, 101, 114,  40, 116,  49, 
-     41,  59,  13,  10,  84, 101, 
-    120, 116, 117, 114, 101,  50, 
-     68,  32,  67, 104, 114, 111, 
-    109,  97,  52,  50,  48,  89, 
-     84, 101, 120, 116, 117, 114, 
-    101,  32,  32,  32,  58,  32, 
-    114, 101, 103, 105, 115, 116, 
-    101, 114,  40, 116,  50,  41, 
-     59,  13,  10,  84, 101, 120, 
-    116, 117, 114, 101,  50,  68, 
-     32,  67, 104, 114, 111, 109, 
-     97,  52,  50,  48,  85,  86, 
-     84, 101, 120, 116, 117, 114, 
-    101,  32,  32,  58,  32, 114, 
-    101, 103, 105, 115, 116, 101, 
-    114,  40, 116,  51,  41,  59, 
-     13,  10,  13,  10,  83,  97, 
-    109, 112, 108, 101, 114,  83, 
-    116,  97, 116, 101,  32,  80, 
-    111, 105, 110, 116,  83,  97, 
-    109, 112, 108, 101, 114,  32, 
-     32,  32,  32,  32,  58,  32, 
-    114, 101, 103, 105, 115, 116, 
-    101, 114,  40, 115,  48,  41, 
-     59,  13,  10,  13,  10,  99, 
-     98, 117, 102, 102, 101, 114, 
-     32,  73, 109,  97, 103, 101, 
-     32,  58,  32, 114, 101, 103, 
-    105, 115, 116, 101, 114,  40, 
-     98,  48,  41,  13,  10, 123, 
-     13,  10,   9, 102, 108, 111, 
-     97, 116,  32, 119, 105, 100, 
-    116, 104,  59,  13,  10,   9, 
-    102, 108, 111,  97, 116,  32, 
-    104, 101, 105, 103, 104, 116, 
-     59,  13,  10, 125,  59,  13, 
-     10,  13,  10, 115, 116, 114, 
-    117,  99, 116,  32,  80, 105, 
-    120, 101, 108,  83, 104,  97, 
-     27, 226,  48,   1, 128,   0, 
-      0,   0,  39, 195,  22,  18, 
-     20,  57, 216,   1,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      0,   0,   2,   0,   0,   0, 
-      1,   0,   0,   0,   2,   0, 
-      0,   0,   0,   0,   0,   0, 
-     89,   0,   0,   0,  40,   0, 
-      0,   0,  27, 226,  48,   1, 
-    138,  62, 140, 209, 140,   7, 
-      0,   0,   1,   0,   0,   0, 
-     88,   0,   0,   0,  89,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   4,   0,   0,   0, 
-     66,   0,  60,  17,  16,   1, 
-      0,   0,   0,   1,  10,   0, 
-      1,   0, 173,   2,  97,  74, 
-     10,   0,   1,   0, 173,   2, 
-     97,  74,  77, 105,  99, 114, 
-    111, 115, 111, 102, 116,  32, 
-     40,  82,  41,  32,  72,  76, 
-     83,  76,  32,  83, 104,  97, 
-    100, 101, 114,  32,  67, 111, 
-    109, 112, 105, 108, 101, 114, 
-     32,  49,  48,  46,  49,   0, 
-      0,   0,  54,   0,  61,  17, 
-      1, 104, 108, 115, 108,  70, 
-    108,  97, 103, 115,   0,  48, 
-    120,  53,   0, 104, 108, 115, 
-    108,  84,  97, 114, 103, 101, 
-    116,   0, 112, 115,  95,  52, 
-     95,  48,   0, 104, 108, 115, 
-    108,  69, 110, 116, 114, 121, 
-      0, 109,  97, 105, 110,   0, 
-      0,   0,   0,   0,  42,   0, 
-     16,  17,   0,   0,   0,   0, 
-    152,   6,   0,   0,   0,   0, 
-      0,   0, 168,   8,   0,   0, 
-      0,   0,   0,   0, 168,   8, 
-      0,   0,   6,  16,   0,   0, 
-    132,   0,   0,   0,   1,   0, 
-    160, 109,  97, 105, 110,   0, 
-     46,   0,  62,  17,   3,  16, 
-      0,   0,   9,   0, 105, 110, 
-    112, 117, 116,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,   0,   0,   4,   0, 
-    132,   0,   0,   0,   1,   0, 
-    168,   8,   0,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,   4,   0,   4,   0, 
-    132,   0,   0,   0,   1,   0, 
-    168,   8,   4,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,   8,   0,   4,   0, 
-    132,   0,   0,   0,   1,   0, 
-    168,   8,   8,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  12,   0,   4,   0, 
-    132,   0,   0,   0,   1,   0, 
-    168,   8,  12,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  16,   0,   4,   0, 
-    132,   0,   0,   0,   1,   0, 
-    168,   8,  16,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  20,   0,   4,   0, 
-    132,   0,   0,   0,   1,   0, 
-    168,   8,  20,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  24,   0,   4,   0, 
-    132,   0,   0,   0,   1,   0, 
-    168,   8,  32,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  28,   0,   4,   0, 
-    132,   0,   0,   0,   1,   0, 
-    168,   8,  36,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  32,   0,   4,   0, 
-    132,   0,   0,   0,   1,   0, 
-    168,   8,  40,   0,   0,   0, 
-     22,   0,  80,  17,   1,   0, 
-      5,   0,  36,   0,   4,   0, 
-    132,   0,   0,   0,   1,   0, 
-    168,   8,  44,   0,   0,   0, 
-     58,   0,  62,  17,   5,  16, 
-      0,   0, 136,   0,  60, 109, 
-     97, 105, 110,  32, 114, 101, 
-    116, 117, 114, 110,  32, 118, 
-     97, 108, 117, 101,  62,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,   0,   0,   4,   0, 
-    132,   0,   0,   0,   1,   0, 
-    168,   8,   0,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,   4,   0,   4,   0, 
-    132,   0,   0,   0,   1,   0, 
-    168,   8,   4,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,   8,   0,   4,   0, 
-    132,   0,   0,   0,   1,   0, 
-    168,   8,   8,   0,   0,   0, 
-     22,   0,  80,  17,   2,   0, 
-      5,   0,  12,   0,   4,   0, 
-    132,   0,   0,   0,   1,   0, 
-    168,   8,  12,   0,   0,   0, 
-     46,   0,  62,  17,   0,  16, 
-      0,   0,   8,   0,  79, 117, 
-    116, 112, 117, 116,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    140,   8,   0,   0,   1,   0, 
-    160,   0,  12,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    168,   8,   0,   0,   1,   0, 
-    132,   0,  16,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    196,   8,   0,   0,   1,   0, 
-    104,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,  12,   0,   4,   0, 
-    216,   8,   0,   0,   1,   0, 
-     84,   0,   4,   0,   0,   0, 
-     46,   0,  62,  17,   8,  16, 
-      0,   0,   8,   0, 111, 102, 
-    102, 115, 101, 116,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-    204,   7,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-    204,   7,   4,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    164,   0,   0,   0,   1,   0, 
-    204,   7,   8,   0,   0,   0, 
-     46,   0,  62,  17,   8,  16, 
-      0,   0,   8,   0,  82,  99, 
-    111, 101, 102, 102,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    196,   0,   0,   0,   1,   0, 
-    228,   7,  16,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    196,   0,   0,   0,   1,   0, 
-    104,   8,  20,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    196,   0,   0,   0,   1,   0, 
-    104,   8,  24,   0,   0,   0, 
-     46,   0,  62,  17,   8,  16, 
-      0,   0,   8,   0,  71,  99, 
-    111, 101, 102, 102,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-    228,   0,   0,   0,   1,   0, 
-     72,   8,  32,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-    228,   0,   0,   0,   1,   0, 
-     72,   8,  36,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    228,   0,   0,   0,   1,   0, 
-     72,   8,  40,   0,   0,   0, 
-     46,   0,  62,  17,   8,  16, 
-      0,   0,   8,   0,  66,  99, 
-    111, 101, 102, 102,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   0,   0,   4,   0, 
-      4,   1,   0,   0,   1,   0, 
-     40,   8,  48,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   4,   0,   4,   0, 
-      4,   1,   0,   0,   1,   0, 
-     40,   8,  52,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-      4,   1,   0,   0,   1,   0, 
-     40,   8,  56,   0,   0,   0, 
-     42,   0,  62,  17,   9,  16, 
-      0,   0,   8,   0, 112, 111, 
-    115,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   0,   0, 
-      4,   0,  56,   1,   0,   0, 
-      1,   0,  40,   6,  64,   0, 
-      0,   0,  22,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  56,   1,   0,   0, 
-      1,   0,  60,   6,  68,   0, 
-      0,   0,  46,   0,  62,  17, 
-      7,  16,   0,   0,   8,   0, 
-    121, 117, 118,  52,  52,  52, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  38,   0,  80,  17, 
-      0,   0,   5,   0,   4,   0, 
-      4,   0,  76,   1,   0,   0, 
-      1,   0,  36,   7,  76,   1, 
-     20,   0,  60,   2,  20,   0, 
-     68,   4,  20,   0,  76,   6, 
-     20,   0,  84,   0,   0,   0, 
-     38,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-     76,   1,   0,   0,   1,   0, 
-     36,   7,  76,   1,  20,   0, 
-    212,   2,  20,   0, 220,   4, 
-     20,   0, 228,   6,  20,   0, 
-     88,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 132,   1, 
-      0,   0,   1,   0, 236,   6, 
-     80,   0,   0,   0,  30,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 152,   2, 
-      0,   0,   1,   0,  12,   3, 
-     20,   0, 220,   0,   4,   1, 
-    244,   1,  96,   0,   0,   0, 
-     22,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-    152,   2,   0,   0,   1,   0, 
-     20,   0, 100,   0,   0,   0, 
-     26,   0,  80,  17,   0,   0, 
-      5,   0,   8,   0,   4,   0, 
-     32,   4,   0,   0,   1,   0, 
-     28,   2,  20,   0, 244,   1, 
-     96,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 152,   7, 
-      0,   0,   1,   0,  20,   0, 
-     68,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0,  48,   8, 
-      0,   0,   1,   0,  20,   0, 
-     68,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      0,   0,   4,   0, 112,   8, 
-      0,   0,   1,   0,  84,   0, 
-      0,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      4,   0,   4,   0, 112,   8, 
-      0,   0,   1,   0, 104,   0, 
-      4,   0,   0,   0,  22,   0, 
-     80,  17,   0,   0,   5,   0, 
-      8,   0,   4,   0, 112,   8, 
-      0,   0,   1,   0, 188,   0, 
-      8,   0,   0,   0,   2,   0, 
-      6,   0, 244,   0,   0,   0, 
-     24,   0,   0,   0,   1,   0, 
-      0,   0,  16,   1, 121, 179, 
-    113, 107, 233,  20, 173, 133, 
-     50,  77, 151,  74, 143, 117, 
-    172,  65,   0,   0, 242,   0, 
-      0,   0,  24,   9,   0,   0, 
-      0,   0,   0,   0,   1,   0, 
-      1,   0,  44,   9,   0,   0, 
-      0,   0,   0,   0, 192,   0, 
-      0,   0,  12,   9,   0,   0, 
-    132,   0,   0,   0,  25,   0, 
-      0, 128, 132,   0,   0,   0, 
-     25,   0,   0,   0, 164,   0, 
-      0,   0,  26,   0,   0, 128, 
-    164,   0,   0,   0,  26,   0, 
-      0,   0, 196,   0,   0,   0, 
-     27,   0,   0, 128, 196,   0, 
-      0,   0,  27,   0,   0,   0, 
-    228,   0,   0,   0,  28,   0, 
-      0, 128, 228,   0,   0,   0, 
-     28,   0,   0,   0,   4,   1, 
-      0,   0,  30,   0,   0, 128, 
-      4,   1,   0,   0,  30,   0, 
-      0,   0,  36,   1,   0,   0, 
-     30,   0,   0, 128,  36,   1, 
-      0,   0,  30,   0,   0,   0, 
-     56,   1,   0,   0,  31,   0, 
-      0, 128,  56,   1,   0,   0, 
-     31,   0,   0,   0,  76,   1, 
-      0,   0,  34,   0,   0, 128, 
-     76,   1,   0,   0,  34,   0, 
-      0,   0, 112,   1,   0,   0, 
-     34,   0,   0, 128, 112,   1, 
-      0,   0,  34,   0,   0,   0, 
-    132,   1,   0,   0,  36,   0, 
-      0, 128, 132,   1,   0,   0, 
-     36,   0,   0,   0, 152,   1, 
-      0,   0,  36,   0,   0, 128, 
-    152,   1,   0,   0,  36,   0, 
-      0,   0, 184,   1,   0,   0, 
-     36,   0,   0, 128, 184,   1, 
-      0,   0,  36,   0,   0,   0, 
-    204,   1,   0,   0,  36,   0, 
-      0, 128, 204,   1,   0,   0, 
-     36,   0,   0,   0, 232,   1, 
-      0,   0,  36,   0,   0, 128, 
-    232,   1,   0,   0,  36,   0, 
-      0,   0, 252,   1,   0,   0, 
-     36,   0,   0, 128, 252,   1, 
-      0,   0,  36,   0,   0,   0, 
-     28,   2,   0,   0,  36,   0, 
-      0, 128,  28,   2,   0,   0, 
-     36,   0,   0,   0,  48,   2, 
-      0,   0,  36,   0,   0, 128, 
-     48,   2,   0,   0,  36,   0, 
-      0,   0,  76,   2,   0,   0, 
-     36,   0,   0, 128,  76,   2, 
-      0,   0,  36,   0,   0,   0, 
-    104,   2,   0,   0,  36,   0, 
-      0, 128, 104,   2,   0,   0, 
-     36,   0,   0,   0, 116,   2, 
-      0,   0,  39,   0,   0, 128, 
-    116,   2,   0,   0,  39,   0, 
-      0,   0, 152,   2,   0,   0, 
-     39,   0,   0, 128, 152,   2, 
-      0,   0,  39,   0,   0,   0, 
-    172,   2,   0,   0,  40,   0, 
-      0, 128, 172,   2,   0,   0, 
-     40,   0,   0,   0, 176,   2, 
-      0,   0,  41,   0,   0, 128, 
-    176,   2,   0,   0,  41,   0, 
-      0,   0, 196,   2,   0,   0, 
-     41,   0,   0, 128, 196,   2, 
-      0,   0,  41,   0,   0,   0, 
-    228,   2,   0,   0,  41,   0, 
-      0, 128, 228,   2,   0,   0, 
-     41,   0,   0,   0, 248,   2, 
-      0,   0,  41,   0,   0, 128, 
-    248,   2,   0,   0,  41,   0, 
-      0,   0,  20,   3,   0,   0, 
-     41,   0,   0, 128,  20,   3, 
-      0,   0,  41,   0,   0,   0, 
-     32,   3,   0,   0,  44,   0, 
-      0, 128,  32,   3,   0,   0, 
-     44,   0,   0,   0,  52,   3, 
-      0,   0,  44,   0,   0, 128, 
-     52,   3,   0,   0,  44,   0, 
-      0,   0,  80,   3,   0,   0, 
-     44,   0,   0, 128,  80,   3, 
-      0,   0,  44,   0,   0,   0, 
-    100,   3,   0,   0,  44,   0, 
-      0, 128, 100,   3,   0,   0, 
-     44,   0,   0,   0, 136,   3, 
-      0,   0,  44,   0,   0, 128, 
-    136,   3,   0,   0,  44,   0, 
-      0,   0, 156,   3,   0,   0, 
-     45,   0,   0, 128, 156,   3, 
-      0,   0,  45,   0,   0,   0, 
-    176,   3,   0,   0,  45,   0, 
-      0, 128, 176,   3,   0,   0, 
-     45,   0,   0,   0, 204,   3, 
-      0,   0,  45,   0,   0, 128, 
-    204,   3,   0,   0,  45,   0, 
-      0,   0, 232,   3,   0,   0, 
-     45,   0,   0, 128, 232,   3, 
-      0,   0,  45,   0,   0,   0, 
-    252,   3,   0,   0,  45,   0, 
-      0, 128, 252,   3,   0,   0, 
-     45,   0,   0,   0,  32,   4, 
-      0,   0,  45,   0,   0, 128, 
-     32,   4,   0,   0,  45,   0, 
-      0,   0,  52,   4,   0,   0, 
-     46,   0,   0, 128,  52,   4, 
-      0,   0,  46,   0,   0,   0, 
-     56,   4,   0,   0,  47,   0, 
-      0, 128,  56,   4,   0,   0, 
-     47,   0,   0,   0,  76,   4, 
-      0,   0,  47,   0,   0, 128, 
-     76,   4,   0,   0,  47,   0, 
-      0,   0, 108,   4,   0,   0, 
-     47,   0,   0, 128, 108,   4, 
-      0,   0,  47,   0,   0,   0, 
-    128,   4,   0,   0,  47,   0, 
-      0, 128, 128,   4,   0,   0, 
-     47,   0,   0,   0, 156,   4, 
-      0,   0,  47,   0,   0, 128, 
-    156,   4,   0,   0,  47,   0, 
-      0,   0, 176,   4,   0,   0, 
-     47,   0,   0, 128, 176,   4, 
-      0,   0,  47,   0,   0,   0, 
-    208,   4,   0,   0,  47,   0, 
-      0, 128, 208,   4,   0,   0, 
-     47,   0,   0,   0, 228,   4, 
-      0,   0,  47,   0,   0, 128, 
-    228,   4,   0,   0,  47,   0, 
-      0,   0,   0,   5,   0,   0, 
-     47,   0,   0, 128,   0,   5, 
-      0,   0,  47,   0,   0,   0, 
-     28,   5,   0,   0,  47,   0, 
-      0, 128,  28,   5,   0,   0, 
-     47,   0,   0,   0,  40,   5, 
-      0,   0,  50,   0,   0, 128, 
-     40,   5,   0,   0,  50,   0, 
-      0,   0,  60,   5,   0,   0, 
-     50,   0,   0, 128,  60,   5, 
-      0,   0,  50,   0,   0,   0, 
-     88,   5,   0,   0,  50,   0, 
-      0, 128,  88,   5,   0,   0, 
-     50,   0,   0,   0, 108,   5, 
-      0,   0,  50,   0,   0, 128, 
-    108,   5,   0,   0,  50,   0, 
-      0,   0, 144,   5,   0,   0, 
-     50,   0,   0, 128, 144,   5, 
-      0,   0,  50,   0,   0,   0, 
-    164,   5,   0,   0,  51,   0, 
-      0, 128, 164,   5,   0,   0, 
-     51,   0,   0,   0, 184,   5, 
-      0,   0,  51,   0,   0, 128, 
-    184,   5,   0,   0,  51,   0, 
-      0,   0, 212,   5,   0,   0, 
-     51,   0,   0, 128, 212,   5, 
-      0,   0,  51,   0,   0,   0, 
-    240,   5,   0,   0,  51,   0, 
-      0, 128, 240,   5,   0,   0, 
-     51,   0,   0,   0,   4,   6, 
-      0,   0,  51,   0,   0, 128, 
-      4,   6,   0,   0,  51,   0, 
-      0,   0,  40,   6,   0,   0, 
-     51,   0,   0, 128,  40,   6, 
-      0,   0,  51,   0,   0,   0, 
-     60,   6,   0,   0,  52,   0, 
-      0, 128,  60,   6,   0,   0, 
-     52,   0,   0,   0,  64,   6, 
-      0,   0,  53,   0,   0, 128, 
-     64,   6,   0,   0,  53,   0, 
-      0,   0,  84,   6,   0,   0, 
-     53,   0,   0, 128,  84,   6, 
-      0,   0,  53,   0,   0,   0, 
-    116,   6,   0,   0,  53,   0, 
-      0, 128, 116,   6,   0,   0, 
-     53,   0,   0,   0, 136,   6, 
-      0,   0,  53,   0,   0, 128, 
-    136,   6,   0,   0,  53,   0, 
-      0,   0, 164,   6,   0,   0, 
-     53,   0,   0, 128, 164,   6, 
-      0,   0,  53,   0,   0,   0, 
-    184,   6,   0,   0,  53,   0, 
-      0, 128, 184,   6,   0,   0, 
-     53,   0,   0,   0, 216,   6, 
-      0,   0,  53,   0,   0, 128, 
-    216,   6,   0,   0,  53,   0, 
-      0,   0, 236,   6,   0,   0, 
-     53,   0,   0, 128, 236,   6, 
-      0,   0,  53,   0,   0,   0, 
-      8,   7,   0,   0,  53,   0, 
-      0, 128,   8,   7,   0,   0, 
-     53,   0,   0,   0,  36,   7, 
-      0,   0,  53,   0,   0, 128, 
-     36,   7,   0,   0,  53,   0, 
-      0,   0,  48,   7,   0,   0, 
-     56,   0,   0, 128,  48,   7, 
-      0,   0,  56,   0,   0,   0, 
-     68,   7,   0,   0,  56,   0, 
-      0, 128,  68,   7,   0,   0, 
-     56,   0,   0,   0,  96,   7, 
-      0,   0,  56,   0,   0, 128, 
-     96,   7,   0,   0,  56,   0, 
-      0,   0, 116,   7,   0,   0, 
-     56,   0,   0, 128, 116,   7, 
-      0,   0,  56,   0,   0,   0, 
-    152,   7,   0,   0,  56,   0, 
-      0, 128, 152,   7,   0,   0, 
-     56,   0,   0,   0, 172,   7, 
-      0,   0,  57,   0,   0, 128, 
-    172,   7,   0,   0,  57,   0, 
-      0,   0, 192,   7,   0,   0, 
-     57,   0,   0, 128, 192,   7, 
-      0,   0,  57,   0,   0,   0, 
-    220,   7,   0,   0,  57,   0, 
-      0, 128, 220,   7,   0,   0, 
-     57,   0,   0,   0, 248,   7, 
-      0,   0,  57,   0,   0, 128, 
-    248,   7,   0,   0,  57,   0, 
-      0,   0,  12,   8,   0,   0, 
-     57,   0,   0, 128,  12,   8, 
-      0,   0,  57,   0,   0,   0, 
-     48,   8,   0,   0,  57,   0, 
-      0, 128,  48,   8,   0,   0, 
-     57,   0,   0,   0,  68,   8, 
-      0,   0,  58,   0,   0, 128, 
-     68,   8,   0,   0,  58,   0, 
-      0,   0,  72,   8,   0,   0, 
-     58,   0,   0, 128,  72,   8, 
-      0,   0,  58,   0,   0,   0, 
-     76,   8,   0,   0,  58,   0, 
-      0, 128,  76,   8,   0,   0, 
-     58,   0,   0,   0,  80,   8, 
-      0,   0,  58,   0,   0, 128, 
-     80,   8,   0,   0,  58,   0, 
-      0,   0,  84,   8,   0,   0, 
-     61,   0,   0, 128,  84,   8, 
-      0,   0,  61,   0,   0,   0, 
-    112,   8,   0,   0,  62,   0, 
-      0, 128, 112,   8,   0,   0, 
-     62,   0,   0,   0, 140,   8, 
-      0,   0,  63,   0,   0, 128, 
-    140,   8,   0,   0,  63,   0, 
-      0,   0, 168,   8,   0,   0, 
-     64,   0,   0, 128, 168,   8, 
-      0,   0,  64,   0,   0,   0, 
-    196,   8,   0,   0,  65,   0, 
-      0, 128, 196,   8,   0,   0, 
-     65,   0,   0,   0, 216,   8, 
-      0,   0,  66,   0,   0, 128, 
-    216,   8,   0,   0,  66,   0, 
-      0,   0, 236,   8,   0,   0, 
-     66,   0,   0, 128, 236,   8, 
-      0,   0,  66,   0,   0,   0, 
-      0,   9,   0,   0,  66,   0, 
-      0, 128,   0,   9,   0,   0, 
-     66,   0,   0,   0,  20,   9, 
-      0,   0,  66,   0,   0, 128, 
-     20,   9,   0,   0,  66,   0, 
-      0,   0,  40,   9,   0,   0, 
-     66,   0,   0, 128,  40,   9, 
-      0,   0,  66,   0,   0,   0, 
-      2,   0,  54,   0,  15,   0, 
-     53,   0,   2,   0,  54,   0, 
-     15,   0,  53,   0,   2,   0, 
-     54,   0,  15,   0,  53,   0, 
-      2,   0,  54,   0,  15,   0, 
-     53,   0,   2,   0,  53,   0, 
-     20,   0,  51,   0,   2,   0, 
-     53,   0,  14,   0,  52,   0, 
-      2,   0,  24,   0,   9,   0, 
-     23,   0,   2,   0,  60,   0, 
-     13,   0,  57,   0,   2,   0, 
-     60,   0,   2,   0,  59,   0, 
-      2,   0,  38,   0,   6,   0, 
-     14,   0,   2,   0,  38,   0, 
-      6,   0,  14,   0,   2,   0, 
-     38,   0,   6,   0,  19,   0, 
-      2,   0,  38,   0,   6,   0, 
-     19,   0,   2,   0,  38,   0, 
-     24,   0,  32,   0,   2,   0, 
-     38,   0,  24,   0,  32,   0, 
-      2,   0,  38,   0,  24,   0, 
-     37,   0,   2,   0,  38,   0, 
-     24,   0,  37,   0,   2,   0, 
-     38,   0,   6,   0,  37,   0, 
-      2,   0,  38,   0,   2,   0, 
-     38,   0,   3,   0,  64,   0, 
-     15,   0,  60,   0,   3,   0, 
-     64,   0,   3,   0,  63,   0, 
-      2,   0,   2,   0,   2,   0, 
-      2,   0,   7,   0,  25,   0, 
-     11,   0,  19,   0,   7,   0, 
-     25,   0,  11,   0,  19,   0, 
-      7,   0,  25,   0,  11,   0, 
-     24,   0,   7,   0,  25,   0, 
-     11,   0,  24,   0,   7,   0, 
-     25,   0,   7,   0,  25,   0, 
-      3,   0,  90,   0,  60,   0, 
-     73,   0,   3,   0,  90,   0, 
-     60,   0,  73,   0,   3,   0, 
-     90,   0,  14,   0,  87,   0, 
-      3,   0,  90,   0,  14,   0, 
-     87,   0,   3,   0,  90,   0, 
-      3,   0,  89,   0,   3,   0, 
-     96,   0,  60,   0,  73,   0, 
-      3,   0,  96,   0,  60,   0, 
-     73,   0,   3,   0,  96,   0, 
-     60,   0,  79,   0,   3,   0, 
-     96,   0,  14,   0,  93,   0, 
-      3,   0,  96,   0,  14,   0, 
-     93,   0,   3,   0,  96,   0, 
-      3,   0,  95,   0,   2,   0, 
-      2,   0,   2,   0,   2,   0, 
-      7,   0,  43,   0,  11,   0, 
-     19,   0,   7,   0,  43,   0, 
-     11,   0,  19,   0,   7,   0, 
-     43,   0,  11,   0,  24,   0, 
-      7,   0,  43,   0,  11,   0, 
-     24,   0,   7,   0,  43,   0, 
-     29,   0,  37,   0,   7,   0, 
-     43,   0,  29,   0,  37,   0, 
-      7,   0,  43,   0,  29,   0, 
-     42,   0,   7,   0,  43,   0, 
-     29,   0,  42,   0,   7,   0, 
-     43,   0,  11,   0,  42,   0, 
-      7,   0,  43,   0,   7,   0, 
-     43,   0,   3,   0,  91,   0, 
-     61,   0,  74,   0,   3,   0, 
-     91,   0,  61,   0,  74,   0, 
-      3,   0,  91,   0,  14,   0, 
-     88,   0,   3,   0,  91,   0, 
-     14,   0,  88,   0,   3,   0, 
-     91,   0,   3,   0,  90,   0, 
-      3,   0,  97,   0,  61,   0, 
-     74,   0,   3,   0,  97,   0, 
-     61,   0,  74,   0,   3,   0, 
-     97,   0,  61,   0,  80,   0, 
-      3,   0,  97,   0,  14,   0, 
-     94,   0,   3,   0,  97,   0, 
-     14,   0,  94,   0,   3,   0, 
-     97,   0,   3,   0,  96,   0, 
-      2,   0,   2,   0,   2,   0, 
-      2,   0,   7,   0,  43,   0, 
-     11,   0,  19,   0,   7,   0, 
-     43,   0,  11,   0,  19,   0, 
-      7,   0,  43,   0,  11,   0, 
-     24,   0,   7,   0,  43,   0, 
-     11,   0,  24,   0,   7,   0, 
-     43,   0,  29,   0,  37,   0, 
-      7,   0,  43,   0,  29,   0, 
-     37,   0,   7,   0,  43,   0, 
-     29,   0,  42,   0,   7,   0, 
-     43,   0,  29,   0,  42,   0, 
-      7,   0,  43,   0,  11,   0, 
-     42,   0,   7,   0,  43,   0, 
-      7,   0,  43,   0,   3,   0, 
-     91,   0,  61,   0,  74,   0, 
-      3,   0,  91,   0,  61,   0, 
-     74,   0,   3,   0,  91,   0, 
-     14,   0,  88,   0,   3,   0, 
-     91,   0,  14,   0,  88,   0, 
-      3,   0,  91,   0,   3,   0, 
-     90,   0,   3,   0,  97,   0, 
-     61,   0,  74,   0,   3,   0, 
-     97,   0,  61,   0,  74,   0, 
-      3,   0,  97,   0,  61,   0, 
-     80,   0,   3,   0,  97,   0, 
-     14,   0,  94,   0,   3,   0, 
-     97,   0,  14,   0,  94,   0, 
-      3,   0,  97,   0,   3,   0, 
-     96,   0,   2,   0,   2,   0, 
-      2,   0,   2,   0,   2,   0, 
-      2,   0,   2,   0,   2,   0, 
-      2,   0,   2,   0,   2,   0, 
-      2,   0,   2,   0,   2,   0, 
-      2,   0,   2,   0,   2,   0, 
-     18,   0,   2,   0,  17,   0, 
-      2,   0,  32,   0,  13,   0, 
-     31,   0,   2,   0,  32,   0, 
-     13,   0,  31,   0,   2,   0, 
-     32,   0,  13,   0,  31,   0, 
-      2,   0,  17,   0,   2,   0, 
-     16,   0,   2,   0,  15,   0, 
-      2,   0,  15,   0,   2,   0, 
-     15,   0,   2,   0,  15,   0, 
-      2,   0,  15,   0,   2,   0, 
-     15,   0,   2,   0,  15,   0, 
-      2,   0,  15,   0,   2,   0, 
-     15,   0,   2,   0,  15,   0, 
-    246,   0,   0,   0,   4,   0, 
-      0,   0,   0,   0,   0,   0, 
-     32,   0,   0,   0,   0,   0, 
-      0,   0,  20,   0,   0,   0, 
-     56,   0,   0,   0,  92,   0, 
-      0,   0, 132,   0,   0,   0, 
-    172,   0,   0,   0, 208,   0, 
-      0,   0, 236,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  11, 202,  49,   1, 
-     56,   0,   0,   0,   0,  16, 
-      0,   0,  18,  16,   0,   0, 
-     84,   1,   0,   0,  10,   0, 
-    255, 255,   4,   0,   0,   0, 
-    255, 255,   3,   0,   0,   0, 
-      0,   0,  72,   0,   0,   0, 
-     72,   0,   0,   0,   8,   0, 
-      0,   0,  80,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-     27,  21,  64,   0,   0,   0, 
-      4,   0,   0,   0,  16,   0, 
-    102, 108, 111,  97, 116,  52, 
-      0, 243, 242, 241,  22,   0, 
-     27,  21,  64,   0,   0,   0, 
-      2,   0,   0,   0,   8,   0, 
-    102, 108, 111,  97, 116,  50, 
-      0, 243, 242, 241,  50,   0, 
-      3,  18,  13,  21,   3,   0, 
-      0,  16,   0,   0,   0,   0, 
-    112, 111, 115,   0, 242, 241, 
-     13,  21,   3,   0,   1,  16, 
-      0,   0,  16,   0, 117, 118, 
-      0, 243, 242, 241,  13,  21, 
-      3,   0,   0,  16,   0,   0, 
-     24,   0,  99, 111, 108, 111, 
-    114,   0,  38,   0,   5,  21, 
-      3,   0,   0,   0,   2,  16, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  40,   0, 
-     80, 105, 120, 101, 108,  83, 
-    104,  97, 100, 101, 114,  73, 
-    110, 112, 117, 116,   0, 241, 
-     10,   0,   1,  18,   1,   0, 
-      0,   0,   3,  16,   0,   0, 
-     10,   0,  24,  21,   0,  16, 
-      0,   0,   1,   0,   1,   0, 
-     14,   0,   8,  16,   5,  16, 
-      0,   0,  23,   0,   1,   0, 
-      4,  16,   0,   0,  22,   0, 
-     27,  21,  64,   0,   0,   0, 
-      3,   0,   0,   0,  12,   0, 
-    102, 108, 111,  97, 116,  51, 
-      0, 243, 242, 241,  10,   0, 
-     24,  21,   7,  16,   0,   0, 
-      1,   0,   1,   0,  18,   0, 
-     27,  21, 117,   0,   0,   0, 
-      2,   0,   0,   0,   8,   0, 
-    117, 105, 110, 116,  50,   0, 
-     14,   0,  23,  21,   0,  16, 
-      0,   0,   3,   2, 128,   0, 
-      0,   0, 242, 241,  10,   0, 
-     24,  21,  10,  16,   0,   0, 
-      1,   0,   1,   0,  10,   0, 
-     24,  21,  11,  16,   0,   0, 
-      1,   0,   0,   2,  14,   0, 
-     23,  21,   0,   0,   0,   0, 
-     10,   2, 128,   0,   0,   0, 
-    242, 241,  10,   0,  24,  21, 
-     13,  16,   0,   0,   1,   0, 
-      1,   0,  10,   0,  24,  21, 
-     14,  16,   0,   0,   1,   0, 
-      0,   2,  10,   0,  24,  21, 
-     64,   0,   0,   0,   1,   0, 
-      1,   0,  10,   0,  24,  21, 
-     16,  16,   0,   0,   1,   0, 
-      0,   2,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  11, 202, 
-     49,   1,  56,   0,   0,   0, 
-      0,  16,   0,   0,   0,  16, 
-      0,   0,   0,   0,   0,   0, 
-     11,   0, 255, 255,   4,   0, 
-      0,   0, 255, 255,   3,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    116, 117, 114, 101,  46,  83, 
-     97, 109, 112, 108, 101,  40, 
-     80, 111, 105, 110, 116,  83, 
-     97, 109, 112, 108, 101, 114, 
-     44,  32, 105, 110, 112, 117, 
-    116,  46, 117, 118,  41,  46, 
-    114,  59,  13,  10,  13,  10, 
-      9, 105, 102,  32,  40, 112, 
-    111, 115,  46, 120,  32,  37, 
-     32,  50,  32,  61,  61,  32, 
-     48,  32,  38,  38,  32, 112, 
-    111, 115,  46, 121,  32,  37, 
-     32,  50,  32,  61,  61,  32, 
-     48,  41,  13,  10,   9, 123, 
-     13,  10,   9,   9,  47,  47, 
-     32,  66,  50,  32,  66,  51, 
-     13,  10,   9,   9, 121, 117, 
-    118,  52,  52,  52,  46, 103, 
-     98,  32,  61,  32,  89,  85, 
-     86,  52,  50,  48,  85,  86, 
-     84, 101, 120, 116, 117, 114, 
-    101,  46,  83,  97, 109, 112, 
-    108, 101,  40,  80, 111, 105, 
-    110, 116,  83,  97, 109, 112, 
-    108, 101, 114,  44,  32, 105, 
-    110, 112, 117, 116,  46, 117, 
-    118,  41,  46, 114, 103,  59, 
-     13,  10,   9, 125,  13,  10, 
-      9, 101, 108, 115, 101,  32, 
-    105, 102,  32,  40, 112, 111, 
-    115,  46, 120,  32,  37,  32, 
-     50,  32,  61,  61,  32,  49, 
-     41,  13,  10,   9, 123,  13, 
-     10,   9,   9,  47,  47,  32, 
-     66,  52,  32,  66,  53,  13, 
-     10,   9,   9, 121, 117, 118, 
-     52,  52,  52,  46, 103,  32, 
-     61,  32,  67, 104, 114, 111, 
-    109,  97,  52,  50,  48,  89, 
-     84, 101, 120, 116, 117, 114, 
-    101,  46,  83,  97, 109, 112, 
-    108, 101,  40,  80, 111, 105, 
-    110, 116,  83,  97, 109, 112, 
-    108, 101, 114,  44,  32, 102, 
-    108, 111,  97, 116,  50,  40, 
-    105, 110, 112, 117, 116,  46, 
-    117, 118,  46, 120,  32,  47, 
-     32,  50,  44,  32, 105, 110, 
-    112, 117, 116,  46, 117, 118, 
-     46, 121,  41,  41,  46, 114, 
-     59,  13,  10,   9,   9, 121, 
-    117, 118,  52,  52,  52,  46, 
-     98,  32,  61,  32,  67, 104, 
-    114, 111, 109,  97,  52,  50, 
-     48,  89,  84, 101, 120, 116, 
-    117, 114, 101,  46,  83,  97, 
-    109, 112, 108, 101,  40,  80, 
-    111, 105, 110, 116,  83,  97, 
-    109, 112, 108, 101, 114,  44, 
-     32, 102, 108, 111,  97, 116, 
-     50,  40, 105, 110, 112, 117, 
-    116,  46, 117, 118,  46, 120, 
-     32,  47,  32,  50,  32,  43, 
-     32,  48,  46,  53,  44,  32, 
-    105, 110, 112, 117, 116,  46, 
-    117, 118,  46, 121,  41,  41, 
-     46, 114,  59,  13,  10,   9, 
-    125,  13,  10,   9, 101, 108, 
-    115, 101,  32, 105, 102,  32, 
-     40, 112, 111, 115,  46, 120, 
-     32,  37,  32,  52,  32,  61, 
-     61,  32,  48,  32,  38,  38, 
-     32, 112, 111, 115,  46, 121, 
-     32,  37,  32,  50,  32,  61, 
-     61,  32,  49,  41,  13,  10, 
-      9, 123,  13,  10,   9,   9, 
-     47,  47,  32,  66,  54,  32, 
-     66,  55,  13,  10,   9,   9, 
-    121, 117, 118,  52,  52,  52, 
-     46, 103,  32,  61,  32,  67, 
-    104, 114, 111, 109,  97,  52, 
-     50,  48,  85,  86,  84, 101, 
-    120, 116, 117, 114, 101,  46, 
-     83,  97, 109, 112, 108, 101, 
-     40,  80, 111, 105, 110, 116, 
-     83,  97, 109, 112, 108, 101, 
-    114,  44,  32, 102, 108, 111, 
-     97, 116,  50,  40, 105, 110, 
-    112, 117, 116,  46, 117, 118, 
-     46, 120,  32,  47,  32,  50, 
-     44,  32, 105, 110, 112, 117, 
-    116,  46, 117, 118,  46, 121, 
-     41,  41,  46, 114,  59,  13, 
-     10,   9,   9, 121, 117, 118, 
-     52,  52,  52,  46,  98,  32, 
-     61,  32,  67, 104, 114, 111, 
-    109,  97,  52,  50,  48,  85, 
-     86,  84, 101, 120, 116, 117, 
-    114, 101,  46,  83,  97, 109, 
-    112, 108, 101,  40,  80, 111, 
-    105, 110, 116,  83,  97, 109, 
-    112, 108, 101, 114,  44,  32, 
-    102, 108, 111,  97, 116,  50, 
-     40, 105, 110, 112, 117, 116, 
-     46, 117, 118,  46, 120,  32, 
-     47,  32,  50,  32,  43,  32, 
-     48,  46,  53,  44,  32, 105, 
-    110, 112, 117, 116,  46, 117, 
-    118,  46, 121,  41,  41,  46, 
-    114,  59,  13,  10,   9, 125, 
-     13,  10,   9, 101, 108, 115, 
-    101,  32, 105, 102,  32,  40, 
-    112, 111, 115,  46, 120,  32, 
-     37,  32,  52,  32,  61,  61, 
-     32,  50,  32,  38,  38,  32, 
-    112, 111, 115,  46, 121,  32, 
-     37,  32,  50,  32,  61,  61, 
-     32,  49,  41,  13,  10,   9, 
-    123,  13,  10,   9,   9,  47, 
-     47,  32,  66,  56,  32,  66, 
-     57,  13,  10,   9,   9, 121, 
-    117, 118,  52,  52,  52,  46, 
-    103,  32,  61,  32,  67, 104, 
-    114, 111, 109,  97,  52,  50, 
-     48,  85,  86,  84, 101, 120, 
-    116, 117, 114, 101,  46,  83, 
-     97, 109, 112, 108, 101,  40, 
-     80, 111, 105, 110, 116,  83, 
-     97, 109, 112, 108, 101, 114, 
-     44,  32, 102, 108, 111,  97, 
-    116,  50,  40, 105, 110, 112, 
-    117, 116,  46, 117, 118,  46, 
-    120,  32,  47,  32,  50,  44, 
-     32, 105, 110, 112, 117, 116, 
-     46, 117, 118,  46, 121,  41, 
-     41,  46, 103,  59,  13,  10, 
-      9,   9, 121, 117, 118,  52, 
-     52,  52,  46,  98,  32,  61, 
-     32,  67, 104, 114, 111, 109, 
-     97,  52,  50,  48,  85,  86, 
-     84, 101, 120, 116, 117, 114, 
-    101,  46,  83,  97, 109, 112, 
-    108, 101,  40,  80, 111, 105, 
-    110, 116,  83,  97, 109, 112, 
-    108, 101, 114,  44,  32, 102, 
-    108, 111,  97, 116,  50,  40, 
-    105, 110, 112, 117, 116,  46, 
-    117, 118,  46, 120,  32,  47, 
-     32,  50,  32,  43,  32,  48, 
-     46,  53,  44,  32, 105, 110, 
-    112, 117, 116,  46, 117, 118, 
-     46, 121,  41,  41,  46, 103, 
-     59,  13,  10,   9, 125,  13, 
-     10,  13,  10,   9,  47,  47, 
-     32, 121, 117, 118,  32, 116, 
-    111,  32, 114, 103,  98,  13, 
-     10,   9, 121, 117, 118,  52, 
-     52,  52,  32,  43,  61,  32, 
-    111, 102, 102, 115, 101, 116, 
-     59,  13,  10,   9,  79, 117, 
-    116, 112, 117, 116,  46, 114, 
-     32,  61,  32, 100, 111, 116, 
-     40, 121, 117, 118,  52,  52, 
-     52,  44,  32,  82,  99, 111, 
-    101, 102, 102,  41,  59,  13, 
-     10,   9,  79, 117, 116, 112, 
-    117, 116,  46, 103,  32,  61, 
-     32, 100, 111, 116,  40, 121, 
-    117, 118,  52,  52,  52,  44, 
-     32,  71,  99, 111, 101, 102, 
-    102,  41,  59,  13,  10,   9, 
-     79, 117, 116, 112, 117, 116, 
-     46,  98,  32,  61,  32, 100, 
-    111, 116,  40, 121, 117, 118, 
-     52,  52,  52,  44,  32,  66, 
-     99, 111, 101, 102, 102,  41, 
-     59,  13,  10,   9,  79, 117, 
-    116, 112, 117, 116,  46,  97, 
-     32,  61,  32,  49,  46,  48, 
-    102,  59,  13,  10,   9, 114, 
-    101, 116, 117, 114, 110,  32, 
-     79, 117, 116, 112, 117, 116, 
-     59,  13,  10, 125,   0,   7, 
-      0,   0,   0,   0,   0,   0, 
-      0,  88,   0,   0,   0,   1, 
-      0,   0,   0,  89,   0,   0, 
-      0, 176,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   4,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     68,  51,  68,  83,  72,  68, 
-     82,   0,  44,   9,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     32,   0,   0,  96,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0, 255, 255, 255, 255, 
-     26,   9,  47, 241,  64,   0, 
-      0,   0,  36,   2,   0,   0, 
-    133,   0,   0,   0,   1,   0, 
-      0,   0, 209,   0,   0,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   1,   0,   0,   0, 
-     21,   0,   0,   0,   1,   0, 
-      0,   0,  93,   0,   0,   0, 
-      1,   0,   0,   0,  57,   0, 
-      0,   0,   1,   0,   0,   0, 
-    237,   0,   0,   0,   1,   0, 
-      0,   0, 173,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,  64,   0,   1,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     32,   0,   0,   0,   0,   0, 
-      0,   0,   0,  64,   0,   0, 
-      0,   0,   0,   0,   0,  32, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,  16,   0,   0, 
-      0,   0,   8,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   2,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  12,   0,   0,   0, 
-     24,   0,   0,   0,  36,   0, 
-      0,   0,  48,   0,   0,   0, 
-     60,   0,   0,   0,  72,   0, 
-      0,   0,  84,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-     18,   0,  37,  17,   0,   0, 
-      0,   0, 128,   0,   0,   0, 
-      1,   0, 109,  97, 105, 110, 
-      0,   0,  34,   0,  81,  17, 
-     12,  16,   0,   0,   7,   0, 
-    255, 255, 255, 255,   0,   0, 
-    255, 255, 255, 255,  89,  85, 
-     86,  52,  50,  48,  89,  84, 
-    101, 120, 116, 117, 114, 101, 
-      0,   0,  34,   0,  81,  17, 
-     12,  16,   0,   0,   7,   0, 
-    255, 255, 255, 255,   1,   0, 
-    255, 255, 255, 255,  89,  85, 
-     86,  52,  50,  48,  85,  86, 
-     84, 101, 120, 116, 117, 114, 
-    101,   0,  38,   0,  81,  17, 
-     12,  16,   0,   0,   7,   0, 
-    255, 255, 255, 255,   2,   0, 
-    255, 255, 255, 255,  67, 104, 
-    114, 111, 109,  97,  52,  50, 
-     48,  89,  84, 101, 120, 116, 
-    117, 114, 101,   0,   0,   0, 
-     38,   0,  81,  17,  12,  16, 
-      0,   0,   7,   0, 255, 255, 
-    255, 255,   3,   0, 255, 255, 
-    255, 255,  67, 104, 114, 111, 
-    109,  97,  52,  50,  48,  85, 
-     86,  84, 101, 120, 116, 117, 
-    114, 101,   0,   0,  34,   0, 
-     81,  17,  15,  16,   0,   0, 
-      6,   0, 255, 255, 255, 255, 
-    255, 255,   0,   0, 255, 255, 
-     80, 111, 105, 110, 116,  83, 
-     97, 109, 112, 108, 101, 114, 
-      0,   0,   0,   0,  26,   0, 
-     81,  17,  17,  16,   0,   0, 
-      8,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255, 255, 255, 
-    119, 105, 100, 116, 104,   0, 
-      0,   0,  26,   0,  81,  17, 
-     17,  16,   0,   0,   8,   0, 
-      0,   0,   4,   0, 255, 255, 
-    255, 255, 255, 255, 104, 101, 
-    105, 103, 104, 116,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  16,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    255, 255, 255, 255,  26,   9, 
-     47, 241,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255, 119,   9,  49,   1, 
-      1,   0,   0,   0,  13,   0, 
-      0, 142,  14,   0,  63,  92, 
-     15,   0,   0,   0,  76,   0, 
-      0,   0,  32,   0,   0,   0, 
-     44,   0,   0,   0, 100,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  22,   0, 
-      0,   0,  25,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      1,   0,   0,   0,   0,   0, 
-      0,   0,  44,   9,   0,   0, 
-     32,   0,   0,  96,   0,   0, 
-    237, 237,   0,   0,   0,   0, 
-      0,   0,   0,   0,   2,   0, 
-      9,   0, 156,   6,   0,   0, 
-      0,   0,   0,   0,  76,   9, 
-      0,   0,   1,   0,   0,   0, 
-    248, 237, 177,   2,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    109,  97, 105, 110,   0, 110, 
-    111, 110, 101,   0,   0,   0, 
-     45, 186,  46, 241,   1,   0, 
-      0,   0,   0,   0,   0,   0, 
-     44,   9,   0,   0,  32,   0, 
-      0,  96,   0,   0, 237, 237, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   2,   0,   2,   0, 
-      7,   0,   0,   0,   0,   0, 
-      1,   0, 255, 255, 255, 255, 
-      0,   0,   0,   0,  44,   9, 
-      0,   0,   8,   2,   0,   0, 
-      0,   0,   0,   0, 255, 255, 
-    255, 255,   0,   0,   0,   0, 
-    255, 255, 255, 255,   1,   0, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   0,   0,  68,  58, 
-     92, 119, 111, 114, 107,  92, 
-    115, 104,  97, 114, 101,  92, 
-    112, 104, 122,  92, 118, 105, 
-    100, 101, 111,  45, 114, 101, 
-    110, 100, 101, 114, 101, 114, 
-     92, 115, 114,  99,  92, 118, 
-    105, 100, 101, 111,  45, 114, 
-    101, 110, 100, 101, 114, 101, 
-    114,  92, 115, 104,  97, 100, 
-    101, 114,  92, 100,  51, 100, 
-     49,  49,  92, 100,  51, 100, 
-     49,  49,  95, 121, 117, 118, 
-     95, 116, 111,  95, 114, 103, 
-     98,  46, 104, 108, 115, 108, 
-      0,   0, 254, 239, 254, 239, 
-      1,   0,   0,   0,   1,   0, 
-      0,   0,   0,   1,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255,  12,   0, 255, 255, 255, 
-    255, 255, 255, 255, 255, 255, 
-    255,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-    148,  46,  49,   1, 209, 166, 
-     49,  98,   1,   0,   0,   0, 
-     96, 210,  98, 137, 134,  16, 
-      3,  77, 163, 252, 140, 199, 
-     50,  19, 237, 237, 132,   0, 
-      0,   0,  47,  76, 105, 110, 
-    107,  73, 110, 102, 111,   0, 
-     47, 110,  97, 109, 101, 115, 
-      0,  47, 115, 114,  99,  47, 
-    104, 101,  97, 100, 101, 114, 
-     98, 108, 111,  99, 107,   0, 
-     47, 115, 114,  99,  47, 102, 
-    105, 108, 101, 115,  47, 100, 
-     58,  92, 119, 111, 114, 107, 
-     92, 115, 104,  97, 114, 101, 
-     92, 112, 104, 122,  92, 118, 
-    105, 100, 101, 111,  45, 114, 
-    101, 110, 100, 101, 114, 101, 
-    114,  92, 115, 114,  99,  92, 
-    118, 105, 100, 101, 111,  45, 
-    114, 101, 110, 100, 101, 114, 
-    101, 114,  92, 115, 104,  97, 
-    100, 101, 114,  92, 100,  51, 
-    100,  49,  49,  92, 100,  51, 
-    100,  49,  49,  95, 121, 117, 
-    118,  95, 116, 111,  95, 114, 
-    103,  98,  46, 104, 108, 115, 
-    108,   0,   4,   0,   0,   0, 
-      6,   0,   0,   0,   1,   0, 
-      0,   0,  58,   0,   0,   0, 
-      0,   0,   0,   0,  17,   0, 
-      0,   0,   7,   0,   0,   0, 
-     10,   0,   0,   0,   6,   0, 
-      0,   0,   0,   0,   0,   0, 
-      5,   0,   0,   0,  34,   0, 
-      0,   0,   8,   0,   0,   0, 
-      0,   0,   0,   0, 220,  81, 
-     51,   1,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,  16,   0,   0,   0, 
-     32,   0,   0,   0, 224,   0, 
-      0,   0, 140,   1,   0,   0, 
-    107,   1,   0,   0,  56,   0, 
-      0,   0,   0,   0,   0,   0, 
-    109,   8,   0,   0, 128,   0, 
-      0,   0, 140,   7,   0,   0, 
-     12,  16,   0,   0,  80,   0, 
-      0,   0,   0,   0,   0,   0, 
-     40,   0,   0,   0, 116,   2, 
-      0,   0,  44,   0,   0,   0, 
-      8,   1,   0,   0,   3,   0, 
-      0,   0,  34,   0,   0,   0, 
-     23,   0,   0,   0,  33,   0, 
-      0,   0,  24,   0,   0,   0, 
-     12,   0,   0,   0,   6,   0, 
-      0,   0,  25,   0,   0,   0, 
-     26,   0,   0,   0,  27,   0, 
-      0,   0,  13,   0,   0,   0, 
-      8,   0,   0,   0,   9,   0, 
-      0,   0,  10,   0,   0,   0, 
-     11,   0,   0,   0,  14,   0, 
-      0,   0,  15,   0,   0,   0, 
-     16,   0,   0,   0,  17,   0, 
-      0,   0,  18,   0,   0,   0, 
-     19,   0,   0,   0,  20,   0, 
-      0,   0,  21,   0,   0,   0, 
-     22,   0,   0,   0,   7,   0, 
-      0,   0,  28,   0,   0,   0, 
-     29,   0,   0,   0,  30,   0, 
-      0,   0,  32,   0,   0,   0, 
-     31,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,  35,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0,   0,   0, 
-      0,   0,   0,   0
-};
@@ -1,5 +1,11 @@
 // SDL shader, https://github.com/libsdl-org/SDL/blob/main/src/render/direct3d/SDL_shaders_d3d.c
 
+// YUVShaderConstants from color_matrix.h
+float4 Offset : register(c0);
+float4 Rcoeff : register(c1);
+float4 Gcoeff : register(c2);
+float4 Bcoeff : register(c3);
+
 texture YTexture;
 texture UTexture;
 texture VTexture;
@@ -43,11 +49,6 @@ struct PixelShaderInput
 
 float4 main(PixelShaderInput input) : COLOR
 {
-    const float3 offset = {-0.0627451017, -0.501960814, -0.501960814};
-    const float3 Rcoeff = {1.1644,  0.0000,  1.7927};
-    const float3 Gcoeff = {1.1644, -0.2132, -0.5329};
-    const float3 Bcoeff = {1.1644,  2.1124,  0.0000};
-
     float4 Output;
 
     float3 yuv;
@@ -55,10 +56,10 @@ float4 main(PixelShaderInput input) : COLOR
     yuv.y = tex2D(USampler, input.uv).r;
     yuv.z = tex2D(VSampler, input.uv).r;
 
-    yuv += offset;
-    Output.r = dot(yuv, Rcoeff);
-    Output.g = dot(yuv, Gcoeff);
-    Output.b = dot(yuv, Bcoeff);
+    yuv += Offset.xyz;
+    Output.r = dot(yuv, Rcoeff.xyz);
+    Output.g = dot(yuv, Gcoeff.xyz);
+    Output.b = dot(yuv, Bcoeff.xyz);
     Output.a = 1.0f;
 
     return Output;
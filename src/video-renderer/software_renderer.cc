@@ -0,0 +1,239 @@
+#include "software_renderer.h"
+#include "cpu_color_converter.h"
+#include "cpu_sharpen.h"
+#include "plane_copy.h"
+#include "log.h"
+
+#include <chrono>
+#include <cstring>
+
+using namespace DX;
+
+SoftwareRenderer::SoftwareRenderer()
+	: buffer_pool_(0)
+{
+
+}
+
+SoftwareRenderer::~SoftwareRenderer()
+{
+	Destroy();
+}
+
+bool SoftwareRenderer::Init(HWND /*hwnd*/)
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+
+	is_initialized_ = true;
+	return true;
+}
+
+void SoftwareRenderer::Destroy()
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+
+	buffer_ = PixelFrame();
+	width_ = 0;
+	height_ = 0;
+	pitch_ = 0;
+	format_ = PIXEL_FORMAT_UNKNOW;
+	is_initialized_ = false;
+}
+
+bool SoftwareRenderer::Resize()
+{
+	// The output surface always follows the frame size.
+	return true;
+}
+
+void SoftwareRenderer::Render(PixelFrame* frame)
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+
+	if (!is_initialized_) {
+		return;
+	}
+
+	if (width_ != frame->width || height_ != frame->height) {
+		if (!CreateBuffer(frame->width, frame->height)) {
+			return;
+		}
+	}
+
+	auto start_time = std::chrono::steady_clock::now();
+
+	Copy(frame);
+
+	auto end_time = std::chrono::steady_clock::now();
+	double elapsed_ms = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+
+	uint64_t pixels = 0;
+	for (auto& rect : dirty_rects_) {
+		pixels += static_cast<uint64_t>(rect.right - rect.left) * (rect.bottom - rect.top);
+	}
+
+	stats_.last_pixels = pixels;
+	stats_.total_pixels += pixels;
+	stats_.frame_count += 1;
+	stats_.last_ms = elapsed_ms;
+	stats_.average_ms += (elapsed_ms - stats_.average_ms) / static_cast<double>(stats_.frame_count);
+	if (elapsed_ms > stats_.max_ms) {
+		stats_.max_ms = elapsed_ms;
+	}
+}
+
+void SoftwareRenderer::SetSharpen(float unsharp)
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+
+	unsharp = unsharp < 0.0f ? 0.0f : (unsharp > 10.0f ? 10.0f : unsharp);
+	if (unsharp_ != unsharp) {
+		unsharp_ = unsharp;
+		is_sharpen_changed_ = true;
+	}
+}
+
+const uint8_t* SoftwareRenderer::GetBuffer()
+{
+	return buffer_.plane[0];
+}
+
+int SoftwareRenderer::GetPitch()
+{
+	return pitch_;
+}
+
+int SoftwareRenderer::GetWidth()
+{
+	return width_;
+}
+
+int SoftwareRenderer::GetHeight()
+{
+	return height_;
+}
+
+SoftwareRenderStats SoftwareRenderer::GetStats()
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+	return stats_;
+}
+
+uint64_t SoftwareRenderer::GetPixelsTouched()
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+	return stats_.last_pixels;
+}
+
+uint64_t SoftwareRenderer::GetBytesHeld()
+{
+	std::lock_guard<std::mutex> locker(mutex_);
+	return buffer_.storage ? static_cast<uint64_t>(pitch_) * height_ : 0;
+}
+
+bool SoftwareRenderer::CreateBuffer(int width, int height)
+{
+	if (width <= 0 || height <= 0) {
+		LOG("Invalid frame size, %dx%d", width, height);
+		return false;
+	}
+
+	buffer_ = PixelFrame();
+	if (!buffer_pool_.Alloc(width, height, PIXEL_FORMAT_ARGB, &buffer_)) {
+		width_ = height_ = pitch_ = 0;
+		return false;
+	}
+
+	pitch_ = buffer_.pitch[0];
+	memset(buffer_.plane[0], 0, static_cast<size_t>(pitch_) * height);
+	width_ = width;
+	height_ = height;
+	format_ = PIXEL_FORMAT_UNKNOW;
+	return true;
+}
+
+void SoftwareRenderer::Copy(PixelFrame* frame)
+{
+	// Nothing to keep after the buffer was (re)created or the format or colors changed.
+	bool is_color_changed = color_matrix_ != frame->color_matrix || color_range_ != frame->color_range;
+	GetDirtyRects(frame, format_ != frame->format || is_sharpen_changed_ || is_color_changed, dirty_rects_);
+	format_ = frame->format;
+	color_matrix_ = frame->color_matrix;
+	color_range_ = frame->color_range;
+	is_sharpen_changed_ = false;
+
+	if (unsharp_ > 0.0f) {
+		// Sharpened pixels depend on their neighbours up to two pixels away.
+		for (auto& rect : dirty_rects_) {
+			rect.left = rect.left > 2 ? rect.left - 2 : 0;
+			rect.top = rect.top > 2 ? rect.top - 2 : 0;
+			rect.right = rect.right + 2 < width_ ? rect.right + 2 : width_;
+			rect.bottom = rect.bottom + 2 < height_ ? rect.bottom + 2 : height_;
+			ConvertAndSharpen(frame, rect, unsharp_, buffer_.plane[0], pitch_);
+		}
+		return;
+	}
+
+	for (auto& rect : dirty_rects_) {
+		CopyRect(frame, rect);
+	}
+}
+
+void SoftwareRenderer::CopyRect(PixelFrame* frame, const PixelRect& rect)
+{
+	int x = rect.left;
+	int y = rect.top;
+	int width = rect.right - rect.left;
+	int height = rect.bottom - rect.top;
+	uint8_t* dst_data = buffer_.plane[0] + y * pitch_ + x * 4;
+
+	if (frame->format == PIXEL_FORMAT_ARGB) {
+		CopyPlane(dst_data, pitch_, frame->plane[0] + y * frame->pitch[0] + x * 4, frame->pitch[0], width * 4, height);
+	}
+	else if (frame->format == PIXEL_FORMAT_I420) {
+		I420ToBGRA(frame->plane[0] + y * frame->pitch[0] + x, frame->pitch[0],
+			frame->plane[1] + (y / 2) * frame->pitch[1] + x / 2, frame->pitch[1],
+			frame->plane[2] + (y / 2) * frame->pitch[2] + x / 2, frame->pitch[2],
+			dst_data, pitch_, width, height, frame->color_matrix, frame->color_range);
+	}
+	else if (frame->format == PIXEL_FORMAT_I444) {
+		I444ToBGRA(frame->plane[0] + y * frame->pitch[0] + x, frame->pitch[0],
+			frame->plane[1] + y * frame->pitch[1] + x, frame->pitch[1],
+			frame->plane[2] + y * frame->pitch[2] + x, frame->pitch[2],
+			dst_data, pitch_, width, height, frame->color_matrix, frame->color_range);
+	}
+	else if (frame->format == PIXEL_FORMAT_NV12) {
+		NV12ToBGRA(frame->plane[0] + y * frame->pitch[0] + x, frame->pitch[0],
+			frame->plane[1] + (y / 2) * frame->pitch[1] + x, frame->pitch[1],
+			dst_data, pitch_, width, height, frame->color_matrix, frame->color_range);
+	}
+	else if (frame->format == PIXEL_FORMAT_P010) {
+		P010ToBGRA(frame->plane[0] + y * frame->pitch[0] + x * 2, frame->pitch[0],
+			frame->plane[1] + (y / 2) * frame->pitch[1] + x * 2, frame->pitch[1],
+			dst_data, pitch_, width, height, frame->color_matrix, frame->color_range);
+	}
+	else if (frame->format == PIXEL_FORMAT_I010) {
+		I010ToBGRA(frame->plane[0] + y * frame->pitch[0] + x * 2, frame->pitch[0],
+			frame->plane[1] + (y / 2) * frame->pitch[1] + x, frame->pitch[1],
+			frame->plane[2] + (y / 2) * frame->pitch[2] + x, frame->pitch[2],
+			dst_data, pitch_, width, height, frame->color_matrix, frame->color_range);
+	}
+	else if (frame->format == PIXEL_FORMAT_YUY2) {
+		YUY2ToBGRA(frame->plane[0] + y * frame->pitch[0] + x * 2, frame->pitch[0], dst_data, pitch_, width, height, frame->color_matrix, frame->color_range);
+	}
+	else if (frame->format == PIXEL_FORMAT_UYVY) {
+		UYVYToBGRA(frame->plane[0] + y * frame->pitch[0] + x * 2, frame->pitch[0], dst_data, pitch_, width, height, frame->color_matrix, frame->color_range);
+	}
+	else if (frame->format == PIXEL_FORMAT_I422) {
+		I422ToBGRA(frame->plane[0] + y * frame->pitch[0] + x, frame->pitch[0],
+			frame->plane[1] + y * frame->pitch[1] + x / 2, frame->pitch[1],
+			frame->plane[2] + y * frame->pitch[2] + x / 2, frame->pitch[2],
+			dst_data, pitch_, width, height, frame->color_matrix, frame->color_range);
+	}
+	else if (frame->format == PIXEL_FORMAT_RGB24) {
+		RGB24ToBGRA(frame->plane[0] + y * frame->pitch[0] + x * 3, frame->pitch[0], dst_data, pitch_, width, height);
+	}
+	else if (frame->format == PIXEL_FORMAT_RGBA) {
+		RGBAToBGRA(frame->plane[0] + y * frame->pitch[0] + x * 4, frame->pitch[0], dst_data, pitch_, width, height);
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "renderer.h"
+#include <mutex>
+#include <vector>
+
+namespace DX {
+
+struct SoftwareRenderStats
+{
+	uint64_t frame_count = 0;
+	double   last_ms     = 0.0;
+	double   average_ms  = 0.0;
+	double   max_ms      = 0.0;
+
+	// Pixels converted by the last frame and in total, less than the
+	// frame size when only dirty rects were updated.
+	uint64_t last_pixels  = 0;
+	uint64_t total_pixels = 0;
+};
+
+// Renders PixelFrame into an in-memory BGRA surface, no window or GPU required.
+class SoftwareRenderer : public Renderer
+{
+public:
+	SoftwareRenderer();
+	virtual ~SoftwareRenderer();
+
+	// hwnd is not used and may be NULL.
+	virtual bool Init(HWND hwnd);
+	virtual void Destroy();
+
+	virtual bool Resize();
+
+	virtual void Render(PixelFrame* frame);
+
+	// sharpness: 0.0 to 10.0, converted and sharpened in one pass
+	virtual void SetSharpen(float unsharp);
+
+	// Output surface with 64 byte aligned rows, valid until the next Render()
+	// or Destroy().
+	const uint8_t* GetBuffer();
+	int GetPitch();
+	int GetWidth();
+	int GetHeight();
+
+	SoftwareRenderStats GetStats();
+
+	virtual uint64_t GetPixelsTouched();
+
+	virtual uint64_t GetBytesHeld();
+
+protected:
+	bool CreateBuffer(int width, int height);
+	void Copy(PixelFrame* frame);
+	void CopyRect(PixelFrame* frame, const PixelRect& rect);
+
+	std::mutex mutex_;
+
+	bool is_initialized_ = false;
+
+	int width_  = 0;
+	int height_ = 0;
+	int pitch_  = 0;
+	PixelFormat format_ = PIXEL_FORMAT_UNKNOW;
+	ColorMatrix color_matrix_ = COLOR_MATRIX_BT601;
+	ColorRange color_range_ = COLOR_RANGE_LIMITED;
+	// 64 byte aligned BGRA rows from the pool, no buffer kept after a resize.
+	PixelFramePool buffer_pool_;
+	PixelFrame buffer_;
+	std::vector<PixelRect> dirty_rects_;
+
+	float unsharp_ = 0.0;
+	bool is_sharpen_changed_ = false;
+
+	SoftwareRenderStats stats_;
+};
+
+}
@@ -0,0 +1,244 @@
+#include "tile_hasher.h"
+
+#include <cstring>
+
+using namespace DX;
+
+static const uint64_t kPrime1 = 0x9e3779b185ebca87ULL;
+static const uint64_t kPrime2 = 0xc2b2ae3d27d4eb4fULL;
+
+static inline uint64_t Rotate(uint64_t value, int bits)
+{
+	return (value << bits) | (value >> (64 - bits));
+}
+
+static inline uint64_t Mix(uint64_t hash, uint64_t value)
+{
+	hash ^= Rotate(value * kPrime2, 31) * kPrime1;
+	return Rotate(hash, 27) * kPrime1 + kPrime2;
+}
+
+static inline uint64_t Load64(const uint8_t* data)
+{
+	uint64_t value;
+	memcpy(&value, data, 8);
+	return value;
+}
+
+// Four independent lanes keep the multiplies from serializing.
+static uint64_t HashBytes(const uint8_t* data, int size, uint64_t hash)
+{
+	uint64_t lanes[4] = { hash, hash + kPrime1, hash ^ kPrime2, hash - kPrime1 };
+
+	int i = 0;
+	for (; i + 32 <= size; i += 32) {
+		lanes[0] = Mix(lanes[0], Load64(data + i));
+		lanes[1] = Mix(lanes[1], Load64(data + i + 8));
+		lanes[2] = Mix(lanes[2], Load64(data + i + 16));
+		lanes[3] = Mix(lanes[3], Load64(data + i + 24));
+	}
+
+	hash = Mix(Mix(Mix(Mix(hash, lanes[0]), lanes[1]), lanes[2]), lanes[3]);
+
+	for (; i + 8 <= size; i += 8) {
+		hash = Mix(hash, Load64(data + i));
+	}
+
+	uint64_t tail = 0;
+	if (i < size) {
+		memcpy(&tail, data + i, size - i);
+	}
+
+	return Mix(hash, tail ^ static_cast<uint64_t>(size));
+}
+
+// Bytes per pixel and subsampling shifts of one plane.
+static bool GetPlaneLayout(PixelFormat format, int plane, int* bytes_per_pixel, int* x_shift, int* y_shift)
+{
+	*bytes_per_pixel = 1;
+	*x_shift = 0;
+	*y_shift = 0;
+
+	switch (format)
+	{
+	case PIXEL_FORMAT_ARGB:
+		*bytes_per_pixel = 4;
+		return plane == 0;
+	case PIXEL_FORMAT_I420:
+		*x_shift = plane > 0 ? 1 : 0;
+		*y_shift = plane > 0 ? 1 : 0;
+		return plane < 3;
+	case PIXEL_FORMAT_NV12:
+		// Interleaved UV, one 2 byte pair per 2x2 luma pixels.
+		*bytes_per_pixel = plane > 0 ? 2 : 1;
+		*x_shift = plane > 0 ? 1 : 0;
+		*y_shift = plane > 0 ? 1 : 0;
+		return plane < 2;
+	case PIXEL_FORMAT_I444:
+		return plane < 3;
+	case PIXEL_FORMAT_P010:
+		*bytes_per_pixel = plane > 0 ? 4 : 2;
+		*x_shift = plane > 0 ? 1 : 0;
+		*y_shift = plane > 0 ? 1 : 0;
+		return plane < 2;
+	case PIXEL_FORMAT_I010:
+		*bytes_per_pixel = 2;
+		*x_shift = plane > 0 ? 1 : 0;
+		*y_shift = plane > 0 ? 1 : 0;
+		return plane < 3;
+	case PIXEL_FORMAT_YUY2:
+	case PIXEL_FORMAT_UYVY:
+		// Tiles are even sized, so pixel pairs never straddle two tiles.
+		*bytes_per_pixel = 2;
+		return plane == 0;
+	case PIXEL_FORMAT_I422:
+		*x_shift = plane > 0 ? 1 : 0;
+		return plane < 3;
+	case PIXEL_FORMAT_RGB24:
+		*bytes_per_pixel = 3;
+		return plane == 0;
+	case PIXEL_FORMAT_RGBA:
+		*bytes_per_pixel = 4;
+		return plane == 0;
+	default:
+		return false;
+	}
+}
+
+static uint64_t HashRect(const PixelFrame* frame, const PixelRect& rect, uint64_t hash)
+{
+	for (int plane = 0; plane < 3; plane++) {
+		int bytes_per_pixel = 0, x_shift = 0, y_shift = 0;
+		if (!GetPlaneLayout(frame->format, plane, &bytes_per_pixel, &x_shift, &y_shift)) {
+			break;
+		}
+
+		// Rects start on even pixels, so a subsampled plane splits cleanly.
+		int left = (rect.left >> x_shift) * bytes_per_pixel;
+		int right = ((rect.right + x_shift) >> x_shift) * bytes_per_pixel;
+		int top = rect.top >> y_shift;
+		int bottom = (rect.bottom + y_shift) >> y_shift;
+
+		for (int y = top; y < bottom; y++) {
+			hash = HashBytes(frame->plane[plane] + y * frame->pitch[plane] + left, right - left, hash);
+		}
+	}
+
+	return hash;
+}
+
+TileHasher::TileHasher(int tile_size)
+{
+	tile_size_ = tile_size < 2 ? 2 : (tile_size + 1) & ~1;
+}
+
+TileHasher::~TileHasher()
+{
+
+}
+
+int TileHasher::Update(const PixelFrame* frame)
+{
+	if (frame->width != width_ || frame->height != height_ || frame->format != format_) {
+		width_ = frame->width;
+		height_ = frame->height;
+		format_ = frame->format;
+		tiles_x_ = (width_ + tile_size_ - 1) / tile_size_;
+		tiles_y_ = (height_ + tile_size_ - 1) / tile_size_;
+		hashes_.clear();
+	}
+
+	bool is_first = hashes_.empty();
+	if (is_first) {
+		hashes_.assign(static_cast<size_t>(tiles_x_) * tiles_y_, 0);
+	}
+
+	changed_tiles_.clear();
+
+	for (int ty = 0; ty < tiles_y_; ty++) {
+		for (int tx = 0; tx < tiles_x_; tx++) {
+			PixelRect tile;
+			tile.left = tx * tile_size_;
+			tile.top = ty * tile_size_;
+			tile.right = tile.left + tile_size_ < width_ ? tile.left + tile_size_ : width_;
+			tile.bottom = tile.top + tile_size_ < height_ ? tile.top + tile_size_ : height_;
+
+			uint64_t hash = HashTile(frame, tile);
+			uint64_t& last_hash = hashes_[ty * tiles_x_ + tx];
+			if (is_first || hash != last_hash) {
+				last_hash = hash;
+				changed_tiles_.push_back(tile);
+			}
+		}
+	}
+
+	return static_cast<int>(changed_tiles_.size());
+}
+
+const std::vector<PixelRect>& TileHasher::GetChangedTiles()
+{
+	return changed_tiles_;
+}
+
+int TileHasher::GetTileCount()
+{
+	return tiles_x_ * tiles_y_;
+}
+
+int TileHasher::GetTileSize()
+{
+	return tile_size_;
+}
+
+void TileHasher::Reset()
+{
+	hashes_.clear();
+	changed_tiles_.clear();
+}
+
+uint64_t TileHasher::HashTile(const PixelFrame* frame, const PixelRect& tile)
+{
+	return HashRect(frame, tile, kPrime2);
+}
+
+uint64_t DX::HashFrame(const PixelFrame* frame, int sample_step)
+{
+	// Size and format are part of the content.
+	uint64_t hash = Mix(kPrime2, (static_cast<uint64_t>(frame->width) << 32) | static_cast<uint32_t>(frame->height));
+	hash = Mix(hash, static_cast<uint64_t>(frame->format));
+
+	std::vector<PixelRect> tiles;
+	GetSampledTiles(frame->width, frame->height, sample_step, tiles);
+	for (auto& tile : tiles) {
+		hash = HashRect(frame, tile, hash);
+	}
+
+	return hash;
+}
+
+void DX::GetSampledTiles(int width, int height, int sample_step, std::vector<PixelRect>& tiles)
+{
+	tiles.clear();
+
+	PixelRect rect;
+	if (sample_step <= 1) {
+		rect.right = width;
+		rect.bottom = height;
+		tiles.push_back(rect);
+		return;
+	}
+
+	const int tile_size = 64;
+	int tiles_x = (width + tile_size - 1) / tile_size;
+	int tiles_y = (height + tile_size - 1) / tile_size;
+
+	for (int ty = 0; ty < tiles_y; ty++) {
+		for (int tx = ty % sample_step; tx < tiles_x; tx += sample_step) {
+			rect.left = tx * tile_size;
+			rect.top = ty * tile_size;
+			rect.right = rect.left + tile_size < width ? rect.left + tile_size : width;
+			rect.bottom = rect.top + tile_size < height ? rect.top + tile_size : height;
+			tiles.push_back(rect);
+		}
+	}
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "renderer.h"
+#include <cstdint>
+#include <vector>
+
+namespace DX {
+
+// Keeps one 64-bit hash per tile of the last frame, so changes can be found
+// without holding a copy of it. Supports ARGB, RGBA, RGB24, I420, I422, I444,
+// NV12, YUY2, UYVY, and the 10-bit I010 and P010. Planes of other formats are
+// not hashed, so their tiles never change.
+class TileHasher
+{
+public:
+	// tile_size in luma pixels, rounded up to a multiple of 2.
+	TileHasher(int tile_size = 64);
+	virtual ~TileHasher();
+
+	// Hashes frame and returns the number of tiles that differ from the previous
+	// Update(). All tiles count as changed after Reset() or a size or format change.
+	int Update(const PixelFrame* frame);
+
+	// Tiles found changed by the last Update(), clipped to the frame.
+	const std::vector<PixelRect>& GetChangedTiles();
+
+	int GetTileCount();
+	int GetTileSize();
+
+	void Reset();
+
+private:
+	uint64_t HashTile(const PixelFrame* frame, const PixelRect& tile);
+
+	int tile_size_ = 64;
+	int width_ = 0;
+	int height_ = 0;
+	int tiles_x_ = 0;
+	int tiles_y_ = 0;
+	PixelFormat format_ = PIXEL_FORMAT_UNKNOW;
+
+	std::vector<uint64_t> hashes_;
+	std::vector<PixelRect> changed_tiles_;
+};
+
+// 64-bit content fingerprint of a frame and its size and format, for the same
+// formats as TileHasher. With sample_step > 1 only every sample_step-th 64x64
+// tile is hashed, staggered from row to row: cheaper, but changes that miss
+// every sampled tile go unseen.
+uint64_t HashFrame(const PixelFrame* frame, int sample_step = 1);
+
+// Rects HashFrame() reads in a width x height frame, tile row by tile row, the
+// whole frame for sample_step <= 1. Lets a caller read back only these.
+void GetSampledTiles(int width, int height, int sample_step, std::vector<PixelRect>& tiles);
+
+}
@@ -0,0 +1,124 @@
+#include "worker_pool.h"
+
+using namespace DX;
+
+// Set while this thread runs a task of any pool, a nested Run() must not wait
+// on the pool it is part of.
+static thread_local bool is_in_task = false;
+
+WorkerPool& WorkerPool::Instance()
+{
+	static WorkerPool worker_pool([] {
+		int num_threads = static_cast<int>(std::thread::hardware_concurrency()) - 1;
+		return num_threads < 1 ? 1 : (num_threads > 7 ? 7 : num_threads);
+	}());
+	return worker_pool;
+}
+
+WorkerPool::WorkerPool(int num_threads)
+{
+	for (int i = 0; i < num_threads; i++) {
+		threads_.emplace_back(&WorkerPool::WorkerThread, this);
+	}
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> locker(mutex_);
+		is_quit_ = true;
+	}
+	start_cond_.notify_all();
+
+	for (auto& thread : threads_) {
+		if (thread.joinable()) {
+			thread.join();
+		}
+	}
+}
+
+int WorkerPool::GetConcurrency()
+{
+	return static_cast<int>(threads_.size()) + 1;
+}
+
+void WorkerPool::Run(int count, const std::function<void(int)>& task)
+{
+	if (count <= 0) {
+		return;
+	}
+
+	if (count == 1 || threads_.empty() || is_in_task) {
+		for (int i = 0; i < count; i++) {
+			task(i);
+		}
+		return;
+	}
+
+	std::unique_lock<std::mutex> run_locker(run_mutex_, std::try_to_lock);
+	if (!run_locker.owns_lock()) {
+		for (int i = 0; i < count; i++) {
+			task(i);
+		}
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> locker(mutex_);
+		task_ = &task;
+		task_count_ = count;
+		next_task_ = 0;
+		pending_tasks_ = count;
+		generation_ += 1;
+	}
+	start_cond_.notify_all();
+
+	RunTasks();
+
+	std::unique_lock<std::mutex> locker(mutex_);
+	done_cond_.wait(locker, [this] { return pending_tasks_ == 0; });
+	task_ = NULL;
+}
+
+void WorkerPool::RunTasks()
+{
+	std::unique_lock<std::mutex> locker(mutex_);
+
+	while (task_ && next_task_ < task_count_) {
+		int index = next_task_++;
+		const std::function<void(int)>* task = task_;
+
+		locker.unlock();
+		is_in_task = true;
+		(*task)(index);
+		is_in_task = false;
+		locker.lock();
+
+		pending_tasks_ -= 1;
+		if (pending_tasks_ == 0) {
+			done_cond_.notify_all();
+		}
+	}
+}
+
+void WorkerPool::WorkerThread()
+{
+	uint64_t generation = 0;
+
+	while (true) {
+		{
+			std::unique_lock<std::mutex> locker(mutex_);
+			start_cond_.wait(locker, [this, generation] {
+				return is_quit_ || generation_ != generation;
+			});
+
+			if (is_quit_) {
+				break;
+			}
+
+			generation = generation_;
+		}
+
+		RunTasks();
+	}
+}
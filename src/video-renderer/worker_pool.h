@@ -0,0 +1,48 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace DX {
+
+// Shared worker threads for splitting per-frame CPU work into stripes.
+class WorkerPool
+{
+public:
+	static WorkerPool& Instance();
+
+	WorkerPool(int num_threads);
+	virtual ~WorkerPool();
+
+	// Worker threads plus the calling thread.
+	int GetConcurrency();
+
+	// Runs task(0) ... task(count - 1) and returns when all of them are done.
+	// The calling thread takes part; if another caller is using the pool, or
+	// Run() is called from inside a task, the tasks run on the calling thread only.
+	void Run(int count, const std::function<void(int)>& task);
+
+private:
+	void WorkerThread();
+	void RunTasks();
+
+	std::mutex run_mutex_;
+
+	std::mutex mutex_;
+	std::condition_variable start_cond_;
+	std::condition_variable done_cond_;
+	std::vector<std::thread> threads_;
+	bool is_quit_ = false;
+
+	const std::function<void(int)>* task_ = NULL;
+	uint64_t generation_ = 0;
+	int task_count_ = 0;
+	int next_task_ = 0;
+	int pending_tasks_ = 0;
+};
+
+}
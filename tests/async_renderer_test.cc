@@ -0,0 +1,143 @@
+#include "async_renderer.h"
+#include "software_renderer.h"
+#include "test.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace DX;
+
+// SoftwareRenderer that holds each Render() until the test opens the gate.
+class GatedRenderer : public SoftwareRenderer
+{
+public:
+	virtual void Render(PixelFrame* frame)
+	{
+		{
+			std::unique_lock<std::mutex> locker(gate_mutex_);
+			started_ += 1;
+			gate_cond_.notify_all();
+			gate_cond_.wait(locker, [this] { return is_open_; });
+		}
+		SoftwareRenderer::Render(frame);
+	}
+
+	void WaitStarted(int count)
+	{
+		std::unique_lock<std::mutex> locker(gate_mutex_);
+		gate_cond_.wait(locker, [this, count] { return started_ >= count; });
+	}
+
+	void Open()
+	{
+		std::lock_guard<std::mutex> locker(gate_mutex_);
+		is_open_ = true;
+		gate_cond_.notify_all();
+	}
+
+private:
+	std::mutex gate_mutex_;
+	std::condition_variable gate_cond_;
+	int started_ = 0;
+	bool is_open_ = false;
+};
+
+static void WaitRendered(AsyncRenderer& async_renderer, uint64_t count)
+{
+	for (int i = 0; i < 2000 && async_renderer.GetStats().rendered_frames < count; i++) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	CHECK(async_renderer.GetStats().rendered_frames == count);
+}
+
+// A caller owned ARGB frame without storage, every byte set to value.
+static PixelFrame MakeFrame(std::vector<uint8_t>& pixels, int width, int height, uint8_t value)
+{
+	pixels.assign(static_cast<size_t>(width) * height * 4, value);
+
+	PixelFrame frame;
+	frame.width = width;
+	frame.height = height;
+	frame.format = PIXEL_FORMAT_ARGB;
+	frame.plane[0] = pixels.data();
+	frame.pitch[0] = width * 4;
+	return frame;
+}
+
+static void CheckOutput(SoftwareRenderer& renderer, uint8_t value)
+{
+	for (int y = 0; y < renderer.GetHeight(); y++) {
+		const uint8_t* row = renderer.GetBuffer() + y * renderer.GetPitch();
+		for (int x = 0; x < renderer.GetWidth() * 4; x++) {
+			CHECK(row[x] == value);
+		}
+	}
+}
+
+// Frames posted while the renderer is busy overwrite each other, only the
+// latest one is rendered, in full although it only carries a small dirty rect.
+static void TestBusyRendererDropsFrames()
+{
+	GatedRenderer renderer;
+	CHECK(renderer.Init(NULL));
+
+	AsyncRenderer async_renderer;
+	CHECK(async_renderer.Init(&renderer));
+
+	std::vector<uint8_t> pixels;
+	async_renderer.RenderAsync(MakeFrame(pixels, 16, 8, 1));
+	renderer.WaitStarted(1);
+
+	PixelRect rect;
+	rect.right = 2;
+	rect.bottom = 2;
+	for (uint8_t value = 2; value <= 4; value++) {
+		PixelFrame frame = MakeFrame(pixels, 16, 8, value);
+		frame.dirty_rects.assign(1, rect);
+		async_renderer.RenderAsync(frame);
+	}
+
+	// The frames were copied, the caller may reuse its planes.
+	memset(pixels.data(), 0xFF, pixels.size());
+
+	renderer.Open();
+	WaitRendered(async_renderer, 2);
+
+	RenderQueueStats stats = async_renderer.GetStats();
+	CHECK(stats.submitted_frames == 4);
+	CHECK(stats.dropped_frames == 2);
+	CHECK(stats.queue_latency.GetCount() == 2);
+	CHECK(stats.render_latency.GetCount() == 2);
+	CheckOutput(renderer, 4);
+
+	async_renderer.Destroy();
+}
+
+static void TestIdleRendererKeepsEveryFrame()
+{
+	SoftwareRenderer renderer;
+	CHECK(renderer.Init(NULL));
+
+	AsyncRenderer async_renderer;
+	CHECK(async_renderer.Init(&renderer));
+
+	std::vector<uint8_t> pixels;
+	for (int i = 1; i <= 5; i++) {
+		async_renderer.RenderAsync(MakeFrame(pixels, 8, 8, static_cast<uint8_t>(i)));
+		WaitRendered(async_renderer, i);
+	}
+
+	CHECK(async_renderer.GetStats().dropped_frames == 0);
+	CheckOutput(renderer, 5);
+}
+
+int main()
+{
+	RUN_TEST(TestBusyRendererDropsFrames);
+	RUN_TEST(TestIdleRendererKeepsEveryFrame);
+	return 0;
+}
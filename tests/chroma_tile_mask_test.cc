@@ -0,0 +1,308 @@
+#include "chroma_tile_mask.h"
+#include "renderer.h"
+#include "test.h"
+
+#include <vector>
+
+using namespace DX;
+
+// Grey background, a text-like stripe block with hard colour edges, a noisy
+// block, and a smooth colour gradient that has no detail per 2x2 block.
+static void FillImage(PixelFrame* frame, uint32_t seed)
+{
+	for (int y = 0; y < frame->height; y++) {
+		uint8_t* row = frame->plane[0] + y * frame->pitch[0];
+		for (int x = 0; x < frame->width; x++) {
+			seed = seed * 1664525 + 1013904223;
+			uint8_t* pixel = row + x * 4;
+			if (x >= 70 && x < 100 && y >= 10 && y < 40) {
+				bool on = (x / 2 + y) % 2 == 0;
+				pixel[0] = on ? 250 : 10;
+				pixel[1] = on ? 20 : 200;
+				pixel[2] = on ? 30 : 240;
+			}
+			else if (x >= frame->width - 5 && y >= frame->height - 7) {
+				pixel[0] = static_cast<uint8_t>(seed >> 24);
+				pixel[1] = static_cast<uint8_t>(seed >> 16);
+				pixel[2] = static_cast<uint8_t>(seed >> 8);
+			}
+			else if (y >= 64) {
+				pixel[0] = static_cast<uint8_t>(x);
+				pixel[1] = static_cast<uint8_t>(y);
+				pixel[2] = static_cast<uint8_t>((x + y) / 2);
+			}
+			else {
+				pixel[0] = pixel[1] = pixel[2] = 128;
+			}
+			pixel[3] = static_cast<uint8_t>(seed);
+		}
+	}
+}
+
+static int GetChroma(const PixelFrame& frame, int x, int y, int c)
+{
+	const uint8_t* pixel = frame.plane[0] + y * frame.pitch[0] + x * 4;
+	return pixel[c] - pixel[1];
+}
+
+// Straight port of the classification rule, blocks on the right and bottom
+// edges repeat their last column or row.
+static std::vector<uint8_t> ClassifyReference(const PixelFrame& frame, int tile_size, int threshold, int min_blocks)
+{
+	int tiles_x = (frame.width + tile_size - 1) / tile_size;
+	int tiles_y = (frame.height + tile_size - 1) / tile_size;
+	std::vector<uint8_t> tiles(tiles_x * tiles_y, 0);
+
+	for (int ty = 0; ty < tiles_y; ty++) {
+		for (int tx = 0; tx < tiles_x; tx++) {
+			int right = (tx + 1) * tile_size < frame.width ? (tx + 1) * tile_size : frame.width;
+			int bottom = (ty + 1) * tile_size < frame.height ? (ty + 1) * tile_size : frame.height;
+			int count = 0;
+			for (int y = ty * tile_size; y < bottom; y += 2) {
+				for (int x = tx * tile_size; x < right; x += 2) {
+					int xs[2] = { x, x + 1 < right ? x + 1 : x };
+					int ys[2] = { y, y + 1 < bottom ? y + 1 : y };
+					for (int c = 0; c < 3; c += 2) {
+						int min_value = 255, max_value = -255;
+						for (int i = 0; i < 4; i++) {
+							int value = GetChroma(frame, xs[i % 2], ys[i / 2], c);
+							min_value = value < min_value ? value : min_value;
+							max_value = value > max_value ? value : max_value;
+						}
+						if (max_value - min_value > threshold) {
+							count++;
+							break;
+						}
+					}
+				}
+			}
+			tiles[ty * tiles_x + tx] = count >= min_blocks ? 1 : 0;
+		}
+	}
+
+	return tiles;
+}
+
+static void CheckClassify(int width, int height, int tile_size, int threshold, int min_blocks)
+{
+	PixelFramePool pool;
+	PixelFrame frame;
+	pool.Alloc(width, height, PIXEL_FORMAT_ARGB, &frame);
+	FillImage(&frame, static_cast<uint32_t>(width * 31 + height));
+
+	ChromaTileMask mask;
+	mask.tile_size = tile_size;
+	ClassifyChromaDetail(&frame, &mask, threshold, min_blocks);
+
+	CHECK(mask.tile_size == tile_size);
+	CHECK(mask.Matches(width, height));
+	CHECK(mask.tiles == ClassifyReference(frame, tile_size, threshold, min_blocks));
+}
+
+static void TestClassifyMatchesReference()
+{
+	CheckClassify(128, 64, 64, 16, 4);
+	// Sizes that are not a multiple of the tile size, or even of 2.
+	CheckClassify(203, 131, 64, 16, 4);
+	CheckClassify(101, 77, 32, 16, 1);
+	CheckClassify(7, 5, 4, 0, 1);
+	CheckClassify(150, 97, 16, 40, 3);
+	// Large enough to be split into WorkerPool tasks.
+	CheckClassify(645, 483, 64, 16, 4);
+}
+
+static void TestClassifyMarksText()
+{
+	PixelFramePool pool;
+	PixelFrame frame;
+	pool.Alloc(203, 131, PIXEL_FORMAT_ARGB, &frame);
+	FillImage(&frame, 1);
+
+	ChromaTileMask mask;
+	ClassifyChromaDetail(&frame, &mask);
+	CHECK(mask.tile_size == 64);
+	CHECK(mask.tiles_x == 4 && mask.tiles_y == 3);
+
+	// The stripes sit in tile 1 of row 0 and the noise in the clipped corner
+	// tiles, the gradient and the flat grey have no detail.
+	CHECK(mask.IsSet(1, 0));
+	CHECK(mask.IsSet(3, 1));
+	CHECK(mask.IsSet(3, 2));
+	CHECK(mask.GetCount() == 3);
+}
+
+static void TestClassifyOtherInput()
+{
+	PixelFramePool pool;
+	PixelFrame nv12, argb;
+	pool.Alloc(130, 66, PIXEL_FORMAT_NV12, &nv12);
+	pool.Alloc(130, 66, PIXEL_FORMAT_ARGB, &argb);
+	FillImage(&argb, 2);
+
+	// Other formats, or no required blocks, mark every tile.
+	ChromaTileMask mask;
+	ClassifyChromaDetail(&nv12, &mask);
+	CHECK(mask.Matches(130, 66));
+	CHECK(mask.GetCount() == 3 * 2);
+
+	ClassifyChromaDetail(&argb, &mask, 16, 0);
+	CHECK(mask.GetCount() == 3 * 2);
+
+	// A tile size that is not a multiple of 4 falls back to 64.
+	mask.tile_size = 30;
+	ClassifyChromaDetail(&argb, &mask);
+	CHECK(mask.tile_size == 64);
+	CHECK(mask.Matches(130, 66));
+
+	CHECK(!mask.Matches(200, 66));
+	CHECK(!mask.Matches(130, 130));
+	CHECK(mask.Matches(192, 128));
+}
+
+static ChromaTileMask MakeMask(int tile_size, int tiles_x, int tiles_y, uint32_t seed)
+{
+	ChromaTileMask mask;
+	mask.tile_size = tile_size;
+	mask.tiles_x = tiles_x;
+	mask.tiles_y = tiles_y;
+	mask.tiles.resize(tiles_x * tiles_y);
+	for (auto& tile : mask.tiles) {
+		seed = seed * 1664525 + 1013904223;
+		tile = (seed >> 28) & 1;
+	}
+	return mask;
+}
+
+static void TestSerializeRoundTrip()
+{
+	// Tile counts on and off byte boundaries, and header values above 255.
+	const int sizes[][3] = { { 64, 30, 17 }, { 64, 8, 1 }, { 4, 1, 1 }, { 16, 7, 3 }, { 256, 300, 2 }, { 64, 0, 0 } };
+
+	for (auto& size : sizes) {
+		ChromaTileMask mask = MakeMask(size[0], size[1], size[2], size[1]);
+		std::vector<uint8_t> data;
+		SerializeChromaTileMask(mask, data);
+		CHECK(data.size() == 6 + (mask.tiles.size() + 7) / 8);
+
+		ChromaTileMask parsed;
+		CHECK(ParseChromaTileMask(data.data(), data.size(), &parsed));
+		CHECK(parsed.tile_size == mask.tile_size);
+		CHECK(parsed.tiles_x == mask.tiles_x);
+		CHECK(parsed.tiles_y == mask.tiles_y);
+		CHECK(parsed.tiles == mask.tiles);
+	}
+
+	// Unused bits of the last byte stay clear.
+	ChromaTileMask mask = MakeMask(64, 3, 1, 0);
+	mask.tiles.assign(3, 1);
+	std::vector<uint8_t> data;
+	SerializeChromaTileMask(mask, data);
+	CHECK(data.size() == 7);
+	CHECK(data[6] == 0x07);
+}
+
+static void TestParseRejectsBadInput()
+{
+	ChromaTileMask mask = MakeMask(64, 30, 17, 9);
+	std::vector<uint8_t> data;
+	SerializeChromaTileMask(mask, data);
+
+	ChromaTileMask parsed = MakeMask(32, 2, 2, 1);
+	const ChromaTileMask original = parsed;
+
+	// Every truncation, an extra byte, and no data at all.
+	for (size_t size = 0; size < data.size(); size++) {
+		CHECK(!ParseChromaTileMask(data.data(), size, &parsed));
+	}
+	std::vector<uint8_t> oversized = data;
+	oversized.push_back(0);
+	CHECK(!ParseChromaTileMask(oversized.data(), oversized.size(), &parsed));
+	CHECK(!ParseChromaTileMask(NULL, 0, &parsed));
+
+	// Tile sizes the converters cannot split.
+	std::vector<uint8_t> bad_tile = data;
+	bad_tile[0] = 62;
+	CHECK(!ParseChromaTileMask(bad_tile.data(), bad_tile.size(), &parsed));
+	bad_tile[0] = 0;
+	CHECK(!ParseChromaTileMask(bad_tile.data(), bad_tile.size(), &parsed));
+
+	// A failed parse leaves the mask alone.
+	CHECK(parsed.tile_size == original.tile_size);
+	CHECK(parsed.tiles_x == original.tiles_x && parsed.tiles_y == original.tiles_y);
+	CHECK(parsed.tiles == original.tiles);
+}
+
+static void TestTileRunsClipToFrame()
+{
+	const int width = 200;
+	const int height = 100;
+
+	ChromaTileMask mask = MakeMask(64, 4, 2, 0);
+	mask.tiles = { 1, 1, 0, 1,
+	               0, 1, 1, 1 };
+	CHECK(mask.Matches(width, height));
+
+	std::vector<PixelRect> rects;
+	GetChromaTileRuns(mask, width, height, true, rects);
+	CHECK(rects.size() == 3);
+	CHECK(rects[0].left == 0 && rects[0].top == 0 && rects[0].right == 128 && rects[0].bottom == 64);
+	CHECK(rects[1].left == 192 && rects[1].top == 0 && rects[1].right == 200 && rects[1].bottom == 64);
+	CHECK(rects[2].left == 64 && rects[2].top == 64 && rects[2].right == 200 && rects[2].bottom == 100);
+
+	GetChromaTileRuns(mask, width, height, false, rects);
+	CHECK(rects.size() == 2);
+	CHECK(rects[0].left == 128 && rects[0].right == 192 && rects[0].bottom == 64);
+	CHECK(rects[1].left == 0 && rects[1].top == 64 && rects[1].right == 64 && rects[1].bottom == 100);
+}
+
+static bool Contains(const PixelRect& rect, int x, int y)
+{
+	return x >= rect.left && x < rect.right && y >= rect.top && y < rect.bottom;
+}
+
+static void TestChroma420RectsCoverTheirSamples()
+{
+	const int width = 200;
+	const int height = 100;
+
+	// A clipped edge tile run and an inner tile.
+	const PixelRect rects[] = { { 192, 64, 200, 100 }, { 64, 0, 128, 64 }, { 0, 0, width, height } };
+	for (auto& rect : rects) {
+		PixelRect y_rects[2], uv_rects[2];
+		GetChroma420Rects(width, rect, y_rects, uv_rects);
+
+		// B4 B5 of odd columns and B6-B9 of even columns on odd rows land
+		// inside the rects exactly when their pixel is inside rect.
+		for (int y = 0; y < height; y++) {
+			for (int x = 0; x < width; x++) {
+				bool inside = Contains(rect, x, y);
+				if (x % 2 == 1) {
+					CHECK(Contains(y_rects[0], x / 2, y) == inside);
+					CHECK(Contains(y_rects[1], x / 2 + width / 2, y) == inside);
+				}
+				else if (y % 2 == 1) {
+					CHECK(Contains(uv_rects[0], x / 4, y / 2) == inside);
+					CHECK(Contains(uv_rects[1], x / 4 + width / 4, y / 2) == inside);
+				}
+			}
+		}
+
+		int area = (rect.right - rect.left) * (rect.bottom - rect.top);
+		for (int i = 0; i < 2; i++) {
+			CHECK((y_rects[i].right - y_rects[i].left) * (y_rects[i].bottom - y_rects[i].top) == area / 2);
+			CHECK((uv_rects[i].right - uv_rects[i].left) * (uv_rects[i].bottom - uv_rects[i].top) == area / 8);
+		}
+	}
+}
+
+int main()
+{
+	RUN_TEST(TestClassifyMatchesReference);
+	RUN_TEST(TestClassifyMarksText);
+	RUN_TEST(TestClassifyOtherInput);
+	RUN_TEST(TestSerializeRoundTrip);
+	RUN_TEST(TestParseRejectsBadInput);
+	RUN_TEST(TestTileRunsClipToFrame);
+	RUN_TEST(TestChroma420RectsCoverTheirSamples);
+	return 0;
+}
@@ -0,0 +1,245 @@
+#include "color_matrix.h"
+#include "cpu_color_converter.h"
+#include "test.h"
+
+#include <cstddef>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace DX;
+
+static const ColorMatrix kMatrices[] = { COLOR_MATRIX_BT601, COLOR_MATRIX_BT709, COLOR_MATRIX_BT2020 };
+static const ColorRange kRanges[] = { COLOR_RANGE_LIMITED, COLOR_RANGE_FULL };
+
+// Float to UNORM8 as the output merger does it, saturate then round.
+static uint8_t ToUnorm8(float value)
+{
+	value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+	return static_cast<uint8_t>(static_cast<int>(value * 255.0f + 0.5f));
+}
+
+static float Dot(const float a[3], const float b[4])
+{
+	return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+// Scalar port of d3d11_yuv.hlsl, d3d11_nv12.hlsl and d3d9_yuv.hlsl on one
+// point sampled pixel, B G R A in memory.
+static void ShaderYUVToBGRA(const YUVShaderConstants& constants, uint8_t y, uint8_t u, uint8_t v, uint8_t bgra[4])
+{
+	float yuv[3] = { y / 255.0f, u / 255.0f, v / 255.0f };
+	for (int i = 0; i < 3; i++) {
+		yuv[i] += constants.offset[i];
+	}
+
+	bgra[0] = ToUnorm8(Dot(yuv, constants.b));
+	bgra[1] = ToUnorm8(Dot(yuv, constants.g));
+	bgra[2] = ToUnorm8(Dot(yuv, constants.r));
+	bgra[3] = 255;
+}
+
+// The shaders and the CPU fixed point tables are built from the same
+// coefficients, their output may differ by rounding only.
+static void TestShaderMatchesCPUTable()
+{
+	const int kStep = 3;
+	const int width = 256 / kStep + 1;
+
+	std::vector<uint8_t> y_row(width), u_row(width), v_row(width);
+	std::vector<uint8_t> bgra(static_cast<size_t>(width) * 4);
+
+	for (ColorMatrix matrix : kMatrices) {
+		for (ColorRange range : kRanges) {
+			const YUVShaderConstants constants = GetYUVShaderConstants(matrix, range);
+
+			for (int y = 0; y < 256; y += kStep) {
+				for (int u = 0; u < 256; u += kStep) {
+					for (int x = 0; x < width; x++) {
+						y_row[x] = static_cast<uint8_t>(y);
+						u_row[x] = static_cast<uint8_t>(u);
+						v_row[x] = static_cast<uint8_t>(x * kStep > 255 ? 255 : x * kStep);
+					}
+
+					I444ToBGRA(y_row.data(), width, u_row.data(), width, v_row.data(), width,
+						bgra.data(), width * 4, width, 1, matrix, range);
+
+					for (int x = 0; x < width; x++) {
+						uint8_t expected[4];
+						ShaderYUVToBGRA(constants, y_row[x], u_row[x], v_row[x], expected);
+						for (int c = 0; c < 4; c++) {
+							CHECK_NEAR(bgra[x * 4 + c], expected[c], 2);
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+struct ShaderConstant
+{
+	std::string name;
+	size_t offset;
+	size_t size;
+};
+
+static std::string ReadShader(const char* path)
+{
+	std::ifstream file(std::string(SHADER_DIR) + "/" + path);
+	CHECK(file.is_open());
+	std::stringstream text;
+	text << file.rdbuf();
+	return text.str();
+}
+
+// Members of "cbuffer <name>" with their offsets under the HLSL packing rules,
+// the same numbers fxc prints in the header comments: scalars and vectors are
+// packed in order and a member never straddles a 16 byte register.
+static std::vector<ShaderConstant> GetCBufferLayout(const std::string& source, const std::string& name)
+{
+	std::vector<ShaderConstant> members;
+	size_t begin = source.find("cbuffer " + name);
+	CHECK(begin != std::string::npos);
+	begin = source.find('{', begin);
+	size_t end = source.find('}', begin);
+	CHECK(begin != std::string::npos && end != std::string::npos);
+
+	std::istringstream body(source.substr(begin + 1, end - begin - 1));
+	std::string type, member;
+	size_t offset = 0;
+	while (body >> type >> member) {
+		size_t components = 1;
+		if (type.size() == 6 && type.compare(0, 5, "float") == 0) {
+			components = type[5] - '0';
+		}
+		else {
+			CHECK(type == "float" || type == "int" || type == "uint");
+		}
+		CHECK(member.back() == ';');
+		member.pop_back();
+
+		size_t size = components * 4;
+		if (offset % 16 + size > 16) {
+			offset = (offset + 15) / 16 * 16;
+		}
+		members.push_back({ member, offset, size });
+		offset += size;
+	}
+	return members;
+}
+
+// D3D9 constants are placed one per float4 register with ": register(cN)".
+static std::vector<ShaderConstant> GetRegisterLayout(const std::string& source)
+{
+	std::vector<ShaderConstant> members;
+	std::istringstream lines(source);
+	std::string line;
+	while (std::getline(lines, line)) {
+		size_t reg = line.find(": register(c");
+		if (line.compare(0, 7, "float4 ") != 0 || reg == std::string::npos) {
+			continue;
+		}
+		std::string member = line.substr(7, line.find(' ', 7) - 7);
+		members.push_back({ member, static_cast<size_t>(std::stoi(line.substr(reg + 12))) * 16, 16 });
+	}
+	return members;
+}
+
+static void CheckYUVShaderConstants(const std::vector<ShaderConstant>& members)
+{
+	struct Field
+	{
+		const char* name;
+		size_t offset;
+		size_t size;
+	};
+	static const Field kFields[] = {
+		{ "Offset", offsetof(YUVShaderConstants, offset), sizeof(YUVShaderConstants::offset) },
+		{ "Rcoeff", offsetof(YUVShaderConstants, r), sizeof(YUVShaderConstants::r) },
+		{ "Gcoeff", offsetof(YUVShaderConstants, g), sizeof(YUVShaderConstants::g) },
+		{ "Bcoeff", offsetof(YUVShaderConstants, b), sizeof(YUVShaderConstants::b) },
+	};
+
+	CHECK(members.size() == 4);
+	for (size_t i = 0; i < members.size(); i++) {
+		CHECK(members[i].name == kFields[i].name);
+		CHECK(members[i].offset == kFields[i].offset);
+		CHECK(members[i].size == kFields[i].size);
+	}
+	CHECK(members.back().offset + members.back().size == sizeof(YUVShaderConstants));
+}
+
+// fxc is not available outside the Visual Studio build, so the cbuffer layout
+// is worked out from the shader sources and compared with the C++ struct that
+// is uploaded into it.
+static void TestShaderConstantLayout()
+{
+	// D3D11 constant buffer sizes must be a multiple of 16 bytes.
+	CHECK(sizeof(YUVShaderConstants) % 16 == 0);
+
+	static const char* kD3D11Shaders[] = {
+		"d3d11/d3d11_yuv.hlsl",
+		"d3d11/d3d11_nv12.hlsl",
+		"d3d11/d3d11_yuv_to_rgb.hlsl",
+		"d3d11/d3d11_yuv420_to_rgb.hlsl",
+	};
+	for (const char* path : kD3D11Shaders) {
+		CheckYUVShaderConstants(GetCBufferLayout(ReadShader(path), "ColorMatrix"));
+	}
+
+	CheckYUVShaderConstants(GetRegisterLayout(ReadShader("d3d9/d3d9_yuv.hlsl")));
+}
+
+static void TestKnownColors()
+{
+	uint8_t bgra[4];
+
+	// Limited range black and white.
+	for (ColorMatrix matrix : kMatrices) {
+		const YUVShaderConstants constants = GetYUVShaderConstants(matrix, COLOR_RANGE_LIMITED);
+		ShaderYUVToBGRA(constants, 16, 128, 128, bgra);
+		CHECK(bgra[0] == 0 && bgra[1] == 0 && bgra[2] == 0);
+		ShaderYUVToBGRA(constants, 235, 128, 128, bgra);
+		CHECK(bgra[0] == 255 && bgra[1] == 255 && bgra[2] == 255);
+	}
+
+	// Full range grey is unchanged.
+	ShaderYUVToBGRA(GetYUVShaderConstants(COLOR_MATRIX_BT709, COLOR_RANGE_FULL), 77, 128, 128, bgra);
+	CHECK(bgra[0] == 77 && bgra[1] == 77 && bgra[2] == 77);
+
+	// 75% red bars, BT.601 and BT.709 limited range.
+	ShaderYUVToBGRA(GetYUVShaderConstants(COLOR_MATRIX_BT601, COLOR_RANGE_LIMITED), 65, 100, 212, bgra);
+	CHECK_NEAR(bgra[2], 191, 2);
+	CHECK_NEAR(bgra[1], 0, 2);
+	CHECK_NEAR(bgra[0], 0, 2);
+	ShaderYUVToBGRA(GetYUVShaderConstants(COLOR_MATRIX_BT709, COLOR_RANGE_LIMITED), 51, 109, 212, bgra);
+	CHECK_NEAR(bgra[2], 191, 2);
+	CHECK_NEAR(bgra[1], 0, 2);
+	CHECK_NEAR(bgra[0], 0, 2);
+}
+
+static void TestColorMetadataCodes()
+{
+	CHECK(GetColorMatrix(0) == COLOR_MATRIX_BT601);
+	CHECK(GetColorMatrix(1) == COLOR_MATRIX_BT709);
+	CHECK(GetColorMatrix(2) == COLOR_MATRIX_BT601);
+	CHECK(GetColorMatrix(5) == COLOR_MATRIX_BT601);
+	CHECK(GetColorMatrix(6) == COLOR_MATRIX_BT601);
+	CHECK(GetColorMatrix(9) == COLOR_MATRIX_BT2020);
+	CHECK(GetColorMatrix(10) == COLOR_MATRIX_BT2020);
+
+	CHECK(GetColorRange(0) == COLOR_RANGE_LIMITED);
+	CHECK(GetColorRange(1) == COLOR_RANGE_LIMITED);
+	CHECK(GetColorRange(2) == COLOR_RANGE_FULL);
+}
+
+int main()
+{
+	RUN_TEST(TestShaderMatchesCPUTable);
+	RUN_TEST(TestShaderConstantLayout);
+	RUN_TEST(TestKnownColors);
+	RUN_TEST(TestColorMetadataCodes);
+	return 0;
+}
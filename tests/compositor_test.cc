@@ -0,0 +1,349 @@
+#include "compositor.h"
+#include "cpu_color_converter.h"
+#include "cpu_scaler.h"
+#include "renderer.h"
+#include "test.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using namespace DX;
+
+static PixelRect MakeRect(int left, int top, int right, int bottom)
+{
+	PixelRect rect;
+	rect.left = left;
+	rect.top = top;
+	rect.right = right;
+	rect.bottom = bottom;
+	return rect;
+}
+
+static CompositeLayer MakeLayer(PixelFrame* frame, const PixelRect& dst_rect, int z_order)
+{
+	CompositeLayer layer;
+	layer.frame = frame;
+	layer.dst_rect = dst_rect;
+	layer.z_order = z_order;
+	return layer;
+}
+
+static void FillSolid(PixelFrame* frame, uint32_t color)
+{
+	for (int y = 0; y < frame->height; y++) {
+		uint32_t* row = reinterpret_cast<uint32_t*>(frame->plane[0] + y * frame->pitch[0]);
+		std::fill(row, row + frame->width, color);
+	}
+}
+
+static void FillNoise(PixelFrame* frame, uint32_t seed)
+{
+	int row_bytes[3], rows[3];
+	GetPlaneSize(frame->format, frame->width, frame->height, row_bytes, rows);
+	for (int i = 0; i < 3; i++) {
+		for (int y = 0; y < rows[i]; y++) {
+			uint8_t* row = frame->plane[i] + y * frame->pitch[i];
+			for (int x = 0; x < row_bytes[i]; x++) {
+				seed = seed * 1664525 + 1013904223;
+				row[x] = static_cast<uint8_t>(seed >> 24);
+			}
+		}
+	}
+	// Opaque ARGB, the compositor does not blend.
+	if (frame->format == PIXEL_FORMAT_ARGB) {
+		for (int y = 0; y < frame->height; y++) {
+			for (int x = 0; x < frame->width; x++) {
+				frame->plane[0][y * frame->pitch[0] + x * 4 + 3] = 255;
+			}
+		}
+	}
+}
+
+// Changes only the pixels of rect, as a source reporting it as dirty would.
+static void FillRectNoise(PixelFrame* frame, const PixelRect& rect, uint32_t seed)
+{
+	for (int y = rect.top; y < rect.bottom; y++) {
+		for (int x = rect.left; x < rect.right; x++) {
+			seed = seed * 1664525 + 1013904223;
+			if (frame->format == PIXEL_FORMAT_ARGB) {
+				uint32_t* row = reinterpret_cast<uint32_t*>(frame->plane[0] + y * frame->pitch[0]);
+				row[x] = (seed >> 8) | 0xff000000;
+				continue;
+			}
+
+			// I420
+			frame->plane[0][y * frame->pitch[0] + x] = static_cast<uint8_t>(seed >> 24);
+			if (x % 2 == 0 && y % 2 == 0) {
+				frame->plane[1][y / 2 * frame->pitch[1] + x / 2] = static_cast<uint8_t>(seed >> 16);
+				frame->plane[2][y / 2 * frame->pitch[2] + x / 2] = static_cast<uint8_t>(seed >> 8);
+			}
+		}
+	}
+}
+
+static uint32_t GetPixel(const PixelFrame* frame, int x, int y)
+{
+	return reinterpret_cast<const uint32_t*>(frame->plane[0] + y * frame->pitch[0])[x];
+}
+
+// Nearest sampled ARGB layers drawn in z order over black.
+static void CheckNearestOutput(const PixelFrame* output, std::vector<CompositeLayer> layers)
+{
+	std::stable_sort(layers.begin(), layers.end(), [](const CompositeLayer& a, const CompositeLayer& b) {
+		return a.z_order < b.z_order;
+	});
+
+	for (int y = 0; y < output->height; y++) {
+		for (int x = 0; x < output->width; x++) {
+			uint32_t expected = 0xff000000;
+			for (auto& layer : layers) {
+				const PixelRect& rect = layer.dst_rect;
+				if (x < rect.left || x >= rect.right || y < rect.top || y >= rect.bottom) {
+					continue;
+				}
+				int src_x = (x - rect.left) * layer.frame->width / (rect.right - rect.left);
+				int src_y = (y - rect.top) * layer.frame->height / (rect.bottom - rect.top);
+				expected = GetPixel(layer.frame, src_x, src_y);
+			}
+			CHECK(GetPixel(output, x, y) == expected);
+		}
+	}
+}
+
+static bool IsSameOutput(const PixelFrame* a, const PixelFrame* b)
+{
+	for (int y = 0; y < a->height; y++) {
+		if (memcmp(a->plane[0] + y * a->pitch[0], b->plane[0] + y * b->pitch[0], a->width * 4) != 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void TestDamageMapsLayerRectsToOutput()
+{
+	PixelFramePool pool;
+	PixelFrame a, b;
+	pool.Alloc(64, 48, PIXEL_FORMAT_ARGB, &a);
+	pool.Alloc(64, 48, PIXEL_FORMAT_ARGB, &b);
+	FillNoise(&a, 1);
+	FillNoise(&b, 2);
+
+	Compositor compositor;
+	CHECK(compositor.Init(320, 240, NULL));
+
+	std::vector<CompositeLayer> layers;
+	layers.push_back(MakeLayer(&a, MakeRect(10, 20, 74, 68), 0));
+	layers.push_back(MakeLayer(&b, MakeRect(100, 100, 228, 196), 1));
+
+	compositor.Compose(layers);
+	CHECK(compositor.GetStats().last_pixels == 320 * 240);
+	CheckNearestOutput(compositor.GetOutput(), layers);
+
+	// Nothing updated, nothing redrawn.
+	layers[0].is_updated = false;
+	layers[1].is_updated = false;
+	compositor.Compose(layers);
+	CHECK(compositor.GetStats().last_pixels == 0);
+
+	// Unscaled damage is moved by the destination, scaled damage is scaled too.
+	a.dirty_rects.assign(1, MakeRect(8, 8, 24, 16));
+	b.dirty_rects.assign(1, MakeRect(4, 4, 8, 8));
+	FillRectNoise(&a, a.dirty_rects[0], 3);
+	FillRectNoise(&b, b.dirty_rects[0], 4);
+	layers[0].is_updated = true;
+	layers[1].is_updated = true;
+	compositor.Compose(layers);
+	CHECK(compositor.GetStats().last_pixels == 16 * 8 + 8 * 8);
+	CheckNearestOutput(compositor.GetOutput(), layers);
+
+	// Damage past the output edge is clipped.
+	layers[0].dst_rect = MakeRect(290, 200, 354, 248);
+	layers[1].is_updated = false;
+	compositor.Compose(layers);
+	a.dirty_rects.assign(1, MakeRect(0, 0, 64, 48));
+	compositor.Compose(layers);
+	CHECK(compositor.GetStats().last_pixels == 30 * 40);
+}
+
+static void TestZOrder()
+{
+	PixelFramePool pool;
+	PixelFrame red, green;
+	pool.Alloc(32, 32, PIXEL_FORMAT_ARGB, &red);
+	pool.Alloc(32, 32, PIXEL_FORMAT_ARGB, &green);
+	FillSolid(&red, 0xffff0000);
+	FillSolid(&green, 0xff00ff00);
+
+	Compositor compositor;
+	CHECK(compositor.Init(64, 64, NULL));
+
+	// Listed top first, drawn by z_order.
+	std::vector<CompositeLayer> layers;
+	layers.push_back(MakeLayer(&green, MakeRect(16, 16, 48, 48), 5));
+	layers.push_back(MakeLayer(&red, MakeRect(0, 0, 32, 32), -1));
+	compositor.Compose(layers);
+
+	const PixelFrame* output = compositor.GetOutput();
+	CHECK(GetPixel(output, 20, 20) == 0xff00ff00);
+	CHECK(GetPixel(output, 10, 10) == 0xffff0000);
+	CHECK(GetPixel(output, 40, 40) == 0xff00ff00);
+	CHECK(GetPixel(output, 60, 4) == 0xff000000);
+
+	// Equal z_order keeps the list order.
+	layers[0].z_order = 0;
+	layers[1].z_order = 0;
+	compositor.Compose(layers);
+	CHECK(GetPixel(compositor.GetOutput(), 20, 20) == 0xffff0000);
+
+	layers[1].z_order = -1;
+	compositor.Compose(layers);
+	CHECK(GetPixel(compositor.GetOutput(), 20, 20) == 0xff00ff00);
+	CheckNearestOutput(compositor.GetOutput(), layers);
+}
+
+static void TestNearestAndFilteredScaling()
+{
+	PixelFramePool pool;
+	PixelFrame frame;
+	pool.Alloc(40, 30, PIXEL_FORMAT_ARGB, &frame);
+	FillNoise(&frame, 5);
+
+	const PixelRect dst_rect = MakeRect(5, 7, 105, 82);
+	std::vector<CompositeLayer> layers;
+	layers.push_back(MakeLayer(&frame, dst_rect, 0));
+
+	Compositor compositor;
+	CHECK(compositor.Init(128, 96, NULL));
+	compositor.Compose(layers);
+	CheckNearestOutput(compositor.GetOutput(), layers);
+	CHECK(compositor.GetStats().last_converted_pixels == 0);
+
+	static const ScaleFilter kFilters[] = { SCALE_FILTER_BILINEAR, SCALE_FILTER_BICUBIC, SCALE_FILTER_LANCZOS3 };
+	for (ScaleFilter filter : kFilters) {
+		compositor.SetScaleFilter(filter);
+		compositor.Compose(layers);
+
+		int dst_width = dst_rect.right - dst_rect.left;
+		int dst_height = dst_rect.bottom - dst_rect.top;
+		std::vector<uint8_t> expected(dst_width * dst_height * 4);
+		ARGBScaler scaler;
+		CHECK(scaler.Init(frame.width, frame.height, dst_width, dst_height, filter));
+		scaler.Scale(frame.plane[0], frame.pitch[0], expected.data(), dst_width * 4);
+
+		const PixelFrame* output = compositor.GetOutput();
+		for (int y = 0; y < dst_height; y++) {
+			const uint8_t* row = output->plane[0] + (dst_rect.top + y) * output->pitch[0] + dst_rect.left * 4;
+			CHECK(memcmp(row, expected.data() + y * dst_width * 4, dst_width * 4) == 0);
+		}
+		CHECK(GetPixel(output, 4, 6) == 0xff000000);
+		CHECK(GetPixel(output, 105, 82) == 0xff000000);
+	}
+}
+
+static void TestStripesMatchReference()
+{
+	PixelFramePool pool;
+	std::vector<PixelFrame> frames(6);
+	for (size_t i = 0; i < frames.size(); i++) {
+		pool.Alloc(96 + static_cast<int>(i) * 10, 80 + static_cast<int>(i) * 6, PIXEL_FORMAT_ARGB, &frames[i]);
+		FillNoise(&frames[i], static_cast<uint32_t>(i) + 10);
+	}
+
+	// Unscaled, up-scaled, down-scaled and overlapping tiles.
+	std::vector<CompositeLayer> layers;
+	layers.push_back(MakeLayer(&frames[0], MakeRect(0, 0, 96, 80), 0));
+	layers.push_back(MakeLayer(&frames[1], MakeRect(90, 10, 406, 266), 1));
+	layers.push_back(MakeLayer(&frames[2], MakeRect(300, 200, 358, 249), 2));
+	layers.push_back(MakeLayer(&frames[3], MakeRect(20, 250, 146, 348), 0));
+	layers.push_back(MakeLayer(&frames[4], MakeRect(400, 300, 700, 500), 3));
+	layers.push_back(MakeLayer(&frames[5], MakeRect(-50, 380, 100, 490), 4));
+
+	// Large enough for the damage to be split into stripes on the WorkerPool.
+	Compositor compositor;
+	CHECK(compositor.Init(640, 479, NULL));
+	compositor.Compose(layers);
+	CHECK(compositor.GetStats().last_pixels == 640 * 479);
+	CheckNearestOutput(compositor.GetOutput(), layers);
+
+	frames[1].dirty_rects.assign(1, MakeRect(3, 5, 104, 84));
+	FillRectNoise(&frames[1], frames[1].dirty_rects[0], 99);
+	for (auto& layer : layers) {
+		layer.is_updated = layer.frame == &frames[1];
+	}
+	compositor.Compose(layers);
+	CHECK(compositor.GetStats().last_pixels > 256 * 256);
+	CheckNearestOutput(compositor.GetOutput(), layers);
+}
+
+// Composes the layers from scratch with the filter.
+static void ComposeReference(const std::vector<CompositeLayer>& layers, int width, int height,
+	ScaleFilter filter, Compositor* reference)
+{
+	CHECK(reference->Init(width, height, NULL));
+	reference->SetScaleFilter(filter);
+	reference->Compose(layers);
+}
+
+static void TestScaledLayerConvertsOnlyDirtyRects()
+{
+	PixelFramePool pool;
+	PixelFrame frame;
+	pool.Alloc(80, 60, PIXEL_FORMAT_I420, &frame);
+	FillNoise(&frame, 7);
+
+	// Half of the up-scaled layer is past the right and bottom edges.
+	std::vector<CompositeLayer> layers;
+	layers.push_back(MakeLayer(&frame, MakeRect(100, 80, 260, 200), 0));
+
+	Compositor compositor;
+	CHECK(compositor.Init(200, 150, NULL));
+	compositor.SetScaleFilter(SCALE_FILTER_BILINEAR);
+	compositor.Compose(layers);
+
+	// About 50x35 source pixels reach the output, plus the filter taps.
+	uint64_t visible_pixels = compositor.GetStats().last_converted_pixels;
+	CHECK(visible_pixels >= 50 * 35);
+	CHECK(visible_pixels <= 54 * 39);
+
+	// Only the dirty rect is converted again, the result matches converting
+	// the whole frame.
+	frame.dirty_rects.assign(1, MakeRect(10, 10, 20, 16));
+	FillRectNoise(&frame, frame.dirty_rects[0], 8);
+	compositor.Compose(layers);
+	CHECK(compositor.GetStats().last_converted_pixels == 10 * 6);
+	{
+		Compositor reference;
+		ComposeReference(layers, 200, 150, SCALE_FILTER_BILINEAR, &reference);
+		CHECK(IsSameOutput(compositor.GetOutput(), reference.GetOutput()));
+	}
+
+	// Odd dirty columns still convert whole chroma pairs.
+	frame.dirty_rects.assign(1, MakeRect(31, 3, 33, 7));
+	FillRectNoise(&frame, MakeRect(30, 2, 34, 8), 9);
+	compositor.Compose(layers);
+	CHECK(compositor.GetStats().last_converted_pixels == 4 * 6);
+	{
+		Compositor reference;
+		ComposeReference(layers, 200, 150, SCALE_FILTER_BILINEAR, &reference);
+		CHECK(IsSameOutput(compositor.GetOutput(), reference.GetOutput()));
+	}
+
+	// A dirty rect the output never shows is not converted.
+	frame.dirty_rects.assign(1, MakeRect(70, 50, 80, 60));
+	FillRectNoise(&frame, frame.dirty_rects[0], 10);
+	compositor.Compose(layers);
+	CHECK(compositor.GetStats().last_converted_pixels == 0);
+	CHECK(compositor.GetStats().last_pixels == 0);
+}
+
+int main()
+{
+	RUN_TEST(TestDamageMapsLayerRectsToOutput);
+	RUN_TEST(TestZOrder);
+	RUN_TEST(TestNearestAndFilteredScaling);
+	RUN_TEST(TestStripesMatchReference);
+	RUN_TEST(TestScaledLayerConvertsOnlyDirtyRects);
+	return 0;
+}
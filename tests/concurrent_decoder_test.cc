@@ -0,0 +1,88 @@
+#include "concurrent_decoder.h"
+#include "test.h"
+
+#include <chrono>
+#include <thread>
+
+// Blocks like a hardware decode and returns a frame as wide as the packet.
+class FakeDecoder : public AVDecoder
+{
+public:
+	FakeDecoder(int latency_ms) : latency_ms_(latency_ms) {}
+
+	virtual bool Init() { return true; }
+	virtual void Destroy() {}
+
+	virtual int Send(std::vector<uint8_t>& frame)
+	{
+		if (frame.empty()) {
+			return AVERROR(EINVAL);
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(latency_ms_));
+		packet_size_ = static_cast<int>(frame.size());
+		return 0;
+	}
+
+	virtual int Recv(std::shared_ptr<AVFrame>& frame)
+	{
+		frame.reset(av_frame_alloc(), [](AVFrame* frame) { av_frame_free(&frame); });
+		frame->width = packet_size_;
+		return 0;
+	}
+
+private:
+	int latency_ms_ = 0;
+	int packet_size_ = 0;
+};
+
+static void TestStreamsOverlap()
+{
+	FakeDecoder yuv420_decoder(40);
+	FakeDecoder chroma420_decoder(30);
+	std::vector<uint8_t> packets[2] = { std::vector<uint8_t>(100), std::vector<uint8_t>(50) };
+
+	ConcurrentDecoder decoder;
+	for (int i = 0; i < 3; i++) {
+		DecodeTask tasks[2];
+		tasks[0].decoder = &yuv420_decoder;
+		tasks[0].packet = &packets[0];
+		tasks[1].decoder = &chroma420_decoder;
+		tasks[1].packet = &packets[1];
+
+		auto start_time = std::chrono::steady_clock::now();
+		decoder.Run(tasks, 2);
+		double elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+
+		// Back to back would take at least 70 ms.
+		CHECK(elapsed_ms < 65.0);
+		CHECK(tasks[0].result >= 0 && tasks[0].frame && tasks[0].frame->width == 100);
+		CHECK(tasks[1].result >= 0 && tasks[1].frame && tasks[1].frame->width == 50);
+		CHECK(tasks[0].decode_ms >= 39.0);
+		CHECK(tasks[1].decode_ms >= 29.0);
+	}
+}
+
+static void TestFailedSendHasNoFrame()
+{
+	FakeDecoder decoder(0);
+	std::vector<uint8_t> packets[2] = { std::vector<uint8_t>(10), std::vector<uint8_t>() };
+
+	DecodeTask tasks[2];
+	for (int i = 0; i < 2; i++) {
+		tasks[i].decoder = &decoder;
+		tasks[i].packet = &packets[i];
+	}
+
+	ConcurrentDecoder concurrent_decoder;
+	concurrent_decoder.Run(tasks, 1);
+	concurrent_decoder.Run(tasks + 1, 1);
+	CHECK(tasks[0].result >= 0 && tasks[0].frame);
+	CHECK(tasks[1].result < 0 && !tasks[1].frame);
+}
+
+int main()
+{
+	RUN_TEST(TestStreamsOverlap);
+	RUN_TEST(TestFailedSendHasNoFrame);
+	return 0;
+}
@@ -0,0 +1,100 @@
+#include "concurrent_encoder.h"
+#include "mock_video_encoder.h"
+#include "renderer.h"
+#include "test.h"
+
+#include <chrono>
+
+using namespace DX;
+
+static uint32_t ReadUint32(const std::vector<uint8_t>& data, size_t offset)
+{
+	return data[offset] | (data[offset + 1] << 8) | (data[offset + 2] << 16) | (static_cast<uint32_t>(data[offset + 3]) << 24);
+}
+
+static void TestStreamsOverlap()
+{
+	MockVideoEncoder yuv420_encoder(40000);
+	MockVideoEncoder chroma420_encoder(30000);
+	CHECK(yuv420_encoder.Init());
+	CHECK(chroma420_encoder.Init());
+
+	PixelFramePool pool;
+	PixelFrame frame;
+	pool.Alloc(320, 180, PIXEL_FORMAT_NV12, &frame);
+
+	ConcurrentEncoder encoder;
+	std::vector<uint8_t> out_frames[2];
+
+	for (int i = 0; i < 3; i++) {
+		EncodeTask tasks[2];
+		tasks[0].encoder = &yuv420_encoder;
+		tasks[0].input.frame = &frame;
+		tasks[0].out_frame = &out_frames[0];
+		tasks[1].encoder = &chroma420_encoder;
+		tasks[1].input.frame = &frame;
+		tasks[1].out_frame = &out_frames[1];
+
+		auto start_time = std::chrono::steady_clock::now();
+		encoder.Run(tasks, 2);
+		double elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+
+		// Back to back would take at least 70 ms.
+		CHECK(elapsed_ms < 65.0);
+		for (int j = 0; j < 2; j++) {
+			CHECK(tasks[j].frame_size == 12);
+			CHECK(out_frames[j].size() == 12);
+			CHECK(ReadUint32(out_frames[j], 0) == static_cast<uint32_t>(i));
+			CHECK(ReadUint32(out_frames[j], 4) == 320);
+			CHECK(ReadUint32(out_frames[j], 8) == 180);
+		}
+		CHECK(tasks[0].encode_ms >= 39.0);
+		CHECK(tasks[1].encode_ms >= 29.0);
+	}
+
+	CHECK(yuv420_encoder.GetEncodedFrames() == 3);
+	CHECK(chroma420_encoder.GetEncodedFrames() == 3);
+}
+
+static void TestErrorsAreReportedPerTask()
+{
+	MockVideoEncoder encoder(0);
+	MockVideoEncoder uninitialized_encoder(0);
+	CHECK(encoder.Init());
+
+	PixelFramePool pool;
+	PixelFrame frame;
+	pool.Alloc(64, 64, PIXEL_FORMAT_NV12, &frame);
+
+	std::vector<uint8_t> out_frames[3];
+	EncodeTask tasks[3];
+	tasks[0].encoder = &encoder;
+	tasks[0].input.frame = &frame;
+	tasks[1].encoder = &uninitialized_encoder;
+	tasks[1].input.frame = &frame;
+	tasks[2].encoder = &encoder;
+	for (int i = 0; i < 3; i++) {
+		tasks[i].out_frame = &out_frames[i];
+	}
+
+	// Task 1 has an uninitialized encoder and task 2 no input.
+	ConcurrentEncoder concurrent_encoder;
+	concurrent_encoder.Run(tasks, 1);
+	concurrent_encoder.Run(tasks + 1, 2);
+
+	CHECK(tasks[0].frame_size == 12);
+	CHECK(tasks[1].frame_size < 0);
+	CHECK(tasks[2].frame_size < 0);
+	CHECK(encoder.GetEncodedFrames() == 1);
+
+	concurrent_encoder.Destroy();
+	concurrent_encoder.Run(tasks, 1);
+	CHECK(encoder.GetEncodedFrames() == 2);
+}
+
+int main()
+{
+	RUN_TEST(TestStreamsOverlap);
+	RUN_TEST(TestErrorsAreReportedPerTask);
+	return 0;
+}
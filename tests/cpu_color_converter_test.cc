@@ -0,0 +1,501 @@
+#include "cpu_color_converter.h"
+#include "color_matrix.h"
+#include "renderer.h"
+#include "test.h"
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using namespace DX;
+
+static const ColorMatrix kMatrices[] = { COLOR_MATRIX_BT601, COLOR_MATRIX_BT709, COLOR_MATRIX_BT2020 };
+static const ColorRange kRanges[] = { COLOR_RANGE_LIMITED, COLOR_RANGE_FULL };
+
+// 1 and 7 only run the scalar loop, the others add tails of 1 to 7 pixels
+// after the 8 pixel SSE2 blocks.
+static const int kWidths[] = { 1, 7, 8, 9, 15, 17, 31, 33 };
+
+// The 6-bit fixed point coefficients and the 8-bit chroma of the 10-bit paths
+// keep the kernels within this many codes of the exact result, BT.2020 full
+// range green reaches it at the chroma extremes. The errors go both ways, a
+// mean further from 0 than kMaxMeanError is a bias in the kernel.
+static const int kTolerance = 3;
+static const double kMaxMeanError = 0.25;
+
+struct ErrorStats
+{
+	long long sum = 0;
+	long long count = 0;
+};
+
+static uint16_t NextSample(uint32_t* seed)
+{
+	*seed = *seed * 1664525 + 1013904223;
+	return static_cast<uint16_t>(*seed >> 22);
+}
+
+// Random 10-bit codes, with whole rows at the smallest and largest code and a
+// pair of extremes inside the others.
+static uint16_t Sample10(int x, int y, uint32_t* seed)
+{
+	if (y == 0) {
+		return 0;
+	}
+	if (y == 1) {
+		return 1023;
+	}
+	uint16_t value = NextSample(seed);
+	if (x % 5 == 0) {
+		return 0;
+	}
+	if (x % 5 == 1) {
+		return 1023;
+	}
+	return value;
+}
+
+// Float model of color_matrix.h on samples in 8-bit units, rounded to nearest.
+static void YUVToBGRAReference(ColorMatrix matrix, ColorRange range, double y, double u, double v, uint8_t bgra[4])
+{
+	const YUVToRGBCoefficients k = GetYUVToRGBCoefficients(matrix, range);
+	const double luma = k.y_scale * (y - k.y_offset);
+	const double rgb[3] = {
+		luma + k.rv * (v - 128.0),
+		luma + k.gu * (u - 128.0) + k.gv * (v - 128.0),
+		luma + k.bu * (u - 128.0),
+	};
+	for (int c = 0; c < 3; c++) {
+		double value = std::floor(rgb[c] + 0.5);
+		bgra[2 - c] = static_cast<uint8_t>(value < 0.0 ? 0.0 : (value > 255.0 ? 255.0 : value));
+	}
+	bgra[3] = 255;
+}
+
+static void CheckRow(const uint8_t* bgra, const uint8_t* expected, int width, ErrorStats* stats)
+{
+	for (int x = 0; x < width; x++) {
+		for (int c = 0; c < 4; c++) {
+			CHECK_NEAR(bgra[x * 4 + c], expected[x * 4 + c], kTolerance);
+			stats->sum += bgra[x * 4 + c] - expected[x * 4 + c];
+			stats->count++;
+		}
+	}
+}
+
+static void CheckUnbiased(const ErrorStats& stats)
+{
+	CHECK(std::fabs(static_cast<double>(stats.sum) / stats.count) < kMaxMeanError);
+}
+
+static void CheckI010(int width, int height, ColorMatrix matrix, ColorRange range, uint32_t seed, ErrorStats* stats)
+{
+	PixelFramePool pool;
+	PixelFrame frame;
+	CHECK(pool.Alloc(width, height, PIXEL_FORMAT_I010, &frame));
+
+	for (int y = 0; y < height; y++) {
+		uint16_t* row_y = reinterpret_cast<uint16_t*>(frame.plane[0] + y * frame.pitch[0]);
+		for (int x = 0; x < width; x++) {
+			// Bits above the low 10 are ignored.
+			row_y[x] = static_cast<uint16_t>(Sample10(x, y, &seed) | (x % 3 == 2 ? 0xfc00 : 0));
+		}
+	}
+	for (int y = 0; y < (height + 1) / 2; y++) {
+		uint16_t* row_u = reinterpret_cast<uint16_t*>(frame.plane[1] + y * frame.pitch[1]);
+		uint16_t* row_v = reinterpret_cast<uint16_t*>(frame.plane[2] + y * frame.pitch[2]);
+		for (int x = 0; x < (width + 1) / 2; x++) {
+			row_u[x] = Sample10(x, y, &seed);
+			row_v[x] = Sample10(x + 3, y, &seed);
+		}
+	}
+
+	std::vector<uint8_t> bgra(static_cast<size_t>(width) * height * 4);
+	I010ToBGRA(frame.plane[0], frame.pitch[0], frame.plane[1], frame.pitch[1], frame.plane[2], frame.pitch[2],
+		bgra.data(), width * 4, width, height, matrix, range);
+
+	std::vector<uint8_t> expected(static_cast<size_t>(width) * 4);
+	for (int y = 0; y < height; y++) {
+		const uint16_t* row_y = reinterpret_cast<const uint16_t*>(frame.plane[0] + y * frame.pitch[0]);
+		const uint16_t* row_u = reinterpret_cast<const uint16_t*>(frame.plane[1] + (y / 2) * frame.pitch[1]);
+		const uint16_t* row_v = reinterpret_cast<const uint16_t*>(frame.plane[2] + (y / 2) * frame.pitch[2]);
+		for (int x = 0; x < width; x++) {
+			YUVToBGRAReference(matrix, range, (row_y[x] & 0x3ff) / 4.0, row_u[x / 2] / 4.0, row_v[x / 2] / 4.0,
+				&expected[x * 4]);
+		}
+		CheckRow(&bgra[static_cast<size_t>(y) * width * 4], expected.data(), width, stats);
+	}
+}
+
+static void CheckP010(int width, int height, ColorMatrix matrix, ColorRange range, uint32_t seed, ErrorStats* stats)
+{
+	PixelFramePool pool;
+	PixelFrame frame;
+	CHECK(pool.Alloc(width, height, PIXEL_FORMAT_P010, &frame));
+
+	for (int y = 0; y < height; y++) {
+		uint16_t* row_y = reinterpret_cast<uint16_t*>(frame.plane[0] + y * frame.pitch[0]);
+		for (int x = 0; x < width; x++) {
+			row_y[x] = static_cast<uint16_t>(Sample10(x, y, &seed) << 6);
+		}
+	}
+	for (int y = 0; y < (height + 1) / 2; y++) {
+		uint16_t* row_uv = reinterpret_cast<uint16_t*>(frame.plane[1] + y * frame.pitch[1]);
+		for (int x = 0; x < (width + 1) / 2; x++) {
+			row_uv[x * 2 + 0] = static_cast<uint16_t>(Sample10(x, y, &seed) << 6);
+			row_uv[x * 2 + 1] = static_cast<uint16_t>(Sample10(x + 3, y, &seed) << 6);
+		}
+	}
+
+	std::vector<uint8_t> bgra(static_cast<size_t>(width) * height * 4);
+	P010ToBGRA(frame.plane[0], frame.pitch[0], frame.plane[1], frame.pitch[1],
+		bgra.data(), width * 4, width, height, matrix, range);
+
+	std::vector<uint8_t> expected(static_cast<size_t>(width) * 4);
+	for (int y = 0; y < height; y++) {
+		const uint16_t* row_y = reinterpret_cast<const uint16_t*>(frame.plane[0] + y * frame.pitch[0]);
+		const uint16_t* row_uv = reinterpret_cast<const uint16_t*>(frame.plane[1] + (y / 2) * frame.pitch[1]);
+		for (int x = 0; x < width; x++) {
+			YUVToBGRAReference(matrix, range, (row_y[x] >> 6) / 4.0,
+				(row_uv[(x / 2) * 2] >> 6) / 4.0, (row_uv[(x / 2) * 2 + 1] >> 6) / 4.0, &expected[x * 4]);
+		}
+		CheckRow(&bgra[static_cast<size_t>(y) * width * 4], expected.data(), width, stats);
+	}
+}
+
+static void TestI010MatchesReference()
+{
+	uint32_t seed = 1;
+	for (ColorMatrix matrix : kMatrices) {
+		for (ColorRange range : kRanges) {
+			ErrorStats stats;
+			for (int width : kWidths) {
+				CheckI010(width, 6, matrix, range, seed++, &stats);
+			}
+			CheckUnbiased(stats);
+		}
+	}
+}
+
+static void TestP010MatchesReference()
+{
+	uint32_t seed = 101;
+	for (ColorMatrix matrix : kMatrices) {
+		for (ColorRange range : kRanges) {
+			ErrorStats stats;
+			for (int width : kWidths) {
+				CheckP010(width, 6, matrix, range, seed++, &stats);
+			}
+			CheckUnbiased(stats);
+		}
+	}
+}
+
+// The low 6 bits of P010 samples are padding, the SSE2 block and the tail both
+// drop them so the output is the same as with the bits cleared.
+static void TestP010IgnoresLowBits()
+{
+	const int width = 17;
+	const int height = 2;
+
+	uint32_t seed = 7;
+	std::vector<uint16_t> clean_y(width * height), padded_y(width * height);
+	std::vector<uint16_t> clean_uv(width + 1), padded_uv(width + 1);
+	for (size_t i = 0; i < clean_y.size(); i++) {
+		clean_y[i] = static_cast<uint16_t>(Sample10(static_cast<int>(i % width), static_cast<int>(i / width), &seed) << 6);
+		seed = seed * 1664525 + 1013904223;
+		padded_y[i] = static_cast<uint16_t>(clean_y[i] | (seed >> 26));
+	}
+	for (size_t i = 0; i < clean_uv.size(); i++) {
+		clean_uv[i] = static_cast<uint16_t>(Sample10(static_cast<int>(i), 0, &seed) << 6);
+		seed = seed * 1664525 + 1013904223;
+		padded_uv[i] = static_cast<uint16_t>(clean_uv[i] | (seed >> 26));
+	}
+	// All low bits set where the rounding is most likely to tip.
+	padded_y[0] = static_cast<uint16_t>(clean_y[0] | 0x3f);
+	padded_y[width - 1] = static_cast<uint16_t>(clean_y[width - 1] | 0x3f);
+
+	for (ColorMatrix matrix : kMatrices) {
+		for (ColorRange range : kRanges) {
+			std::vector<uint8_t> clean(width * height * 4), padded(width * height * 4);
+			P010ToBGRA(reinterpret_cast<const uint8_t*>(clean_y.data()), width * 2,
+				reinterpret_cast<const uint8_t*>(clean_uv.data()), 0, clean.data(), width * 4, width, height, matrix, range);
+			P010ToBGRA(reinterpret_cast<const uint8_t*>(padded_y.data()), width * 2,
+				reinterpret_cast<const uint8_t*>(padded_uv.data()), 0, padded.data(), width * 4, width, height, matrix, range);
+			CHECK(clean == padded);
+		}
+	}
+}
+
+// A row of one 10-bit Y code with neutral chroma through both kernels, in the
+// SSE2 block and in the tail.
+static void CheckGrey(ColorMatrix matrix, ColorRange range, int code, uint8_t expected)
+{
+	const int width = 9;
+	std::vector<uint16_t> y_row(width, static_cast<uint16_t>(code));
+	std::vector<uint16_t> uv_row(width + 1, 512);
+	std::vector<uint16_t> p010_y(width, static_cast<uint16_t>(code << 6));
+	std::vector<uint16_t> p010_uv(width + 1, 512 << 6);
+	std::vector<uint8_t> bgra(width * 4);
+
+	I010ToBGRA(reinterpret_cast<const uint8_t*>(y_row.data()), width * 2,
+		reinterpret_cast<const uint8_t*>(uv_row.data()), width + 1,
+		reinterpret_cast<const uint8_t*>(uv_row.data()), width + 1,
+		bgra.data(), width * 4, width, 1, matrix, range);
+	for (int x = 0; x < width; x++) {
+		CHECK(bgra[x * 4 + 0] == expected && bgra[x * 4 + 1] == expected && bgra[x * 4 + 2] == expected);
+		CHECK(bgra[x * 4 + 3] == 255);
+	}
+
+	P010ToBGRA(reinterpret_cast<const uint8_t*>(p010_y.data()), width * 2,
+		reinterpret_cast<const uint8_t*>(p010_uv.data()), (width + 1) * 2,
+		bgra.data(), width * 4, width, 1, matrix, range);
+	for (int x = 0; x < width; x++) {
+		CHECK(bgra[x * 4 + 0] == expected && bgra[x * 4 + 1] == expected && bgra[x * 4 + 2] == expected);
+		CHECK(bgra[x * 4 + 3] == 255);
+	}
+}
+
+static void TestBT709FullRangeExtremes()
+{
+	CheckGrey(COLOR_MATRIX_BT709, COLOR_RANGE_FULL, 0, 0);
+	CheckGrey(COLOR_MATRIX_BT709, COLOR_RANGE_FULL, 1023, 255);
+	// 10-bit code 512 is 8-bit 128.
+	CheckGrey(COLOR_MATRIX_BT709, COLOR_RANGE_FULL, 512, 128);
+}
+
+// A 10-bit code is 4x the 8-bit one, limited range black and white are 64 and 940.
+static void TestLimitedRangeBlackAndWhite()
+{
+	for (ColorMatrix matrix : kMatrices) {
+		CheckGrey(matrix, COLOR_RANGE_LIMITED, 64, 0);
+		CheckGrey(matrix, COLOR_RANGE_LIMITED, 940, 255);
+		CheckGrey(matrix, COLOR_RANGE_LIMITED, 0, 0);
+		CheckGrey(matrix, COLOR_RANGE_LIMITED, 1023, 255);
+	}
+}
+
+static const PixelFormat kFormats[] = {
+	PIXEL_FORMAT_YUY2, PIXEL_FORMAT_UYVY, PIXEL_FORMAT_I422, PIXEL_FORMAT_RGB24, PIXEL_FORMAT_RGBA,
+};
+
+static bool IsRGB(PixelFormat format)
+{
+	return format == PIXEL_FORMAT_RGB24 || format == PIXEL_FORMAT_RGBA;
+}
+
+// Random bytes in every plane, with whole rows of 0 and 255 and a pair of
+// extremes inside the others.
+static void FillFrame(PixelFrame* frame, uint32_t seed)
+{
+	int row_bytes[3], rows[3];
+	CHECK(GetPlaneSize(frame->format, frame->width, frame->height, row_bytes, rows));
+	for (int i = 0; i < 3; i++) {
+		for (int y = 0; y < rows[i]; y++) {
+			uint8_t* row = frame->plane[i] + y * frame->pitch[i];
+			for (int x = 0; x < row_bytes[i]; x++) {
+				row[x] = static_cast<uint8_t>(Sample10(x, y, &seed) >> 2);
+			}
+		}
+	}
+}
+
+// Pixel (x, y) of frame read straight from its layout.
+static void ReferenceBGRA(const PixelFrame& frame, int x, int y, uint8_t bgra[4])
+{
+	const uint8_t* row = frame.plane[0] + y * frame.pitch[0];
+
+	switch (frame.format) {
+	case PIXEL_FORMAT_YUY2:
+		YUVToBGRAReference(frame.color_matrix, frame.color_range,
+			row[x * 2], row[(x / 2) * 4 + 1], row[(x / 2) * 4 + 3], bgra);
+		break;
+	case PIXEL_FORMAT_UYVY:
+		YUVToBGRAReference(frame.color_matrix, frame.color_range,
+			row[x * 2 + 1], row[(x / 2) * 4], row[(x / 2) * 4 + 2], bgra);
+		break;
+	case PIXEL_FORMAT_I422:
+		YUVToBGRAReference(frame.color_matrix, frame.color_range, row[x],
+			frame.plane[1][y * frame.pitch[1] + x / 2], frame.plane[2][y * frame.pitch[2] + x / 2], bgra);
+		break;
+	case PIXEL_FORMAT_RGB24:
+		bgra[0] = row[x * 3 + 0];
+		bgra[1] = row[x * 3 + 1];
+		bgra[2] = row[x * 3 + 2];
+		bgra[3] = 255;
+		break;
+	case PIXEL_FORMAT_RGBA:
+		bgra[0] = row[x * 4 + 2];
+		bgra[1] = row[x * 4 + 1];
+		bgra[2] = row[x * 4 + 0];
+		bgra[3] = row[x * 4 + 3];
+		break;
+	default:
+		CHECK(false);
+	}
+}
+
+// The whole frame through the public converter of its format.
+static void ConvertFrame(const PixelFrame& frame, uint8_t* dst, int dst_pitch)
+{
+	switch (frame.format) {
+	case PIXEL_FORMAT_YUY2:
+		YUY2ToBGRA(frame.plane[0], frame.pitch[0], dst, dst_pitch, frame.width, frame.height,
+			frame.color_matrix, frame.color_range);
+		break;
+	case PIXEL_FORMAT_UYVY:
+		UYVYToBGRA(frame.plane[0], frame.pitch[0], dst, dst_pitch, frame.width, frame.height,
+			frame.color_matrix, frame.color_range);
+		break;
+	case PIXEL_FORMAT_I422:
+		I422ToBGRA(frame.plane[0], frame.pitch[0], frame.plane[1], frame.pitch[1], frame.plane[2], frame.pitch[2],
+			dst, dst_pitch, frame.width, frame.height, frame.color_matrix, frame.color_range);
+		break;
+	case PIXEL_FORMAT_RGB24:
+		RGB24ToBGRA(frame.plane[0], frame.pitch[0], dst, dst_pitch, frame.width, frame.height);
+		break;
+	case PIXEL_FORMAT_RGBA:
+		RGBAToBGRA(frame.plane[0], frame.pitch[0], dst, dst_pitch, frame.width, frame.height);
+		break;
+	default:
+		CHECK(false);
+	}
+}
+
+static void CheckFormat(PixelFormat format, int width, int height, ColorMatrix matrix, ColorRange range,
+	uint32_t seed, ErrorStats* stats)
+{
+	PixelFramePool pool;
+	PixelFrame frame;
+	CHECK(pool.Alloc(width, height, format, &frame));
+	frame.color_matrix = matrix;
+	frame.color_range = range;
+	FillFrame(&frame, seed);
+
+	std::vector<uint8_t> bgra(static_cast<size_t>(width) * height * 4);
+	ConvertFrame(frame, bgra.data(), width * 4);
+
+	std::vector<uint8_t> expected(static_cast<size_t>(width) * 4);
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			ReferenceBGRA(frame, x, y, &expected[x * 4]);
+		}
+		if (IsRGB(format)) {
+			CHECK(memcmp(&bgra[static_cast<size_t>(y) * width * 4], expected.data(), width * 4) == 0);
+		}
+		else {
+			CheckRow(&bgra[static_cast<size_t>(y) * width * 4], expected.data(), width, stats);
+		}
+	}
+}
+
+static void TestPackedAndRGBMatchReference()
+{
+	uint32_t seed = 201;
+	for (PixelFormat format : kFormats) {
+		for (ColorMatrix matrix : kMatrices) {
+			for (ColorRange range : kRanges) {
+				ErrorStats stats;
+				for (int width : kWidths) {
+					CheckFormat(format, width, 5, matrix, range, seed++, &stats);
+				}
+				if (!IsRGB(format)) {
+					CheckUnbiased(stats);
+				}
+			}
+		}
+	}
+}
+
+static void CheckPacked422ToI422(PixelFormat format, int width, uint32_t seed)
+{
+	const int height = 3;
+	const int uv_offset = format == PIXEL_FORMAT_YUY2 ? 1 : 0;
+
+	PixelFramePool pool;
+	PixelFrame packed, i422;
+	CHECK(pool.Alloc(width, height, format, &packed));
+	CHECK(pool.Alloc(width, height, PIXEL_FORMAT_I422, &i422));
+	FillFrame(&packed, seed);
+
+	if (format == PIXEL_FORMAT_YUY2) {
+		YUY2ToI422(packed.plane[0], packed.pitch[0], i422.plane[0], i422.pitch[0],
+			i422.plane[1], i422.pitch[1], i422.plane[2], i422.pitch[2], width, height);
+	}
+	else {
+		UYVYToI422(packed.plane[0], packed.pitch[0], i422.plane[0], i422.pitch[0],
+			i422.plane[1], i422.pitch[1], i422.plane[2], i422.pitch[2], width, height);
+	}
+
+	for (int y = 0; y < height; y++) {
+		const uint8_t* src = packed.plane[0] + y * packed.pitch[0];
+		for (int x = 0; x < width; x++) {
+			CHECK(i422.plane[0][y * i422.pitch[0] + x] == src[x * 2 + 1 - uv_offset]);
+		}
+		for (int x = 0; x < (width + 1) / 2; x++) {
+			CHECK(i422.plane[1][y * i422.pitch[1] + x] == src[x * 4 + uv_offset]);
+			CHECK(i422.plane[2][y * i422.pitch[2] + x] == src[x * 4 + uv_offset + 2]);
+		}
+	}
+}
+
+static void TestPacked422ToI422()
+{
+	// The SSE2 loop takes 16 pixels at a time.
+	static const int kSplitWidths[] = { 1, 7, 15, 16, 17, 31, 33, 47 };
+
+	uint32_t seed = 301;
+	for (int width : kSplitWidths) {
+		CheckPacked422ToI422(PIXEL_FORMAT_YUY2, width, seed++);
+		CheckPacked422ToI422(PIXEL_FORMAT_UYVY, width, seed++);
+	}
+}
+
+// A span of a row converts to the same pixels as the whole frame, wherever the
+// SSE2 blocks fall, and writes nothing past x1.
+static void TestFrameRowToBGRA()
+{
+	const int width = 37;
+	const int height = 3;
+	const uint8_t kGuard = 0xa5;
+
+	uint32_t seed = 401;
+	for (PixelFormat format : kFormats) {
+		PixelFramePool pool;
+		PixelFrame frame;
+		CHECK(pool.Alloc(width, height, format, &frame));
+		frame.color_matrix = COLOR_MATRIX_BT709;
+		frame.color_range = COLOR_RANGE_FULL;
+		FillFrame(&frame, seed++);
+
+		std::vector<uint8_t> whole(static_cast<size_t>(width) * height * 4);
+		ConvertFrame(frame, whole.data(), width * 4);
+
+		for (int y = 0; y < height; y++) {
+			for (int x0 : { 0, 2, 6, 10 }) {
+				for (int x1 : { x0 + 1, x0 + 9, x0 + 17, width }) {
+					std::vector<uint8_t> row(static_cast<size_t>(x1 - x0) * 4 + 4, kGuard);
+					FrameRowToBGRA(&frame, y, x0, x1, row.data());
+
+					CHECK(memcmp(row.data(), &whole[(static_cast<size_t>(y) * width + x0) * 4], (x1 - x0) * 4) == 0);
+					for (int i = 0; i < 4; i++) {
+						CHECK(row[(x1 - x0) * 4 + i] == kGuard);
+					}
+				}
+			}
+		}
+	}
+}
+
+int main()
+{
+	RUN_TEST(TestI010MatchesReference);
+	RUN_TEST(TestP010MatchesReference);
+	RUN_TEST(TestP010IgnoresLowBits);
+	RUN_TEST(TestBT709FullRangeExtremes);
+	RUN_TEST(TestLimitedRangeBlackAndWhite);
+	RUN_TEST(TestPackedAndRGBMatchReference);
+	RUN_TEST(TestPacked422ToI422);
+	RUN_TEST(TestFrameRowToBGRA);
+	return 0;
+}
@@ -0,0 +1,231 @@
+#include "cpu_rgb_to_yuv_converter.h"
+#include "chroma_tile_mask.h"
+#include "renderer.h"
+#include "test.h"
+
+#include <cmath>
+
+using namespace DX;
+
+static const double kYCoeff[3] = {  0.257,  0.504,  0.098 };
+static const double kUCoeff[3] = { -0.148, -0.291,  0.439 };
+static const double kVCoeff[3] = {  0.439, -0.368, -0.071 };
+static const double kYOffset = 0.062;
+static const double kUVOffset = 0.501;
+
+static void FillImage(PixelFrame* frame, uint32_t seed)
+{
+	for (int y = 0; y < frame->height; y++) {
+		uint8_t* row = frame->plane[0] + y * frame->pitch[0];
+		for (int x = 0; x < frame->width; x++) {
+			seed = seed * 1664525 + 1013904223;
+			row[x * 4 + 0] = static_cast<uint8_t>(seed >> 24);
+			row[x * 4 + 1] = static_cast<uint8_t>(seed >> 16);
+			row[x * 4 + 2] = static_cast<uint8_t>(seed >> 8);
+			// Alpha does not take part in the conversion.
+			row[x * 4 + 3] = static_cast<uint8_t>(seed);
+		}
+	}
+
+	// The extremes, where the limited range formulas reach 16/235 and 16/240.
+	static const uint8_t kCorners[][3] = { { 0, 0, 0 }, { 255, 255, 255 }, { 255, 0, 0 }, { 0, 0, 255 } };
+	for (int i = 0; i < 4; i++) {
+		uint8_t* pixel = frame->plane[0] + (i % 2) * frame->pitch[0] + i * 4;
+		pixel[0] = kCorners[i][0];
+		pixel[1] = kCorners[i][1];
+		pixel[2] = kCorners[i][2];
+	}
+}
+
+// Point sampling of the RGB texture, texture coordinates snapped to 8 bits of
+// sub-texel precision first as D3D11 does, so the shader's texel edge
+// coordinates pick the texel to their right.
+static const uint8_t* SamplePoint(const PixelFrame& frame, double u, double v)
+{
+	int x = static_cast<int>(std::floor(std::floor(u * frame.width * 256.0 + 0.5) / 256.0));
+	int y = static_cast<int>(std::floor(std::floor(v * frame.height * 256.0 + 0.5) / 256.0));
+	x = x < 0 ? 0 : (x >= frame.width ? frame.width - 1 : x);
+	y = y < 0 ? 0 : (y >= frame.height ? frame.height - 1 : y);
+	return frame.plane[0] + y * frame.pitch[0] + x * 4;
+}
+
+// dot(rgb, coeff) + offset written to a UNORM target, rounded half up.
+static uint8_t DotToUnorm8(const uint8_t* bgra, const double coeff[3], double offset)
+{
+	double value = bgra[2] / 255.0 * coeff[0] + bgra[1] / 255.0 * coeff[1] + bgra[0] / 255.0 * coeff[2] + offset;
+	value = value < 0.0 ? 0.0 : (value > 1.0 ? 1.0 : value);
+	return static_cast<uint8_t>(std::floor(value * 255.0 + 0.5 + 1e-9));
+}
+
+// Scalar port of d3d11_rgb_to_yuv420.hlsl. (x, y) is the render target pixel,
+// the UV target is half size so its pixels only reach the top left quarter.
+static void YUV420Reference(const PixelFrame& argb, int x, int y, uint8_t* out_y, uint8_t out_uv[2])
+{
+	const double width = argb.width;
+	const double height = argb.height;
+	const double uv_x = (x + 0.5) / width;
+	const double uv_y = (y + 0.5) / height;
+
+	// B1
+	*out_y = DotToUnorm8(SamplePoint(argb, uv_x, uv_y), kYCoeff, kYOffset);
+
+	// B2 B3
+	const uint8_t* point2 = SamplePoint(argb, std::fmod(x * 2.0, width) / width, std::fmod(y * 2.0, height) / height);
+	out_uv[0] = DotToUnorm8(point2, kUCoeff, kUVOffset);
+	out_uv[1] = DotToUnorm8(point2, kVCoeff, kUVOffset);
+}
+
+// Scalar port of d3d11_rgb_to_chroma420.hlsl, same pixel convention.
+static void Chroma420Reference(const PixelFrame& argb, int x, int y, uint8_t* out_y, uint8_t out_uv[2])
+{
+	const double width = argb.width;
+	const double height = argb.height;
+
+	// B4 B5
+	const double* coeff = x < width / 2 ? kUCoeff : kVCoeff;
+	const uint8_t* point = SamplePoint(argb, (std::fmod(x, width / 2) * 2 + 1) / width, y / height);
+	*out_y = DotToUnorm8(point, coeff, kUVOffset);
+
+	out_uv[0] = 0;
+	out_uv[1] = 0;
+	if (x < width / 2 && y < height / 2) {
+		// B6 B8 | B7 B9
+		coeff = x < width / 4 ? kUCoeff : kVCoeff;
+		const double row_v = (std::fmod(y, height / 2) * 2 + 1) / height;
+		out_uv[0] = DotToUnorm8(SamplePoint(argb, std::fmod(x, width / 4) * 4 / width, row_v), coeff, kUVOffset);
+		out_uv[1] = DotToUnorm8(SamplePoint(argb, (std::fmod(x, width / 4) * 4 + 2) / width, row_v), coeff, kUVOffset);
+	}
+}
+
+static void CheckMatchesShader(int width, int height, uint32_t seed)
+{
+	PixelFramePool pool;
+	PixelFrame image;
+	pool.Alloc(width, height, PIXEL_FORMAT_ARGB, &image);
+	FillImage(&image, seed);
+
+	CPURGBToYUVConverter converter;
+	CHECK(converter.Init(width, height));
+	CHECK(converter.Convert(&image));
+
+	const PixelFrame* yuv420 = converter.GetYUV420Frame();
+	const PixelFrame* chroma420 = converter.GetChroma420Frame();
+	CHECK(yuv420->format == PIXEL_FORMAT_NV12 && chroma420->format == PIXEL_FORMAT_NV12);
+
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			uint8_t expected_y, expected_uv[2];
+			YUV420Reference(image, x, y, &expected_y, expected_uv);
+			CHECK(yuv420->plane[0][y * yuv420->pitch[0] + x] == expected_y);
+			if (x < width / 2 && y < height / 2) {
+				const uint8_t* uv = yuv420->plane[1] + y * yuv420->pitch[1] + x * 2;
+				CHECK(uv[0] == expected_uv[0]);
+				CHECK(uv[1] == expected_uv[1]);
+			}
+
+			Chroma420Reference(image, x, y, &expected_y, expected_uv);
+			CHECK(chroma420->plane[0][y * chroma420->pitch[0] + x] == expected_y);
+			if (x < width / 2 && y < height / 2) {
+				const uint8_t* uv = chroma420->plane[1] + y * chroma420->pitch[1] + x * 2;
+				CHECK(uv[0] == expected_uv[0]);
+				CHECK(uv[1] == expected_uv[1]);
+			}
+		}
+	}
+}
+
+static void TestMatchesShader()
+{
+	CheckMatchesShader(4, 2, 1);
+	// Widths that leave SSE2 and AVX2 tails.
+	CheckMatchesShader(36, 6, 2);
+	CheckMatchesShader(132, 18, 3);
+	// Large enough to be split into WorkerPool stripes.
+	CheckMatchesShader(800, 720, 4);
+}
+
+static void TestMaskedTilesAreNeutral()
+{
+	const int width = 200;
+	const int height = 100;
+
+	PixelFramePool pool;
+	PixelFrame image;
+	pool.Alloc(width, height, PIXEL_FORMAT_ARGB, &image);
+	FillImage(&image, 5);
+
+	// Tiles on the right and bottom edges are clipped to the frame.
+	ChromaTileMask mask;
+	mask.tile_size = 64;
+	mask.tiles_x = 4;
+	mask.tiles_y = 2;
+	mask.tiles.assign(mask.tiles_x * mask.tiles_y, 0);
+	mask.tiles[1] = 1;
+	mask.tiles[7] = 1;
+
+	CPURGBToYUVConverter converter;
+	CHECK(converter.Init(width, height));
+	CHECK(converter.Convert(&image, &mask));
+
+	const PixelFrame* yuv420 = converter.GetYUV420Frame();
+	const PixelFrame* chroma420 = converter.GetChroma420Frame();
+
+	// Every luma pixel maps to one Chroma420 Y sample, and every other pixel
+	// of odd rows to one Chroma420 UV sample.
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			bool is_set = mask.IsSet(x / mask.tile_size, y / mask.tile_size);
+			uint8_t expected_y, expected_uv[2];
+
+			YUV420Reference(image, x, y, &expected_y, expected_uv);
+			CHECK(yuv420->plane[0][y * yuv420->pitch[0] + x] == expected_y);
+
+			if (x % 2 == 1) {
+				int column = x / 2;
+				uint8_t u = chroma420->plane[0][y * chroma420->pitch[0] + column];
+				uint8_t v = chroma420->plane[0][y * chroma420->pitch[0] + column + width / 2];
+				uint8_t expected_u, expected_v;
+				Chroma420Reference(image, column, y, &expected_u, expected_uv);
+				Chroma420Reference(image, column + width / 2, y, &expected_v, expected_uv);
+				CHECK(u == (is_set ? expected_u : 128));
+				CHECK(v == (is_set ? expected_v : 128));
+			}
+			else if (y % 2 == 1) {
+				int pair = x / 4;
+				int c = (x % 4 == 0) ? 0 : 1;
+				uint8_t expected_u[2], expected_v[2];
+				Chroma420Reference(image, pair, y / 2, &expected_y, expected_u);
+				Chroma420Reference(image, pair + width / 4, y / 2, &expected_y, expected_v);
+				const uint8_t* uv = chroma420->plane[1] + (y / 2) * chroma420->pitch[1];
+				CHECK(uv[pair * 2 + c] == (is_set ? expected_u[c] : 128));
+				CHECK(uv[(pair + width / 4) * 2 + c] == (is_set ? expected_v[c] : 128));
+			}
+		}
+	}
+}
+
+static void TestRejectsUnsupportedInput()
+{
+	CPURGBToYUVConverter converter;
+	CHECK(!converter.Init(66, 32));
+	CHECK(!converter.Init(64, 31));
+	CHECK(converter.GetYUV420Frame() == NULL);
+
+	PixelFramePool pool;
+	PixelFrame image, nv12;
+	pool.Alloc(64, 32, PIXEL_FORMAT_ARGB, &image);
+	pool.Alloc(64, 32, PIXEL_FORMAT_NV12, &nv12);
+	CHECK(!converter.Convert(&image));
+
+	CHECK(converter.Init(64, 16));
+	CHECK(!converter.Convert(&image));
+	CHECK(!converter.Convert(&nv12));
+}
+
+int main()
+{
+	RUN_TEST(TestMatchesShader);
+	RUN_TEST(TestMaskedTilesAreNeutral);
+	RUN_TEST(TestRejectsUnsupportedInput);
+	return 0;
+}
@@ -0,0 +1,183 @@
+#include "cpu_scaler.h"
+#include "renderer.h"
+#include "test.h"
+
+#include <cstring>
+
+using namespace DX;
+
+static const ScaleFilter kFilters[] = {
+	SCALE_FILTER_NEAREST, SCALE_FILTER_BILINEAR, SCALE_FILTER_BICUBIC, SCALE_FILTER_LANCZOS3
+};
+
+static void FillSolid(PixelFrame* frame, uint8_t b, uint8_t g, uint8_t r)
+{
+	for (int y = 0; y < frame->height; y++) {
+		uint8_t* row = frame->plane[0] + y * frame->pitch[0];
+		for (int x = 0; x < frame->width; x++) {
+			row[x * 4 + 0] = b;
+			row[x * 4 + 1] = g;
+			row[x * 4 + 2] = r;
+			row[x * 4 + 3] = 255;
+		}
+	}
+}
+
+static void FillNoise(PixelFrame* frame)
+{
+	uint32_t seed = 1;
+	for (int y = 0; y < frame->height; y++) {
+		uint8_t* row = frame->plane[0] + y * frame->pitch[0];
+		for (int x = 0; x < frame->width * 4; x++) {
+			seed = seed * 1664525 + 1013904223;
+			row[x] = static_cast<uint8_t>(seed >> 24);
+		}
+	}
+}
+
+static void TestSolidColorIsPreserved()
+{
+	static const int kSizes[][4] = {
+		{ 768, 432, 192, 108 },  // 4:1 like 8K -> 1080p
+		{ 256, 144, 192, 108 },
+		{ 128, 72, 192, 108 },
+		{ 31, 17, 200, 3 },
+	};
+
+	PixelFramePool pool;
+	for (const auto& size : kSizes) {
+		PixelFrame src, dst;
+		pool.Alloc(size[0], size[1], PIXEL_FORMAT_ARGB, &src);
+		pool.Alloc(size[2], size[3], PIXEL_FORMAT_ARGB, &dst);
+		FillSolid(&src, 10, 128, 250);
+
+		for (ScaleFilter filter : kFilters) {
+			ARGBScaler scaler;
+			CHECK(scaler.Init(size[0], size[1], size[2], size[3], filter));
+			scaler.Scale(src.plane[0], src.pitch[0], dst.plane[0], dst.pitch[0]);
+
+			for (int y = 0; y < dst.height; y++) {
+				const uint8_t* row = dst.plane[0] + y * dst.pitch[0];
+				for (int x = 0; x < dst.width; x++) {
+					CHECK_NEAR(row[x * 4 + 0], 10, 1);
+					CHECK_NEAR(row[x * 4 + 1], 128, 1);
+					CHECK_NEAR(row[x * 4 + 2], 250, 1);
+					CHECK_NEAR(row[x * 4 + 3], 255, 1);
+				}
+			}
+		}
+	}
+}
+
+static void TestSameSizeIsCopy()
+{
+	PixelFramePool pool;
+	PixelFrame src, dst;
+	pool.Alloc(67, 23, PIXEL_FORMAT_ARGB, &src);
+	pool.Alloc(67, 23, PIXEL_FORMAT_ARGB, &dst);
+	FillNoise(&src);
+
+	for (ScaleFilter filter : kFilters) {
+		ARGBScaler scaler;
+		CHECK(scaler.Init(67, 23, 67, 23, filter));
+		scaler.Scale(src.plane[0], src.pitch[0], dst.plane[0], dst.pitch[0]);
+
+		for (int y = 0; y < src.height; y++) {
+			const uint8_t* a = src.plane[0] + y * src.pitch[0];
+			const uint8_t* b = dst.plane[0] + y * dst.pitch[0];
+			for (int x = 0; x < src.width * 4; x++) {
+				CHECK_NEAR(a[x], b[x], 1);
+			}
+		}
+	}
+}
+
+static void TestNearestDuplicatesPixels()
+{
+	PixelFramePool pool;
+	PixelFrame src, dst;
+	pool.Alloc(16, 8, PIXEL_FORMAT_ARGB, &src);
+	pool.Alloc(32, 16, PIXEL_FORMAT_ARGB, &dst);
+	FillNoise(&src);
+
+	ARGBScaler scaler;
+	CHECK(scaler.Init(16, 8, 32, 16, SCALE_FILTER_NEAREST));
+	scaler.Scale(src.plane[0], src.pitch[0], dst.plane[0], dst.pitch[0]);
+
+	for (int y = 0; y < dst.height; y++) {
+		const uint8_t* src_row = src.plane[0] + (y / 2) * src.pitch[0];
+		const uint8_t* dst_row = dst.plane[0] + y * dst.pitch[0];
+		for (int x = 0; x < dst.width; x++) {
+			CHECK(memcmp(dst_row + x * 4, src_row + (x / 2) * 4, 4) == 0);
+		}
+	}
+}
+
+static void TestRampStaysLinear()
+{
+	PixelFramePool pool;
+	PixelFrame src, dst;
+	pool.Alloc(64, 4, PIXEL_FORMAT_ARGB, &src);
+	pool.Alloc(32, 2, PIXEL_FORMAT_ARGB, &dst);
+	for (int y = 0; y < src.height; y++) {
+		uint8_t* row = src.plane[0] + y * src.pitch[0];
+		for (int x = 0; x < src.width; x++) {
+			memset(row + x * 4, x * 3, 4);
+		}
+	}
+
+	// Pixel centers line up, output x samples source x * 2 + 0.5. The kernels
+	// are symmetric so a ramp stays a ramp away from the clamped edges.
+	for (ScaleFilter filter : kFilters) {
+		if (filter == SCALE_FILTER_NEAREST) {
+			continue;
+		}
+
+		ARGBScaler scaler;
+		CHECK(scaler.Init(64, 4, 32, 2, filter));
+		scaler.Scale(src.plane[0], src.pitch[0], dst.plane[0], dst.pitch[0]);
+
+		for (int y = 0; y < dst.height; y++) {
+			const uint8_t* row = dst.plane[0] + y * dst.pitch[0];
+			for (int x = 4; x < dst.width - 4; x++) {
+				CHECK_NEAR(row[x * 4 + 1], (x * 2 + 0.5) * 3 + 0.5, 1);
+			}
+		}
+	}
+}
+
+static void TestClipLimitsWrites()
+{
+	PixelFramePool pool;
+	PixelFrame src, dst;
+	pool.Alloc(300, 200, PIXEL_FORMAT_ARGB, &src);
+	pool.Alloc(150, 100, PIXEL_FORMAT_ARGB, &dst);
+	FillSolid(&src, 200, 200, 200);
+
+	for (ScaleFilter filter : kFilters) {
+		memset(dst.plane[0], 0, static_cast<size_t>(dst.pitch[0]) * dst.height);
+
+		PixelRect clip = { 10, 20, 70, 45 };
+		ARGBScaler scaler;
+		CHECK(scaler.Init(300, 200, 150, 100, filter));
+		scaler.Scale(src.plane[0], src.pitch[0], dst.plane[0], dst.pitch[0], &clip);
+
+		for (int y = 0; y < dst.height; y++) {
+			const uint8_t* row = dst.plane[0] + y * dst.pitch[0];
+			for (int x = 0; x < dst.width; x++) {
+				bool inside = x >= clip.left && x < clip.right && y >= clip.top && y < clip.bottom;
+				CHECK_NEAR(row[x * 4 + 1], inside ? 200 : 0, 1);
+			}
+		}
+	}
+}
+
+int main()
+{
+	RUN_TEST(TestSolidColorIsPreserved);
+	RUN_TEST(TestSameSizeIsCopy);
+	RUN_TEST(TestNearestDuplicatesPixels);
+	RUN_TEST(TestRampStaysLinear);
+	RUN_TEST(TestClipLimitsWrites);
+	return 0;
+}
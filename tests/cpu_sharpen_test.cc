@@ -0,0 +1,175 @@
+#include "cpu_sharpen.h"
+#include "cpu_color_converter.h"
+#include "renderer.h"
+#include "test.h"
+
+#include <cmath>
+#include <cstring>
+
+using namespace DX;
+
+static void FillNoise(uint8_t* data, size_t size, uint32_t seed)
+{
+	for (size_t i = 0; i < size; i++) {
+		seed = seed * 1664525 + 1013904223;
+		data[i] = static_cast<uint8_t>(seed >> 24);
+	}
+}
+
+// Scalar port of d3d11_sharpen.hlsl. Texture is the BGRA image as UNORM,
+// uv is in texture coordinates with texel centers at (i + 0.5) / size.
+struct Float2
+{
+	float x;
+	float y;
+};
+
+static float Clampf(float value, float lo, float hi)
+{
+	return value < lo ? lo : (value > hi ? hi : value);
+}
+
+// Texture.Sample(PointSampler, uv)
+static float SamplePoint(const PixelFrame& image, Float2 uv, int c)
+{
+	int x = static_cast<int>(std::floor(uv.x * image.width));
+	int y = static_cast<int>(std::floor(uv.y * image.height));
+	return image.plane[0][y * image.pitch[0] + x * 4 + c] / 255.0f;
+}
+
+// Texture.Sample(LinearSampler, uv), uv stays within the edge texel centers.
+static float SampleLinear(const PixelFrame& image, Float2 uv, int c)
+{
+	float tx = uv.x * image.width - 0.5f;
+	float ty = uv.y * image.height - 0.5f;
+	int x0 = static_cast<int>(std::floor(tx));
+	int y0 = static_cast<int>(std::floor(ty));
+	float fx = tx - x0;
+	float fy = ty - y0;
+	int x1 = x0 + 1 < image.width ? x0 + 1 : x0;
+	int y1 = y0 + 1 < image.height ? y0 + 1 : y0;
+
+	const uint8_t* row0 = image.plane[0] + y0 * image.pitch[0];
+	const uint8_t* row1 = image.plane[0] + y1 * image.pitch[0];
+	float top = row0[x0 * 4 + c] * (1.0f - fx) + row0[x1 * 4 + c] * fx;
+	float bottom = row1[x0 * 4 + c] * (1.0f - fx) + row1[x1 * 4 + c] * fx;
+	return (top * (1.0f - fy) + bottom * fy) / 255.0f;
+}
+
+// SampleClamped(uv, ps)
+static float SampleClamped(const PixelFrame& image, Float2 uv, Float2 ps, int c)
+{
+	Float2 clamped = { Clampf(uv.x, ps.x * 0.5f, 1.0f - ps.x * 0.5f), Clampf(uv.y, ps.y * 0.5f, 1.0f - ps.y * 0.5f) };
+	return SampleLinear(image, clamped, c);
+}
+
+// main() for the pixel at (x, y), returns the UNORM output in 0 to 255.
+static float SharpenReference(const PixelFrame& image, int x, int y, int c, float unsharp)
+{
+	Float2 uv = { (x + 0.5f) / image.width, (y + 0.5f) / image.height };
+	Float2 ps = { 1.0f / image.width, 1.0f / image.height };
+	Float2 st1 = { ps.x * 1.2f, ps.y * 1.2f };
+	Float2 st2 = { ps.x * 1.5f, ps.y * 1.5f };
+
+	float p = SamplePoint(image, uv, c);
+	float sum1 = SampleClamped(image, { uv.x + st1.x, uv.y + st1.y }, ps, c)
+		+ SampleClamped(image, { uv.x + st1.x, uv.y - st1.y }, ps, c)
+		+ SampleClamped(image, { uv.x - st1.x, uv.y + st1.y }, ps, c)
+		+ SampleClamped(image, { uv.x - st1.x, uv.y - st1.y }, ps, c);
+	float sum2 = SampleClamped(image, { uv.x + st2.x, uv.y }, ps, c)
+		+ SampleClamped(image, { uv.x, uv.y + st2.y }, ps, c)
+		+ SampleClamped(image, { uv.x - st2.x, uv.y }, ps, c)
+		+ SampleClamped(image, { uv.x, uv.y - st2.y }, ps, c);
+	float t = p * 0.859375f + sum2 * -0.1171875f + sum1 * -0.09765625f;
+	return Clampf(p + t * unsharp, 0.0f, 1.0f) * 255.0f;
+}
+
+static void TestMatchesShader()
+{
+	PixelFramePool pool;
+	PixelFrame src, dst;
+	pool.Alloc(67, 41, PIXEL_FORMAT_ARGB, &src);
+	pool.Alloc(67, 41, PIXEL_FORMAT_ARGB, &dst);
+	FillNoise(src.plane[0], static_cast<size_t>(src.pitch[0]) * src.height, 7);
+
+	const float kUnsharp[] = { 0.0f, 0.5f, 1.0f, 3.0f, 10.0f };
+	for (float unsharp : kUnsharp) {
+		PixelRect rect = { 0, 0, src.width, src.height };
+		SharpenBGRA(src.plane[0], src.pitch[0], dst.plane[0], dst.pitch[0], src.width, src.height, rect, unsharp);
+
+		for (int y = 0; y < src.height; y++) {
+			for (int x = 0; x < src.width; x++) {
+				for (int c = 0; c < 4; c++) {
+					float expected = SharpenReference(src, x, y, c, unsharp);
+					CHECK_NEAR(dst.plane[0][y * dst.pitch[0] + x * 4 + c], std::floor(expected + 0.5f), 1);
+				}
+			}
+		}
+	}
+}
+
+static void TestFlatAreasAreUnchanged()
+{
+	PixelFramePool pool;
+	PixelFrame src, dst;
+	pool.Alloc(40, 20, PIXEL_FORMAT_ARGB, &src);
+	pool.Alloc(40, 20, PIXEL_FORMAT_ARGB, &dst);
+	memset(src.plane[0], 0x5A, static_cast<size_t>(src.pitch[0]) * src.height);
+
+	PixelRect rect = { 0, 0, src.width, src.height };
+	SharpenBGRA(src.plane[0], src.pitch[0], dst.plane[0], dst.pitch[0], src.width, src.height, rect, 10.0f);
+	for (int y = 0; y < dst.height; y++) {
+		for (int x = 0; x < dst.width * 4; x++) {
+			CHECK(dst.plane[0][y * dst.pitch[0] + x] == 0x5A);
+		}
+	}
+}
+
+// The fused kernel must match converting first and sharpening second.
+static void CheckFusedMatchesTwoPass(PixelFormat format, int width, int height, const PixelRect& rect)
+{
+	PixelFramePool pool;
+	PixelFrame frame, converted, two_pass, fused;
+	pool.Alloc(width, height, format, &frame);
+	pool.Alloc(width, height, PIXEL_FORMAT_ARGB, &converted);
+	pool.Alloc(width, height, PIXEL_FORMAT_ARGB, &two_pass);
+	pool.Alloc(width, height, PIXEL_FORMAT_ARGB, &fused);
+
+	for (int i = 0; i < 3; i++) {
+		if (frame.plane[i]) {
+			int plane_height = (i > 0 && (format == PIXEL_FORMAT_I420 || format == PIXEL_FORMAT_NV12)) ? (height + 1) / 2 : height;
+			FillNoise(frame.plane[i], static_cast<size_t>(frame.pitch[i]) * plane_height, 11 + i);
+		}
+	}
+	memset(two_pass.plane[0], 0, static_cast<size_t>(two_pass.pitch[0]) * height);
+	memset(fused.plane[0], 0, static_cast<size_t>(fused.pitch[0]) * height);
+
+	for (int y = 0; y < height; y++) {
+		FrameRowToBGRA(&frame, y, 0, width, converted.plane[0] + y * converted.pitch[0]);
+	}
+	SharpenBGRA(converted.plane[0], converted.pitch[0], two_pass.plane[0], two_pass.pitch[0], width, height, rect, 1.5f);
+	ConvertAndSharpen(&frame, rect, 1.5f, fused.plane[0], fused.pitch[0]);
+
+	for (int y = 0; y < height; y++) {
+		CHECK(memcmp(two_pass.plane[0] + y * two_pass.pitch[0], fused.plane[0] + y * fused.pitch[0], width * 4) == 0);
+	}
+}
+
+static void TestFusedMatchesTwoPass()
+{
+	const PixelFormat kFormats[] = { PIXEL_FORMAT_ARGB, PIXEL_FORMAT_I420, PIXEL_FORMAT_I444, PIXEL_FORMAT_NV12 };
+	for (PixelFormat format : kFormats) {
+		CheckFusedMatchesTwoPass(format, 64, 48, PixelRect{ 0, 0, 64, 48 });
+		CheckFusedMatchesTwoPass(format, 64, 48, PixelRect{ 6, 3, 37, 29 });
+		// Large enough to be split into WorkerPool stripes.
+		CheckFusedMatchesTwoPass(format, 400, 300, PixelRect{ 0, 0, 400, 300 });
+	}
+}
+
+int main()
+{
+	RUN_TEST(TestMatchesShader);
+	RUN_TEST(TestFlatAreasAreUnchanged);
+	RUN_TEST(TestFusedMatchesTwoPass);
+	return 0;
+}
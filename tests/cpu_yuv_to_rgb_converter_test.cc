@@ -0,0 +1,216 @@
+#include "cpu_rgb_to_yuv_converter.h"
+#include "cpu_yuv_to_rgb_converter.h"
+#include "color_matrix.h"
+#include "renderer.h"
+#include "test.h"
+
+#include <cstring>
+
+using namespace DX;
+
+static void FillImage(PixelFrame* frame)
+{
+	uint32_t seed = 3;
+	for (int y = 0; y < frame->height; y++) {
+		uint8_t* row = frame->plane[0] + y * frame->pitch[0];
+		for (int x = 0; x < frame->width; x++) {
+			seed = seed * 1664525 + 1013904223;
+			// Text-like hard colour edges on the left half, noise on the right.
+			if (x < frame->width / 2) {
+				bool on = ((x / 3) + (y / 5)) % 2 == 0;
+				row[x * 4 + 0] = on ? 255 : 20;
+				row[x * 4 + 1] = on ? 40 : 200;
+				row[x * 4 + 2] = on ? 10 : 250;
+			}
+			else {
+				row[x * 4 + 0] = static_cast<uint8_t>(seed >> 24);
+				row[x * 4 + 1] = static_cast<uint8_t>(seed >> 16);
+				row[x * 4 + 2] = static_cast<uint8_t>(seed >> 8);
+			}
+			row[x * 4 + 3] = 255;
+		}
+	}
+}
+
+static uint8_t ToUnorm8(float value)
+{
+	value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+	return static_cast<uint8_t>(static_cast<int>(value * 255.0f + 0.5f));
+}
+
+// Scalar port of d3d11_yuv_to_rgb.hlsl, point sampling at texel centers.
+static void CombineReference(const PixelFrame& yuv420, const PixelFrame& chroma420, int x, int y, uint8_t bgra[4])
+{
+	const YUVShaderConstants constants = GetYUVShaderConstants(COLOR_MATRIX_BT601, COLOR_RANGE_LIMITED);
+	const int width = yuv420.width;
+	const uint8_t* yuv420_uv = yuv420.plane[1] + (y / 2) * yuv420.pitch[1];
+	const uint8_t* chroma420_y = chroma420.plane[0] + y * chroma420.pitch[0];
+	const uint8_t* chroma420_uv = chroma420.plane[1] + (y / 2) * chroma420.pitch[1];
+
+	float yuv[3];
+	yuv[0] = yuv420.plane[0][y * yuv420.pitch[0] + x] / 255.0f;
+
+	if (x % 2 == 0 && y % 2 == 0) {
+		// B2 B3
+		yuv[1] = yuv420_uv[(x / 2) * 2 + 0] / 255.0f;
+		yuv[2] = yuv420_uv[(x / 2) * 2 + 1] / 255.0f;
+	}
+	else if (x % 2 == 1) {
+		// B4 B5
+		yuv[1] = chroma420_y[x / 2] / 255.0f;
+		yuv[2] = chroma420_y[x / 2 + width / 2] / 255.0f;
+	}
+	else {
+		// B6 B7 from r, B8 B9 from g
+		int c = (x % 4 == 0) ? 0 : 1;
+		yuv[1] = chroma420_uv[(x / 4) * 2 + c] / 255.0f;
+		yuv[2] = chroma420_uv[(x / 4 + width / 4) * 2 + c] / 255.0f;
+	}
+
+	for (int i = 0; i < 3; i++) {
+		yuv[i] += constants.offset[i];
+	}
+	bgra[0] = ToUnorm8(yuv[0] * constants.b[0] + yuv[1] * constants.b[1] + yuv[2] * constants.b[2]);
+	bgra[1] = ToUnorm8(yuv[0] * constants.g[0] + yuv[1] * constants.g[1] + yuv[2] * constants.g[2]);
+	bgra[2] = ToUnorm8(yuv[0] * constants.r[0] + yuv[1] * constants.r[1] + yuv[2] * constants.r[2]);
+	bgra[3] = 0xff;
+}
+
+// Scalar port of d3d11_yuv420_to_rgb.hlsl: the UV plane is sampled linearly
+// half a luma pixel right and down, i.e. at texel x / 2, y / 2 of the UV plane.
+static void UpsampleReference(const PixelFrame& yuv420, int x, int y, uint8_t bgra[4])
+{
+	const YUVShaderConstants constants = GetYUVShaderConstants(COLOR_MATRIX_BT601, COLOR_RANGE_LIMITED);
+	const int half_width = yuv420.width / 2;
+	const int half_height = yuv420.height / 2;
+
+	int i0 = x / 2;
+	int j0 = y / 2;
+	int i1 = i0 + 1 < half_width ? i0 + 1 : i0;
+	int j1 = j0 + 1 < half_height ? j0 + 1 : j0;
+	float fx = (x % 2) * 0.5f;
+	float fy = (y % 2) * 0.5f;
+
+	float yuv[3];
+	yuv[0] = yuv420.plane[0][y * yuv420.pitch[0] + x] / 255.0f;
+	for (int c = 0; c < 2; c++) {
+		const uint8_t* row0 = yuv420.plane[1] + j0 * yuv420.pitch[1];
+		const uint8_t* row1 = yuv420.plane[1] + j1 * yuv420.pitch[1];
+		float top = row0[i0 * 2 + c] * (1.0f - fx) + row0[i1 * 2 + c] * fx;
+		float bottom = row1[i0 * 2 + c] * (1.0f - fx) + row1[i1 * 2 + c] * fx;
+		yuv[1 + c] = (top * (1.0f - fy) + bottom * fy) / 255.0f;
+	}
+
+	for (int i = 0; i < 3; i++) {
+		yuv[i] += constants.offset[i];
+	}
+	bgra[0] = ToUnorm8(yuv[0] * constants.b[0] + yuv[1] * constants.b[1] + yuv[2] * constants.b[2]);
+	bgra[1] = ToUnorm8(yuv[0] * constants.g[0] + yuv[1] * constants.g[1] + yuv[2] * constants.g[2]);
+	bgra[2] = ToUnorm8(yuv[0] * constants.r[0] + yuv[1] * constants.r[1] + yuv[2] * constants.r[2]);
+	bgra[3] = 0xff;
+}
+
+static void CheckCombine(int width, int height)
+{
+	PixelFramePool pool;
+	PixelFrame image;
+	pool.Alloc(width, height, PIXEL_FORMAT_ARGB, &image);
+	FillImage(&image);
+
+	CPURGBToYUVConverter splitter;
+	CHECK(splitter.Init(width, height));
+	CHECK(splitter.Convert(&image));
+
+	CPUYUVToRGBConverter combiner;
+	CHECK(combiner.Init(width, height));
+	CHECK(combiner.Combine(splitter.GetYUV420Frame(), splitter.GetChroma420Frame()));
+
+	const PixelFrame* output = combiner.GetRGBAFrame();
+	CHECK(output->format == PIXEL_FORMAT_ARGB);
+	CHECK(output->width == width && output->height == height);
+
+	for (int y = 0; y < height; y++) {
+		const uint8_t* src_row = image.plane[0] + y * image.pitch[0];
+		const uint8_t* dst_row = output->plane[0] + y * output->pitch[0];
+		for (int x = 0; x < width; x++) {
+			uint8_t expected[4];
+			CombineReference(*splitter.GetYUV420Frame(), *splitter.GetChroma420Frame(), x, y, expected);
+			for (int c = 0; c < 4; c++) {
+				CHECK_NEAR(dst_row[x * 4 + c], expected[c], 1);
+			}
+
+			// Full chroma survives the round trip, only 8-bit limited range rounding is lost.
+			for (int c = 0; c < 3; c++) {
+				CHECK_NEAR(dst_row[x * 4 + c], src_row[x * 4 + c], 3);
+			}
+		}
+	}
+}
+
+static void TestMatchesShader()
+{
+	CheckCombine(64, 32);
+	CheckCombine(132, 18);
+	// Large enough to be split into WorkerPool stripes.
+	CheckCombine(800, 720);
+}
+
+static void TestMaskedTilesMatchFullCombine()
+{
+	const int width = 256;
+	const int height = 128;
+
+	PixelFramePool pool;
+	PixelFrame image;
+	pool.Alloc(width, height, PIXEL_FORMAT_ARGB, &image);
+	FillImage(&image);
+
+	ChromaTileMask mask;
+	mask.tile_size = 64;
+	mask.tiles_x = width / 64;
+	mask.tiles_y = height / 64;
+	mask.tiles.assign(mask.tiles_x * mask.tiles_y, 0);
+	mask.tiles[1] = 1;
+	mask.tiles[6] = 1;
+
+	CPURGBToYUVConverter splitter;
+	CHECK(splitter.Init(width, height));
+	CHECK(splitter.Convert(&image, &mask));
+
+	CPUYUVToRGBConverter combiner;
+	CHECK(combiner.Init(width, height));
+	CHECK(combiner.Combine(splitter.GetYUV420Frame(), splitter.GetChroma420Frame(), &mask));
+
+	const PixelFrame* output = combiner.GetRGBAFrame();
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			const uint8_t* pixel = output->plane[0] + y * output->pitch[0] + x * 4;
+			uint8_t expected[4];
+			int tolerance = 1;
+			if (mask.IsSet(x / 64, y / 64)) {
+				CombineReference(*splitter.GetYUV420Frame(), *splitter.GetChroma420Frame(), x, y, expected);
+			}
+			else {
+				// The CPU rounds the interpolated chroma to 8 bits first, the U to
+				// B coefficient doubles that half step.
+				UpsampleReference(*splitter.GetYUV420Frame(), x, y, expected);
+				tolerance = 2;
+			}
+			for (int c = 0; c < 4; c++) {
+				CHECK_NEAR(pixel[c], expected[c], tolerance);
+			}
+		}
+	}
+
+	// Outside the mask the Chroma420 samples are neutral.
+	const PixelFrame* chroma420 = splitter.GetChroma420Frame();
+	CHECK(chroma420->plane[0][0] == 128);
+	CHECK(chroma420->plane[0][(height - 1) * chroma420->pitch[0] + width - 1] == 128);
+}
+
+int main()
+{
+	RUN_TEST(TestMatchesShader);
+	RUN_TEST(TestMaskedTilesMatchFullCombine);
+	return 0;
+}
@@ -0,0 +1,405 @@
+#include "cursor_overlay.h"
+#include "test.h"
+
+#include <cstring>
+
+using namespace DX;
+
+static void FillPattern(PixelFrame* frame, int seed)
+{
+	for (int y = 0; y < frame->height; y++) {
+		uint8_t* row = frame->plane[0] + y * frame->pitch[0];
+		for (int x = 0; x < frame->width * 4; x++) {
+			row[x] = static_cast<uint8_t>(x * 7 + y * 13 + seed);
+		}
+	}
+}
+
+static bool IsSameFrame(const PixelFrame* a, const PixelFrame* b)
+{
+	for (int y = 0; y < a->height; y++) {
+		if (memcmp(a->plane[0] + y * a->pitch[0], b->plane[0] + y * b->pitch[0], a->width * 4) != 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// frame with the cursor drawn on top, the expected Compose() output.
+static void DrawExpected(PixelFramePool& pool, const PixelFrame* frame, const CursorState& cursor, PixelFrame* expected)
+{
+	CHECK(pool.Clone(frame, expected));
+	PixelRect clip;
+	clip.right = frame->width;
+	clip.bottom = frame->height;
+	DrawCursor(expected, cursor, clip);
+}
+
+static CursorState MakeColorCursor(int x, int y)
+{
+	std::shared_ptr<CursorShape> shape = std::make_shared<CursorShape>();
+	shape->type = CURSOR_SHAPE_COLOR;
+	shape->width = 6;
+	shape->height = 5;
+	shape->pitch = 6 * 4;
+	shape->data.assign(shape->pitch * shape->height, 0xff);
+
+	CursorState cursor;
+	cursor.shape = shape;
+	cursor.x = x;
+	cursor.y = y;
+	cursor.is_visible = true;
+	return cursor;
+}
+
+static void TestCursorRect()
+{
+	CursorState cursor = MakeColorCursor(-2, -3);
+	PixelRect rect;
+	CHECK(GetCursorRect(cursor, 64, 32, &rect));
+	CHECK(rect.left == 0 && rect.top == 0 && rect.right == 4 && rect.bottom == 2);
+
+	cursor.x = 62;
+	cursor.y = 30;
+	CHECK(GetCursorRect(cursor, 64, 32, &rect));
+	CHECK(rect.left == 62 && rect.top == 30 && rect.right == 64 && rect.bottom == 32);
+
+	cursor.x = 64;
+	CHECK(!GetCursorRect(cursor, 64, 32, &rect));
+
+	cursor.x = 10;
+	cursor.is_visible = false;
+	CHECK(!GetCursorRect(cursor, 64, 32, &rect));
+}
+
+static void TestDrawColorCursor()
+{
+	PixelFramePool pool;
+	PixelFrame frame;
+	CHECK(pool.Alloc(8, 1, PIXEL_FORMAT_ARGB, &frame));
+	memset(frame.plane[0], 100, 8 * 4);
+
+	// BGRA pixels: opaque, transparent and half transparent.
+	std::shared_ptr<CursorShape> shape = std::make_shared<CursorShape>();
+	shape->type = CURSOR_SHAPE_COLOR;
+	shape->width = 3;
+	shape->height = 1;
+	shape->pitch = 3 * 4;
+	shape->data = { 10, 20, 30, 255,  10, 20, 30, 0,  200, 200, 200, 128 };
+
+	CursorState cursor;
+	cursor.shape = shape;
+	cursor.x = 1;
+	cursor.is_visible = true;
+
+	PixelRect clip;
+	clip.right = 8;
+	clip.bottom = 1;
+	DrawCursor(&frame, cursor, clip);
+
+	const uint8_t* pixel = frame.plane[0];
+	CHECK(pixel[0] == 100);
+	CHECK(pixel[4] == 10 && pixel[5] == 20 && pixel[6] == 30 && pixel[7] == 100);
+	CHECK(pixel[8] == 100 && pixel[9] == 100 && pixel[10] == 100);
+	CHECK_NEAR(pixel[12], (200 * 128 + 100 * 127) / 255, 1);
+	CHECK(pixel[16] == 100);
+
+	// RGBA frames swap red and blue.
+	PixelFrame rgba_frame;
+	CHECK(pool.Alloc(8, 1, PIXEL_FORMAT_RGBA, &rgba_frame));
+	memset(rgba_frame.plane[0], 100, 8 * 4);
+	DrawCursor(&rgba_frame, cursor, clip);
+	CHECK(rgba_frame.plane[0][4] == 30 && rgba_frame.plane[0][5] == 20 && rgba_frame.plane[0][6] == 10);
+}
+
+static void TestDrawMonochromeCursor()
+{
+	PixelFramePool pool;
+	PixelFrame frame;
+	CHECK(pool.Alloc(4, 1, PIXEL_FORMAT_ARGB, &frame));
+	memset(frame.plane[0], 0x5a, 4 * 4);
+
+	// AND mask 1100, XOR mask 1010: invert, keep, white, black.
+	std::shared_ptr<CursorShape> shape = std::make_shared<CursorShape>();
+	shape->type = CURSOR_SHAPE_MONOCHROME;
+	shape->width = 4;
+	shape->height = 1;
+	shape->pitch = 1;
+	shape->data = { 0xc0, 0xa0 };
+
+	CursorState cursor;
+	cursor.shape = shape;
+	cursor.is_visible = true;
+
+	PixelRect clip;
+	clip.right = 4;
+	clip.bottom = 1;
+	DrawCursor(&frame, cursor, clip);
+
+	const uint8_t* pixel = frame.plane[0];
+	CHECK(pixel[0] == 0xa5 && pixel[1] == 0xa5 && pixel[2] == 0xa5 && pixel[3] == 0x5a);
+	CHECK(pixel[4] == 0x5a && pixel[5] == 0x5a && pixel[6] == 0x5a);
+	CHECK(pixel[8] == 0xff && pixel[9] == 0xff && pixel[10] == 0xff);
+	CHECK(pixel[12] == 0x00 && pixel[13] == 0x00 && pixel[14] == 0x00 && pixel[15] == 0x5a);
+}
+
+static void TestDrawMaskedColorCursor()
+{
+	PixelFramePool pool;
+	PixelFrame frame;
+	CHECK(pool.Alloc(2, 1, PIXEL_FORMAT_ARGB, &frame));
+	memset(frame.plane[0], 0x0f, 2 * 4);
+
+	// Alpha 0xff XORs the screen, 0 replaces it.
+	std::shared_ptr<CursorShape> shape = std::make_shared<CursorShape>();
+	shape->type = CURSOR_SHAPE_MASKED_COLOR;
+	shape->width = 2;
+	shape->height = 1;
+	shape->pitch = 2 * 4;
+	shape->data = { 0xff, 0xf0, 0x00, 0xff,  1, 2, 3, 0 };
+
+	CursorState cursor;
+	cursor.shape = shape;
+	cursor.is_visible = true;
+
+	PixelRect clip;
+	clip.right = 2;
+	clip.bottom = 1;
+	DrawCursor(&frame, cursor, clip);
+
+	const uint8_t* pixel = frame.plane[0];
+	CHECK(pixel[0] == 0xf0 && pixel[1] == 0xff && pixel[2] == 0x0f);
+	CHECK(pixel[4] == 1 && pixel[5] == 2 && pixel[6] == 3);
+}
+
+static void TestDrawIsClipped()
+{
+	PixelFramePool pool;
+	PixelFrame frame, original;
+	CHECK(pool.Alloc(16, 16, PIXEL_FORMAT_ARGB, &frame));
+	FillPattern(&frame, 0);
+	CHECK(pool.Clone(&frame, &original));
+
+	CursorState cursor = MakeColorCursor(4, 4);
+	PixelRect clip;
+	clip.left = 6;
+	clip.top = 5;
+	clip.right = 16;
+	clip.bottom = 6;
+	DrawCursor(&frame, cursor, clip);
+
+	for (int y = 0; y < 16; y++) {
+		for (int x = 0; x < 16; x++) {
+			bool is_drawn = x >= 6 && x < 10 && y == 5;
+			const uint8_t* pixel = frame.plane[0] + y * frame.pitch[0] + x * 4;
+			const uint8_t* original_pixel = original.plane[0] + y * original.pitch[0] + x * 4;
+			for (int i = 0; i < 3; i++) {
+				CHECK(pixel[i] == (is_drawn ? 0xff : original_pixel[i]));
+			}
+			CHECK(pixel[3] == original_pixel[3]);
+		}
+	}
+
+	// Shape data shorter than its size draws nothing.
+	std::shared_ptr<CursorShape> shape = std::make_shared<CursorShape>(*cursor.shape);
+	shape->data.resize(shape->data.size() - 1);
+	cursor.shape = shape;
+	FillPattern(&frame, 0);
+	clip.left = 0;
+	clip.top = 0;
+	DrawCursor(&frame, cursor, clip);
+	CHECK(IsSameFrame(&frame, &original));
+}
+
+// Compose() only redraws the damage of the frame and the old and new cursor area.
+static void TestCompose()
+{
+	PixelFramePool pool;
+	PixelFrame frame, expected;
+	CHECK(pool.Alloc(64, 32, PIXEL_FORMAT_ARGB, &frame));
+	FillPattern(&frame, 0);
+
+	CursorCompositor compositor;
+	CursorState cursor = MakeColorCursor(10, 10);
+	std::vector<PixelRect> no_rects;
+
+	const PixelFrame* output = compositor.Compose(&frame, no_rects, false, cursor);
+	CHECK(output != NULL);
+	CHECK(output->dirty_rects.empty());
+	CHECK(!output->is_unchanged);
+	DrawExpected(pool, &frame, cursor, &expected);
+	CHECK(IsSameFrame(output, &expected));
+
+	// Cursor move on an unchanged frame: the old area is restored.
+	cursor.x = 40;
+	cursor.y = 20;
+	output = compositor.Compose(&frame, no_rects, true, cursor);
+	CHECK(output->dirty_rects.size() == 2);
+	CHECK(!output->is_unchanged);
+	DrawExpected(pool, &frame, cursor, &expected);
+	CHECK(IsSameFrame(output, &expected));
+
+	// Only the dirty rects of the frame are copied.
+	PixelFrame next_frame;
+	CHECK(pool.Clone(&frame, &next_frame));
+	PixelRect rect;
+	rect.left = 0;
+	rect.top = 0;
+	rect.right = 8;
+	rect.bottom = 4;
+	for (int y = rect.top; y < rect.bottom; y++) {
+		memset(next_frame.plane[0] + y * next_frame.pitch[0], 7, (rect.right - rect.left) * 4);
+	}
+	output = compositor.Compose(&next_frame, std::vector<PixelRect>(1, rect), false, cursor);
+	DrawExpected(pool, &next_frame, cursor, &expected);
+	CHECK(IsSameFrame(output, &expected));
+
+	FillPattern(&next_frame, 1);
+	output = compositor.Compose(&next_frame, std::vector<PixelRect>(1, rect), false, cursor);
+	CHECK(!IsSameFrame(output, &next_frame));
+	CHECK(memcmp(output->plane[0], next_frame.plane[0], 8 * 4) == 0);
+
+	// Hiding the cursor restores its area, after that nothing changes.
+	cursor.is_visible = false;
+	output = compositor.Compose(&next_frame, no_rects, false, cursor);
+	CHECK(!output->is_unchanged);
+	CHECK(IsSameFrame(output, &next_frame));
+
+	output = compositor.Compose(&next_frame, no_rects, true, cursor);
+	CHECK(output->dirty_rects.empty());
+	CHECK(output->is_unchanged);
+	CHECK(IsSameFrame(output, &next_frame));
+}
+
+static void TestComposeNewSize()
+{
+	PixelFramePool pool;
+	PixelFrame frame, small_frame, i420_frame;
+	CHECK(pool.Alloc(64, 32, PIXEL_FORMAT_ARGB, &frame));
+	CHECK(pool.Alloc(32, 16, PIXEL_FORMAT_ARGB, &small_frame));
+	CHECK(pool.Alloc(32, 16, PIXEL_FORMAT_I420, &i420_frame));
+	FillPattern(&frame, 0);
+	FillPattern(&small_frame, 5);
+
+	CursorCompositor compositor;
+	CursorState cursor = MakeColorCursor(10, 10);
+	CHECK(compositor.Compose(&frame, std::vector<PixelRect>(), false, cursor) != NULL);
+
+	// Damage of a frame of another size is ignored, the whole frame is redrawn.
+	const PixelFrame* output = compositor.Compose(&small_frame, std::vector<PixelRect>(), true, cursor);
+	CHECK(output->width == 32 && output->height == 16);
+	CHECK(output->dirty_rects.empty());
+	CHECK(!output->is_unchanged);
+
+	PixelFrame expected;
+	DrawExpected(pool, &small_frame, cursor, &expected);
+	CHECK(IsSameFrame(output, &expected));
+
+	CHECK(compositor.Compose(&i420_frame, std::vector<PixelRect>(), false, cursor) == NULL);
+	CHECK(compositor.Compose(NULL, std::vector<PixelRect>(), false, cursor) == NULL);
+}
+
+static void TestSerializeCursorState()
+{
+	CursorState cursor = MakeColorCursor(-3, 700);
+	std::shared_ptr<CursorShape> shape = std::make_shared<CursorShape>(*cursor.shape);
+	shape->hot_x = 2;
+	shape->hot_y = 4;
+	for (size_t i = 0; i < shape->data.size(); i++) {
+		shape->data[i] = static_cast<uint8_t>(i * 5);
+	}
+	cursor.shape = shape;
+
+	// With the shape.
+	std::vector<uint8_t> data;
+	SerializeCursorState(cursor, true, data);
+	CHECK(data.size() == 21 + shape->data.size());
+
+	CursorState parsed;
+	CHECK(ParseCursorState(data.data(), data.size(), &parsed));
+	CHECK(parsed.x == -3 && parsed.y == 700 && parsed.is_visible);
+	CHECK(parsed.shape && parsed.shape != cursor.shape);
+	CHECK(parsed.shape->type == CURSOR_SHAPE_COLOR);
+	CHECK(parsed.shape->width == 6 && parsed.shape->height == 5 && parsed.shape->pitch == 24);
+	CHECK(parsed.shape->hot_x == 2 && parsed.shape->hot_y == 4);
+	CHECK(parsed.shape->data == shape->data);
+
+	// Position only, the parsed shape is kept.
+	std::shared_ptr<const CursorShape> last_shape = parsed.shape;
+	cursor.x = 40;
+	cursor.y = -7;
+	cursor.is_visible = false;
+	SerializeCursorState(cursor, false, data);
+	CHECK(data.size() == 9);
+	CHECK(ParseCursorState(data.data(), data.size(), &parsed));
+	CHECK(parsed.x == 40 && parsed.y == -7 && !parsed.is_visible);
+	CHECK(parsed.shape == last_shape);
+
+	// Monochrome shapes carry the AND and XOR masks.
+	std::shared_ptr<CursorShape> mono = std::make_shared<CursorShape>();
+	mono->type = CURSOR_SHAPE_MONOCHROME;
+	mono->width = 12;
+	mono->height = 3;
+	mono->pitch = 2;
+	mono->data = { 0xff, 0xf0, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x81, 0x80, 0x18, 0x10 };
+	cursor.shape = mono;
+	cursor.is_visible = true;
+	SerializeCursorState(cursor, true, data);
+	CHECK(ParseCursorState(data.data(), data.size(), &parsed));
+	CHECK(parsed.shape->type == CURSOR_SHAPE_MONOCHROME && parsed.shape->height == 3);
+	CHECK(parsed.shape->data == mono->data);
+
+	// A shape without enough data is not sent.
+	std::shared_ptr<CursorShape> short_shape = std::make_shared<CursorShape>(*shape);
+	short_shape->data.resize(10);
+	cursor.shape = short_shape;
+	SerializeCursorState(cursor, true, data);
+	CHECK(data.size() == 9);
+}
+
+static void TestParseRejectsBadInput()
+{
+	CursorState cursor = MakeColorCursor(5, 6);
+	std::vector<uint8_t> data;
+	SerializeCursorState(cursor, true, data);
+
+	CursorState parsed;
+	CHECK(!ParseCursorState(data.data(), 8, &parsed));
+	CHECK(!ParseCursorState(data.data(), 20, &parsed));
+	CHECK(!ParseCursorState(data.data(), data.size() - 1, &parsed));
+
+	std::vector<uint8_t> bad = data;
+	bad.push_back(0);
+	CHECK(!ParseCursorState(bad.data(), bad.size(), &parsed));
+
+	bad = data;
+	bad[0] |= 4;
+	CHECK(!ParseCursorState(bad.data(), bad.size(), &parsed));
+
+	// Shape type 3 does not exist.
+	bad = data;
+	bad[9] = 3;
+	CHECK(!ParseCursorState(bad.data(), bad.size(), &parsed));
+
+	// Pitch below the row size.
+	bad = data;
+	bad[15] = 4;
+	CHECK(!ParseCursorState(bad.data(), bad.size(), &parsed));
+
+	// A failed parse leaves the cursor alone.
+	CHECK(!parsed.shape && !parsed.is_visible && parsed.x == 0);
+}
+
+int main()
+{
+	RUN_TEST(TestCursorRect);
+	RUN_TEST(TestDrawColorCursor);
+	RUN_TEST(TestDrawMonochromeCursor);
+	RUN_TEST(TestDrawMaskedColorCursor);
+	RUN_TEST(TestDrawIsClipped);
+	RUN_TEST(TestCompose);
+	RUN_TEST(TestComposeNewSize);
+	RUN_TEST(TestSerializeCursorState);
+	RUN_TEST(TestParseRejectsBadInput);
+	return 0;
+}
@@ -0,0 +1,163 @@
+#include "damage_detector.h"
+#include "test.h"
+
+#include <cstring>
+
+using namespace DX;
+
+static void FillPattern(PixelFrame* frame)
+{
+	for (int y = 0; y < frame->height; y++) {
+		uint8_t* row = frame->plane[0] + y * frame->pitch[0];
+		for (int x = 0; x < frame->width * 4; x++) {
+			row[x] = static_cast<uint8_t>(x * 7 + y * 13);
+		}
+	}
+}
+
+static void CopyFrame(const PixelFrame* src, PixelFrame* dst)
+{
+	for (int y = 0; y < src->height; y++) {
+		memcpy(dst->plane[0] + y * dst->pitch[0], src->plane[0] + y * src->pitch[0], src->width * 4);
+	}
+}
+
+static bool IsRect(const PixelRect& rect, int left, int top, int right, int bottom)
+{
+	return rect.left == left && rect.top == top && rect.right == right && rect.bottom == bottom;
+}
+
+static void TestUnchangedFrame()
+{
+	PixelFramePool pool;
+	PixelFrame last_frame, frame;
+	CHECK(pool.Alloc(200, 100, PIXEL_FORMAT_ARGB, &last_frame));
+	CHECK(pool.Alloc(200, 100, PIXEL_FORMAT_ARGB, &frame));
+	FillPattern(&last_frame);
+	CopyFrame(&last_frame, &frame);
+
+	DamageDetector detector;
+	CHECK(detector.Detect(&last_frame, &frame) == 0);
+	CHECK(detector.GetDamageRects().empty());
+	CHECK(detector.GetTileCount() == 4 * 2);
+}
+
+static void TestMergesChangedTiles()
+{
+	PixelFramePool pool;
+	PixelFrame last_frame, frame;
+	CHECK(pool.Alloc(200, 100, PIXEL_FORMAT_ARGB, &last_frame));
+	CHECK(pool.Alloc(200, 100, PIXEL_FORMAT_ARGB, &frame));
+	FillPattern(&last_frame);
+	CopyFrame(&last_frame, &frame);
+
+	DamageDetector detector(64);
+
+	// One pixel marks its whole tile.
+	frame.plane[0][5 * frame.pitch[0] + 70 * 4] ^= 1;
+	CHECK(detector.Detect(&last_frame, &frame) == 1);
+	CHECK(detector.GetDamageRects().size() == 1);
+	CHECK(IsRect(detector.GetDamageRects()[0], 64, 0, 128, 64));
+
+	// Tiles (1, 0), (2, 0), (1, 1) and (2, 1) merge into one rect.
+	frame.plane[0][5 * frame.pitch[0] + 130 * 4] ^= 1;
+	frame.plane[0][70 * frame.pitch[0] + 64 * 4] ^= 1;
+	frame.plane[0][99 * frame.pitch[0] + 191 * 4 + 3] ^= 1;
+	CHECK(detector.Detect(&last_frame, &frame) == 4);
+	CHECK(detector.GetDamageRects().size() == 1);
+	CHECK(IsRect(detector.GetDamageRects()[0], 64, 0, 192, 100));
+
+	// Edge tiles are clipped to the frame, runs of another span are not merged.
+	CopyFrame(&last_frame, &frame);
+	frame.plane[0][5 * frame.pitch[0] + 0 * 4] ^= 1;
+	frame.plane[0][99 * frame.pitch[0] + 199 * 4] ^= 1;
+	CHECK(detector.Detect(&last_frame, &frame) == 2);
+
+	const std::vector<PixelRect>& rects = detector.GetDamageRects();
+	CHECK(rects.size() == 2);
+	CHECK(IsRect(rects[0], 0, 0, 64, 64));
+	CHECK(IsRect(rects[1], 192, 64, 200, 100));
+}
+
+// Every byte of a row is compared, in the vector blocks and in the tail.
+static void TestFindsEveryByte()
+{
+	PixelFramePool pool;
+	PixelFrame last_frame, frame;
+	CHECK(pool.Alloc(53, 3, PIXEL_FORMAT_RGBA, &last_frame));
+	CHECK(pool.Alloc(53, 3, PIXEL_FORMAT_RGBA, &frame));
+	FillPattern(&last_frame);
+	CopyFrame(&last_frame, &frame);
+
+	DamageDetector detector(16);
+	for (int x = 0; x < 53 * 4; x++) {
+		uint8_t* byte = &frame.plane[0][2 * frame.pitch[0] + x];
+		*byte ^= 0x80;
+		CHECK(detector.Detect(&last_frame, &frame) == 1);
+		CHECK(detector.GetDamageRects().size() == 1);
+
+		const PixelRect& rect = detector.GetDamageRects()[0];
+		CHECK(rect.left == x / 4 / 16 * 16);
+		CHECK(rect.right - rect.left == (rect.left + 16 <= 53 ? 16 : 53 - rect.left));
+		*byte ^= 0x80;
+	}
+
+	CHECK(detector.Detect(&last_frame, &frame) == 0);
+}
+
+static void TestRejectsOtherFrames()
+{
+	PixelFramePool pool;
+	PixelFrame frame, small_frame, rgba_frame, i420_frame;
+	CHECK(pool.Alloc(64, 64, PIXEL_FORMAT_ARGB, &frame));
+	CHECK(pool.Alloc(32, 64, PIXEL_FORMAT_ARGB, &small_frame));
+	CHECK(pool.Alloc(64, 64, PIXEL_FORMAT_RGBA, &rgba_frame));
+	CHECK(pool.Alloc(64, 64, PIXEL_FORMAT_I420, &i420_frame));
+
+	DamageDetector detector;
+	CHECK(detector.Detect(NULL, &frame) == -1);
+	CHECK(detector.Detect(&small_frame, &frame) == -1);
+	CHECK(detector.Detect(&rgba_frame, &frame) == -1);
+	CHECK(detector.Detect(&i420_frame, &i420_frame) == -1);
+	CHECK(detector.GetDamageRects().empty());
+}
+
+static void TestTileSize()
+{
+	CHECK(DamageDetector().GetTileSize() == 64);
+	CHECK(DamageDetector(20).GetTileSize() == 32);
+	CHECK(DamageDetector(8).GetTileSize() == 16);
+}
+
+// GetDirtyRects() yields nothing for an unchanged frame unless the whole frame is asked for.
+static void TestUnchangedDirtyRects()
+{
+	PixelFrame frame;
+	frame.width = 64;
+	frame.height = 32;
+	frame.format = PIXEL_FORMAT_ARGB;
+
+	std::vector<PixelRect> rects;
+	GetDirtyRects(&frame, false, rects);
+	CHECK(rects.size() == 1);
+	CHECK(IsRect(rects[0], 0, 0, 64, 32));
+
+	frame.is_unchanged = true;
+	GetDirtyRects(&frame, false, rects);
+	CHECK(rects.empty());
+
+	GetDirtyRects(&frame, true, rects);
+	CHECK(rects.size() == 1);
+	CHECK(IsRect(rects[0], 0, 0, 64, 32));
+}
+
+int main()
+{
+	RUN_TEST(TestUnchangedFrame);
+	RUN_TEST(TestMergesChangedTiles);
+	RUN_TEST(TestFindsEveryByte);
+	RUN_TEST(TestRejectsOtherFrames);
+	RUN_TEST(TestTileSize);
+	RUN_TEST(TestUnchangedDirtyRects);
+	return 0;
+}
@@ -0,0 +1,82 @@
+#include "frame_mailbox.h"
+#include "test.h"
+
+#include <memory>
+#include <thread>
+
+using namespace DX;
+
+static void TestKeepsLatestItem()
+{
+	FrameMailbox<int> mailbox;
+	int item = 0;
+	CHECK(!mailbox.HasItem());
+	CHECK(!mailbox.Fetch(item));
+
+	mailbox.Post(1);
+	mailbox.Post(2);
+	mailbox.Post(3);
+	CHECK(mailbox.HasItem());
+	CHECK(mailbox.Fetch(item));
+	CHECK(item == 3);
+	CHECK(!mailbox.Fetch(item));
+
+	CHECK(mailbox.GetPostedCount() == 3);
+	CHECK(mailbox.GetDroppedCount() == 2);
+
+	mailbox.Post(4);
+	CHECK(mailbox.Fetch(item));
+	CHECK(item == 4);
+	CHECK(mailbox.GetDroppedCount() == 2);
+}
+
+static void TestOverwrittenItemIsReleased()
+{
+	FrameMailbox<std::shared_ptr<int>> mailbox;
+	std::shared_ptr<int> first = std::make_shared<int>(1);
+	std::weak_ptr<int> weak_first = first;
+
+	mailbox.Post(std::move(first));
+	mailbox.Post(std::make_shared<int>(2));
+	CHECK(weak_first.expired());
+
+	std::shared_ptr<int> item;
+	CHECK(mailbox.Fetch(item));
+	CHECK(*item == 2);
+}
+
+// The consumer only ever sees newer items, and every item is either fetched or dropped.
+static void TestProducerConsumer()
+{
+	FrameMailbox<int> mailbox;
+	const int count = 200000;
+
+	std::thread producer([&mailbox, count] {
+		for (int i = 1; i <= count; i++) {
+			mailbox.Post(i);
+		}
+	});
+
+	int last_item = 0;
+	uint64_t fetched = 0;
+	while (last_item < count) {
+		int item = 0;
+		if (mailbox.Fetch(item)) {
+			CHECK(item > last_item);
+			last_item = item;
+			fetched += 1;
+		}
+	}
+	producer.join();
+
+	CHECK(mailbox.GetPostedCount() == static_cast<uint64_t>(count));
+	CHECK(fetched + mailbox.GetDroppedCount() == static_cast<uint64_t>(count));
+}
+
+int main()
+{
+	RUN_TEST(TestKeepsLatestItem);
+	RUN_TEST(TestOverwrittenItemIsReleased);
+	RUN_TEST(TestProducerConsumer);
+	return 0;
+}
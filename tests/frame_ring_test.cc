@@ -0,0 +1,141 @@
+#include "frame_ring.h"
+#include "test.h"
+
+#include <memory>
+
+using namespace DX;
+
+static PixelFrame* WriteFrame(FrameRing& ring, uint8_t value)
+{
+	PixelFrame* frame = ring.BeginWrite(64, 32, PIXEL_FORMAT_ARGB);
+	if (frame) {
+		frame->plane[0][0] = value;
+		ring.EndWrite();
+	}
+	return frame;
+}
+
+static void TestPublishesLatestFrame()
+{
+	FrameRing ring(3);
+	CHECK(!ring.GetLatest());
+	CHECK(ring.GetSequence() == 0);
+
+	PixelFrame* frame = WriteFrame(ring, 1);
+	CHECK(frame != NULL);
+	CHECK(frame->width == 64 && frame->height == 32);
+	CHECK(frame->format == PIXEL_FORMAT_ARGB);
+
+	std::shared_ptr<const PixelFrame> latest = ring.GetLatest();
+	CHECK(latest.get() == frame);
+	CHECK(latest->plane[0][0] == 1);
+	CHECK(ring.GetSequence() == 1);
+
+	// An unpublished write changes neither the latest frame nor the sequence.
+	PixelFrame* discarded = ring.BeginWrite(64, 32, PIXEL_FORMAT_ARGB);
+	CHECK(discarded != NULL && discarded != frame);
+	ring.EndWrite(false);
+	CHECK(ring.GetLatest().get() == frame);
+	CHECK(ring.GetSequence() == 1);
+
+	ring.Clear();
+	CHECK(!ring.GetLatest());
+	CHECK(latest->plane[0][0] == 1);
+}
+
+// Only a buffer with no view and no copy left is written again.
+static void TestReusesBufferAfterLastViewIsReleased()
+{
+	FrameRing ring(3);
+
+	PixelFrame* first = WriteFrame(ring, 1);
+	std::shared_ptr<const PixelFrame> view = ring.GetLatest();
+	std::shared_ptr<const PixelFrame> second_view = ring.GetLatest();
+	PixelFrame copy = *view;
+
+	PixelFrame* second = WriteFrame(ring, 2);
+	PixelFrame* third = WriteFrame(ring, 3);
+	CHECK(second != first && third != first && third != second);
+
+	// third is the latest frame, second is the only free buffer.
+	CHECK(ring.BeginWrite(64, 32, PIXEL_FORMAT_ARGB) == second);
+	ring.EndWrite(false);
+
+	view.reset();
+	CHECK(ring.BeginWrite(64, 32, PIXEL_FORMAT_ARGB) == second);
+	ring.EndWrite(false);
+
+	// The copy still shares the planes of the first buffer.
+	second_view.reset();
+	CHECK(ring.BeginWrite(64, 32, PIXEL_FORMAT_ARGB) == second);
+	ring.EndWrite(false);
+	CHECK(copy.plane[0][0] == 1);
+
+	copy = PixelFrame();
+	CHECK(ring.BeginWrite(64, 32, PIXEL_FORMAT_ARGB) == first);
+	ring.EndWrite(false);
+	CHECK(ring.GetDroppedCount() == 0);
+}
+
+static void TestDropsWhenEveryBufferIsHeld()
+{
+	FrameRing ring(2);
+
+	PixelFrame* first = WriteFrame(ring, 1);
+	std::shared_ptr<const PixelFrame> first_view = ring.GetLatest();
+	PixelFrame* second = WriteFrame(ring, 2);
+	CHECK(first != NULL && second != NULL);
+
+	CHECK(ring.BeginWrite(64, 32, PIXEL_FORMAT_ARGB) == NULL);
+	CHECK(ring.BeginWrite(64, 32, PIXEL_FORMAT_ARGB) == NULL);
+	CHECK(ring.GetDroppedCount() == 2);
+	CHECK(ring.GetSequence() == 2);
+	CHECK(ring.GetLatest().get() == second);
+	CHECK(first_view->plane[0][0] == 1);
+
+	first_view.reset();
+	CHECK(WriteFrame(ring, 3) == first);
+	CHECK(ring.GetDroppedCount() == 2);
+	CHECK(ring.GetSequence() == 3);
+}
+
+static void TestKeepsPlanesOfReusedBuffer()
+{
+	FrameRing ring(1);
+
+	PixelFrame* frame = WriteFrame(ring, 9);
+	ring.Clear();
+
+	// Same size, the capture only has to write the changed regions.
+	PixelFrame* reused = ring.BeginWrite(64, 32, PIXEL_FORMAT_ARGB);
+	CHECK(reused == frame);
+	CHECK(reused->plane[0][0] == 9);
+	CHECK(reused->dirty_rects.empty());
+	ring.EndWrite(false);
+
+	// A new size gets new planes.
+	reused = ring.BeginWrite(128, 64, PIXEL_FORMAT_ARGB);
+	CHECK(reused == frame);
+	CHECK(reused->width == 128 && reused->height == 64);
+	ring.EndWrite();
+}
+
+static void TestBeginWriteTwice()
+{
+	FrameRing ring(3);
+	CHECK(ring.BeginWrite(64, 32, PIXEL_FORMAT_ARGB) != NULL);
+	CHECK(ring.BeginWrite(64, 32, PIXEL_FORMAT_ARGB) == NULL);
+	ring.EndWrite();
+	CHECK(ring.GetSequence() == 1);
+	CHECK(ring.GetDroppedCount() == 0);
+}
+
+int main()
+{
+	RUN_TEST(TestPublishesLatestFrame);
+	RUN_TEST(TestReusesBufferAfterLastViewIsReleased);
+	RUN_TEST(TestDropsWhenEveryBufferIsHeld);
+	RUN_TEST(TestKeepsPlanesOfReusedBuffer);
+	RUN_TEST(TestBeginWriteTwice);
+	return 0;
+}
@@ -0,0 +1,92 @@
+#include "frame_signal.h"
+#include "test.h"
+
+#include <chrono>
+#include <thread>
+
+using namespace DX;
+
+static int64_t GetElapsedMs(std::chrono::steady_clock::time_point start_time)
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now() - start_time).count();
+}
+
+static void TestWaitTimesOut()
+{
+	FrameSignal signal;
+
+	auto start_time = std::chrono::steady_clock::now();
+	CHECK(!signal.Wait(0, 30));
+	CHECK(GetElapsedMs(start_time) >= 25);
+
+	CHECK(!signal.Wait(0, 0));
+	CHECK(signal.GetSequence() == 0);
+}
+
+static void TestWaitReturnsForNewerFrame()
+{
+	FrameSignal signal;
+	CHECK(signal.Notify(100) == 1);
+	CHECK(signal.Notify(200) == 2);
+
+	int64_t timestamp_us = 0;
+	CHECK(signal.GetSequence(&timestamp_us) == 2);
+	CHECK(timestamp_us == 200);
+
+	// Frames already there are not waited for.
+	CHECK(signal.Wait(0, 0));
+	CHECK(signal.Wait(1, 0));
+	CHECK(!signal.Wait(2, 0));
+}
+
+static void TestNotifyWakesWaiter()
+{
+	FrameSignal signal;
+	bool is_woken = false;
+
+	std::thread waiter([&signal, &is_woken] {
+		is_woken = signal.Wait(0, -1);
+	});
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	signal.Notify(1);
+	waiter.join();
+	CHECK(is_woken);
+}
+
+static void TestCancelAndReset()
+{
+	FrameSignal signal;
+	bool is_woken = true;
+
+	std::thread waiter([&signal, &is_woken] {
+		is_woken = signal.Wait(0, -1);
+	});
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	signal.Cancel();
+	waiter.join();
+	CHECK(!is_woken);
+
+	// Cancelled, even a newer frame does not count.
+	signal.Notify(1);
+	CHECK(!signal.Wait(0, 0));
+
+	// After Reset() only frames notified later count, the sequence keeps going.
+	signal.Reset();
+	CHECK(!signal.Wait(0, 0));
+	CHECK(signal.Notify(2) == 2);
+	CHECK(signal.Wait(0, 0));
+	CHECK(signal.Wait(1, 0));
+	CHECK(!signal.Wait(2, 0));
+}
+
+int main()
+{
+	RUN_TEST(TestWaitTimesOut);
+	RUN_TEST(TestWaitReturnsForNewerFrame);
+	RUN_TEST(TestNotifyWakesWaiter);
+	RUN_TEST(TestCancelAndReset);
+	return 0;
+}
@@ -0,0 +1,116 @@
+#include "renderer.h"
+#include "test.h"
+
+#include <cstdint>
+#include <cstring>
+
+using namespace DX;
+
+static void TestPlanesAreAligned()
+{
+	PixelFramePool pool;
+
+	for (int format = PIXEL_FORMAT_ARGB; format < PIXEL_FORMAT_MAX; format++) {
+		PixelFrame frame;
+		CHECK(pool.Alloc(33, 17, static_cast<PixelFormat>(format), &frame));
+
+		int row_bytes[3], rows[3];
+		CHECK(GetPlaneSize(frame.format, frame.width, frame.height, row_bytes, rows));
+		for (int i = 0; i < 3; i++) {
+			if (row_bytes[i] == 0) {
+				CHECK(frame.plane[i] == NULL);
+				continue;
+			}
+			CHECK(reinterpret_cast<uintptr_t>(frame.plane[i]) % 64 == 0);
+			CHECK(frame.pitch[i] % 64 == 0);
+			CHECK(frame.pitch[i] >= row_bytes[i]);
+		}
+	}
+}
+
+static void TestBuffersAreRecycled()
+{
+	PixelFramePool pool;
+	uint8_t* plane = NULL;
+	{
+		PixelFrame frame;
+		CHECK(pool.Alloc(64, 64, PIXEL_FORMAT_I420, &frame));
+		plane = frame.plane[0];
+
+		// Still held by a copy after the first frame went away.
+		PixelFrame copy = frame;
+		frame = PixelFrame();
+		PixelFrame other;
+		CHECK(pool.Alloc(64, 64, PIXEL_FORMAT_I420, &other));
+		CHECK(other.plane[0] != plane);
+	}
+
+	PixelFrame frame;
+	CHECK(pool.Alloc(64, 64, PIXEL_FORMAT_I420, &frame));
+	CHECK(pool.GetHitCount() == 1);
+	CHECK(pool.GetMissCount() == 2);
+
+	// Another size or format never gets the buffer.
+	PixelFrame nv12;
+	CHECK(pool.Alloc(64, 64, PIXEL_FORMAT_NV12, &nv12));
+	CHECK(pool.GetMissCount() == 3);
+}
+
+static void TestReusedFrameIsReset()
+{
+	PixelFramePool pool;
+	PixelFrame frame;
+	CHECK(pool.Alloc(32, 32, PIXEL_FORMAT_I420, &frame));
+
+	PixelRect rect;
+	rect.right = 2;
+	rect.bottom = 2;
+	frame.dirty_rects.assign(1, rect);
+	frame.is_unchanged = true;
+	frame.color_matrix = COLOR_MATRIX_BT709;
+	frame.color_range = COLOR_RANGE_FULL;
+
+	CHECK(pool.Alloc(32, 32, PIXEL_FORMAT_I420, &frame));
+	CHECK(frame.dirty_rects.empty());
+	CHECK(!frame.is_unchanged);
+	CHECK(frame.color_matrix == COLOR_MATRIX_BT601);
+	CHECK(frame.color_range == COLOR_RANGE_LIMITED);
+}
+
+static void TestClone()
+{
+	PixelFramePool pool;
+	PixelFrame src;
+	CHECK(pool.Alloc(21, 9, PIXEL_FORMAT_NV12, &src));
+	for (int y = 0; y < 9; y++) {
+		memset(src.plane[0] + y * src.pitch[0], y, 21);
+	}
+	for (int y = 0; y < 5; y++) {
+		memset(src.plane[1] + y * src.pitch[1], 100 + y, 22);
+	}
+	src.color_matrix = COLOR_MATRIX_BT709;
+	src.dirty_rects.assign(2, PixelRect());
+	src.is_unchanged = true;
+
+	PixelFrame dst;
+	CHECK(pool.Clone(&src, &dst));
+	CHECK(dst.plane[0] != src.plane[0]);
+	CHECK(dst.color_matrix == COLOR_MATRIX_BT709);
+	CHECK(dst.dirty_rects.size() == 2);
+	CHECK(dst.is_unchanged);
+	for (int y = 0; y < 9; y++) {
+		CHECK(memcmp(dst.plane[0] + y * dst.pitch[0], src.plane[0] + y * src.pitch[0], 21) == 0);
+	}
+	for (int y = 0; y < 5; y++) {
+		CHECK(memcmp(dst.plane[1] + y * dst.pitch[1], src.plane[1] + y * src.pitch[1], 22) == 0);
+	}
+}
+
+int main()
+{
+	RUN_TEST(TestPlanesAreAligned);
+	RUN_TEST(TestBuffersAreRecycled);
+	RUN_TEST(TestReusedFrameIsReset);
+	RUN_TEST(TestClone);
+	return 0;
+}
@@ -0,0 +1,111 @@
+#include "plane_copy.h"
+#include "test.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace DX;
+
+static void CheckCopy(int row_bytes, int height, int dst_pitch, int src_pitch)
+{
+	std::vector<uint8_t> src(static_cast<size_t>(src_pitch) * height + 1);
+	std::vector<uint8_t> dst(static_cast<size_t>(dst_pitch) * height + 1, 0xAA);
+	for (size_t i = 0; i < src.size(); i++) {
+		src[i] = static_cast<uint8_t>(i * 7 + 3);
+	}
+
+	// Odd start addresses take the unaligned head of the streaming copy.
+	CopyPlane(dst.data() + 1, dst_pitch, src.data() + 1, src_pitch, row_bytes, height);
+
+	CHECK(dst[0] == 0xAA);
+	for (int y = 0; y < height; y++) {
+		const uint8_t* dst_row = dst.data() + 1 + static_cast<size_t>(y) * dst_pitch;
+		CHECK(memcmp(dst_row, src.data() + 1 + static_cast<size_t>(y) * src_pitch, row_bytes) == 0);
+		// With equal pitches the padding may be copied in one bulk copy.
+		if (dst_pitch != src_pitch) {
+			for (int x = row_bytes; x < dst_pitch; x++) {
+				CHECK(dst_row[x] == 0xAA);
+			}
+		}
+	}
+}
+
+static void TestSmallPlanes()
+{
+	for (int row_bytes = 1; row_bytes < 100; row_bytes += 7) {
+		CheckCopy(row_bytes, 5, row_bytes, row_bytes);
+		CheckCopy(row_bytes, 5, row_bytes + 3, row_bytes + 17);
+	}
+}
+
+// Above the streaming and striping thresholds.
+static void TestLargePlanes()
+{
+	CheckCopy(3840 * 4, 600, 3840 * 4, 3840 * 4);
+	CheckCopy(3840 * 4 - 12, 700, 3840 * 4, 3840 * 4 + 64);
+}
+
+static void TestCopyPlane10To16()
+{
+	for (int width = 1; width < 40; width += 3) {
+		const int height = 3;
+		std::vector<uint16_t> src(static_cast<size_t>(width + 5) * height);
+		std::vector<uint16_t> dst(static_cast<size_t>(width + 2) * height, 0xAAAA);
+		for (size_t i = 0; i < src.size(); i++) {
+			// Garbage above bit 9 must be ignored.
+			src[i] = static_cast<uint16_t>((i * 97) | (i & 1 ? 0xFC00 : 0));
+		}
+
+		CopyPlane10To16(reinterpret_cast<uint8_t*>(dst.data()), (width + 2) * 2,
+			reinterpret_cast<const uint8_t*>(src.data()), (width + 5) * 2, width, height);
+
+		for (int y = 0; y < height; y++) {
+			for (int x = 0; x < width; x++) {
+				int value = src[y * (width + 5) + x] & 0x3ff;
+				CHECK(dst[y * (width + 2) + x] == ((value << 6) | (value >> 4)));
+			}
+			CHECK(dst[y * (width + 2) + width] == 0xAAAA);
+		}
+	}
+
+	// 0 and 1023 map to the ends of the 16-bit range.
+	uint16_t src[2] = { 0, 1023 };
+	uint16_t dst[2] = { 1, 1 };
+	CopyPlane10To16(reinterpret_cast<uint8_t*>(dst), 4, reinterpret_cast<const uint8_t*>(src), 4, 2, 1);
+	CHECK(dst[0] == 0 && dst[1] == 0xFFFF);
+}
+
+static void TestSplitUVPlane16()
+{
+	for (int width = 1; width < 40; width += 3) {
+		const int height = 2;
+		std::vector<uint16_t> src(static_cast<size_t>(width * 2 + 4) * height);
+		std::vector<uint16_t> dst_u(static_cast<size_t>(width) * height);
+		std::vector<uint16_t> dst_v(static_cast<size_t>(width) * height);
+		for (size_t i = 0; i < src.size(); i++) {
+			// P010 keeps the sample in the high bits, so the top bit is often set.
+			src[i] = static_cast<uint16_t>(i * 4099 + 0x8000);
+		}
+
+		SplitUVPlane16(reinterpret_cast<uint8_t*>(dst_u.data()), width * 2,
+			reinterpret_cast<uint8_t*>(dst_v.data()), width * 2,
+			reinterpret_cast<const uint8_t*>(src.data()), (width * 2 + 4) * 2, width, height);
+
+		for (int y = 0; y < height; y++) {
+			for (int x = 0; x < width; x++) {
+				CHECK(dst_u[y * width + x] == src[y * (width * 2 + 4) + x * 2]);
+				CHECK(dst_v[y * width + x] == src[y * (width * 2 + 4) + x * 2 + 1]);
+			}
+		}
+	}
+}
+
+int main()
+{
+	RUN_TEST(TestSmallPlanes);
+	RUN_TEST(TestLargePlanes);
+	RUN_TEST(TestCopyPlane10To16);
+	RUN_TEST(TestSplitUVPlane16);
+	return 0;
+}
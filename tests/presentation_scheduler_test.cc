@@ -0,0 +1,197 @@
+#include "presentation_scheduler.h"
+#include "test.h"
+
+using namespace DX;
+
+static const int64_t kFrameDuration = 33333;
+
+// Polls at the current time and presents right away, returns the frame or -1.
+static int PollAndPresent(PresentationScheduler<int>& scheduler)
+{
+	int frame = -1;
+	if (scheduler.Poll(frame)) {
+		scheduler.Presented();
+	}
+	return frame;
+}
+
+static void TestFramesArePacedByPts()
+{
+	ManualClock clock;
+	clock.SetTime(1000000);
+	PresentationScheduler<int> scheduler(&clock);
+
+	for (int i = 0; i < 3; i++) {
+		scheduler.Push(i, i * kFrameDuration);
+	}
+
+	CHECK(scheduler.GetWaitTime() == 0);
+	CHECK(PollAndPresent(scheduler) == 0);
+
+	// Not due yet.
+	clock.Advance(10000);
+	CHECK(PollAndPresent(scheduler) == -1);
+	CHECK(scheduler.GetWaitTime() == kFrameDuration - 10000);
+
+	clock.Advance(kFrameDuration - 10000);
+	CHECK(PollAndPresent(scheduler) == 1);
+
+	clock.Advance(kFrameDuration);
+	CHECK(PollAndPresent(scheduler) == 2);
+	CHECK(scheduler.GetWaitTime() == -1);
+
+	PresentationStats stats = scheduler.GetStats();
+	CHECK(stats.queued_frames == 3);
+	CHECK(stats.presented_frames == 3);
+	CHECK(stats.dropped_frames == 0);
+	// Presented exactly on the pts grid.
+	CHECK(stats.jitter.GetCount() == 2);
+	CHECK(stats.jitter.GetBucket(0) == 2);
+}
+
+static void TestLateFramesAreDropped()
+{
+	ManualClock clock;
+	PresentationScheduler<int> scheduler(&clock, 8);
+
+	for (int i = 0; i < 5; i++) {
+		scheduler.Push(i, i * kFrameDuration);
+	}
+	CHECK(PollAndPresent(scheduler) == 0);
+
+	// Frames 1 and 2 missed their slot, 3 is due.
+	clock.Advance(3 * kFrameDuration + 100);
+	CHECK(PollAndPresent(scheduler) == 3);
+	CHECK(scheduler.GetStats().dropped_frames == 2);
+
+	clock.Advance(kFrameDuration);
+	CHECK(PollAndPresent(scheduler) == 4);
+	CHECK(scheduler.GetStats().presented_frames == 3);
+}
+
+static void TestFullQueueDropsOldest()
+{
+	ManualClock clock;
+	PresentationScheduler<int> scheduler(&clock, 2);
+
+	scheduler.Push(0, 0);
+	scheduler.Push(1, kFrameDuration);
+	CHECK(!scheduler.WaitForSpace(0));
+	scheduler.Push(2, 2 * kFrameDuration);
+	CHECK(scheduler.GetStats().dropped_frames == 1);
+
+	CHECK(PollAndPresent(scheduler) == 1);
+	CHECK(scheduler.WaitForSpace(0));
+}
+
+static void TestRenderCostStartsFramesEarly()
+{
+	ManualClock clock;
+	PresentationScheduler<int> scheduler(&clock);
+	const int64_t render_cost = 8000;
+
+	for (int i = 0; i < 40; i++) {
+		scheduler.Push(i, i * kFrameDuration);
+
+		int frame = -1;
+		while (!scheduler.Poll(frame)) {
+			clock.Advance(100);
+		}
+		CHECK(frame == i);
+		clock.Advance(render_cost);
+		scheduler.Presented();
+	}
+
+	PresentationStats stats = scheduler.GetStats();
+	CHECK(stats.dropped_frames == 0);
+	CHECK(stats.render_cost_ms > 7.0 && stats.render_cost_ms <= 8.0);
+
+	// The next frame is polled about one render cost before its pts slot.
+	scheduler.Push(40, 40 * kFrameDuration);
+	int64_t wait_time = scheduler.GetWaitTime();
+	CHECK(wait_time > kFrameDuration - render_cost - 1000 && wait_time < kFrameDuration - render_cost + 1000);
+}
+
+static void TestFramesWithoutPts()
+{
+	ManualClock clock;
+	PresentationScheduler<int> scheduler(&clock);
+	scheduler.SetFrameDuration(20000);
+
+	scheduler.Push(0, kNoPts);
+	scheduler.Push(1, kNoPts);
+	CHECK(PollAndPresent(scheduler) == 0);
+
+	clock.Advance(19999);
+	CHECK(PollAndPresent(scheduler) == -1);
+	clock.Advance(1);
+	CHECK(PollAndPresent(scheduler) == 1);
+}
+
+static void TestUnderrunCountsRepeats()
+{
+	ManualClock clock;
+	PresentationScheduler<int> scheduler(&clock);
+
+	scheduler.Push(0, 0);
+	CHECK(PollAndPresent(scheduler) == 0);
+
+	for (int i = 0; i < 3; i++) {
+		clock.Advance(kFrameDuration);
+		CHECK(PollAndPresent(scheduler) == -1);
+	}
+	CHECK(scheduler.GetStats().repeated_frames == 3);
+
+	// The late frame restarts the timeline, the next one is not rushed.
+	clock.Advance(1000);
+	scheduler.Push(1, kFrameDuration);
+	CHECK(PollAndPresent(scheduler) == 1);
+	scheduler.Push(2, 2 * kFrameDuration);
+	CHECK(PollAndPresent(scheduler) == -1);
+	clock.Advance(kFrameDuration);
+	CHECK(PollAndPresent(scheduler) == 2);
+	CHECK(scheduler.GetStats().dropped_frames == 0);
+}
+
+static void TestPtsJumpsRestartTimeline()
+{
+	ManualClock clock;
+	PresentationScheduler<int> scheduler(&clock);
+
+	scheduler.Push(0, 0);
+	CHECK(PollAndPresent(scheduler) == 0);
+
+	// A splice jumps forward by minutes, the frame follows one interval later.
+	scheduler.Push(1, 600000000);
+	clock.Advance(kFrameDuration - 1);
+	CHECK(PollAndPresent(scheduler) == -1);
+	clock.Advance(1);
+	CHECK(PollAndPresent(scheduler) == 1);
+
+	// Frames after the splice keep their own spacing.
+	scheduler.Push(2, 600000000 + kFrameDuration);
+	clock.Advance(kFrameDuration);
+	CHECK(PollAndPresent(scheduler) == 2);
+
+	// A wrapped clock jumps back.
+	scheduler.Push(3, 0);
+	clock.Advance(kFrameDuration);
+	CHECK(PollAndPresent(scheduler) == 3);
+
+	PresentationStats stats = scheduler.GetStats();
+	CHECK(stats.presented_frames == 4);
+	CHECK(stats.dropped_frames == 0);
+	CHECK(stats.repeated_frames == 0);
+}
+
+int main()
+{
+	RUN_TEST(TestFramesArePacedByPts);
+	RUN_TEST(TestLateFramesAreDropped);
+	RUN_TEST(TestFullQueueDropsOldest);
+	RUN_TEST(TestRenderCostStartsFramesEarly);
+	RUN_TEST(TestFramesWithoutPts);
+	RUN_TEST(TestUnderrunCountsRepeats);
+	RUN_TEST(TestPtsJumpsRestartTimeline);
+	return 0;
+}
@@ -0,0 +1,163 @@
+#include "software_renderer.h"
+#include "test.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+using namespace DX;
+
+static uint32_t g_seed = 1;
+
+static uint8_t Random8()
+{
+	g_seed = g_seed * 1103515245 + 12345;
+	return static_cast<uint8_t>(g_seed >> 16);
+}
+
+static void FillRandom(PixelFrame* frame)
+{
+	int row_bytes[3], rows[3];
+	GetPlaneSize(frame->format, frame->width, frame->height, row_bytes, rows);
+	for (int i = 0; i < 3; i++) {
+		for (int y = 0; y < rows[i]; y++) {
+			for (int x = 0; x < row_bytes[i]; x++) {
+				frame->plane[i][y * frame->pitch[i] + x] = Random8();
+			}
+		}
+	}
+}
+
+static int Clamp255(double value)
+{
+	long rounded = lround(value);
+	return rounded < 0 ? 0 : (rounded > 255 ? 255 : static_cast<int>(rounded));
+}
+
+// Float reference of one I420 pixel, B G R A in memory.
+static void ReferenceI420(const PixelFrame* frame, int x, int y, uint8_t bgra[4])
+{
+	YUVToRGBCoefficients c = GetYUVToRGBCoefficients(frame->color_matrix, frame->color_range);
+	double luma = c.y_scale * (frame->plane[0][y * frame->pitch[0] + x] - c.y_offset);
+	double u = frame->plane[1][y / 2 * frame->pitch[1] + x / 2] - 128.0;
+	double v = frame->plane[2][y / 2 * frame->pitch[2] + x / 2] - 128.0;
+	bgra[0] = static_cast<uint8_t>(Clamp255(luma + c.bu * u));
+	bgra[1] = static_cast<uint8_t>(Clamp255(luma + c.gu * u + c.gv * v));
+	bgra[2] = static_cast<uint8_t>(Clamp255(luma + c.rv * v));
+	bgra[3] = 255;
+}
+
+static void CheckI420Output(SoftwareRenderer& renderer, const PixelFrame* frame)
+{
+	CHECK(renderer.GetWidth() == frame->width);
+	CHECK(renderer.GetHeight() == frame->height);
+
+	for (int y = 0; y < frame->height; y++) {
+		const uint8_t* row = renderer.GetBuffer() + y * renderer.GetPitch();
+		for (int x = 0; x < frame->width; x++) {
+			uint8_t expected[4];
+			ReferenceI420(frame, x, y, expected);
+			for (int i = 0; i < 4; i++) {
+				CHECK_NEAR(row[x * 4 + i], expected[i], 2);
+			}
+		}
+	}
+}
+
+static void TestI420MatchesReference()
+{
+	PixelFramePool pool;
+	PixelFrame frame;
+	CHECK(pool.Alloc(37, 21, PIXEL_FORMAT_I420, &frame));
+	FillRandom(&frame);
+
+	SoftwareRenderer renderer;
+	CHECK(renderer.Init(NULL));
+
+	for (int matrix = 0; matrix < COLOR_MATRIX_MAX; matrix++) {
+		for (int range = 0; range < COLOR_RANGE_MAX; range++) {
+			frame.color_matrix = static_cast<ColorMatrix>(matrix);
+			frame.color_range = static_cast<ColorRange>(range);
+			renderer.Render(&frame);
+			CheckI420Output(renderer, &frame);
+		}
+	}
+}
+
+static void TestARGBIsCopied()
+{
+	PixelFramePool pool;
+	PixelFrame frame;
+	CHECK(pool.Alloc(19, 7, PIXEL_FORMAT_ARGB, &frame));
+	FillRandom(&frame);
+
+	SoftwareRenderer renderer;
+	CHECK(renderer.Init(NULL));
+	renderer.Render(&frame);
+
+	for (int y = 0; y < frame.height; y++) {
+		CHECK(memcmp(renderer.GetBuffer() + y * renderer.GetPitch(), frame.plane[0] + y * frame.pitch[0], frame.width * 4) == 0);
+	}
+}
+
+static void TestBufferIsAligned()
+{
+	PixelFramePool pool;
+	SoftwareRenderer renderer;
+	CHECK(renderer.Init(NULL));
+
+	// Each size change reallocates the surface.
+	for (int width = 1; width < 80; width += 13) {
+		PixelFrame frame;
+		CHECK(pool.Alloc(width, 3, PIXEL_FORMAT_ARGB, &frame));
+		FillRandom(&frame);
+		renderer.Render(&frame);
+
+		CHECK(reinterpret_cast<uintptr_t>(renderer.GetBuffer()) % 64 == 0);
+		CHECK(renderer.GetPitch() % 64 == 0);
+		CHECK(renderer.GetPitch() >= width * 4);
+	}
+}
+
+static void TestDirtyRectsOnly()
+{
+	PixelFramePool pool;
+	PixelFrame frame;
+	CHECK(pool.Alloc(64, 32, PIXEL_FORMAT_I420, &frame));
+	FillRandom(&frame);
+
+	SoftwareRenderer renderer;
+	CHECK(renderer.Init(NULL));
+	renderer.Render(&frame);
+	CHECK(renderer.GetPixelsTouched() == 64 * 32);
+
+	// Odd edges grow to the chroma grid: 10x6 becomes 12x8.
+	PixelRect rect;
+	rect.left = 5;
+	rect.top = 3;
+	rect.right = 15;
+	rect.bottom = 9;
+	for (int y = rect.top; y < rect.bottom; y++) {
+		memset(frame.plane[0] + y * frame.pitch[0] + rect.left, 200, rect.right - rect.left);
+	}
+	frame.dirty_rects.assign(1, rect);
+
+	renderer.Render(&frame);
+	CHECK(renderer.GetPixelsTouched() == 12 * 8);
+	CheckI420Output(renderer, &frame);
+
+	// An unchanged frame touches nothing, whatever its dirty rects.
+	frame.is_unchanged = true;
+	renderer.Render(&frame);
+	CHECK(renderer.GetPixelsTouched() == 0);
+	CheckI420Output(renderer, &frame);
+}
+
+int main()
+{
+	RUN_TEST(TestI420MatchesReference);
+	RUN_TEST(TestARGBIsCopied);
+	RUN_TEST(TestBufferIsAligned);
+	RUN_TEST(TestDirtyRectsOnly);
+	return 0;
+}
@@ -0,0 +1,108 @@
+#include "stream_workers.h"
+#include "test.h"
+
+#include <atomic>
+#include <chrono>
+
+static void TestEveryIndexRunsOnce()
+{
+	StreamWorkers workers;
+
+	for (int count = 1; count <= 4; count++) {
+		std::atomic<int> runs[4];
+		for (auto& run : runs) {
+			run = 0;
+		}
+
+		workers.Run(count, [&](int index) {
+			runs[index] += 1;
+		});
+
+		for (int i = 0; i < 4; i++) {
+			CHECK(runs[i] == (i < count ? 1 : 0));
+		}
+	}
+
+	// Fewer tasks after more threads were started.
+	std::atomic<int> total(0);
+	workers.Run(2, [&](int) { total += 1; });
+	CHECK(total == 2);
+}
+
+static void TestJobsOverlap()
+{
+	StreamWorkers workers;
+
+	for (int i = 0; i < 3; i++) {
+		auto start_time = std::chrono::steady_clock::now();
+		workers.Run(2, [](int index) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(index == 0 ? 40 : 30));
+		});
+		double elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+		CHECK(elapsed_ms >= 39.0 && elapsed_ms < 65.0);
+	}
+}
+
+static void TestFirstJobRunsOnCaller()
+{
+	StreamWorkers workers;
+	std::thread::id ids[2];
+
+	for (int i = 0; i < 2; i++) {
+		std::thread::id worker_id = ids[1];
+		workers.Run(2, [&](int index) {
+			ids[index] = std::this_thread::get_id();
+		});
+		CHECK(ids[0] == std::this_thread::get_id());
+		CHECK(ids[1] != std::this_thread::get_id());
+		// Threads are kept between runs.
+		CHECK(i == 0 || ids[1] == worker_id);
+	}
+
+	workers.Destroy();
+	workers.Run(2, [&](int index) {
+		ids[index] = std::this_thread::get_id();
+	});
+	CHECK(ids[1] != std::this_thread::get_id());
+}
+
+static void TestRunsFromTwoThreads()
+{
+	StreamWorkers workers;
+	std::atomic<int> active(0);
+	std::atomic<int> max_active(0);
+	std::atomic<int> total(0);
+
+	auto job = [&](int) {
+		int now_active = ++active;
+		int expected = max_active;
+		while (now_active > expected && !max_active.compare_exchange_weak(expected, now_active)) {
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		total += 1;
+		active -= 1;
+	};
+
+	std::thread other([&] {
+		for (int i = 0; i < 50; i++) {
+			workers.Run(2, job);
+		}
+	});
+	for (int i = 0; i < 50; i++) {
+		workers.Run(2, job);
+	}
+	other.join();
+
+	// Runs are serialized, at most one run's jobs are active at a time.
+	CHECK(total == 200);
+	CHECK(max_active <= 2);
+}
+
+int main()
+{
+	RUN_TEST(TestEveryIndexRunsOnce);
+	RUN_TEST(TestJobsOverlap);
+	RUN_TEST(TestFirstJobRunsOnCaller);
+	RUN_TEST(TestRunsFromTwoThreads);
+	return 0;
+}
@@ -0,0 +1,127 @@
+#include "synthetic_screen_capture.h"
+#include "test.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace DX;
+
+static uint32_t GetFrameTag(const PixelFrame* frame)
+{
+	uint32_t tag = 0;
+	memcpy(&tag, frame->plane[0], sizeof(tag));
+	return tag;
+}
+
+// WaitForFrame() returns every frame at most once, newest first.
+static void TestWaitForFrame()
+{
+	SyntheticScreenCapture capture(64, 32, 200);
+	CHECK(capture.Init());
+
+	Image image;
+	for (int i = 0; i < 10; i++) {
+		uint64_t last_sequence = image.sequence;
+		int64_t last_timestamp = image.timestamp;
+		CHECK(capture.WaitForFrame(image, 1000));
+
+		CHECK(image.sequence > last_sequence);
+		CHECK(image.timestamp > last_timestamp);
+		CHECK(image.width == 64 && image.height == 32);
+		CHECK(image.frame->format == PIXEL_FORMAT_ARGB);
+		CHECK(GetFrameTag(image.frame.get()) == static_cast<uint32_t>(image.sequence));
+		CHECK(!image.is_cursor_only);
+	}
+
+	capture.Destroy();
+}
+
+// The capture writes other buffers while a frame is held.
+static void TestHeldFrameDoesNotChange()
+{
+	SyntheticScreenCapture capture(64, 32, 200);
+	CHECK(capture.Init());
+
+	Image held_image;
+	CHECK(capture.WaitForFrame(held_image, 1000));
+	const PixelFrame* held_frame = held_image.frame.get();
+	size_t frame_bytes = held_frame->pitch[0] * held_frame->height;
+	std::vector<uint8_t> pixels(held_frame->plane[0], held_frame->plane[0] + frame_bytes);
+
+	Image image = held_image;
+	for (int i = 0; i < 10; i++) {
+		CHECK(capture.WaitForFrame(image, 1000));
+		CHECK(image.frame.get() != held_frame);
+		CHECK(GetFrameTag(image.frame.get()) == static_cast<uint32_t>(image.sequence));
+	}
+
+	CHECK(memcmp(held_frame->plane[0], pixels.data(), frame_bytes) == 0);
+	CHECK(GetFrameTag(held_frame) == static_cast<uint32_t>(held_image.sequence));
+	capture.Destroy();
+}
+
+static void TestFrameCallback()
+{
+	SyntheticScreenCapture capture(64, 32, 200);
+	std::atomic<int> frame_count{ 0 };
+	std::atomic<bool> is_tag_ok{ true };
+
+	capture.SetFrameCallback([&frame_count, &is_tag_ok](const Image& image) {
+		if (GetFrameTag(image.frame.get()) != static_cast<uint32_t>(image.sequence)) {
+			is_tag_ok = false;
+		}
+		frame_count += 1;
+	});
+	CHECK(capture.Init());
+
+	Image image;
+	for (int i = 0; i < 5; i++) {
+		CHECK(capture.WaitForFrame(image, 1000));
+	}
+
+	// Frame n is published after the callback for frame n - 1 returned.
+	CHECK(frame_count >= static_cast<int>(image.sequence) - 1);
+	CHECK(frame_count >= 4);
+	CHECK(is_tag_ok);
+	capture.Destroy();
+}
+
+// Destroy() wakes a blocked WaitForFrame(), Init() starts over.
+static void TestDestroyWakesWaiter()
+{
+	SyntheticScreenCapture capture(64, 32, 200);
+	CHECK(capture.Init());
+
+	bool is_woken = true;
+	std::thread waiter([&capture, &is_woken] {
+		Image image;
+		image.sequence = 1ull << 40;
+		is_woken = capture.WaitForFrame(image, -1);
+	});
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	capture.Destroy();
+	waiter.join();
+	CHECK(!is_woken);
+
+	Image image;
+	CHECK(!capture.Capture(image));
+	CHECK(!capture.WaitForFrame(image, 0));
+
+	CHECK(capture.Init());
+	CHECK(capture.WaitForFrame(image, 1000));
+	CHECK(GetFrameTag(image.frame.get()) == static_cast<uint32_t>(image.sequence));
+	capture.Destroy();
+}
+
+int main()
+{
+	RUN_TEST(TestWaitForFrame);
+	RUN_TEST(TestHeldFrameDoesNotChange);
+	RUN_TEST(TestFrameCallback);
+	RUN_TEST(TestDestroyWakesWaiter);
+	return 0;
+}
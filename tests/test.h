@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+			exit(1); \
+		} \
+	} while (0)
+
+#define CHECK_NEAR(a, b, tolerance) \
+	do { \
+		long long diff_ = static_cast<long long>(a) - static_cast<long long>(b); \
+		if (diff_ < -(tolerance) || diff_ > (tolerance)) { \
+			fprintf(stderr, "%s:%d: CHECK_NEAR(%s, %s) failed, %lld vs %lld\n", __FILE__, __LINE__, \
+				#a, #b, static_cast<long long>(a), static_cast<long long>(b)); \
+			exit(1); \
+		} \
+	} while (0)
+
+#define RUN_TEST(test) \
+	do { \
+		test(); \
+		printf("[ OK ] %s\n", #test); \
+	} while (0)
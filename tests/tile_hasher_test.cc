@@ -0,0 +1,199 @@
+#include "tile_hasher.h"
+#include "renderer.h"
+#include "test.h"
+
+#include <cstring>
+
+using namespace DX;
+
+static int GetPlaneHeight(const PixelFrame& frame, int plane)
+{
+	bool is_subsampled = frame.format == PIXEL_FORMAT_I420 || frame.format == PIXEL_FORMAT_NV12;
+	return (plane > 0 && is_subsampled) ? (frame.height + 1) / 2 : frame.height;
+}
+
+static void FillNoise(PixelFrame* frame)
+{
+	uint32_t seed = 5;
+	for (int i = 0; i < 3; i++) {
+		if (!frame->plane[i]) {
+			continue;
+		}
+		size_t size = static_cast<size_t>(frame->pitch[i]) * GetPlaneHeight(*frame, i);
+		for (size_t j = 0; j < size; j++) {
+			seed = seed * 1664525 + 1013904223;
+			frame->plane[i][j] = static_cast<uint8_t>(seed >> 24);
+		}
+	}
+}
+
+static bool HasTile(const std::vector<PixelRect>& tiles, int left, int top)
+{
+	for (const PixelRect& tile : tiles) {
+		if (tile.left == left && tile.top == top) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static void CheckFormat(PixelFormat format)
+{
+	PixelFramePool pool;
+	PixelFrame frame;
+	pool.Alloc(200, 130, format, &frame);
+	FillNoise(&frame);
+
+	TileHasher hasher(64);
+	CHECK(hasher.Update(&frame) == 4 * 3);
+	CHECK(hasher.GetTileCount() == 4 * 3);
+	CHECK(hasher.Update(&frame) == 0);
+	CHECK(hasher.GetChangedTiles().empty());
+
+	// One luma sample in tile (1, 0).
+	frame.plane[0][10 * frame.pitch[0] + 70 * (format == PIXEL_FORMAT_ARGB ? 4 : 1)] ^= 1;
+	CHECK(hasher.Update(&frame) == 1);
+	CHECK(HasTile(hasher.GetChangedTiles(), 64, 0));
+
+	// The last chroma sample, in the clipped corner tile.
+	if (format != PIXEL_FORMAT_ARGB) {
+		int plane = format == PIXEL_FORMAT_NV12 ? 1 : 2;
+		int row_bytes = format == PIXEL_FORMAT_I420 ? 100 : 200;
+		frame.plane[plane][(GetPlaneHeight(frame, plane) - 1) * frame.pitch[plane] + row_bytes - 1] ^= 1;
+		CHECK(hasher.Update(&frame) == 1);
+		const PixelRect& tile = hasher.GetChangedTiles()[0];
+		CHECK(tile.left == 192 && tile.top == 128 && tile.right == 200 && tile.bottom == 130);
+	}
+
+	// Row padding is not content.
+	int row_bytes = format == PIXEL_FORMAT_ARGB ? 200 * 4 : 200;
+	if (frame.pitch[0] > row_bytes) {
+		frame.plane[0][frame.pitch[0] - 1] ^= 1;
+		CHECK(hasher.Update(&frame) == 0);
+	}
+
+	hasher.Reset();
+	CHECK(hasher.Update(&frame) == 4 * 3);
+}
+
+static void TestChangedTiles()
+{
+	CheckFormat(PIXEL_FORMAT_ARGB);
+	CheckFormat(PIXEL_FORMAT_I420);
+	CheckFormat(PIXEL_FORMAT_I444);
+	CheckFormat(PIXEL_FORMAT_NV12);
+}
+
+static void TestSizeChangeMarksAllTiles()
+{
+	PixelFramePool pool;
+	PixelFrame small_frame, large_frame;
+	pool.Alloc(128, 128, PIXEL_FORMAT_I420, &small_frame);
+	pool.Alloc(256, 128, PIXEL_FORMAT_I420, &large_frame);
+	FillNoise(&small_frame);
+	FillNoise(&large_frame);
+
+	TileHasher hasher(64);
+	CHECK(hasher.Update(&small_frame) == 4);
+	CHECK(hasher.Update(&large_frame) == 8);
+	CHECK(hasher.Update(&large_frame) == 0);
+}
+
+static void TestHashFrame()
+{
+	PixelFramePool pool;
+	PixelFrame frame, copy;
+	pool.Alloc(200, 130, PIXEL_FORMAT_ARGB, &frame);
+	FillNoise(&frame);
+	CHECK(pool.Clone(&frame, &copy));
+
+	uint64_t hash = HashFrame(&frame);
+	CHECK(HashFrame(&frame) == hash);
+	CHECK(HashFrame(&copy) == hash);
+	CHECK(HashFrame(&frame, 0) == hash);
+
+	// Any pixel is content, row padding is not.
+	const int offsets[] = { 0, 70 * 4 + 1, 64 * frame.pitch[0] + 100 * 4, 129 * frame.pitch[0] + 199 * 4 + 3 };
+	for (int offset : offsets) {
+		frame.plane[0][offset] ^= 1;
+		CHECK(HashFrame(&frame) != hash);
+		frame.plane[0][offset] ^= 1;
+	}
+	if (frame.pitch[0] > 200 * 4) {
+		frame.plane[0][frame.pitch[0] - 1] ^= 1;
+		CHECK(HashFrame(&frame) == hash);
+	}
+
+	// Size and format are part of the content.
+	PixelFrame black_frame, wide_frame, i444_frame;
+	pool.Alloc(64, 64, PIXEL_FORMAT_ARGB, &black_frame);
+	pool.Alloc(128, 32, PIXEL_FORMAT_ARGB, &wide_frame);
+	pool.Alloc(64, 64, PIXEL_FORMAT_I444, &i444_frame);
+	for (int y = 0; y < 64; y++) {
+		memset(black_frame.plane[0] + y * black_frame.pitch[0], 0, 64 * 4);
+		for (int i = 0; i < 3; i++) {
+			memset(i444_frame.plane[i] + y * i444_frame.pitch[i], 0, 64);
+		}
+	}
+	for (int y = 0; y < 32; y++) {
+		memset(wide_frame.plane[0] + y * wide_frame.pitch[0], 0, 128 * 4);
+	}
+	CHECK(HashFrame(&black_frame) != HashFrame(&wide_frame));
+	CHECK(HashFrame(&black_frame) != HashFrame(&i444_frame));
+}
+
+// With sample_step 4 the tile rows of a 4x3 tile frame sample tiles 0, 1 and 2.
+static void TestHashFrameSampled()
+{
+	PixelFramePool pool;
+	PixelFrame frame;
+	pool.Alloc(200, 130, PIXEL_FORMAT_ARGB, &frame);
+	FillNoise(&frame);
+
+	uint64_t hash = HashFrame(&frame, 4);
+	CHECK(HashFrame(&frame, 4) == hash);
+	CHECK(HashFrame(&frame, 2) != hash);
+
+	struct Sample { int x, y; bool is_sampled; };
+	const Sample samples[] = {
+		{ 10, 10, true }, { 70, 10, false }, { 70, 70, true }, { 10, 70, false },
+		{ 130, 129, true }, { 199, 129, false },
+	};
+	for (const Sample& sample : samples) {
+		uint8_t* pixel = frame.plane[0] + sample.y * frame.pitch[0] + sample.x * 4;
+		*pixel ^= 1;
+		CHECK((HashFrame(&frame, 4) != hash) == sample.is_sampled);
+		*pixel ^= 1;
+	}
+}
+
+static void TestGetSampledTiles()
+{
+	std::vector<PixelRect> tiles;
+	GetSampledTiles(200, 130, 4, tiles);
+	CHECK(tiles.size() == 3);
+	CHECK(tiles[0].left == 0 && tiles[0].top == 0 && tiles[0].right == 64 && tiles[0].bottom == 64);
+	CHECK(tiles[1].left == 64 && tiles[1].top == 64 && tiles[1].right == 128 && tiles[1].bottom == 128);
+	// Clipped to the frame.
+	CHECK(tiles[2].left == 128 && tiles[2].top == 128 && tiles[2].right == 192 && tiles[2].bottom == 130);
+
+	GetSampledTiles(200, 130, 1, tiles);
+	CHECK(tiles.size() == 1);
+	CHECK(tiles[0].left == 0 && tiles[0].top == 0 && tiles[0].right == 200 && tiles[0].bottom == 130);
+
+	// Every other tile, the second tile row starts one tile in.
+	GetSampledTiles(256, 128, 2, tiles);
+	CHECK(tiles.size() == 4);
+	CHECK(tiles[0].left == 0 && tiles[1].left == 128);
+	CHECK(tiles[2].left == 64 && tiles[2].top == 64 && tiles[3].left == 192);
+}
+
+int main()
+{
+	RUN_TEST(TestChangedTiles);
+	RUN_TEST(TestSizeChangeMarksAllTiles);
+	RUN_TEST(TestHashFrame);
+	RUN_TEST(TestHashFrameSampled);
+	RUN_TEST(TestGetSampledTiles);
+	return 0;
+}
@@ -0,0 +1,79 @@
+#include "worker_pool.h"
+#include "test.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace DX;
+
+static void TestRunsEveryTaskOnce()
+{
+	WorkerPool pool(3);
+	std::vector<std::atomic<int>> runs(100);
+	for (auto& count : runs) {
+		count = 0;
+	}
+
+	for (int round = 0; round < 50; round++) {
+		pool.Run(static_cast<int>(runs.size()), [&runs](int index) {
+			runs[index] += 1;
+		});
+	}
+
+	for (auto& count : runs) {
+		CHECK(count == 50);
+	}
+}
+
+// A task that splits its own work again, as the compositor does through the scaler.
+static void TestNestedRun()
+{
+	WorkerPool pool(3);
+	const int outer_count = 8;
+	const int inner_count = 16;
+	std::vector<std::atomic<int>> runs(outer_count * inner_count);
+	for (auto& count : runs) {
+		count = 0;
+	}
+
+	for (int round = 0; round < 20; round++) {
+		pool.Run(outer_count, [&](int outer) {
+			pool.Run(inner_count, [&](int inner) {
+				runs[outer * inner_count + inner] += 1;
+			});
+		});
+	}
+
+	for (auto& count : runs) {
+		CHECK(count == 20);
+	}
+}
+
+static void TestConcurrentCallers()
+{
+	WorkerPool pool(2);
+	std::atomic<int> total(0);
+
+	std::vector<std::thread> callers;
+	for (int i = 0; i < 4; i++) {
+		callers.emplace_back([&pool, &total] {
+			for (int round = 0; round < 100; round++) {
+				pool.Run(10, [&total](int) { total += 1; });
+			}
+		});
+	}
+
+	for (auto& caller : callers) {
+		caller.join();
+	}
+	CHECK(total == 4 * 100 * 10);
+}
+
+int main()
+{
+	RUN_TEST(TestRunsEveryTaskOnce);
+	RUN_TEST(TestNestedRun);
+	RUN_TEST(TestConcurrentCallers);
+	return 0;
+}